@@ -0,0 +1,204 @@
+#ifndef _ANALYZE_BENCH_H_
+#define _ANALYZE_BENCH_H_
+
+// Planner statistics benchmark: on scaled copies of the loaded database,
+// times a set of queries and records their EXPLAIN QUERY PLAN before
+// statistics exist, after a full ANALYZE (STAT4 histograms) and after
+// PRAGMA optimize with an analysis_limit.
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include <string.h>
+#include "timestamps.h"
+#include "bench_stats.h"
+
+// Each copy doubles its tables this many times: 1x, 4x and 16x the load
+static const int ANALYZE_DOUBLINGS[] = {0, 2, 4};
+#define ANALYZE_QUERY_REPEATS 5
+#define ANALYZE_OPTIMIZE_LIMIT 400
+#define ANALYZE_PLAN_SIZE 512
+#define ANALYZE_MAX_QUERIES 16
+
+typedef enum {
+    ANALYZE_NONE,
+    ANALYZE_FULL,
+    ANALYZE_OPTIMIZE,
+    ANALYZE_MODE_COUNT
+} analyze_mode_t;
+
+const char *analyze_mode_name(analyze_mode_t mode) {
+    switch (mode) {
+        case ANALYZE_NONE: return "no_stats";
+        case ANALYZE_FULL: return "analyze";
+        case ANALYZE_OPTIMIZE: return "optimize";
+        default: return "unknown";
+    }
+}
+
+int analyze_exec(sqlite3 *db, const char *sql) {
+    char *err = NULL;
+    int rc = sqlite3_exec(db, sql, NULL, NULL, &err);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "Analyze error: %s\n", err ? err : sqlite3_errmsg(db));
+        sqlite3_free(err);
+    }
+    return rc;
+}
+
+// EXPLAIN QUERY PLAN details joined with "; "
+void analyze_query_plan(sqlite3 *db, const char *sql, char *plan, size_t size) {
+    char explain[2048];
+    sqlite3_stmt *stmt;
+    size_t used = 0;
+
+    plan[0] = '\0';
+    snprintf(explain, sizeof(explain), "EXPLAIN QUERY PLAN %s", sql);
+    if (sqlite3_prepare_v2(db, explain, -1, &stmt, NULL) != SQLITE_OK) {
+        snprintf(plan, size, "error: %s", sqlite3_errmsg(db));
+        return;
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW && used < size) {
+        used += snprintf(plan + used, size - used, "%s%s", used ? "; " : "",
+                         (const char *)sqlite3_column_text(stmt, 3));
+    }
+    sqlite3_finalize(stmt);
+}
+
+// Median run time of sql in microseconds
+timestamp_t analyze_time_query(sqlite3 *db, const char *sql) {
+    sqlite3_stmt *stmt;
+    latency_samples samples;
+    timestamp_t median;
+
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Analyze error: %s\n", sqlite3_errmsg(db));
+        return 0;
+    }
+    latency_init(&samples);
+    for (int r = 0; r < ANALYZE_QUERY_REPEATS; r++) {
+        timestamp_t start = timestamp_us();
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+        }
+        sqlite3_reset(stmt);
+        latency_add(&samples, timestamp_us() - start);
+    }
+    sqlite3_finalize(stmt);
+    median = (timestamp_t)latency_percentile(&samples, 50);
+    latency_free(&samples);
+    return median;
+}
+
+// Opens an in-memory copy of src and runs each scale statement doublings
+// times, with ?1 bound to the round number (1, 2, ...)
+sqlite3 *analyze_open_scaled_copy(sqlite3 *src, const char *const *scale_sql, int scale_count,
+                                  int doublings) {
+    sqlite3 *db = NULL;
+    sqlite3_int64 size = 0;
+    unsigned char *image = sqlite3_serialize(src, "main", &size, 0);
+    if (!image) {
+        fprintf(stderr, "Serialize error: %s\n", sqlite3_errmsg(src));
+        return NULL;
+    }
+    if (sqlite3_open(":memory:", &db) != SQLITE_OK ||
+        sqlite3_deserialize(db, "main", image, size, size,
+                            SQLITE_DESERIALIZE_FREEONCLOSE | SQLITE_DESERIALIZE_RESIZEABLE) != SQLITE_OK) {
+        fprintf(stderr, "Deserialize error: %s\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return NULL;
+    }
+    analyze_exec(db, "BEGIN TRANSACTION");
+    for (int round = 1; round <= doublings; round++) {
+        for (int i = 0; i < scale_count; i++) {
+            sqlite3_stmt *stmt;
+            if (sqlite3_prepare_v2(db, scale_sql[i], -1, &stmt, NULL) != SQLITE_OK) {
+                fprintf(stderr, "Analyze scale error: %s\n", sqlite3_errmsg(db));
+                continue;
+            }
+            sqlite3_bind_int(stmt, 1, round);
+            if (sqlite3_step(stmt) != SQLITE_DONE) {
+                fprintf(stderr, "Analyze scale error: %s\n", sqlite3_errmsg(db));
+            }
+            sqlite3_finalize(stmt);
+        }
+    }
+    analyze_exec(db, "COMMIT");
+    return db;
+}
+
+// For each scale factor, compares query plans and median query times with no
+// statistics, after ANALYZE and after PRAGMA optimize (analysis_limit), each
+// on its own copy. scale_sql statements double the data set once per run.
+void analyze_benchmark(sqlite3 *src, const char *driver, const char *const *queries,
+                       const char *const *query_names, int query_count,
+                       const char *const *scale_sql, int scale_count) {
+    static char plans[ANALYZE_MODE_COUNT][ANALYZE_MAX_QUERIES][ANALYZE_PLAN_SIZE];
+    timestamp_t times[ANALYZE_MODE_COUNT][ANALYZE_MAX_QUERIES];
+    char tag[128];
+    char sql[128];
+
+    if (query_count > ANALYZE_MAX_QUERIES) query_count = ANALYZE_MAX_QUERIES;
+    printf("\n=== ANALYZE Planner Benchmark (%s) ===\n", driver);
+    for (size_t d = 0; d < sizeof(ANALYZE_DOUBLINGS) / sizeof(ANALYZE_DOUBLINGS[0]); d++) {
+        int factor = 1 << ANALYZE_DOUBLINGS[d];
+
+        for (int mode = 0; mode < ANALYZE_MODE_COUNT; mode++) {
+            sqlite3 *db = analyze_open_scaled_copy(src, scale_sql, scale_count, ANALYZE_DOUBLINGS[d]);
+            if (!db) {
+                return;
+            }
+            snprintf(tag, sizeof(tag), "%s_analyze_x%d_%s", driver, factor,
+                     analyze_mode_name((analyze_mode_t)mode));
+            if (mode == ANALYZE_FULL) {
+                timestamp_t start = timestamp_us();
+                analyze_exec(db, "ANALYZE;");
+                timestamp_t elapsed = timestamp_us() - start;
+                printf(" x%d: ANALYZE %.1f ms\n", factor, elapsed / 1000.0);
+                print_metric(tag, "elapsed us", (double)elapsed);
+            } else if (mode == ANALYZE_OPTIMIZE) {
+                // PRAGMA optimize is meant to run before closing a connection and
+                // considers the tables its queries used, so run them once first.
+                // The 0x10000 bit, which also checks tables not used yet, is only
+                // understood from SQLite 3.46 on; the bundled 3.45 gets 0x02 alone.
+                for (int q = 0; q < query_count; q++) {
+                    analyze_exec(db, queries[q]);
+                }
+                const char *mask = sqlite3_libversion_number() >= 3046000 ? "0x10002" : "0x02";
+                snprintf(sql, sizeof(sql), "PRAGMA analysis_limit=%d; PRAGMA optimize=%s;",
+                         ANALYZE_OPTIMIZE_LIMIT, mask);
+                timestamp_t start = timestamp_us();
+                analyze_exec(db, sql);
+                timestamp_t elapsed = timestamp_us() - start;
+                printf(" x%d: PRAGMA optimize=%s (analysis_limit=%d) %.1f ms\n", factor, mask,
+                       ANALYZE_OPTIMIZE_LIMIT, elapsed / 1000.0);
+                print_metric(tag, "elapsed us", (double)elapsed);
+            }
+            for (int q = 0; q < query_count; q++) {
+                analyze_query_plan(db, queries[q], plans[mode][q], ANALYZE_PLAN_SIZE);
+                times[mode][q] = analyze_time_query(db, queries[q]);
+            }
+            sqlite3_close(db);
+        }
+
+        printf(" x%d: median of %d runs, us\n", factor, ANALYZE_QUERY_REPEATS);
+        printf("  %-20s %10s %10s %10s  plan changed\n", "query", "no_stats", "analyze", "optimize");
+        for (int q = 0; q < query_count; q++) {
+            int analyze_changed = strcmp(plans[ANALYZE_NONE][q], plans[ANALYZE_FULL][q]) != 0;
+            int optimize_changed = strcmp(plans[ANALYZE_NONE][q], plans[ANALYZE_OPTIMIZE][q]) != 0;
+            printf("  %-20s %10llu %10llu %10llu  %s/%s\n", query_names[q],
+                   times[ANALYZE_NONE][q], times[ANALYZE_FULL][q], times[ANALYZE_OPTIMIZE][q],
+                   analyze_changed ? "analyze" : "-", optimize_changed ? "optimize" : "-");
+            for (int mode = 0; mode < ANALYZE_MODE_COUNT; mode++) {
+                if (mode == ANALYZE_NONE || strcmp(plans[ANALYZE_NONE][q], plans[mode][q]) != 0) {
+                    printf("    %-9s %s\n", analyze_mode_name((analyze_mode_t)mode), plans[mode][q]);
+                }
+                snprintf(tag, sizeof(tag), "%s_analyze_x%d_%s_%s", driver, factor,
+                         analyze_mode_name((analyze_mode_t)mode), query_names[q]);
+                print_metric(tag, "median us", (double)times[mode][q]);
+                print_metric(tag, "plan changed",
+                             strcmp(plans[ANALYZE_NONE][q], plans[mode][q]) != 0 ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+#endif
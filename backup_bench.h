@@ -0,0 +1,138 @@
+#ifndef _BACKUP_BENCH_H_
+#define _BACKUP_BENCH_H_
+
+// Snapshotting an in-memory database to disk: the online backup API with
+// different page counts per sqlite3_backup_step, and sqlite3_serialize
+// followed by a plain file write.
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include "timestamps.h"
+#include "bench_stats.h"
+
+#define BACKUP_DB_FILE "backup_bench.db"
+#define SERIALIZE_DB_FILE "serialize_bench.db"
+
+// Pages copied per sqlite3_backup_step; -1 copies everything in one step
+static const int BACKUP_PAGES_PER_STEP[] = {16, 64, 256, 1024, -1};
+
+sqlite3_int64 backup_db_bytes(sqlite3 *db) {
+    sqlite3_stmt *stmt;
+    sqlite3_int64 bytes = 0;
+    if (sqlite3_prepare_v2(db,
+                           "SELECT page_count * page_size FROM pragma_page_count, pragma_page_size;",
+                           -1, &stmt, NULL) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+        bytes = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return bytes;
+}
+
+// Backs src up to BACKUP_DB_FILE pages_per_step pages at a time. Each step
+// holds the source while it copies, so the step durations bound how long a
+// live database is blocked. Tags carry BENCH_ARCH since native and wasm runs
+// share the "c" driver.
+void backup_run(sqlite3 *src, const char *driver, int pages_per_step, sqlite3_int64 bytes) {
+    char tag[128];
+    char step_tag[160];
+    sqlite3 *dst = NULL;
+    latency_samples steps;
+    int rc;
+
+    remove(BACKUP_DB_FILE);
+    if (sqlite3_open(BACKUP_DB_FILE, &dst) != SQLITE_OK) {
+        fprintf(stderr, "Cannot open database: %s\n", sqlite3_errmsg(dst));
+        sqlite3_close(dst);
+        return;
+    }
+    timestamp_t start = timestamp_us();
+    sqlite3_backup *backup = sqlite3_backup_init(dst, "main", src, "main");
+    if (!backup) {
+        fprintf(stderr, "Backup error: %s\n", sqlite3_errmsg(dst));
+        sqlite3_close(dst);
+        return;
+    }
+    latency_init(&steps);
+    do {
+        timestamp_t step_start = timestamp_us();
+        rc = sqlite3_backup_step(backup, pages_per_step);
+        latency_add(&steps, timestamp_us() - step_start);
+    } while (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED);
+    int pages = sqlite3_backup_pagecount(backup);
+    sqlite3_backup_finish(backup);
+    timestamp_t elapsed = timestamp_us() - start;
+    sqlite3_int64 copied = backup_db_bytes(dst);
+    sqlite3_close(dst);
+    remove(BACKUP_DB_FILE);
+
+    if (rc != SQLITE_DONE) {
+        fprintf(stderr, "Backup step error: %s\n", sqlite3_errstr(rc));
+        latency_free(&steps);
+        return;
+    }
+    double mb_per_s = elapsed ? bytes / (1024.0 * 1024.0) * 1000000.0 / elapsed : 0.0;
+    if (pages_per_step < 0) {
+        snprintf(tag, sizeof(tag), "%s_%s_backup_all_pages", driver, BENCH_ARCH);
+    } else {
+        snprintf(tag, sizeof(tag), "%s_%s_backup_%d_pages", driver, BENCH_ARCH, pages_per_step);
+    }
+    snprintf(step_tag, sizeof(step_tag), "%s_step", tag);
+    printf(" %s: %d pages in %.1f ms, %.2f MB/s%s\n", tag, pages, elapsed / 1000.0, mb_per_s,
+           copied == bytes ? "" : "  SIZE MISMATCH");
+    print_metric(tag, "elapsed us", (double)elapsed);
+    print_metric(tag, "MB per s", mb_per_s);
+    // One op per sqlite3_backup_step call: p50/p99/max are step durations
+    latency_report(step_tag, &steps, elapsed);
+    latency_free(&steps);
+}
+
+// sqlite3_serialize into a heap copy, then write that to SERIALIZE_DB_FILE
+void serialize_run(sqlite3 *src, const char *driver) {
+    char tag[128];
+    sqlite3_int64 size = 0;
+
+    snprintf(tag, sizeof(tag), "%s_%s_serialize", driver, BENCH_ARCH);
+    timestamp_t start = timestamp_us();
+    unsigned char *image = sqlite3_serialize(src, "main", &size, 0);
+    timestamp_t serialize_us = timestamp_us() - start;
+    if (!image) {
+        fprintf(stderr, "Serialize error: %s\n", sqlite3_errmsg(src));
+        return;
+    }
+
+    start = timestamp_us();
+    FILE *file = fopen(SERIALIZE_DB_FILE, "wb");
+    size_t written = file ? fwrite(image, 1, (size_t)size, file) : 0;
+    if (file) {
+        fclose(file);
+    }
+    timestamp_t write_us = timestamp_us() - start;
+    sqlite3_free(image);
+    remove(SERIALIZE_DB_FILE);
+    if ((sqlite3_int64)written != size) {
+        fprintf(stderr, "Cannot write %s\n", SERIALIZE_DB_FILE);
+        return;
+    }
+
+    timestamp_t elapsed = serialize_us + write_us;
+    double mb_per_s = elapsed ? size / (1024.0 * 1024.0) * 1000000.0 / elapsed : 0.0;
+    printf(" %s: %lld bytes, serialize %.1f ms + write %.1f ms, %.2f MB/s\n", tag, (long long)size,
+           serialize_us / 1000.0, write_us / 1000.0, mb_per_s);
+    print_metric(tag, "bytes", (double)size);
+    print_metric(tag, "serialize us", (double)serialize_us);
+    print_metric(tag, "write us", (double)write_us);
+    print_metric(tag, "MB per s", mb_per_s);
+}
+
+void backup_benchmark(sqlite3 *src, const char *driver) {
+    sqlite3_int64 bytes = backup_db_bytes(src);
+    printf("\n=== Backup and Serialize Benchmark (%s, %s, %lld bytes) ===\n", driver, BENCH_ARCH,
+           (long long)bytes);
+    for (size_t i = 0; i < sizeof(BACKUP_PAGES_PER_STEP) / sizeof(BACKUP_PAGES_PER_STEP[0]); i++) {
+        backup_run(src, driver, BACKUP_PAGES_PER_STEP[i], bytes);
+    }
+    serialize_run(src, driver);
+}
+
+#endif
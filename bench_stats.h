@@ -0,0 +1,258 @@
+#ifndef _BENCH_STATS_H_
+#define _BENCH_STATS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "timestamps.h"
+#include "cpu_dispatch.h"
+
+// Architecture the benchmark was compiled for, named like the image tags
+#if defined(__wasm__)
+#define BENCH_ARCH "wasm32"
+#elif defined(__x86_64__)
+#define BENCH_ARCH "amd64"
+#elif defined(__aarch64__)
+#define BENCH_ARCH "arm64"
+#elif defined(__riscv) && __riscv_xlen == 64
+#define BENCH_ARCH "riscv64"
+#else
+#define BENCH_ARCH "unknown"
+#endif
+
+// Deterministic pseudo-random numbers (splitmix64), so every architecture
+// and runtime replays exactly the same workload
+typedef struct {
+    uint64_t state;
+} bench_rng;
+
+void bench_rng_seed(bench_rng *rng, uint64_t seed) {
+    rng->state = seed;
+}
+
+uint64_t bench_rng_next(bench_rng *rng) {
+    uint64_t z = (rng->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// returns a value in [0, 1)
+double bench_rng_uniform(bench_rng *rng) {
+    return (bench_rng_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// returns a value in [0, n)
+uint64_t bench_rng_range(bench_rng *rng, uint64_t n) {
+    return bench_rng_next(rng) % n;
+}
+
+// Zipf distribution over ranks 0..n-1, sampled by binary search of the CDF
+typedef struct {
+    double *cdf;
+    int n;
+} zipf_table;
+
+int zipf_init(zipf_table *zipf, int n, double exponent) {
+    zipf->cdf = (double *)malloc(sizeof(double) * n);
+    zipf->n = n;
+    if (!zipf->cdf) {
+        return -1;
+    }
+    double sum = 0.0;
+    for (int i = 0; i < n; i++) {
+        sum += 1.0 / pow(i + 1, exponent);
+        zipf->cdf[i] = sum;
+    }
+    for (int i = 0; i < n; i++) {
+        zipf->cdf[i] /= sum;
+    }
+    return 0;
+}
+
+int zipf_sample(const zipf_table *zipf, bench_rng *rng) {
+    double u = bench_rng_uniform(rng);
+    int lo = 0;
+    int hi = zipf->n - 1;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (zipf->cdf[mid] < u) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void zipf_free(zipf_table *zipf) {
+    free(zipf->cdf);
+    zipf->cdf = NULL;
+}
+
+// Sum, minimum and maximum of n values. Four lanes summed in a fixed order
+// give the same result in every clone and fit one AVX2 register.
+CPU_DISPATCH_CLONES
+void stats_sum_min_max(const double *values, int n, double *sum, double *min, double *max) {
+    double s[4] = {0.0, 0.0, 0.0, 0.0};
+    double lo[4], hi[4];
+    for (int k = 0; k < 4; k++) {
+        lo[k] = hi[k] = n > 0 ? values[0] : 0.0;
+    }
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (int k = 0; k < 4; k++) {
+            double v = values[i + k];
+            s[k] += v;
+            lo[k] = v < lo[k] ? v : lo[k];
+            hi[k] = v > hi[k] ? v : hi[k];
+        }
+    }
+    for (; i < n; i++) {
+        double v = values[i];
+        s[i & 3] += v;
+        lo[i & 3] = v < lo[i & 3] ? v : lo[i & 3];
+        hi[i & 3] = v > hi[i & 3] ? v : hi[i & 3];
+    }
+    *sum = (s[0] + s[1]) + (s[2] + s[3]);
+    *min = fmin(fmin(lo[0], lo[1]), fmin(lo[2], lo[3]));
+    *max = fmax(fmax(hi[0], hi[1]), fmax(hi[2], hi[3]));
+}
+
+// Sum of squared deviations from mean, in the same lanes
+CPU_DISPATCH_CLONES
+double stats_sum_squared_deviation(const double *values, int n, double mean) {
+    double s[4] = {0.0, 0.0, 0.0, 0.0};
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (int k = 0; k < 4; k++) {
+            double diff = values[i + k] - mean;
+            s[k] += diff * diff;
+        }
+    }
+    for (; i < n; i++) {
+        double diff = values[i] - mean;
+        s[i & 3] += diff * diff;
+    }
+    return (s[0] + s[1]) + (s[2] + s[3]);
+}
+
+// Sum, minimum and maximum of byte-sized counts, 32 at a time
+CPU_DISPATCH_CLONES
+void stats_sum_min_max_u8(const uint8_t *values, int n, int *sum, int *min, int *max) {
+    unsigned int total = 0;
+    uint8_t lo = 0xFF;
+    uint8_t hi = 0;
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        for (int k = 0; k < 32; k++) {
+            uint8_t v = values[i + k];
+            total += v;
+            lo = v < lo ? v : lo;
+            hi = v > hi ? v : hi;
+        }
+    }
+    for (; i < n; i++) {
+        uint8_t v = values[i];
+        total += v;
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+    }
+    *sum = (int)total;
+    *min = n > 0 ? lo : 0;
+    *max = hi;
+}
+
+// Growable list of latencies in microseconds
+typedef struct {
+    unsigned int *us;
+    size_t count;
+    size_t capacity;
+    int sorted;
+} latency_samples;
+
+void latency_init(latency_samples *samples) {
+    samples->us = NULL;
+    samples->count = 0;
+    samples->capacity = 0;
+    samples->sorted = 1;
+}
+
+void latency_add(latency_samples *samples, timestamp_t us) {
+    if (samples->count == samples->capacity) {
+        size_t capacity = samples->capacity ? samples->capacity * 2 : 4096;
+        unsigned int *grown = (unsigned int *)realloc(samples->us, sizeof(unsigned int) * capacity);
+        if (!grown) {
+            return;
+        }
+        samples->us = grown;
+        samples->capacity = capacity;
+    }
+    samples->us[samples->count++] = (unsigned int)us;
+    samples->sorted = 0;
+}
+
+int latency_compare(const void *a, const void *b) {
+    unsigned int x = *(const unsigned int *)a;
+    unsigned int y = *(const unsigned int *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile, p in [0, 100]; sorts the samples on first use
+double latency_percentile(latency_samples *samples, double p) {
+    if (samples->count == 0) {
+        return 0.0;
+    }
+    if (!samples->sorted) {
+        qsort(samples->us, samples->count, sizeof(unsigned int), latency_compare);
+        samples->sorted = 1;
+    }
+    size_t rank = (size_t)ceil(p / 100.0 * samples->count);
+    if (rank == 0) rank = 1;
+    return samples->us[rank - 1];
+}
+
+// Time spent in the sampled operations themselves
+timestamp_t latency_total(const latency_samples *samples) {
+    timestamp_t total = 0;
+    for (size_t i = 0; i < samples->count; i++) {
+        total += samples->us[i];
+    }
+    return total;
+}
+
+double latency_mean(const latency_samples *samples) {
+    double sum = 0.0;
+    for (size_t i = 0; i < samples->count; i++) {
+        sum += samples->us[i];
+    }
+    return samples->count ? sum / samples->count : 0.0;
+}
+
+// Prints and records count, throughput and the usual percentiles under tag
+void latency_report(const char *tag, latency_samples *samples, timestamp_t elapsed_us) {
+    double qps = elapsed_us ? samples->count * 1000000.0 / elapsed_us : 0.0;
+    double mean = latency_mean(samples);
+    double p50 = latency_percentile(samples, 50);
+    double p95 = latency_percentile(samples, 95);
+    double p99 = latency_percentile(samples, 99);
+    double max = latency_percentile(samples, 100);
+
+    printf("  %-28s %8zu ops %10.0f ops/s  mean %8.1f  p50 %6.0f  p95 %6.0f  p99 %6.0f  max %7.0f us\n",
+           tag, samples->count, qps, mean, p50, p95, p99, max);
+    print_metric(tag, "ops", (double)samples->count);
+    print_metric(tag, "ops per s", qps);
+    print_metric(tag, "mean us", mean);
+    print_metric(tag, "p50 us", p50);
+    print_metric(tag, "p95 us", p95);
+    print_metric(tag, "p99 us", p99);
+    print_metric(tag, "max us", max);
+}
+
+void latency_free(latency_samples *samples) {
+    free(samples->us);
+    latency_init(samples);
+}
+
+#endif
@@ -6,6 +6,17 @@
 #include "dictionary_words.h"
 #include <sys/time.h>
 #include "timestamps.h"
+#include "fts_bench.h"
+#include "fts_ascii_tokenizer.h"
+#include "spatial_bench.h"
+#include "json_bench.h"
+#include "session_bench.h"
+#include "snapshot_bench.h"
+#include "parallel_bench.h"
+#include "backup_bench.h"
+#include "storage_report.h"
+#include "stmt_monitor.h"
+#include "analyze_bench.h"
 
 // Early startup detection - runs before main()
 __attribute__((constructor))
@@ -16,10 +27,108 @@ void early_startup() {
     fflush(stdout);
 }
 
-#define DICTIONARY_SIZE 10000
+#define DICTIONARY_SIZE DICTIONARY_WORD_COUNT
+
+// Command-line selectable benchmark options
+typedef struct {
+    double scale;
+    fts_layout_t fts_layout;
+    const char *fts_prefix;
+    const char *fts_tokenizer;
+    int run_fts_bench;
+    int run_fts_prefix_bench;
+    int fts_query_seconds;
+    int run_fts_tokenizer_bench;
+    int run_spatial_bench;
+    int run_geopoly_bench;
+    int run_json_bench;
+    int run_json_ingest_bench;
+    int run_session_bench;
+    int snapshot_seconds;
+    int parallel_threads;
+    int run_backup_bench;
+    int run_analyze_bench;
+    const char *dbstat_report;
+} bench_options;
+
+// Full-text indexes over the dictionary and the generated text corpus
+const fts_index_spec DICTIONARY_FTS = {"dictionary_fts", "word", "dictionary_words", "id", NULL, NULL};
+const fts_index_spec TEXT_FTS = {"text_fts", "content", "text_corpus", "id", NULL, NULL};
+
+// prefix= configurations compared by the prefix index benchmark
+const char *FTS_PREFIX_CONFIGS[] = {"", "2", "3", "2 3", "2 3 4"};
+
+// Tables whose bulk load is captured and replayed by --session-bench
+const char *const SESSION_TABLES[] = {"mathematical_data", "prime_data"};
+
+// Analysis queries, also run by the --snapshot-bench and --parallel-bench
+// readers and compared before and after ANALYZE by --analyze-bench
+const char *WORD_LENGTH_QUERY =
+    "SELECT "
+    "  length, "
+    "  COUNT(*) as word_count, "
+    "  ROUND(COUNT(*) * 100.0 / (SELECT COUNT(*) FROM dictionary_words), 2) as percentage, "
+    "  GROUP_CONCAT(word, ', ') as sample_words "
+    "FROM dictionary_words "
+    "GROUP BY length "
+    "ORDER BY word_count DESC "
+    "LIMIT 10;";
+
+const char *MATH_CATEGORY_QUERY =
+    "SELECT "
+    "  category, "
+    "  COUNT(*) as count, "
+    "  ROUND(AVG(value), 4) as avg_value, "
+    "  ROUND(MIN(value), 4) as min_value, "
+    "  ROUND(MAX(value), 4) as max_value, "
+    "  ROUND(SUM(value), 2) as total_value "
+    "FROM mathematical_data "
+    "GROUP BY category "
+    "ORDER BY count DESC;";
+
+const char *PRIME_GAP_QUERY =
+    "SELECT "
+    "  gap_to_next, "
+    "  COUNT(*) as frequency, "
+    "  MIN(prime_number) as first_occurrence, "
+    "  MAX(prime_number) as last_occurrence "
+    "FROM prime_data "
+    "WHERE gap_to_next > 0 "
+    "GROUP BY gap_to_next "
+    "ORDER BY frequency DESC "
+    "LIMIT 15;";
+
+const char *FIRST_CHAR_QUERY =
+    "SELECT "
+    "  d.first_char, "
+    "  COUNT(d.id) as word_count, "
+    "  AVG(d.length) as avg_length, "
+    "  COUNT(CASE WHEN d.length > 7 THEN 1 END) as long_words "
+    "FROM dictionary_words d "
+    "GROUP BY d.first_char "
+    "HAVING word_count > 50 "
+    "ORDER BY word_count DESC;";
+
+// --analyze-bench: the analysis queries plus two selective lookups where
+// the index choice depends on the skewed category and value distributions
+const char *const ANALYZE_QUERY_NAMES[] = {
+    "word_length", "math_category", "prime_gap", "first_char", "category_value", "gap_prime_range",
+};
 
-// Large numerical data arrays
-double MATHEMATICAL_CONSTANTS[50000] = {
+const char *const ANALYZE_SCALE_SQL[] = {
+    "INSERT INTO dictionary_words (word, length, first_char) "
+    "SELECT word || '_' || ?1, length, first_char FROM dictionary_words;",
+    "INSERT INTO mathematical_data (value, category, computed_at) "
+    "SELECT value, category, computed_at FROM mathematical_data;",
+    // Offsets are distinct powers of two above every prime, keeping prime_number unique
+    "INSERT INTO prime_data (prime_number, nth_prime, gap_to_next) "
+    "SELECT prime_number + (1 << (?1 + 20)), nth_prime, gap_to_next FROM prime_data;",
+};
+
+// Seed values of the large arrays. The arrays themselves are zero-initialized
+// (.bss) and filled at startup, so the binary carries no mostly-zero data
+// segment for the runtime to copy at instantiation
+static const double MATHEMATICAL_CONSTANT_SEEDS[] = {
     3.14159265358979323846,  // PI
     2.71828182845904523536,  // E
     1.41421356237309504880,  // sqrt(2)
@@ -42,7 +151,7 @@ double MATHEMATICAL_CONSTANTS[50000] = {
     // Generate the rest programmatically
 };
 
-int PRIME_NUMBERS[10000] = {
+static const int PRIME_NUMBER_SEEDS[] = {
     2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71,
     73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151,
     157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233,
@@ -53,8 +162,12 @@ int PRIME_NUMBERS[10000] = {
     // ... rest would be calculated
 };
 
+// Large numerical data arrays
+double MATHEMATICAL_CONSTANTS[50000];
+int PRIME_NUMBERS[10000];
+
 // Large text corpus for testing
-const char* SAMPLE_TEXTS[5000] = {
+const char *const SAMPLE_TEXTS[] = {
     "The quick brown fox jumps over the lazy dog. This pangram contains every letter of the English alphabet at least once.",
     "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.",
     "To be or not to be, that is the question: Whether 'tis nobler in the mind to suffer the slings and arrows of outrageous fortune.",
@@ -70,6 +183,7 @@ const char* SAMPLE_TEXTS[5000] = {
 
 // Initialize mathematical constants array
 void initialize_mathematical_constants() {
+    memcpy(MATHEMATICAL_CONSTANTS, MATHEMATICAL_CONSTANT_SEEDS, sizeof(MATHEMATICAL_CONSTANT_SEEDS));
     // Fill the array with computed values
     for (int i = 10; i < 50000; i++) {
         double base = (double)i;
@@ -79,6 +193,7 @@ void initialize_mathematical_constants() {
 
 // Initialize prime numbers array
 void initialize_prime_numbers() {
+    memcpy(PRIME_NUMBERS, PRIME_NUMBER_SEEDS, sizeof(PRIME_NUMBER_SEEDS));
     int count = 100; // We already have first 100 primes defined
     int candidate = 617; // Next number to check after our predefined primes
     
@@ -111,16 +226,10 @@ void initialize_sample_texts() {
 // Complex data processing functions
 void process_dictionary_data() {
     printf("Processing %d dictionary words...\n", DICTIONARY_SIZE);
-    int total_length = 0;
-    int max_length = 0;
-    int min_length = 1000;
-    
-    for (int i = 0; i < DICTIONARY_SIZE; i++) {
-        int len = strlen(DICTIONARY_WORDS[i]);
-        total_length += len;
-        if (len > max_length) max_length = len;
-        if (len < min_length) min_length = len;
-    }
+    int total_length;
+    int max_length;
+    int min_length;
+    stats_sum_min_max_u8(DICTIONARY_LENGTHS, DICTIONARY_SIZE, &total_length, &min_length, &max_length);
     
     printf("Total character count: %d\n", total_length);
     printf("Average word length: %.2f\n", (double)total_length / DICTIONARY_SIZE);
@@ -130,7 +239,7 @@ void process_dictionary_data() {
     // Find words by length distribution
     int length_distribution[20] = {0}; // Support up to 19 character words
     for (int i = 0; i < DICTIONARY_SIZE; i++) {
-        int len = strlen(DICTIONARY_WORDS[i]);
+        int len = dictionary_word_length(i);
         if (len < 20) {
             length_distribution[len]++;
         }
@@ -147,19 +256,10 @@ void process_dictionary_data() {
 void process_mathematical_data() {
     printf("Processing %d mathematical constants...\n", 50000);
     
-    double sum = 0.0;
-    double max_val = MATHEMATICAL_CONSTANTS[0];
-    double min_val = MATHEMATICAL_CONSTANTS[0];
-    
-    for (int i = 0; i < 50000; i++) {
-        sum += MATHEMATICAL_CONSTANTS[i];
-        if (MATHEMATICAL_CONSTANTS[i] > max_val) {
-            max_val = MATHEMATICAL_CONSTANTS[i];
-        }
-        if (MATHEMATICAL_CONSTANTS[i] < min_val) {
-            min_val = MATHEMATICAL_CONSTANTS[i];
-        }
-    }
+    double sum;
+    double max_val;
+    double min_val;
+    stats_sum_min_max(MATHEMATICAL_CONSTANTS, 50000, &sum, &min_val, &max_val);
     
     printf("Sum: %f\n", sum);
     printf("Average: %f\n", sum / 50000);
@@ -168,11 +268,7 @@ void process_mathematical_data() {
     
     // Calculate standard deviation
     double mean = sum / 50000;
-    double variance_sum = 0.0;
-    for (int i = 0; i < 50000; i++) {
-        double diff = MATHEMATICAL_CONSTANTS[i] - mean;
-        variance_sum += diff * diff;
-    }
+    double variance_sum = stats_sum_squared_deviation(MATHEMATICAL_CONSTANTS, 50000, mean);
     double std_dev = sqrt(variance_sum / 50000);
     printf("Standard deviation: %f\n", std_dev);
 }
@@ -215,7 +311,7 @@ void analyze_word_patterns() {
     // Count words by starting letter
     int letter_counts[26] = {0};
     for (int i = 0; i < DICTIONARY_SIZE; i++) {
-        char first_char = DICTIONARY_WORDS[i][0];
+        char first_char = dictionary_word(i)[0];
         if (first_char >= 'a' && first_char <= 'z') {
             letter_counts[first_char - 'a']++;
         } else if (first_char >= 'A' && first_char <= 'Z') {
@@ -234,28 +330,28 @@ void analyze_word_patterns() {
     printf("\nPalindromes found:\n");
     int palindrome_count = 0;
     for (int i = 0; i < DICTIONARY_SIZE; i++) {
-        int len = strlen(DICTIONARY_WORDS[i]);
+        const char *word = dictionary_word(i);
+        int len = dictionary_word_length(i);
         int is_palindrome = 1;
         for (int j = 0; j < len / 2; j++) {
-            if (DICTIONARY_WORDS[i][j] != DICTIONARY_WORDS[i][len - 1 - j]) {
+            if (word[j] != word[len - 1 - j]) {
                 is_palindrome = 0;
                 break;
             }
         }
         if (is_palindrome && len > 3) { // Only show palindromes longer than 3 chars
-            printf("  %s\n", DICTIONARY_WORDS[i]);
+            printf("  %s\n", word);
             palindrome_count++;
             if (palindrome_count >= 10) break; // Limit output
         }
     }
 }
 
-void comprehensive_database_test(sqlite3 *db) {
+// Creates the tables, indexes and FTS5 indexes and loads the generated data
+void comprehensive_database_load(sqlite3 *db, const bench_options *opts) {
     char *err_msg = 0;
     int rc;
 
-    printf("\n=== Comprehensive Database Test ===\n");
-
     // Create tables with indexes for better performance
     const char *create_sql = 
         "CREATE TABLE dictionary_words(id INTEGER PRIMARY KEY, word TEXT UNIQUE, length INTEGER, first_char TEXT);"
@@ -270,11 +366,7 @@ void comprehensive_database_test(sqlite3 *db) {
         "CREATE INDEX idx_prime_number ON prime_data(prime_number);"
         
         "CREATE TABLE text_corpus(id INTEGER PRIMARY KEY, content TEXT, word_count INTEGER, char_count INTEGER);"
-        "CREATE INDEX idx_word_count ON text_corpus(word_count);"
-        
-        // Create FTS5 tables for full-text search
-        "CREATE VIRTUAL TABLE dictionary_fts USING fts5(word, content='dictionary_words', content_rowid='id');"
-        "CREATE VIRTUAL TABLE text_fts USING fts5(content, content='text_corpus', content_rowid='id');";
+        "CREATE INDEX idx_word_count ON text_corpus(word_count);";
 
     rc = sqlite3_exec(db, create_sql, 0, 0, &err_msg);
     if (rc != SQLITE_OK) {
@@ -283,7 +375,19 @@ void comprehensive_database_test(sqlite3 *db) {
         return;
     }
 
-    printf("Tables and indexes created successfully\n");
+    // Create FTS5 tables for full-text search
+    fts_index_spec dictionary_fts = DICTIONARY_FTS;
+    fts_index_spec text_fts = TEXT_FTS;
+    dictionary_fts.prefix = opts->fts_prefix;
+    dictionary_fts.tokenize = opts->fts_tokenizer;
+    text_fts.tokenize = opts->fts_tokenizer;
+    if (fts_create_index(db, opts->fts_layout, &dictionary_fts) != SQLITE_OK ||
+        fts_create_index(db, opts->fts_layout, &text_fts) != SQLITE_OK) {
+        return;
+    }
+
+    printf("Tables and indexes created successfully (FTS layout: %s)\n",
+           fts_layout_name(opts->fts_layout));
 
     // Insert dictionary data with detailed processing
     printf("Inserting dictionary data...\n");
@@ -292,10 +396,11 @@ void comprehensive_database_test(sqlite3 *db) {
     
     sqlite3_exec(db, "BEGIN TRANSACTION", NULL, NULL, NULL);
     for (int i = 0; i < DICTIONARY_SIZE; i++) {
-        int len = strlen(DICTIONARY_WORDS[i]);
-        char first_char[2] = {DICTIONARY_WORDS[i][0], '\0'};
+        const char *word = dictionary_word(i);
+        int len = dictionary_word_length(i);
+        char first_char[2] = {word[0], '\0'};
         
-        sqlite3_bind_text(stmt, 1, DICTIONARY_WORDS[i], -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 1, word, len, SQLITE_STATIC);
         sqlite3_bind_int(stmt, 2, len);
         sqlite3_bind_text(stmt, 3, first_char, -1, SQLITE_TRANSIENT);
         sqlite3_step(stmt);
@@ -306,10 +411,11 @@ void comprehensive_database_test(sqlite3 *db) {
         }
     }
     sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+    stmt_monitor_snapshot(db, "load_dictionary");
     sqlite3_finalize(stmt);
 
     // Populate FTS5 dictionary table
-    sqlite3_exec(db, "INSERT INTO dictionary_fts(dictionary_fts) VALUES('rebuild')", NULL, NULL, NULL);
+    fts_populate_index(db, opts->fts_layout, &dictionary_fts);
 
     // Insert mathematical data with categories
     printf("Inserting mathematical data...\n");
@@ -335,6 +441,7 @@ void comprehensive_database_test(sqlite3 *db) {
         }
     }
     sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+    stmt_monitor_snapshot(db, "load_mathematical_data");
     sqlite3_finalize(stmt);
 
     // Insert prime data with gap analysis
@@ -356,6 +463,7 @@ void comprehensive_database_test(sqlite3 *db) {
         }
     }
     sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+    stmt_monitor_snapshot(db, "load_prime_data");
     sqlite3_finalize(stmt);
 
     // Generate and insert text corpus
@@ -372,13 +480,13 @@ void comprehensive_database_test(sqlite3 *db) {
         // Create sentences using random dictionary words
         for (int j = 0; j < 10 && text_len < 800; j++) { // Up to 10 words per sample
             int word_idx = (i * 7 + j * 13) % DICTIONARY_SIZE; // Pseudo-random selection
-            int word_len = strlen(DICTIONARY_WORDS[word_idx]);
+            int word_len = dictionary_word_length(word_idx);
             
             if (text_len + word_len + 2 < sizeof(sample_text)) {
                 if (word_count > 0) {
                     sample_text[text_len++] = ' ';
                 }
-                strcpy(sample_text + text_len, DICTIONARY_WORDS[word_idx]);
+                memcpy(sample_text + text_len, dictionary_word(word_idx), word_len);
                 text_len += word_len;
                 word_count++;
             }
@@ -396,27 +504,25 @@ void comprehensive_database_test(sqlite3 *db) {
         }
     }
     sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+    stmt_monitor_snapshot(db, "load_text_corpus");
     sqlite3_finalize(stmt);
 
     // Populate FTS5 text table
-    sqlite3_exec(db, "INSERT INTO text_fts(text_fts) VALUES('rebuild')", NULL, NULL, NULL);
+    fts_populate_index(db, opts->fts_layout, &text_fts);
+}
+
+// Analysis queries over the loaded tables
+void comprehensive_database_queries(sqlite3 *db, const bench_options *opts) {
+    sqlite3_stmt *stmt;
+    fts_index_spec dictionary_fts = DICTIONARY_FTS;
+    dictionary_fts.prefix = opts->fts_prefix;
+    dictionary_fts.tokenize = opts->fts_tokenizer;
 
     printf("\nRunning comprehensive analysis queries...\n");
     
     // Complex Query 1: Word length distribution with statistics
-    const char *query1 = 
-        "SELECT "
-        "  length, "
-        "  COUNT(*) as word_count, "
-        "  ROUND(COUNT(*) * 100.0 / (SELECT COUNT(*) FROM dictionary_words), 2) as percentage, "
-        "  GROUP_CONCAT(word, ', ') as sample_words "
-        "FROM dictionary_words "
-        "GROUP BY length "
-        "ORDER BY word_count DESC "
-        "LIMIT 10;";
-    
     printf("\nWord Length Distribution (Top 10):\n");
-    rc = sqlite3_prepare_v2(db, query1, -1, &stmt, NULL);
+    sqlite3_prepare_v2(db, WORD_LENGTH_QUERY, -1, &stmt, NULL);
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         printf("  %d chars: %d words (%.2f%%) - samples: %.50s...\n",
                sqlite3_column_int(stmt, 0),
@@ -427,20 +533,8 @@ void comprehensive_database_test(sqlite3 *db) {
     sqlite3_finalize(stmt);
 
     // Complex Query 2: Mathematical data analysis by category
-    const char *query2 = 
-        "SELECT "
-        "  category, "
-        "  COUNT(*) as count, "
-        "  ROUND(AVG(value), 4) as avg_value, "
-        "  ROUND(MIN(value), 4) as min_value, "
-        "  ROUND(MAX(value), 4) as max_value, "
-        "  ROUND(SUM(value), 2) as total_value "
-        "FROM mathematical_data "
-        "GROUP BY category "
-        "ORDER BY count DESC;";
-    
     printf("\nMathematical Data Analysis by Category:\n");
-    rc = sqlite3_prepare_v2(db, query2, -1, &stmt, NULL);
+    sqlite3_prepare_v2(db, MATH_CATEGORY_QUERY, -1, &stmt, NULL);
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         printf("  %s: count=%d, avg=%.4f, min=%.4f, max=%.4f, total=%.2f\n",
                sqlite3_column_text(stmt, 0),
@@ -453,20 +547,8 @@ void comprehensive_database_test(sqlite3 *db) {
     sqlite3_finalize(stmt);
 
     // Complex Query 3: Prime gap analysis
-    const char *query3 = 
-        "SELECT "
-        "  gap_to_next, "
-        "  COUNT(*) as frequency, "
-        "  MIN(prime_number) as first_occurrence, "
-        "  MAX(prime_number) as last_occurrence "
-        "FROM prime_data "
-        "WHERE gap_to_next > 0 "
-        "GROUP BY gap_to_next "
-        "ORDER BY frequency DESC "
-        "LIMIT 15;";
-    
     printf("\nPrime Gap Analysis (Most Frequent Gaps):\n");
-    rc = sqlite3_prepare_v2(db, query3, -1, &stmt, NULL);
+    sqlite3_prepare_v2(db, PRIME_GAP_QUERY, -1, &stmt, NULL);
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         printf("  Gap %d: occurs %d times (first at %d, last at %d)\n",
                sqlite3_column_int(stmt, 0),
@@ -480,30 +562,21 @@ void comprehensive_database_test(sqlite3 *db) {
     printf("\nFull-Text Search Examples:\n");
     
     // Search dictionary for words containing specific patterns
-    const char *fts_query1 = 
-        "SELECT word FROM dictionary_fts WHERE dictionary_fts MATCH 'program*' LIMIT 10;";
+    char fts_query1[512];
+    fts_match_sql(opts->fts_layout, &dictionary_fts, fts_query1, sizeof(fts_query1) - 16);
+    strcat(fts_query1, " LIMIT 10;");
     
     printf("  Dictionary words matching 'program*':\n");
-    rc = sqlite3_prepare_v2(db, fts_query1, -1, &stmt, NULL);
+    sqlite3_prepare_v2(db, fts_query1, -1, &stmt, NULL);
+    sqlite3_bind_text(stmt, 1, "program*", -1, SQLITE_STATIC);
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         printf("    %s\n", sqlite3_column_text(stmt, 0));
     }
     sqlite3_finalize(stmt);
 
     // Cross-table analytical query
-    const char *query5 = 
-        "SELECT "
-        "  d.first_char, "
-        "  COUNT(d.id) as word_count, "
-        "  AVG(d.length) as avg_length, "
-        "  COUNT(CASE WHEN d.length > 7 THEN 1 END) as long_words "
-        "FROM dictionary_words d "
-        "GROUP BY d.first_char "
-        "HAVING word_count > 50 "
-        "ORDER BY word_count DESC;";
-    
     printf("\nAnalysis by First Character (letters with >50 words):\n");
-    rc = sqlite3_prepare_v2(db, query5, -1, &stmt, NULL);
+    sqlite3_prepare_v2(db, FIRST_CHAR_QUERY, -1, &stmt, NULL);
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         printf("  '%s': %d words, avg length %.2f, %d long words (>7 chars)\n",
                sqlite3_column_text(stmt, 0),
@@ -511,14 +584,282 @@ void comprehensive_database_test(sqlite3 *db) {
                sqlite3_column_double(stmt, 2),
                sqlite3_column_int(stmt, 3));
     }
+    stmt_monitor_snapshot(db, "queries");
     sqlite3_finalize(stmt);
 
     printf("Database operations completed successfully\n");
 }
 
+void comprehensive_database_test(sqlite3 *db, const bench_options *opts) {
+    printf("\n=== Comprehensive Database Test ===\n");
+    comprehensive_database_load(db, opts);
+    comprehensive_database_queries(db, opts);
+}
+
+// Compares the FTS5 layouts on copies of the dictionary and text corpus indexes
+void fts_layout_comparison(sqlite3 *db) {
+    const fts_index_spec indexes[] = {
+        {"bench_dictionary_fts", "word", "dictionary_words", "id", NULL, NULL},
+        {"bench_text_fts", "content", "text_corpus", "id", NULL, NULL},
+    };
+    const fts_query_spec queries[] = {
+        {0, "program*"},
+        {1, "sqlite"},
+        {1, "programming"},
+    };
+    fts_layout_benchmark(db, "c", indexes, 2, queries, 3);
+}
+
+// Compares prefix= configurations on a copy of the dictionary index
+void fts_prefix_comparison(sqlite3 *db) {
+    const fts_index_spec index = {"bench_prefix_fts", "word", "dictionary_words", "id", NULL, NULL};
+    fts_prefix_benchmark(db, "c", FTS_LAYOUT_EXTERNAL, &index, FTS_PREFIX_CONFIGS,
+                         sizeof(FTS_PREFIX_CONFIGS) / sizeof(FTS_PREFIX_CONFIGS[0]),
+                         dictionary_word, DICTIONARY_SIZE);
+}
+
+// Compares rebuild time of both FTS tables under unicode61 and ascii_fast
+void fts_tokenizer_comparison(sqlite3 *db) {
+    const fts_index_spec indexes[] = {
+        {"bench_dictionary_fts", "word", "dictionary_words", "id", NULL, NULL},
+        {"bench_text_fts", "content", "text_corpus", "id", NULL, NULL},
+    };
+    const char *tokenizers[] = {NULL, FTS_ASCII_TOKENIZER_NAME};
+    const fts_query_spec queries[] = {
+        {0, "program*"},
+        {0, "data*"},
+        {1, "sqlite"},
+        {1, "programming"},
+        {1, "action*"},
+        {1, "\"network security\""},
+    };
+    printf("\nASCII tokenizer byte classification: %s\n", FTS_ASCII_SIMD);
+    fts_tokenizer_benchmark(db, "c", indexes, 2, tokenizers, 2, queries, 6, 5);
+}
+
+void print_usage(const char *program) {
+    printf("Usage: %s [options]\n", program);
+    printf("  --scale=F          Scale factor of the generated benchmark datasets (default 1)\n");
+    printf("  --fts-layout=NAME  FTS5 layout: regular, external (default), contentless,\n");
+    printf("                     contentless-delete\n");
+    printf("  --fts-prefix=LIST  prefix= option of dictionary_fts, e.g. '2 3 4'\n");
+    printf("  --fts-tokenizer=NAME\n");
+    printf("                     FTS5 tokenizer: unicode61 (default) or %s\n",
+           FTS_ASCII_TOKENIZER_NAME);
+    printf("  --fts-bench        Compare size, build and query time of all FTS5 layouts\n");
+    printf("  --fts-prefix-bench Compare prefix lookup throughput of prefix= configurations\n");
+    printf("  --fts-query-bench[=SECONDS]\n");
+    printf("                     Zipfian FTS5 query workload on text_fts (default 5 s)\n");
+    printf("  --fts-tokenizer-bench\n");
+    printf("                     Compare FTS5 rebuild time of unicode61 and %s\n",
+           FTS_ASCII_TOKENIZER_NAME);
+    printf("  --spatial-bench    Load scale x %d boxes into the locations R-Tree, run\n",
+           SPATIAL_BOXES_PER_SCALE);
+    printf("                     window and nearest-neighbour queries\n");
+    printf("  --geopoly-bench    Load up to scale x %d polygons into a geopoly table, time\n",
+           GEOPOLY_SHAPES_PER_SCALE);
+    printf("                     overlap, within and contains_point queries\n");
+    printf("  --json-bench       Compare text JSON and JSONB, stored and virtual generated\n");
+    printf("                     columns, with and without an index, on scale x %d documents\n",
+           JSON_DOCUMENTS_PER_SCALE);
+    printf("  --json-ingest-bench\n");
+    printf("                     Ingest scale x %d line-delimited JSON documents through\n",
+           JSON_INGEST_DOCUMENTS_PER_SCALE);
+    printf("                     json_each/json_tree, per row and set-based\n");
+    printf("  --session-bench    Capture a session changeset of the mathematical_data and\n");
+    printf("                     prime_data load and apply it to a fresh database\n");
+    printf("  --snapshot-bench[=SECONDS]\n");
+    printf("                     WAL readers on latest data vs a pinned snapshot while a\n");
+    printf("                     writer inserts, SECONDS per mode (default 5)\n");
+    printf("  --parallel-bench[=THREADS]\n");
+    printf("                     Run the analysis queries on 1, 2, 4, ... up to THREADS\n");
+    printf("                     threads (default 4), one read-only connection each\n");
+    printf("  --backup-bench     Back the database up to disk with sqlite3_backup_step at\n");
+    printf("                     several pages per step, and with sqlite3_serialize\n");
+    printf("  --analyze-bench    Compare analysis query plans and times without statistics,\n");
+    printf("                     after ANALYZE and after PRAGMA optimize, at 1x, 4x and 16x\n");
+    printf("  --dbstat-report[=FILE]\n");
+    printf("                     At the end of the run append per-table and per-index dbstat\n");
+    printf("                     pages, payload, unused bytes and fragmentation to FILE\n");
+    printf("                     (default %s)\n", STORAGE_REPORT_DEFAULT_FILE);
+    printf("  --stmt-monitor     Snapshot sqlite_stmt (nstep, reprep, run, mem) at phase\n");
+    printf("                     boundaries into the timing output\n");
+    printf("  --help             Print this help and exit\n");
+}
+
+// returns 0 on success, 1 if --help was given, -1 if the command line could
+// not be parsed
+int parse_options(int argc, char **argv, bench_options *opts) {
+    opts->scale = 1.0;
+    opts->fts_layout = FTS_LAYOUT_EXTERNAL;
+    opts->fts_prefix = NULL;
+    opts->fts_tokenizer = NULL;
+    opts->run_fts_bench = 0;
+    opts->run_fts_prefix_bench = 0;
+    opts->fts_query_seconds = 0;
+    opts->run_fts_tokenizer_bench = 0;
+    opts->run_spatial_bench = 0;
+    opts->run_geopoly_bench = 0;
+    opts->run_json_bench = 0;
+    opts->run_json_ingest_bench = 0;
+    opts->run_session_bench = 0;
+    opts->snapshot_seconds = 0;
+    opts->parallel_threads = 0;
+    opts->run_backup_bench = 0;
+    opts->run_analyze_bench = 0;
+    opts->dbstat_report = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--scale=", 8) == 0) {
+            opts->scale = atof(argv[i] + 8);
+            if (opts->scale <= 0) {
+                fprintf(stderr, "Invalid scale factor: %s\n", argv[i] + 8);
+                return -1;
+            }
+        } else if (strncmp(argv[i], "--fts-layout=", 13) == 0) {
+            if (fts_layout_parse(argv[i] + 13, &opts->fts_layout) != 0) {
+                fprintf(stderr, "Unknown FTS layout: %s\n", argv[i] + 13);
+                return -1;
+            }
+        } else if (strncmp(argv[i], "--fts-prefix=", 13) == 0) {
+            opts->fts_prefix = argv[i] + 13;
+        } else if (strncmp(argv[i], "--fts-tokenizer=", 16) == 0) {
+            opts->fts_tokenizer = argv[i] + 16;
+        } else if (strcmp(argv[i], "--fts-bench") == 0) {
+            opts->run_fts_bench = 1;
+        } else if (strcmp(argv[i], "--fts-prefix-bench") == 0) {
+            opts->run_fts_prefix_bench = 1;
+        } else if (strcmp(argv[i], "--fts-tokenizer-bench") == 0) {
+            opts->run_fts_tokenizer_bench = 1;
+        } else if (strcmp(argv[i], "--spatial-bench") == 0) {
+            opts->run_spatial_bench = 1;
+        } else if (strcmp(argv[i], "--geopoly-bench") == 0) {
+            opts->run_geopoly_bench = 1;
+        } else if (strcmp(argv[i], "--json-bench") == 0) {
+            opts->run_json_bench = 1;
+        } else if (strcmp(argv[i], "--json-ingest-bench") == 0) {
+            opts->run_json_ingest_bench = 1;
+        } else if (strcmp(argv[i], "--session-bench") == 0) {
+            opts->run_session_bench = 1;
+        } else if (strcmp(argv[i], "--backup-bench") == 0) {
+            opts->run_backup_bench = 1;
+        } else if (strcmp(argv[i], "--analyze-bench") == 0) {
+            opts->run_analyze_bench = 1;
+        } else if (strcmp(argv[i], "--stmt-monitor") == 0) {
+            stmt_monitor_enable();
+        } else if (strcmp(argv[i], "--dbstat-report") == 0) {
+            opts->dbstat_report = STORAGE_REPORT_DEFAULT_FILE;
+        } else if (strncmp(argv[i], "--dbstat-report=", 16) == 0) {
+            opts->dbstat_report = argv[i] + 16;
+        } else if (strcmp(argv[i], "--snapshot-bench") == 0) {
+            opts->snapshot_seconds = 5;
+        } else if (strncmp(argv[i], "--snapshot-bench=", 17) == 0) {
+            opts->snapshot_seconds = atoi(argv[i] + 17);
+            if (opts->snapshot_seconds <= 0) {
+                fprintf(stderr, "Invalid snapshot benchmark duration: %s\n", argv[i] + 17);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--parallel-bench") == 0) {
+            opts->parallel_threads = 4;
+        } else if (strncmp(argv[i], "--parallel-bench=", 17) == 0) {
+            opts->parallel_threads = atoi(argv[i] + 17);
+            if (opts->parallel_threads <= 0 || opts->parallel_threads > PARALLEL_MAX_THREADS) {
+                fprintf(stderr, "Invalid thread count: %s\n", argv[i] + 17);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--fts-query-bench") == 0) {
+            opts->fts_query_seconds = 5;
+        } else if (strncmp(argv[i], "--fts-query-bench=", 18) == 0) {
+            opts->fts_query_seconds = atoi(argv[i] + 18);
+            if (opts->fts_query_seconds <= 0) {
+                fprintf(stderr, "Invalid duration: %s\n", argv[i] + 18);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--help") == 0) {
+            return 1;
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+#ifdef BENCH_PREINIT
+// Pre-initialized wasm build (make wasm-preinit): Wizer calls
+// wizer.initialize once at build time and snapshots linear memory into the
+// module, so every instantiation starts with the generated arrays and the
+// loaded database. wizer.resume replaces _start; the constructors already
+// ran in the snapshot. Only the default load options are pre-initialized.
+void __wasm_call_ctors(void);
+void __wasm_call_dtors(void);
+int __main_void(void);
+
+static sqlite3 *preinit_db = NULL;
+static bench_options preinit_opts;
+
+__attribute__((export_name("wizer.initialize")))
+void preinit_initialize(void) {
+    char program[] = "massive_sqlite";
+    char *argv[] = {program, NULL};
+
+    __wasm_call_ctors();
+    parse_options(1, argv, &preinit_opts);
+    initialize_mathematical_constants();
+    initialize_prime_numbers();
+    if (sqlite3_open(":memory:", &preinit_db) != SQLITE_OK) {
+        fprintf(stderr, "Cannot open database: %s\n", sqlite3_errmsg(preinit_db));
+        sqlite3_close(preinit_db);
+        preinit_db = NULL;
+    } else {
+        fts_register_ascii_tokenizer(preinit_db);
+        comprehensive_database_load(preinit_db, &preinit_opts);
+    }
+    // Nothing buffered or open may end up in the snapshot
+    reset_timestamps();
+    fflush(stdout);
+    fflush(stderr);
+}
+
+__attribute__((export_name("wizer.resume")))
+void preinit_resume(void) {
+    early_startup();
+    int rc = __main_void();
+    __wasm_call_dtors();
+    if (rc != 0) {
+        _Exit(rc);
+    }
+}
+
+static int preinit_same_option(const char *a, const char *b) {
+    return a == b || (a && b && strcmp(a, b) == 0);
+}
+
+// Hands the snapshot database to main if it was loaded with the same options
+sqlite3 *preinit_take_database(const bench_options *opts) {
+    sqlite3 *db = preinit_db;
+    preinit_db = NULL;
+    if (db && (opts->fts_layout != preinit_opts.fts_layout ||
+               !preinit_same_option(opts->fts_prefix, preinit_opts.fts_prefix) ||
+               !preinit_same_option(opts->fts_tokenizer, preinit_opts.fts_tokenizer))) {
+        printf("FTS options differ from the pre-initialized snapshot, loading again\n");
+        sqlite3_close(db);
+        return NULL;
+    }
+    return db;
+}
+#endif
+
 int main(int argc, char **argv) {
-    sqlite3 *db;
+    sqlite3 *db = NULL;
     int rc;
+    bench_options opts;
+
+    int parsed = parse_options(argc, argv, &opts);
+    if (parsed != 0) {
+        print_usage(argv[0]);
+        return parsed < 0 ? 1 : 0;
+    }
 
     // Print startup timestamp immediately 
     timestamp_t start_timestamp = timestamp();
@@ -534,14 +875,24 @@ int main(int argc, char **argv) {
     printf("============================================\n");
     printf("SQLite version: %s\n", sqlite3_libversion());
     printf("Dictionary size: %d words\n", DICTIONARY_SIZE);
-    printf("Binary contains massive embedded datasets\n\n");
-    
-    // Initialize dynamic arrays
-    printf("Initializing mathematical constants...\n");
-    initialize_mathematical_constants();
-    
-    printf("Computing prime numbers...\n");
-    initialize_prime_numbers();
+    printf("Binary contains massive embedded datasets\n");
+    cpu_dispatch_report();
+    printf("\n");
+    
+#ifdef BENCH_PREINIT
+    db = preinit_take_database(&opts);
+#endif
+    if (db) {
+        printf("Using pre-initialized constants, primes and database\n");
+        print_metric("c_preinit", "preinitialized", 1.0);
+    } else {
+        // Initialize dynamic arrays
+        printf("Initializing mathematical constants...\n");
+        initialize_mathematical_constants();
+        
+        printf("Computing prime numbers...\n");
+        initialize_prime_numbers();
+    }
     
     // Process all embedded data
     process_dictionary_data();
@@ -549,15 +900,79 @@ int main(int argc, char **argv) {
     process_mathematical_data();
     process_prime_numbers();
     
-    // Open database
-    rc = sqlite3_open(":memory:", &db);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Cannot open database: %s\n", sqlite3_errmsg(db));
-        return 1;
+    if (db) {
+        // Tables were loaded when the snapshot was taken
+        printf("\n=== Comprehensive Database Test (pre-initialized) ===\n");
+        comprehensive_database_queries(db, &opts);
+    } else {
+        // Open database
+        rc = sqlite3_open(":memory:", &db);
+        if (rc != SQLITE_OK) {
+            fprintf(stderr, "Cannot open database: %s\n", sqlite3_errmsg(db));
+            return 1;
+        }
+        fts_register_ascii_tokenizer(db);
+        
+        // Run comprehensive database test
+        comprehensive_database_test(db, &opts);
     }
-    
-    // Run comprehensive database test
-    comprehensive_database_test(db);
+
+    if (opts.run_fts_bench) {
+        fts_layout_comparison(db);
+    }
+    if (opts.run_fts_prefix_bench) {
+        fts_prefix_comparison(db);
+    }
+    if (opts.run_fts_tokenizer_bench) {
+        fts_tokenizer_comparison(db);
+    }
+    if (opts.fts_query_seconds > 0) {
+        fts_query_workload(db, "c", TEXT_FTS.fts_name, dictionary_word, DICTIONARY_SIZE,
+                           opts.fts_query_seconds);
+    }
+    if (opts.run_spatial_bench) {
+        spatial_benchmark(db, "c", "locations", opts.scale);
+    }
+    if (opts.run_geopoly_bench) {
+        geopoly_benchmark(db, "c", "shapes", opts.scale);
+    }
+    if (opts.run_json_bench) {
+        json_benchmark(db, "c", opts.scale);
+    }
+    if (opts.run_json_ingest_bench) {
+        json_ingest_benchmark(db, "c", opts.scale);
+    }
+    if (opts.run_session_bench) {
+        session_benchmark(db, "c", SESSION_TABLES, sizeof(SESSION_TABLES) / sizeof(SESSION_TABLES[0]));
+    }
+    if (opts.snapshot_seconds > 0) {
+        const char *queries[] = {MATH_CATEGORY_QUERY, PRIME_GAP_QUERY};
+        snapshot_benchmark(db, "c", queries, 2,
+                           "INSERT INTO mathematical_data (value, category, computed_at) "
+                           "VALUES (?1, 'live_inserts', unixepoch());",
+                           opts.snapshot_seconds);
+    }
+    if (opts.parallel_threads > 0) {
+        const char *queries[] = {WORD_LENGTH_QUERY, MATH_CATEGORY_QUERY, PRIME_GAP_QUERY, FIRST_CHAR_QUERY};
+        parallel_benchmark(db, "c", queries, 4, opts.parallel_threads);
+    }
+    if (opts.run_backup_bench) {
+        backup_benchmark(db, "c");
+    }
+    if (opts.run_analyze_bench) {
+        const char *queries[] = {
+            WORD_LENGTH_QUERY, MATH_CATEGORY_QUERY, PRIME_GAP_QUERY, FIRST_CHAR_QUERY,
+            "SELECT COUNT(*) FROM mathematical_data WHERE category = 'mixed_functions' AND value BETWEEN 2400.0 AND 2410.0;",
+            "SELECT COUNT(*) FROM prime_data WHERE gap_to_next > 30 AND prime_number BETWEEN 1000 AND 50000;",
+        };
+        analyze_benchmark(db, "c", queries, ANALYZE_QUERY_NAMES, 6, ANALYZE_SCALE_SQL,
+                          sizeof(ANALYZE_SCALE_SQL) / sizeof(ANALYZE_SCALE_SQL[0]));
+    }
+    if (opts.dbstat_report) {
+        storage_report(db, opts.dbstat_report, opts.scale);
+    }
+    // Anything still listed here was never finalized
+    stmt_monitor_snapshot(db, "end_of_run");
     
     sqlite3_close(db);
 
@@ -8,12 +8,46 @@
 #include <string>
 #include <memory>
 #include <chrono>
+#include <cctype>
+#include <cerrno>
+#include <unordered_map>
+#include <string_view>
+#include <charconv>
+#include <initializer_list>
+#include <new>
+#if __cplusplus >= 202002L && !defined(BENCH_RUNTIME_DATA)
+// C++20 builds compute the prime table at compile time; -DBENCH_RUNTIME_DATA
+// keeps the runtime sieve
+#define BENCH_CONSTEXPR_DATA 1
+#include <array>
+#include <span>
+#endif
 #include "dictionary_words.h"
 #include <sys/time.h>
 #include "timestamps.h"
+#include "fts_bench.h"
+#include "spatial_bench.h"
+#include "json_bench.h"
+#include "bench_stats.h"
 
 #define DICTIONARY_SIZE 10000
 
+// Command-line selectable benchmark options
+struct BenchOptions {
+    double scale = 1.0;
+    fts_layout_t fts_layout = FTS_LAYOUT_REGULAR;
+    bool run_fts_bench = false;
+    bool run_spatial_bench = false;
+    bool run_json_bench = false;
+    bool run_json_ingest_bench = false;
+    bool run_fingerprint_bench = false;
+    bool runtime_data = false;
+};
+
+// Full-text index over the sample texts, backed by a plain source table so
+// that every FTS5 layout can be built from it
+const fts_index_spec SAMPLE_TEXTS_FTS = {"sample_texts", "content, category", "sample_texts_source", "id", nullptr, nullptr};
+
 // Large numerical data arrays using C++ containers
 std::vector<double> MATHEMATICAL_CONSTANTS = {
     3.14159265358979323846,  // PI
@@ -38,6 +72,40 @@ std::vector<double> MATHEMATICAL_CONSTANTS = {
     // Generate additional constants programmatically
 };
 
+// Primes below PRIME_SIEVE_LIMIT, at most PRIME_TABLE_SIZE of them
+#define PRIME_SIEVE_LIMIT 100000
+#define PRIME_TABLE_SIZE 10000
+
+#ifdef BENCH_CONSTEXPR_DATA
+struct PrimeTable {
+    std::array<int, PRIME_TABLE_SIZE> values{};
+    size_t count = 0;
+};
+
+// Odd-only sieve, evaluated by the compiler into read-only data. Clang may
+// need -fconstexpr-steps=10000000.
+constexpr PrimeTable constexpr_prime_table() {
+    PrimeTable table;
+    std::array<bool, PRIME_SIEVE_LIMIT / 2> composite{};  // composite[k] is 2k + 1
+    table.values[table.count++] = 2;
+    for (int k = 1; k < PRIME_SIEVE_LIMIT / 2 && table.count < PRIME_TABLE_SIZE; ++k) {
+        if (composite[k]) continue;
+        int p = 2 * k + 1;
+        table.values[table.count++] = p;
+        for (long long j = static_cast<long long>(p) * p / 2; j < PRIME_SIEVE_LIMIT / 2; j += p) {
+            composite[j] = true;
+        }
+    }
+    return table;
+}
+
+constexpr PrimeTable PRIME_TABLE = constexpr_prime_table();
+static_assert(PRIME_TABLE.values[PRIME_TABLE.count - 1] == 99991, "largest prime below 100000");
+
+// Filled only by --runtime-data
+std::vector<int> RUNTIME_PRIME_NUMBERS;
+std::span<const int> PRIME_NUMBERS(PRIME_TABLE.values.data(), PRIME_TABLE.count);
+#else
 std::vector<int> PRIME_NUMBERS = {
     2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71,
     73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151,
@@ -48,25 +116,356 @@ std::vector<int> PRIME_NUMBERS = {
     509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607,
     // Additional primes would be calculated
 };
+#endif
+
+// Strings stored back to back in one buffer sized up front, indexed by
+// string_view. Move-only, so no copy can leave views into a freed buffer.
+class TextColumn {
+private:
+    std::unique_ptr<char[]> buffer;
+    size_t capacity = 0;
+    size_t used = 0;
+    std::vector<std::string_view> index;
+    
+public:
+    TextColumn() = default;
+    TextColumn(size_t rows, size_t bytes) : buffer(new char[bytes]), capacity(bytes) {
+        index.reserve(rows);
+    }
+    TextColumn(const TextColumn&) = delete;
+    TextColumn& operator=(const TextColumn&) = delete;
+    TextColumn(TextColumn&&) noexcept = default;
+    TextColumn& operator=(TextColumn&&) noexcept = default;
+    
+    // Appends the concatenation of parts as one row; false if the buffer or
+    // the index is full, since growing either would move the rows
+    bool append(std::initializer_list<std::string_view> parts) {
+        size_t length = 0;
+        for (auto part : parts) length += part.size();
+        if (used + length > capacity || index.size() == index.capacity()) {
+            return false;
+        }
+        char* row = buffer.get() + used;
+        for (auto part : parts) {
+            std::memcpy(buffer.get() + used, part.data(), part.size());
+            used += part.size();
+        }
+        index.emplace_back(row, length);
+        return true;
+    }
+    
+    size_t size() const { return index.size(); }
+    size_t bytes() const { return used; }
+    std::string_view operator[](size_t i) const { return index[i]; }
+    auto begin() const { return index.begin(); }
+    auto end() const { return index.end(); }
+};
+
+#define SAMPLE_TEXT_COUNT 5000
 
-// Large text corpus for testing using C++ strings
-std::vector<std::string> SAMPLE_TEXTS = {
+// Sample texts seeding the corpus; variants of the C++ texts fill it up to
+// SAMPLE_TEXT_COUNT in generate_sample_texts
+constexpr std::string_view BASE_SAMPLE_TEXTS[] = {
     "The quick brown fox jumps over the lazy dog. This pangram contains every letter of the English alphabet at least once.",
     "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.",
     "SQLite is a C-language library that implements a small, fast, self-contained, high-reliability, full-featured, SQL database engine.",
     "WebAssembly (abbreviated Wasm) is a binary instruction format for a stack-based virtual machine.",
     "Container technology has revolutionized software deployment and distribution across different architectures.",
-    // Additional sample texts...
 };
 
+constexpr std::string_view CPP_SAMPLE_TEXTS[] = {
+    "C++ is a general-purpose programming language created by Bjarne Stroustrup.",
+    "Object-oriented programming provides better code organization and reusability.",
+    "STL containers like vector, map, and set provide powerful data structures.",
+    "Smart pointers help manage memory automatically and prevent leaks.",
+    "Template metaprogramming enables compile-time code generation.",
+};
+
+// Large text corpus for testing, filled by generate_additional_data
+TextColumn SAMPLE_TEXTS;
+
+// Heap allocations made while counting is on (replaced operator new below)
+static bool count_allocations = false;
+static size_t allocation_count = 0;
+static size_t allocation_bytes = 0;
+
+void* operator new(size_t size) {
+    if (count_allocations) {
+        allocation_count++;
+        allocation_bytes += size;
+    }
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+// Out of line, so GCC does not pair an inlined free() with operator new
+__attribute__((noinline)) void operator delete(void* p) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// The generation phase allocates each container once, however many rows
+#define GENERATE_ALLOCATION_BOUND 8
+
+// Ad-hoc statements are cached by fingerprint: literals are lifted out into
+// bound parameters and the parameterized text is grouped by
+// sqlite3_normalized_sql, so queries differing only in literals, case or
+// spacing share one prepared statement
+#define QUERY_CACHE_CAPACITY 512
+
+struct SqlLiteral {
+    int type;          // SQLITE_INTEGER, SQLITE_FLOAT or SQLITE_TEXT
+    std::string text;  // unquoted value
+};
+
+struct QueryCacheStats {
+    long long hits = 0;
+    long long misses = 0;
+    long long uncacheable = 0;
+    long long prepare_ns = 0;
+    long long parameterize_ns = 0;
+};
+
+static bool sql_identifier_char(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$' ||
+           static_cast<unsigned char>(c) >= 0x80;
+}
+
+// Replaces the numeric and string literals in sql with '?', appending their
+// values to literals. Integers anywhere in a GROUP BY or ORDER BY list may be
+// column numbers and stay, and are listed in kept; the list ends at the next
+// clause keyword or ')' or ';' at its own nesting level. Runs of whitespace
+// collapse and comments are dropped. Returns false if sql already has
+// parameters or a number SQLite would reject.
+bool parameterize_literals(const std::string& sql, std::string& parameterized,
+                           std::vector<SqlLiteral>& literals, std::string& kept) {
+    bool in_by_clause = false;
+    int depth = 0, by_depth = 0;
+    size_t i = 0, n = sql.size();
+
+    parameterized.clear();
+    literals.clear();
+    kept.clear();
+    while (i < n) {
+        char c = sql[i];
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            while (i < n && std::isspace(static_cast<unsigned char>(sql[i]))) i++;
+            if (!parameterized.empty()) parameterized += ' ';
+        } else if (c == '-' && i + 1 < n && sql[i + 1] == '-') {
+            while (i < n && sql[i] != '\n') i++;
+        } else if (c == '/' && i + 1 < n && sql[i + 1] == '*') {
+            size_t end = sql.find("*/", i + 2);
+            i = end == std::string::npos ? n : end + 2;
+        } else if (c == '\'') {
+            std::string value;
+            for (i++; i < n; i++) {
+                if (sql[i] == '\'') {
+                    if (i + 1 < n && sql[i + 1] == '\'') {
+                        value += '\'';
+                        i++;
+                    } else {
+                        break;
+                    }
+                } else {
+                    value += sql[i];
+                }
+            }
+            i++;
+            literals.push_back({SQLITE_TEXT, value});
+            parameterized += '?';
+        } else if (c == '"' || c == '`' || c == '[') {
+            // Quoted identifiers pass through
+            char close = c == '[' ? ']' : c;
+            size_t end = sql.find(close, i + 1);
+            end = end == std::string::npos ? n : end + 1;
+            parameterized.append(sql, i, end - i);
+            i = end;
+        } else if (c == '?' || c == ':' || c == '@' ||
+                   (c == '$' && i + 1 < n && sql_identifier_char(sql[i + 1]))) {
+            return false;
+        } else if (std::isdigit(static_cast<unsigned char>(c)) ||
+                   (c == '.' && i + 1 < n && std::isdigit(static_cast<unsigned char>(sql[i + 1])))) {
+            size_t start = i;
+            int type = SQLITE_INTEGER;
+            if (c == '0' && i + 1 < n && (sql[i + 1] == 'x' || sql[i + 1] == 'X')) {
+                for (i += 2; i < n && std::isxdigit(static_cast<unsigned char>(sql[i])); i++) {
+                }
+                // Hex literals too big for 64 bits run uncached, SQLite reports them
+                size_t first = start + 2;
+                while (first < i && sql[first] == '0') first++;
+                if (i - first > 16) return false;
+            } else {
+                while (i < n && (std::isdigit(static_cast<unsigned char>(sql[i])) || sql[i] == '.')) {
+                    if (sql[i] == '.') type = SQLITE_FLOAT;
+                    i++;
+                }
+                if (i < n && (sql[i] == 'e' || sql[i] == 'E')) {
+                    type = SQLITE_FLOAT;
+                    i++;
+                    if (i < n && (sql[i] == '+' || sql[i] == '-')) i++;
+                    while (i < n && std::isdigit(static_cast<unsigned char>(sql[i]))) i++;
+                }
+            }
+            // Malformed numbers such as 1_000 or 12abc run uncached, SQLite reports them
+            if (i < n && sql_identifier_char(sql[i])) return false;
+            std::string value = sql.substr(start, i - start);
+            if (in_by_clause && type == SQLITE_INTEGER) {
+                parameterized += value;
+                kept += value + ',';
+            } else {
+                literals.push_back({type, value});
+                parameterized += '?';
+            }
+        } else if (sql_identifier_char(c)) {
+            size_t start = i;
+            while (i < n && sql_identifier_char(sql[i])) i++;
+            if (i < n && sql[i] == '\'' && i - start == 1 && (c == 'x' || c == 'X')) {
+                // Blob literal, kept as written
+                size_t end = sql.find('\'', i + 1);
+                i = end == std::string::npos ? n : end + 1;
+                parameterized.append(sql, start, i - start);
+                continue;
+            }
+            std::string word = sql.substr(start, i - start);
+            for (auto& ch : word) ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+            if (word == "BY") {
+                // A BY nested in the list (window, subquery) keeps the outer level
+                if (!in_by_clause) by_depth = depth;
+                in_by_clause = true;
+            } else if (depth == by_depth &&
+                       (word == "LIMIT" || word == "OFFSET" || word == "HAVING" || word == "WINDOW" ||
+                        word == "UNION" || word == "INTERSECT" || word == "EXCEPT" ||
+                        word == "FROM" || word == "WHERE" || word == "SELECT" || word == "RETURNING")) {
+                in_by_clause = false;
+            }
+            parameterized.append(sql, start, i - start);
+        } else {
+            if (c == '(') {
+                depth++;
+            } else if (c == ')') {
+                if (depth == by_depth) in_by_clause = false;
+                depth--;
+            } else if (c == ';') {
+                in_by_clause = false;
+                depth = 0;
+            }
+            parameterized += c;
+            i++;
+        }
+    }
+    while (!parameterized.empty() && parameterized.back() == ' ') parameterized.pop_back();
+    return true;
+}
+
+// Folds the current result row of stmt into digest (FNV-1a over each column's
+// type and text), so cached and uncached runs can be compared row by row
+void query_row_digest(sqlite3_stmt* stmt, uint64_t* digest) {
+    uint64_t hash = *digest;
+    int columns = sqlite3_column_count(stmt);
+    for (int col = 0; col < columns; ++col) {
+        int type = sqlite3_column_type(stmt, col);
+        const unsigned char* text = sqlite3_column_text(stmt, col);
+        int bytes = sqlite3_column_bytes(stmt, col);
+        hash = (hash ^ static_cast<uint64_t>(type)) * 0x100000001B3ULL;
+        for (int b = 0; b < bytes; ++b) {
+            hash = (hash ^ text[b]) * 0x100000001B3ULL;
+        }
+        hash = (hash ^ 0x1F) * 0x100000001B3ULL;
+    }
+    *digest = (hash ^ 0x1E) * 0x100000001B3ULL;
+}
+
 class SQLiteDatabase {
 private:
     sqlite3* db;
+    // Parameterized text -> fingerprint, and fingerprint -> prepared statement
+    std::unordered_map<std::string, std::string> fingerprints;
+    std::unordered_map<std::string, sqlite3_stmt*> statements;
+    QueryCacheStats cache_stats;
+    
+    static long long elapsed_ns(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+    
+    // Steps stmt to completion; returns the row count, or -1 on error. With
+    // digest, also hashes every row in order (query_row_digest).
+    long long stepAll(sqlite3_stmt* stmt, uint64_t* digest = nullptr) {
+        long long rows = 0;
+        int rc;
+        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+            if (digest) query_row_digest(stmt, digest);
+            rows++;
+        }
+        if (rc != SQLITE_DONE) {
+            std::cerr << "SQL error: " << sqlite3_errmsg(db) << std::endl;
+            return -1;
+        }
+        return rows;
+    }
+    
+    // Prepares and runs sql without the cache
+    long long executeUncached(const std::string& sql, uint64_t* digest) {
+        sqlite3_stmt* stmt = nullptr;
+        auto start = std::chrono::steady_clock::now();
+        int rc = sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
+        cache_stats.prepare_ns += elapsed_ns(start);
+        cache_stats.uncacheable++;
+        if (rc != SQLITE_OK) {
+            std::cerr << "SQL error: " << sqlite3_errmsg(db) << std::endl;
+            return -1;
+        }
+        long long rows = stepAll(stmt, digest);
+        sqlite3_finalize(stmt);
+        return rows;
+    }
+    
+    // Prepares parameterized and returns the statement shared by its
+    // fingerprint, or nullptr if it cannot be cached
+    sqlite3_stmt* prepareFingerprint(const std::string& parameterized, const std::string& kept,
+                                     size_t literal_count) {
+        sqlite3_stmt* stmt = nullptr;
+        const char* tail = nullptr;
+        auto start = std::chrono::steady_clock::now();
+        int rc = sqlite3_prepare_v2(db, parameterized.c_str(), -1, &stmt, &tail);
+        cache_stats.prepare_ns += elapsed_ns(start);
+        // Literals where parameters are not allowed (DEFAULT, views, PRAGMA)
+        // and multiple statements run uncached
+        if (rc != SQLITE_OK || !stmt || std::strspn(tail, " ;") != std::strlen(tail) ||
+            sqlite3_bind_parameter_count(stmt) != static_cast<int>(literal_count)) {
+            sqlite3_finalize(stmt);
+            return nullptr;
+        }
+        
+        // The normalized text turns every literal into '?', so the kept column
+        // numbers and the parameter count are part of the key
+#ifdef SQLITE_ENABLE_NORMALIZE
+        const char* normalized = sqlite3_normalized_sql(stmt);
+        std::string fingerprint = normalized ? normalized : parameterized;
+#else
+        std::string fingerprint = parameterized;
+#endif
+        fingerprint += '\x1f' + kept + '\x1f' + std::to_string(literal_count);
+        
+        auto it = statements.find(fingerprint);
+        if (it != statements.end()) {
+            sqlite3_finalize(stmt);
+            stmt = it->second;
+        } else {
+            if (statements.size() >= QUERY_CACHE_CAPACITY) {
+                clearCache();
+            }
+            statements.emplace(fingerprint, stmt);
+        }
+        fingerprints.emplace(parameterized, fingerprint);
+        return stmt;
+    }
     
 public:
     SQLiteDatabase() : db(nullptr) {}
     
     ~SQLiteDatabase() {
+        clearCache();
         if (db) {
             sqlite3_close(db);
         }
@@ -93,56 +492,164 @@ public:
         return true;
     }
     
+    // Runs one ad-hoc statement through the fingerprint cache, rebinding its
+    // literals; returns the number of result rows, or -1 on error. With
+    // digest, the result rows are hashed as by query_row_digest.
+    long long executeCached(const std::string& sql, uint64_t* digest = nullptr) {
+        std::string parameterized, kept;
+        std::vector<SqlLiteral> literals;
+        sqlite3_stmt* stmt = nullptr;
+        
+        auto start = std::chrono::steady_clock::now();
+        bool parameterized_ok = parameterize_literals(sql, parameterized, literals, kept);
+        cache_stats.parameterize_ns += elapsed_ns(start);
+        if (!parameterized_ok) {
+            return executeUncached(sql, digest);
+        }
+        auto it = fingerprints.find(parameterized);
+        if (it != fingerprints.end()) {
+            auto cached = statements.find(it->second);
+            if (cached != statements.end()) {
+                stmt = cached->second;
+            }
+        }
+        if (stmt) {
+            cache_stats.hits++;
+        } else {
+            stmt = prepareFingerprint(parameterized, kept, literals.size());
+            if (!stmt) {
+                return executeUncached(sql, digest);
+            }
+            cache_stats.misses++;
+        }
+        
+        for (size_t i = 0; i < literals.size(); ++i) {
+            const SqlLiteral& literal = literals[i];
+            int index = static_cast<int>(i) + 1;
+            if (literal.type == SQLITE_TEXT) {
+                sqlite3_bind_text(stmt, index, literal.text.c_str(),
+                                  static_cast<int>(literal.text.size()), SQLITE_STATIC);
+            } else if (literal.type == SQLITE_FLOAT) {
+                sqlite3_bind_double(stmt, index, std::strtod(literal.text.c_str(), nullptr));
+            } else if (literal.text.size() > 1 && (literal.text[1] == 'x' || literal.text[1] == 'X')) {
+                // Hex literals are 64-bit two's complement, as in SQLite
+                sqlite3_bind_int64(stmt, index, static_cast<sqlite3_int64>(
+                                       std::strtoull(literal.text.c_str(), nullptr, 16)));
+            } else {
+                // Decimal even with leading zeros
+                errno = 0;
+                long long value = std::strtoll(literal.text.c_str(), nullptr, 10);
+                if (errno == ERANGE) {
+                    // Out of range integers are reals in SQL as well
+                    sqlite3_bind_double(stmt, index, std::strtod(literal.text.c_str(), nullptr));
+                } else {
+                    sqlite3_bind_int64(stmt, index, value);
+                }
+            }
+        }
+        long long rows = stepAll(stmt, digest);
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+        return rows;
+    }
+    
+    void clearCache() {
+        for (auto& entry : statements) {
+            sqlite3_finalize(entry.second);
+        }
+        statements.clear();
+        fingerprints.clear();
+    }
+    
+    const QueryCacheStats& cacheStats() const { return cache_stats; }
+    void resetCacheStats() { cache_stats = QueryCacheStats(); }
+    size_t cachedStatements() const { return statements.size(); }
+    size_t cachedFingerprints() const { return fingerprints.size(); }
+    
     sqlite3* getHandle() { return db; }
 };
 
-void generate_additional_data() {
-    // Generate more mathematical constants
-    for (int i = MATHEMATICAL_CONSTANTS.size(); i < 50000; ++i) {
-        MATHEMATICAL_CONSTANTS.push_back(sin(i) * cos(i) + sqrt(i));
-    }
-    
-    // Generate more prime numbers (simple sieve)
-    std::vector<bool> is_prime(100000, true);
+// Runtime prime sieve, the only path before C++20
+void generate_prime_numbers(std::vector<int>& primes) {
+    std::vector<bool> is_prime(PRIME_SIEVE_LIMIT, true);
     is_prime[0] = is_prime[1] = false;
     
-    for (int i = 2; i * i < 100000; ++i) {
+    for (int i = 2; i * i < PRIME_SIEVE_LIMIT; ++i) {
         if (is_prime[i]) {
-            for (int j = i * i; j < 100000; j += i) {
+            for (int j = i * i; j < PRIME_SIEVE_LIMIT; j += i) {
                 is_prime[j] = false;
             }
         }
     }
     
-    PRIME_NUMBERS.clear();
-    for (int i = 2; i < 100000 && PRIME_NUMBERS.size() < 10000; ++i) {
+    primes.clear();
+    primes.reserve(PRIME_TABLE_SIZE);
+    for (int i = 2; i < PRIME_SIEVE_LIMIT && primes.size() < PRIME_TABLE_SIZE; ++i) {
         if (is_prime[i]) {
-            PRIME_NUMBERS.push_back(i);
+            primes.push_back(i);
         }
     }
-    
-    // Generate more sample texts
-    std::vector<std::string> additional_texts = {
-        "C++ is a general-purpose programming language created by Bjarne Stroustrup.",
-        "Object-oriented programming provides better code organization and reusability.",
-        "STL containers like vector, map, and set provide powerful data structures.",
-        "Smart pointers help manage memory automatically and prevent leaks.",
-        "Template metaprogramming enables compile-time code generation.",
-    };
-    
-    for (const auto& text : additional_texts) {
-        SAMPLE_TEXTS.push_back(text);
+}
+
+// Calls emit with the parts of each sample text in order: the base texts,
+// the C++ texts, then numbered variants of the C++ texts
+template <typename Emit>
+void for_each_sample_text(Emit emit) {
+    char digits[16];
+    size_t row = 0;
+    for (auto text : BASE_SAMPLE_TEXTS) {
+        emit({text});
+        row++;
     }
-    
-    while (SAMPLE_TEXTS.size() < 5000) {
-        for (const auto& base_text : additional_texts) {
-            if (SAMPLE_TEXTS.size() >= 5000) break;
-            SAMPLE_TEXTS.push_back(base_text + " (variant " + std::to_string(SAMPLE_TEXTS.size()) + ")");
+    for (auto text : CPP_SAMPLE_TEXTS) {
+        emit({text});
+        row++;
+    }
+    while (row < SAMPLE_TEXT_COUNT) {
+        for (auto text : CPP_SAMPLE_TEXTS) {
+            if (row >= SAMPLE_TEXT_COUNT) break;
+            auto result = std::to_chars(digits, digits + sizeof(digits), row);
+            emit({text, " (variant ", std::string_view(digits, result.ptr - digits), ")"});
+            row++;
         }
     }
 }
 
-void create_and_populate_tables(SQLiteDatabase& database) {
+// Sizes the column in a first pass, then writes every text into it
+void generate_sample_texts() {
+    size_t rows = 0, bytes = 0;
+    for_each_sample_text([&](std::initializer_list<std::string_view> parts) {
+        rows++;
+        for (auto part : parts) bytes += part.size();
+    });
+    SAMPLE_TEXTS = TextColumn(rows, bytes);
+    for_each_sample_text([&](std::initializer_list<std::string_view> parts) {
+        SAMPLE_TEXTS.append(parts);
+    });
+}
+
+void generate_additional_data(bool runtime_data) {
+    // Generate more mathematical constants (transcendental, so always at runtime)
+    MATHEMATICAL_CONSTANTS.reserve(50000);
+    for (int i = MATHEMATICAL_CONSTANTS.size(); i < 50000; ++i) {
+        MATHEMATICAL_CONSTANTS.push_back(sin(i) * cos(i) + sqrt(i));
+    }
+    
+    // Generate more prime numbers, unless the compile-time table is used
+#ifdef BENCH_CONSTEXPR_DATA
+    if (runtime_data) {
+        generate_prime_numbers(RUNTIME_PRIME_NUMBERS);
+        PRIME_NUMBERS = RUNTIME_PRIME_NUMBERS;
+    }
+#else
+    (void)runtime_data;
+    generate_prime_numbers(PRIME_NUMBERS);
+#endif
+    
+    generate_sample_texts();
+}
+
+void create_and_populate_tables(SQLiteDatabase& database, const BenchOptions& options) {
     std::cout << "Creating and populating comprehensive test tables..." << std::endl;
     
     // Create tables with various SQLite features
@@ -163,10 +670,11 @@ void create_and_populate_tables(SQLiteDatabase& database) {
         "gap_to_next INTEGER"
         ")",
         
-        // Sample texts with full-text search
-        "CREATE VIRTUAL TABLE IF NOT EXISTS sample_texts USING fts5("
-        "content, "
-        "category"
+        // Sample texts, indexed for full-text search below
+        "CREATE TABLE IF NOT EXISTS sample_texts_source ("
+        "id INTEGER PRIMARY KEY, "
+        "content TEXT, "
+        "category TEXT"
         ")",
         
         // Dictionary words table
@@ -199,6 +707,11 @@ void create_and_populate_tables(SQLiteDatabase& database) {
         }
     }
     
+    if (fts_create_index(database.getHandle(), options.fts_layout, &SAMPLE_TEXTS_FTS) != SQLITE_OK) {
+        std::cerr << "Failed to create table" << std::endl;
+        return;
+    }
+    
     // Populate mathematical constants
     sqlite3_stmt* stmt;
     const char* insert_math = "INSERT OR REPLACE INTO math_constants (name, value, description) VALUES (?, ?, ?)";
@@ -240,24 +753,35 @@ void create_and_populate_tables(SQLiteDatabase& database) {
     sqlite3_finalize(stmt);
     
     // Populate sample texts
-    const char* insert_text = "INSERT OR REPLACE INTO sample_texts (content, category) VALUES (?, ?)";
+    const char* insert_text = "INSERT INTO sample_texts_source (content, category) VALUES (?, ?)";
     sqlite3_prepare_v2(database.getHandle(), insert_text, -1, &stmt, nullptr);
     
     for (size_t i = 0; i < std::min(SAMPLE_TEXTS.size(), size_t(100)); ++i) {
         std::string category = (i % 3 == 0) ? "technical" : (i % 3 == 1) ? "general" : "scientific";
-        sqlite3_bind_text(stmt, 1, SAMPLE_TEXTS[i].c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 1, SAMPLE_TEXTS[i].data(), static_cast<int>(SAMPLE_TEXTS[i].size()), SQLITE_STATIC);
         sqlite3_bind_text(stmt, 2, category.c_str(), -1, SQLITE_STATIC);
         sqlite3_step(stmt);
         sqlite3_reset(stmt);
     }
     sqlite3_finalize(stmt);
+    fts_populate_index(database.getHandle(), options.fts_layout, &SAMPLE_TEXTS_FTS);
+    
+    // Populate JSON documents, a tenth of the JSON benchmark size
+    json_populate(database.getHandle(), "json_data", 1,
+                  std::max(1, static_cast<int>(options.scale * JSON_DOCUMENTS_PER_SCALE / 10)), 0);
     
     std::cout << "Database populated with comprehensive test data." << std::endl;
 }
 
-void run_comprehensive_tests(SQLiteDatabase& database) {
+void run_comprehensive_tests(SQLiteDatabase& database, const BenchOptions& options) {
     std::cout << "Running comprehensive SQLite feature tests..." << std::endl;
     
+    // Contentless layouts only return rowids, so read the text from the source table
+    std::string text_search = fts_layout_stores_content(options.fts_layout)
+        ? "SELECT content FROM sample_texts WHERE sample_texts MATCH 'sqlite' LIMIT 5"
+        : "SELECT content FROM sample_texts_source WHERE id IN "
+          "(SELECT rowid FROM sample_texts WHERE sample_texts MATCH 'sqlite') LIMIT 5";
+    
     std::vector<std::string> test_queries = {
         // Basic queries
         "SELECT COUNT(*) as total_constants FROM math_constants",
@@ -265,7 +789,7 @@ void run_comprehensive_tests(SQLiteDatabase& database) {
         "SELECT AVG(number) as avg_prime FROM prime_numbers WHERE number < 1000",
         
         // FTS queries
-        "SELECT content FROM sample_texts WHERE sample_texts MATCH 'sqlite' LIMIT 5",
+        text_search,
         "SELECT COUNT(*) FROM sample_texts WHERE sample_texts MATCH 'programming'",
         
         // JSON queries
@@ -307,15 +831,214 @@ void run_comprehensive_tests(SQLiteDatabase& database) {
     }
 }
 
-int main() {
+// Compares the FTS5 layouts on a copy of the sample texts index
+void fts_layout_comparison(SQLiteDatabase& database) {
+    const fts_index_spec indexes[] = {
+        {"bench_sample_texts", "content, category", "sample_texts_source", "id", nullptr, nullptr},
+    };
+    const fts_query_spec queries[] = {
+        {0, "program*"},
+        {0, "sqlite"},
+        {0, "programming"},
+    };
+    fts_layout_benchmark(database.getHandle(), "cpp", indexes, 1, queries, 3);
+}
+
+// Ad-hoc query shapes for the fingerprint cache benchmark, formatted with two
+// numbers, or a word and a number when the first conversion is %s. Some
+// shapes differ from another only in case or spacing.
+#define FINGERPRINT_LOG_PER_SCALE 20000
+const char* const ADHOC_QUERY_SHAPES[] = {
+    "SELECT name, value FROM math_constants WHERE id = %d OR id = %d",
+    "SELECT COUNT(*) FROM prime_numbers WHERE number BETWEEN %d AND %d",
+    "SELECT number FROM prime_numbers WHERE number BETWEEN 0%d AND 00%d ORDER BY 1 LIMIT 20",
+    "SELECT name FROM math_constants WHERE id = 0x%x OR id = 0X%X",
+    "select count(*) from prime_numbers   where number between %d and %d",
+    "SELECT number, gap_to_next FROM prime_numbers WHERE number > %d AND gap_to_next < %d ORDER BY number LIMIT 10",
+    "SELECT AVG(number) FROM prime_numbers WHERE is_twin_prime = 1 AND number BETWEEN %d.5 AND %d.5",
+    "SELECT id FROM json_data WHERE extracted_value = 'value_%d' OR id = %d",
+    "SELECT id, category FROM sample_texts_source WHERE category = '%s' AND id > %d LIMIT 5",
+    "SELECT category, COUNT(*) FROM sample_texts_source WHERE category <> '%s' AND id > %d GROUP BY 1 ORDER BY 2 DESC",
+    "SELECT gap_to_next, number FROM prime_numbers WHERE number BETWEEN %d AND %d ORDER BY gap_to_next COLLATE BINARY, 2 DESC LIMIT 20",
+    "UPDATE math_constants SET description = 'note on %s' WHERE id = %d",
+};
+
+std::vector<std::string> generate_adhoc_query_log(size_t count) {
+    static const char* const words[] = {"technical", "general", "scientific", "o'brien"};
+    std::vector<std::string> log;
+    bench_rng rng;
+    char sql[512];
+    
+    bench_rng_seed(&rng, 40);
+    log.reserve(count);
+    const size_t shapes = sizeof(ADHOC_QUERY_SHAPES) / sizeof(ADHOC_QUERY_SHAPES[0]);
+    for (size_t i = 0; i < count; ++i) {
+        size_t shape = bench_rng_range(&rng, shapes);
+        int a = static_cast<int>(bench_rng_range(&rng, 8000));
+        int b = a + static_cast<int>(bench_rng_range(&rng, 2000));
+        std::string word = words[bench_rng_range(&rng, 4)];
+        // Quotes inside a string literal are doubled
+        for (size_t q = word.find('\''); q != std::string::npos; q = word.find('\'', q + 2)) {
+            word.insert(q, 1, '\'');
+        }
+        const char* format = ADHOC_QUERY_SHAPES[shape];
+        if (std::strstr(format, "%s") == std::strchr(format, '%')) {
+            snprintf(sql, sizeof(sql), format, word.c_str(), a % 100);
+        } else {
+            snprintf(sql, sizeof(sql), format, a, b);
+        }
+        log.push_back(sql);
+    }
+    return log;
+}
+
+// Replays a generated ad-hoc query log with a fresh prepare per query and then
+// through the fingerprint cache, and reports the hit rate and parse time saved
+void fingerprint_cache_benchmark(SQLiteDatabase& database, const BenchOptions& options) {
+    size_t count = std::max(1, static_cast<int>(options.scale * FINGERPRINT_LOG_PER_SCALE));
+    std::vector<std::string> log = generate_adhoc_query_log(count);
+    long long uncached_rows = 0, cached_rows = 0, mismatches = 0;
+    // Per-query digests of the result rows, in order, from the uncached pass
+    std::vector<uint64_t> digests(log.size(), 0xCBF29CE484222325ULL);
+    char tag[128];
+    
+    std::cout << "\n=== Query Fingerprint Cache Benchmark (cpp, " << count << " queries) ===" << std::endl;
+#ifndef SQLITE_ENABLE_NORMALIZE
+    std::cout << "  built without SQLITE_ENABLE_NORMALIZE, grouping by parameterized text only" << std::endl;
+#endif
+    
+    // Baseline: every query is parsed and planned from scratch
+    database.clearCache();
+    database.resetCacheStats();
+    long long uncached_prepare_ns = 0;
+    timestamp_t start = timestamp_us();
+    for (size_t q = 0; q < log.size(); ++q) {
+        const std::string& sql = log[q];
+        sqlite3_stmt* stmt = nullptr;
+        auto prepare_start = std::chrono::steady_clock::now();
+        int rc = sqlite3_prepare_v2(database.getHandle(), sql.c_str(), -1, &stmt, nullptr);
+        uncached_prepare_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - prepare_start).count();
+        if (rc != SQLITE_OK) {
+            std::cerr << "SQL error: " << sqlite3_errmsg(database.getHandle()) << std::endl;
+            continue;
+        }
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            query_row_digest(stmt, &digests[q]);
+            uncached_rows++;
+        }
+        sqlite3_finalize(stmt);
+    }
+    timestamp_t uncached_us = timestamp_us() - start;
+    
+    start = timestamp_us();
+    for (size_t q = 0; q < log.size(); ++q) {
+        uint64_t digest = 0xCBF29CE484222325ULL;
+        long long rows = database.executeCached(log[q], &digest);
+        if (rows > 0) cached_rows += rows;
+        if (digest != digests[q]) mismatches++;
+    }
+    timestamp_t cached_us = timestamp_us() - start;
+    
+    const QueryCacheStats& stats = database.cacheStats();
+    double lookups = static_cast<double>(stats.hits + stats.misses + stats.uncacheable);
+    double hit_rate = lookups > 0 ? 100.0 * stats.hits / lookups : 0.0;
+    // The cache pays for tokenizing every query, hit or miss
+    long long saved_ns = uncached_prepare_ns - stats.prepare_ns - stats.parameterize_ns;
+    double saved_ms = saved_ns / 1e6;
+    std::cout << "  " << database.cachedFingerprints() << " parameterized shapes, "
+              << database.cachedStatements() << " fingerprints (prepared statements)" << std::endl;
+    std::cout << "  hits " << stats.hits << ", misses " << stats.misses << ", uncacheable "
+              << stats.uncacheable << ", hit rate " << hit_rate << "%" << std::endl;
+    std::cout << "  prepare time: " << uncached_prepare_ns / 1e6 << " ms uncached, "
+              << stats.prepare_ns / 1e6 << " ms cached + " << stats.parameterize_ns / 1e6
+              << " ms parameterizing, " << saved_ms << " ms saved" << std::endl;
+    std::cout << "  replay: " << uncached_us / 1000.0 << " ms uncached, " << cached_us / 1000.0
+              << " ms cached" << (uncached_rows == cached_rows ? "" : "  ROW COUNT MISMATCH") << std::endl;
+    if (mismatches) {
+        std::cout << "  RESULT MISMATCH: " << mismatches << " queries returned different rows when cached" << std::endl;
+    }
+    
+    snprintf(tag, sizeof(tag), "cpp_fingerprint_cache");
+    print_metric(tag, "queries", static_cast<double>(count));
+    print_metric(tag, "fingerprints", static_cast<double>(database.cachedStatements()));
+    print_metric(tag, "hit rate percent", hit_rate);
+    print_metric(tag, "uncached prepare us", uncached_prepare_ns / 1000.0);
+    print_metric(tag, "cached prepare us", stats.prepare_ns / 1000.0);
+    print_metric(tag, "parameterize us", stats.parameterize_ns / 1000.0);
+    print_metric(tag, "parse us saved", saved_ns / 1000.0);
+    print_metric(tag, "result mismatches", static_cast<double>(mismatches));
+    print_metric(tag, "uncached replay us", static_cast<double>(uncached_us));
+    print_metric(tag, "cached replay us", static_cast<double>(cached_us));
+    database.clearCache();
+}
+
+bool parse_options(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--scale=", 0) == 0) {
+            options.scale = std::atof(arg.c_str() + 8);
+            if (options.scale <= 0) {
+                std::cerr << "Invalid scale factor: " << arg.substr(8) << std::endl;
+                return false;
+            }
+        } else if (arg.rfind("--fts-layout=", 0) == 0) {
+            if (fts_layout_parse(arg.c_str() + 13, &options.fts_layout) != 0) {
+                std::cerr << "Unknown FTS layout: " << arg.substr(13) << std::endl;
+                return false;
+            }
+        } else if (arg == "--fts-bench") {
+            options.run_fts_bench = true;
+        } else if (arg == "--spatial-bench") {
+            options.run_spatial_bench = true;
+        } else if (arg == "--json-bench") {
+            options.run_json_bench = true;
+        } else if (arg == "--json-ingest-bench") {
+            options.run_json_ingest_bench = true;
+        } else if (arg == "--fingerprint-bench") {
+            options.run_fingerprint_bench = true;
+        } else if (arg == "--runtime-data") {
+            options.runtime_data = true;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "Usage: " << argv[0] << " [--scale=F] [--fts-layout=regular|external|contentless|contentless-delete] [--fts-bench] [--spatial-bench] [--json-bench] [--json-ingest-bench] [--fingerprint-bench] [--runtime-data]" << std::endl;
+        return 1;
+    }
+    
     std::cout << "=== Comprehensive SQLite C++ Application ===" << std::endl;
     std::cout << "Multi-architecture SQLite testing with extensive features" << std::endl;
     
     // Generate additional test data
-    generate_additional_data();
+    auto generate_start = std::chrono::steady_clock::now();
+    count_allocations = true;
+    generate_additional_data(options.runtime_data);
+    count_allocations = false;
+    auto generate_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - generate_start).count();
+#ifdef BENCH_CONSTEXPR_DATA
+    std::cout << "Prime table: " << (options.runtime_data ? "runtime sieve" : "compile-time") << std::endl;
+#else
+    std::cout << "Prime table: runtime sieve" << std::endl;
+#endif
+    print_metric("cpp_generate_data", "elapsed us", static_cast<double>(generate_us));
+    print_metric("cpp_generate_data", "allocations", static_cast<double>(allocation_count));
+    print_metric("cpp_generate_data", "allocated bytes", static_cast<double>(allocation_bytes));
+    if (allocation_count > GENERATE_ALLOCATION_BOUND) {
+        std::cerr << "Data generation made " << allocation_count << " allocations, more than "
+                  << GENERATE_ALLOCATION_BOUND << std::endl;
+    }
     std::cout << "Generated " << MATHEMATICAL_CONSTANTS.size() << " mathematical constants" << std::endl;
     std::cout << "Generated " << PRIME_NUMBERS.size() << " prime numbers" << std::endl;
-    std::cout << "Generated " << SAMPLE_TEXTS.size() << " sample texts" << std::endl;
+    std::cout << "Generated " << SAMPLE_TEXTS.size() << " sample texts (" << SAMPLE_TEXTS.bytes() << " bytes)" << std::endl;
     
     // Initialize SQLite database
     SQLiteDatabase database;
@@ -327,10 +1050,31 @@ int main() {
     std::cout << "SQLite version: " << sqlite3_libversion() << std::endl;
     
     // Create and populate tables
-    create_and_populate_tables(database);
+    create_and_populate_tables(database, options);
     
     // Run comprehensive tests
-    run_comprehensive_tests(database);
+    run_comprehensive_tests(database, options);
+    
+    if (options.run_fts_bench) {
+        fts_layout_comparison(database);
+    }
+    
+    // Populate the locations R-Tree and benchmark it
+    if (options.run_spatial_bench) {
+        spatial_benchmark(database.getHandle(), "cpp", "locations", options.scale);
+    }
+    
+    if (options.run_json_bench) {
+        json_benchmark(database.getHandle(), "cpp", options.scale);
+    }
+    
+    if (options.run_json_ingest_bench) {
+        json_ingest_benchmark(database.getHandle(), "cpp", options.scale);
+    }
+    
+    if (options.run_fingerprint_bench) {
+        fingerprint_cache_benchmark(database, options);
+    }
     
     // Performance test
     auto start_time = std::chrono::high_resolution_clock::now();
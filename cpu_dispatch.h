@@ -0,0 +1,101 @@
+#ifndef _CPU_DISPATCH_H_
+#define _CPU_DISPATCH_H_
+
+// Function multiversioning for the hot loops of the native builds.
+//
+// CPU_DISPATCH_CLONES compiles a function once for the baseline target and
+// once for a newer CPU level; an ifunc resolver picks the version when the
+// binary is loaded, static binaries included. The generic images thereby use
+// AVX2 and FMA on x86-64-v3 hosts, SVE on aarch64 and the V extension on
+// riscv64. Builds that already target such a level with -march (make
+// native-tuned), WASI builds and C libraries without ifunc compile a single
+// version. Define CPU_DISPATCH_DISABLE to turn the clones off.
+
+#include <stdio.h>
+#include "timestamps.h"
+#if defined(__linux__) && (defined(__aarch64__) || defined(__riscv))
+#include <sys/auxv.h>
+#endif
+
+#if defined(__clang__)
+#define CPU_DISPATCH_CLANG(major) (__clang_major__ >= (major))
+#define CPU_DISPATCH_GCC(major) 0
+#elif defined(__GNUC__)
+#define CPU_DISPATCH_CLANG(major) 0
+#define CPU_DISPATCH_GCC(major) (__GNUC__ >= (major))
+#else
+#define CPU_DISPATCH_CLANG(major) 0
+#define CPU_DISPATCH_GCC(major) 0
+#endif
+
+// Level a clone is added for, and whether the build itself already targets it
+#if defined(__x86_64__)
+#define CPU_DISPATCH_LEVEL "x86-64-v3"
+#define CPU_DISPATCH_TARGET "arch=x86-64-v3"
+#define CPU_DISPATCH_COMPILER (CPU_DISPATCH_GCC(11) || CPU_DISPATCH_CLANG(16))
+#if defined(__AVX2__) && defined(__FMA__) && defined(__BMI2__)
+#define CPU_DISPATCH_TUNED_BUILD 1
+#endif
+#elif defined(__aarch64__)
+#define CPU_DISPATCH_LEVEL "sve"
+#define CPU_DISPATCH_TARGET "sve"
+#define CPU_DISPATCH_COMPILER (CPU_DISPATCH_GCC(14) || CPU_DISPATCH_CLANG(16))
+#if defined(__ARM_FEATURE_SVE)
+#define CPU_DISPATCH_TUNED_BUILD 1
+#endif
+#elif defined(__riscv) && __riscv_xlen == 64
+#define CPU_DISPATCH_LEVEL "rv64gcv"
+#define CPU_DISPATCH_TARGET "arch=+v"
+#define CPU_DISPATCH_COMPILER CPU_DISPATCH_GCC(15)
+#if defined(__riscv_vector)
+#define CPU_DISPATCH_TUNED_BUILD 1
+#endif
+#else
+#define CPU_DISPATCH_LEVEL "none"
+#define CPU_DISPATCH_COMPILER 0
+#endif
+#ifndef CPU_DISPATCH_TUNED_BUILD
+#define CPU_DISPATCH_TUNED_BUILD 0
+#endif
+
+#if !defined(CPU_DISPATCH_DISABLE) && defined(__linux__) && defined(__GLIBC__) && \
+    CPU_DISPATCH_COMPILER && !CPU_DISPATCH_TUNED_BUILD
+#define CPU_DISPATCH_ENABLED 1
+#define CPU_DISPATCH_CLONES __attribute__((target_clones("default", CPU_DISPATCH_TARGET)))
+#else
+#define CPU_DISPATCH_ENABLED 0
+#define CPU_DISPATCH_CLONES
+#endif
+
+// Non-zero if this machine runs the CPU_DISPATCH_LEVEL code, either from a
+// clone or because the whole build targets it
+int cpu_dispatch_host_supported(void) {
+#if defined(__x86_64__) && (CPU_DISPATCH_GCC(12) || CPU_DISPATCH_CLANG(16))
+    // The same level check the target_clones resolver makes
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("x86-64-v3");
+#elif defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+           __builtin_cpu_supports("bmi2");
+#elif defined(__aarch64__) && defined(__linux__) && defined(HWCAP_SVE)
+    return (getauxval(AT_HWCAP) & HWCAP_SVE) != 0;
+#elif defined(__riscv) && defined(__linux__)
+    return (getauxval(AT_HWCAP) & (1UL << ('V' - 'A'))) != 0;
+#else
+    return 0;
+#endif
+}
+
+// Prints which version of the multiversioned loops this run uses
+void cpu_dispatch_report(void) {
+    const char *mode = CPU_DISPATCH_TUNED_BUILD ? "tuned build" :
+                       CPU_DISPATCH_ENABLED ? "runtime dispatch" : "single version";
+    int active = CPU_DISPATCH_TUNED_BUILD ||
+                 (CPU_DISPATCH_ENABLED && cpu_dispatch_host_supported());
+    printf("CPU dispatch: %s, %s code path\n", mode, active ? CPU_DISPATCH_LEVEL : "baseline");
+    print_metric("c_cpu_dispatch", "clones", CPU_DISPATCH_ENABLED);
+    print_metric("c_cpu_dispatch", CPU_DISPATCH_LEVEL, active);
+}
+
+#endif
@@ -1,10007 +1,11529 @@
 #ifndef DICTIONARY_WORDS_H
 #define DICTIONARY_WORDS_H
 
-const char* DICTIONARY_WORDS[10000] = {
-    "able",
-    "ablecraft",
-    "ableial",
-    "ablely",
-    "action",
-    "actionable",
-    "actionactivity",
-    "actionanalysis",
-    "actionbattery",
-    "actionconstant",
-    "actioncraft",
-    "actioncurrent",
-    "actionenergy",
-    "actionexperience",
-    "actionfuel",
-    "actionful",
-    "actionist",
-    "actionite",
-    "actionive",
-    "actionlike",
-    "actionness",
-    "actionous",
-    "actionproject",
-    "actionprotocol",
-    "actionschool",
-    "actionstudent",
-    "actionty",
-    "actionvoltage",
-    "actionweek",
-    "actionwise",
-    "activity",
-    "activityapplication",
-    "activitycraft",
-    "activityfold",
-    "activityfoundation",
-    "activitygroup",
-    "activityhand",
-    "activityheadphone",
-    "activityimage",
-    "activitying",
-    "activityize",
-    "activitykeyboard",
-    "activityly",
-    "activitymachine",
-    "activitymobile",
-    "activityoperation",
-    "activitypicture",
-    "activityship",
-    "activitysignal",
-    "adapter",
-    "adapteral",
-    "adaptercharger",
-    "adaptereducation",
-    "adapterelectricity",
-    "adapteren",
-    "adapterexample",
-    "adapterful",
-    "adapterible",
-    "adapterite",
-    "adapterlight",
-    "adaptermaterial",
-    "adapterpath",
-    "adapterpeople",
-    "adapterplan",
-    "adapterproject",
-    "adapterquestion",
-    "adaptership",
-    "adaptersignal",
-    "adapterstructure",
-    "adaptertraining",
-    "adapterty",
-    "adapterure",
-    "adaptervideo",
-    "add",
-    "added",
-    "adder",
-    "addless",
-    "address",
-    "addressable",
-    "addressage",
-    "addressanalysis",
-    "addresscase",
-    "addresscharger",
-    "addressdirectory",
-    "addressdom",
-    "addressfact",
-    "addressfy",
-    "addresshood",
-    "addressial",
-    "addressible",
-    "addressise",
-    "addressize",
-    "addressly",
-    "addressorder",
-    "addressprocedure",
-    "addressproject",
-    "addressteen",
-    "addressth",
-    "addressty",
-    "addresswebsite",
-    "addth",
-    "addty",
-    "algorithm",
-    "algorithmbasis",
-    "algorithmcraft",
-    "algorithmed",
-    "algorithment",
-    "algorithmfy",
-    "algorithmic",
-    "algorithminternet",
-    "algorithmmanagement",
-    "algorithmmaterial",
-    "algorithmous",
-    "algorithmpattern",
-    "algorithmpower",
-    "algorithmprinter",
-    "algorithmsound",
-    "algorithmth",
-    "algorithmtraining",
-    "algorithmty",
-    "algorithmure",
-    "algorithmwar",
-    "algorithmwise",
-    "allow",
-    "allowdom",
-    "allowful",
-    "allowist",
-    "allowteen",
-    "allowty",
-    "analysis",
-    "analysisable",
-    "analysisant",
-    "analysised",
-    "analysisemail",
-    "analysisfy",
-    "analysishood",
-    "analysising",
-    "analysismechanism",
-    "analysismember",
-    "analysisness",
-    "analysisory",
-    "analysisous",
-    "analysisphone",
-    "analysisprocedure",
-    "analysission",
-    "analysissociety",
-    "analysistext",
-    "antiable",
-    "antiableing",
-    "antiaction",
-    "antiactivity",
-    "antiadddom",
-    "antialgorithm",
-    "antiallowent",
-    "antiallowward",
-    "antianalysis",
-    "antiarchitecture",
-    "antiaudio",
-    "antibattery",
-    "antibook",
-    "antibuyive",
-    "anticolor",
-    "anticome",
-    "anticomponent",
-    "anticomputer",
-    "anticonstant",
-    "anticontinueship",
-    "antidatabase",
-    "antiday",
-    "antidesign",
-    "antidevelopment",
-    "antidevice",
-    "antidisplay",
-    "antidocument",
-    "antielectricity",
-    "antiemail",
-    "antiend",
-    "antienergy",
-    "antiengine",
-    "antiequipment",
-    "antiexample",
-    "antifact",
-    "antifile",
-    "antifrequency",
-    "antigraphic",
-    "antigroup",
-    "antigrowth",
-    "antihappen",
-    "antihealth",
-    "antihistoricalary",
-    "antihouse",
-    "antiibleic",
-    "antiimplementation",
-    "antiinfrastructure",
-    "antiinstrument",
-    "antiintegration",
-    "antikeyboard",
-    "antilife",
-    "antilight",
-    "antilive",
-    "antilocation",
-    "antimaintenance",
-    "antimember",
-    "antiment",
-    "antimessage",
-    "antiorder",
-    "antipart",
-    "antipassary",
-    "antipattern",
-    "antipay",
-    "antiperformance",
-    "antipickful",
-    "antiplace",
-    "antiplatform",
-    "antiplay",
-    "antipoint",
-    "antipower",
-    "antiprinter",
-    "antiprofessional",
-    "antiprogramward",
-    "antiproject",
-    "antiproperty",
-    "antiprovideth",
-    "antiquality",
-    "antirememberive",
-    "antirequireial",
-    "antiscreen",
-    "antisell",
-    "antision",
-    "antisoftware",
-    "antisolution",
-    "antispeaker",
-    "antispecial",
-    "antistop",
-    "antistorage",
-    "antistructure",
-    "antisupport",
-    "antisystemer",
-    "antisystemty",
-    "antitechnique",
-    "antitechnology",
-    "antitell",
-    "antitellise",
-    "antiterm",
-    "antithing",
-    "antitime",
-    "antitionless",
-    "antitrain",
-    "antitraining",
-    "antitreatment",
-    "antitruck",
-    "antiuniversity",
-    "antiuse",
-    "antivehicle",
-    "antivoltage",
-    "antiwaitless",
-    "antiwaitship",
-    "antiwant",
-    "antiwater",
-    "antiway",
-    "antiwin",
-    "antiwise",
-    "antiwiseial",
-    "antiwoman",
-    "antiword",
-    "antiwork",
-    "apparatus",
-    "apparatusapplication",
-    "apparatusapproach",
-    "apparatusary",
-    "apparatusconnector",
-    "apparatuscraft",
-    "apparatusen",
-    "apparatusfrequency",
-    "apparatusgovernment",
-    "apparatusible",
-    "apparatusic",
-    "apparatuslevel",
-    "apparatuslike",
-    "apparatusly",
-    "apparatusous",
-    "apparatuspart",
-    "apparatussecurity",
-    "apparatussome",
-    "apparatusspeaker",
-    "apparatusty",
-    "apparatusvariable",
-    "apparatusward",
-    "apparatusway",
-    "apparatusweek",
-    "apparatuswise",
-    "appear",
-    "appearent",
-    "appearise",
-    "appearist",
-    "appearous",
-    "appearty",
-    "application",
-    "applicationable",
-    "applicationant",
-    "applicationary",
-    "applicationcraft",
-    "applicationdom",
-    "applicationen",
-    "applicationest",
-    "applicationfy",
-    "applicationise",
-    "applicationism",
-    "applicationite",
-    "applicationmemory",
-    "applicationment",
-    "applicationmodel",
-    "applicationness",
-    "applicationory",
-    "applicationproperty",
-    "applicationspace",
-    "applicationure",
-    "applicationward",
-    "applicationwise",
-    "approach",
-    "approachable",
-    "approachaction",
-    "approachal",
-    "approachapproach",
-    "approacharea",
-    "approachcomponent",
-    "approachcontroller",
-    "approachcraft",
-    "approachdesign",
-    "approachdocument",
-    "approachdom",
-    "approacher",
-    "approachfold",
-    "approachful",
-    "approachgrowth",
-    "approachheadphone",
-    "approachhood",
-    "approachible",
-    "approachimage",
-    "approachive",
-    "approachmouse",
-    "approachness",
-    "approachperformance",
-    "approachpublic",
-    "approachteen",
-    "approachterm",
-    "approachtion",
-    "approachvoltage",
-    "architecture",
-    "architecturecourse",
-    "architecturedom",
-    "architectureenergy",
-    "architectureer",
-    "architectureful",
-    "architectureing",
-    "architectureinterest",
-    "architecturelike",
-    "architecturement",
-    "architectureous",
-    "architecturepicture",
-    "architecturequestion",
-    "architectureship",
-    "architecturething",
-    "architecturetion",
-    "area",
-    "areabattery",
-    "areacar",
-    "areacase",
-    "areacountry",
-    "areaed",
-    "areaen",
-    "areaer",
-    "areaing",
-    "areaise",
-    "areament",
-    "areamicrophone",
-    "areaness",
-    "areaory",
-    "areaous",
-    "areapattern",
-    "areapower",
-    "areaquality",
-    "areaship",
-    "areaside",
-    "areation",
-    "areauniversity",
-    "areaword",
-    "ask",
-    "askal",
-    "askial",
-    "askic",
-    "askless",
-    "askly",
-    "attribute",
-    "attributeal",
-    "attributecable",
-    "attributedom",
-    "attributeent",
-    "attributeframework",
-    "attributeless",
-    "attributement",
-    "attributepolicy",
-    "attributeprocedure",
-    "attributeresistance",
-    "attributesion",
-    "attributetion",
-    "attributety",
-    "attributewise",
-    "audio",
-    "audiochild",
-    "audioconnector",
-    "audioed",
-    "audioent",
-    "audioexample",
-    "audioite",
-    "audioive",
-    "audioize",
-    "audiomusic",
-    "audioperson",
-    "audiophoto",
-    "audiopublic",
-    "audiosignal",
-    "audiosoftware",
-    "audiosome",
-    "audiostudy",
-    "audioth",
-    "audioty",
-    "autoadapter",
-    "autoaddress",
-    "autoapparatus",
-    "autoasked",
-    "autoaudio",
-    "autobasis",
-    "autobattery",
-    "autobicycle",
-    "autoboat",
-    "autobook",
-    "autobus",
-    "autobusiness",
-    "autocallent",
-    "autocamera",
-    "autocar",
-    "autochild",
-    "autocolor",
-    "autodelivery",
-    "autodesign",
-    "autodocumentation",
-    "autoeconomic",
-    "autoefficiency",
-    "autoelectricity",
-    "autoemail",
-    "autoend",
-    "autofallhood",
-    "autofamily",
-    "autofeelous",
-    "autofinancial",
-    "autofolder",
-    "autofollow",
-    "autofrequency",
-    "autofuel",
-    "autofull",
-    "autofunction",
-    "autogovernment",
-    "autohealth",
-    "autohistorical",
-    "autohistory",
-    "autoimage",
-    "autoimplementation",
-    "autoincludement",
-    "autoinformation",
-    "autoinnovation",
-    "autointegration",
-    "autointerest",
-    "autoleave",
-    "autoless",
-    "autoletter",
-    "autolevel",
-    "autoloseed",
-    "automarket",
-    "automechanism",
-    "automember",
-    "automemory",
-    "automessage",
-    "automicrophone",
-    "automoney",
-    "automost",
-    "automotor",
-    "automotorcycle",
-    "automouse",
-    "autonatural",
-    "autonaturalary",
-    "autoness",
-    "autonessise",
-    "autonews",
-    "autonumber",
-    "autoopen",
-    "autoorganization",
-    "autoparameter",
-    "autopath",
-    "autopay",
-    "autopeople",
-    "autoperformance",
-    "autoperson",
-    "autophone",
-    "autopick",
-    "autopickise",
-    "autoplane",
-    "autoprice",
-    "autoprinciple",
-    "autoprocess",
-    "autoprogram",
-    "autoproject",
-    "autopullite",
-    "autoquestionteen",
-    "autoraise",
-    "autoreach",
-    "autoremember",
-    "autoreportteen",
-    "autoroom",
-    "autoscience",
-    "autoscientific",
-    "autosend",
-    "autosendful",
-    "autoserve",
-    "autoset",
-    "autoship",
-    "autoshipping",
-    "autoside",
-    "autosithood",
-    "autositing",
-    "autosolution",
-    "autosomething",
-    "autosound",
-    "autospecial",
-    "autospend",
-    "autostandard",
-    "autostate",
-    "autostay",
-    "autostoption",
-    "autostrategy",
-    "autosuggest",
-    "autotake",
-    "autotakeite",
-    "autotechnicalize",
-    "autotechnique",
-    "autotechnology",
-    "autotext",
-    "autotool",
-    "autotrain",
-    "autotraining",
-    "autotravel",
-    "autotruck",
-    "autounderstandlike",
-    "autovalue",
-    "autovariable",
-    "autowantory",
-    "autoway",
-    "autowear",
-    "autoweek",
-    "autowhich",
-    "autowinest",
-    "autoword",
-    "autowork",
-    "basis",
-    "basisary",
-    "basisconstant",
-    "basiscontact",
-    "basisdom",
-    "basisengine",
-    "basisexample",
-    "basisframework",
-    "basisfuel",
-    "basishood",
-    "basisite",
-    "basisless",
-    "basismarket",
-    "basisoffice",
-    "basisory",
-    "basisous",
-    "basisproject",
-    "basisresistance",
-    "basission",
-    "basistool",
-    "basistravel",
-    "basisure",
-    "battery",
-    "batteryaudio",
-    "batterycraft",
-    "batteryed",
-    "batteryequipment",
-    "batteryexperience",
-    "batteryfamily",
-    "batteryful",
-    "batteryhome",
-    "batteryinstrument",
-    "batteryinterface",
-    "batteryive",
-    "batteryless",
-    "batterymoney",
-    "batteryous",
-    "batteryprice",
-    "batteryservice",
-    "batterysome",
-    "batterysomething",
-    "batteryspecial",
-    "batterytrain",
-    "believe",
-    "believeible",
-    "bicycle",
-    "bicycleaddress",
-    "bicycleal",
-    "bicyclecamera",
-    "bicycledevelopment",
-    "bicycledevice",
-    "bicycleen",
-    "bicyclehealth",
-    "bicyclehood",
-    "bicycleial",
-    "bicyclelife",
-    "bicycleness",
-    "bicycleparty",
-    "bicyclephone",
-    "bicycleposition",
-    "bicycleprinciple",
-    "bicycleprocedure",
-    "bicyclesion",
-    "bicyclesystem",
-    "bicycletool",
-    "bicycletreatment",
-    "bicycleure",
-    "bicyclewise",
-    "boat",
-    "boatage",
-    "boatbusiness",
-    "boatcharacteristic",
-    "boatcharger",
-    "boatest",
-    "boatfold",
-    "boatite",
-    "boative",
-    "boatlike",
-    "boatmarket",
-    "boatpart",
-    "boatparty",
-    "boatplace",
-    "boatprogram",
-    "boatsion",
-    "boatsupport",
-    "boatworld",
-    "book",
-    "bookal",
-    "bookant",
-    "bookboat",
-    "bookfamily",
-    "bookhand",
-    "bookhood",
-    "bookinterest",
-    "bookist",
-    "bookjob",
-    "bookment",
-    "booknation",
-    "bookplan",
-    "bookpower",
-    "bookprocedure",
-    "bookproperty",
-    "bookresource",
-    "booksion",
-    "booksome",
-    "bookspace",
-    "booktion",
-    "bookvoltage",
-    "bookweek",
-    "break",
-    "breakary",
-    "breakive",
-    "breaklike",
-    "breakship",
-    "breakwise",
-    "bring",
-    "bringable",
-    "bringant",
-    "bringfold",
-    "bringise",
-    "bringist",
-    "bringize",
-    "bringlike",
-    "bringteen",
-    "bringth",
-    "bringward",
-    "build",
-    "buildal",
-    "builddom",
-    "buildest",
-    "buildfold",
-    "buildory",
-    "buildtion",
-    "bus",
-    "busable",
-    "busal",
-    "busary",
-    "buscraft",
-    "bused",
-    "busent",
-    "buser",
-    "busfold",
-    "busible",
-    "busimplementation",
-    "business",
-    "businessant",
-    "businessdom",
-    "businessed",
-    "businessen",
-    "businessent",
-    "businessest",
-    "businessfile",
-    "businessfrequency",
-    "businessing",
-    "businessize",
-    "businessless",
-    "businessly",
-    "businessmonitor",
-    "businessmouse",
-    "businessoperation",
-    "businessperson",
-    "businessplan",
-    "businessplane",
-    "businessprocess",
-    "businessty",
-    "businessuniversity",
-    "businessure",
-    "busise",
-    "busless",
-    "busmotorcycle",
-    "buspackage",
-    "buspart",
-    "busposition",
-    "busproject",
-    "busreason",
-    "bussome",
-    "busstory",
-    "buy",
-    "buyic",
-    "buyism",
-    "buyward",
-    "cable",
-    "cableary",
-    "cablecharacteristic",
-    "cablecharger",
-    "cablecraft",
-    "cableday",
-    "cabledelivery",
-    "cableer",
-    "cablegroup",
-    "cablehood",
-    "cableial",
-    "cableise",
-    "cableist",
-    "cableite",
-    "cableive",
-    "cableless",
-    "cablelevel",
-    "cablelike",
-    "cablemouse",
-    "cablenetwork",
-    "cableous",
-    "cablephone",
-    "cableteen",
-    "cableterm",
-    "cabletion",
-    "cablevehicle",
-    "cablewoman",
-    "call",
-    "callant",
-    "calldom",
-    "caller",
-    "callly",
-    "camera",
-    "cameraaction",
-    "cameracase",
-    "cameracomponent",
-    "cameraent",
-    "camerahood",
-    "cameraial",
-    "cameraise",
-    "cameraite",
-    "cameraive",
-    "cameraize",
-    "cameralife",
-    "camerament",
-    "cameraness",
-    "cameranetwork",
-    "cameraory",
-    "cameraprogram",
-    "cameraquality",
-    "camerasome",
-    "camerastory",
-    "camerastrategy",
-    "camerateen",
-    "cameratool",
-    "camerawise",
-    "car",
-    "carable",
-    "carcraft",
-    "carelectricity",
-    "carent",
-    "carest",
-    "carfuel",
-    "cargovernment",
-    "carhood",
-    "carise",
-    "carly",
-    "carmaterial",
-    "carphone",
-    "carplane",
-    "carteen",
-    "case",
-    "caseant",
-    "casecharger",
-    "casecontroller",
-    "casefoundation",
-    "casefy",
-    "casehood",
-    "caseible",
-    "caseinnovation",
-    "caseism",
-    "caseless",
-    "casemessage",
-    "caseposition",
-    "casereport",
-    "caseth",
-    "casetion",
-    "caseword",
-    "change",
-    "changeable",
-    "changeary",
-    "changeism",
-    "changeous",
-    "characteristic",
-    "characteristicage",
-    "characteristicaudio",
-    "characteristicen",
-    "characteristicfy",
-    "characteristichouse",
-    "characteristicial",
-    "characteristicism",
-    "characteristicize",
-    "characteristiclike",
-    "characteristicly",
-    "characteristicname",
-    "characteristicplan",
-    "characteristicsion",
-    "characteristicsome",
-    "characteristicwoman",
-    "characteristicyear",
-    "charger",
-    "chargerable",
-    "chargerant",
-    "chargerchild",
-    "chargerconnector",
-    "chargercraft",
-    "chargercurrent",
-    "chargered",
-    "chargerer",
-    "chargerfy",
-    "chargergovernment",
-    "chargerible",
-    "chargerize",
-    "chargerly",
-    "chargerresearch",
-    "chargerright",
-    "chargersociety",
-    "chargerspace",
-    "chargertion",
-    "chargerty",
-    "chargerure",
-    "chargerwar",
-    "child",
-    "childage",
-    "childant",
-    "childbicycle",
-    "childdesign",
-    "childdirectory",
-    "childelement",
-    "childen",
-    "childer",
-    "childexperience",
-    "childhistory",
-    "childhood",
-    "childinterest",
-    "childise",
-    "childive",
-    "childless",
-    "childmobile",
-    "childnetwork",
-    "childorganization",
-    "childory",
-    "childous",
-    "childschool",
-    "childspecial",
-    "childstudent",
-    "childtransport",
-    "circuit",
-    "circuitable",
-    "circuitadapter",
-    "circuitconcept",
-    "circuitdirectory",
-    "circuitful",
-    "circuitgovernment",
-    "circuithistory",
-    "circuitise",
-    "circuitless",
-    "circuitment",
-    "circuitory",
-    "circuitous",
-    "circuitpicture",
-    "circuitsome",
-    "circuitstate",
-    "circuitteen",
-    "circuittruck",
-    "circuiture",
-    "coableize",
-    "coaction",
-    "coalgorithm",
-    "coallowary",
-    "coaskwise",
-    "coaudio",
-    "cobasis",
-    "coboat",
-    "cobring",
-    "cobusiness",
-    "cocall",
-    "cocamera",
-    "cocar",
-    "cocolor",
-    "cocommunication",
-    "cocomponent",
-    "coconsider",
-    "cocountry",
-    "coday",
-    "codelivery",
-    "codesign",
-    "codie",
-    "codisplay",
-    "codocumentation",
-    "coeducation",
-    "coelectricity",
-    "coelement",
-    "coeverfy",
-    "coeverwise",
-    "coexample",
-    "coexpect",
-    "cofact",
-    "cofinancial",
-    "cofind",
-    "cofolder",
-    "cofoundation",
-    "cofuel",
-    "cogroup",
-    "cogrow",
-    "cohand",
-    "cohood",
-    "cohouse",
-    "coibleible",
-    "cointerface",
-    "cointernational",
-    "cointernet",
-    "cokill",
-    "coknow",
-    "coknowsome",
-    "color",
-    "colorage",
-    "coloral",
-    "colordevelopment",
-    "colordom",
-    "colored",
-    "coloren",
-    "colorent",
-    "colorgroup",
-    "colorial",
-    "colorise",
-    "colorism",
-    "colorize",
-    "colorless",
-    "colorletter",
-    "colorlike",
-    "colorline",
-    "colormechanism",
-    "colormicrophone",
-    "colornation",
-    "colorous",
-    "colorprice",
-    "colorquality",
-    "colorsome",
-    "colorure",
-    "colorwater",
-    "colorwave",
-    "colorwebsite",
-    "colorweek",
-    "colorwise",
-    "comarket",
-    "come",
-    "comeable",
-    "comechanism",
-    "comeic",
-    "comeing",
-    "comeise",
-    "comeite",
-    "comeive",
-    "comelike",
-    "comement",
-    "comemory",
-    "cometeen",
-    "cometion",
-    "comeure",
-    "communication",
-    "communicationaddress",
-    "communicationcompany",
-    "communicationen",
-    "communicationer",
-    "communicationful",
-    "communicationist",
-    "communicationize",
-    "communicationlike",
-    "communicationline",
-    "communicationnetwork",
-    "communicationorder",
-    "communicationory",
-    "communicationous",
-    "communicationship",
-    "communicationwave",
-    "comost",
-    "company",
-    "companycable",
-    "companycraft",
-    "companycurrent",
-    "companydom",
-    "companyed",
-    "companyeducation",
-    "companyer",
-    "companyful",
-    "companyhealth",
-    "companyial",
-    "companying",
-    "companyise",
-    "companyism",
-    "companyist",
-    "companyive",
-    "companyless",
-    "companylight",
-    "companyorganization",
-    "companyparameter",
-    "companyplane",
-    "companyposition",
-    "companypower",
-    "companyprinciple",
-    "companyquality",
-    "companyresistance",
-    "companyschool",
-    "companysion",
-    "companysome",
-    "companytechnology",
-    "companyteen",
-    "companytreatment",
-    "component",
-    "componentapplication",
-    "componentary",
-    "componentcircuit",
-    "componentcontroller",
-    "componentcourse",
-    "componentcraft",
-    "componentdisplay",
-    "componentdom",
-    "componentfact",
-    "componentfy",
-    "componential",
-    "componentic",
-    "componentinstrument",
-    "componentive",
-    "componently",
-    "componentoperation",
-    "componentous",
-    "componentposition",
-    "componentreason",
-    "componentright",
-    "componentstructure",
-    "componenttool",
-    "componentyear",
-    "computer",
-    "computeradapter",
-    "computerary",
-    "computerbook",
-    "computercraft",
-    "computerent",
-    "computerful",
-    "computering",
-    "computerinstrument",
-    "computerise",
-    "computerist",
-    "computerite",
-    "computerpicture",
-    "computerplane",
-    "computerplatform",
-    "computersound",
-    "computerstandard",
-    "computertion",
-    "computerty",
-    "computerwave",
-    "conation",
-    "concept",
-    "conceptaddress",
-    "conceptage",
-    "conceptaudio",
-    "conceptcontact",
-    "conceptday",
-    "concepted",
-    "conceptenergy",
-    "concepter",
-    "conceptfold",
-    "conceptful",
-    "conceptfy",
-    "concepthistory",
-    "concepthood",
-    "conceptible",
-    "conceptic",
-    "concepting",
-    "conceptinnovation",
-    "conceptism",
-    "conceptize",
-    "conceptless",
-    "conceptmarket",
-    "conceptmobile",
-    "conceptnews",
-    "conceptroom",
-    "conceptsensor",
-    "conceptshipping",
-    "conceptstudy",
-    "conceptterm",
-    "concepture",
-    "connector",
-    "connectoral",
-    "connectorapparatus",
-    "connectoraudio",
-    "connectorbicycle",
-    "connectordom",
-    "connectoren",
-    "connectorent",
-    "connectorequipment",
-    "connectorfunction",
-    "connectorhood",
-    "connectorial",
-    "connectoric",
-    "connectorive",
-    "connectorletter",
-    "connectorlike",
-    "connectorly",
-    "connectormusic",
-    "connectorness",
-    "connectorory",
-    "connectorperformance",
-    "connectorsion",
-    "connectorstorage",
-    "connectorthing",
-    "connectortion",
-    "connectorty",
-    "connectorure",
-    "connectoryoung",
-    "consider",
-    "considered",
-    "considerent",
-    "considerible",
-    "considerly",
-    "constant",
-    "constantable",
-    "constanted",
-    "constanten",
-    "constantexperience",
-    "constantframework",
-    "constantful",
-    "constanting",
-    "constantintegration",
-    "constantlike",
-    "constantmechanism",
-    "constantprinciple",
-    "constantprinter",
-    "constantprocess",
-    "constantsecurity",
-    "constantsolution",
-    "constantspeaker",
-    "constantspecial",
-    "constantstory",
-    "constantthing",
-    "constantwater",
-    "contact",
-    "contactal",
-    "contactant",
-    "contactboat",
-    "contactcompany",
-    "contactdevelopment",
-    "contacted",
-    "contacten",
-    "contactest",
-    "contactfact",
-    "contactfold",
-    "contactfy",
-    "contacthand",
-    "contacthouse",
-    "contactinterest",
-    "contactist",
-    "contactite",
-    "contactmechanism",
-    "contactment",
-    "contactness",
-    "contactory",
-    "contactpackage",
-    "contactsecurity",
-    "contactside",
-    "contactstudy",
-    "contacttechnique",
-    "contactth",
-    "contacttime",
-    "contacttraining",
-    "contacture",
-    "contactwise",
-    "contactyear",
-    "continue",
-    "continueant",
-    "continuefold",
-    "continuefy",
-    "continuety",
-    "continueward",
-    "controller",
-    "controllerdom",
-    "controlleren",
-    "controllerest",
-    "controllerfold",
-    "controllerfuel",
-    "controllergovernment",
-    "controllerible",
-    "controllerise",
-    "controllerism",
-    "controllerize",
-    "controllerjob",
-    "controllermechanism",
-    "controllerness",
-    "controllerory",
-    "controllersupport",
-    "controllerth",
-    "controllerure",
-    "controllervideo",
-    "controllerward",
-    "cooffice",
-    "coorder",
-    "copackage",
-    "copaperic",
-    "coparty",
-    "copass",
-    "copath",
-    "copay",
-    "copayable",
-    "cophone",
-    "cophoto",
-    "copicture",
-    "coplan",
-    "coplane",
-    "coplatform",
-    "coprocess",
-    "coproperty",
-    "coprovide",
-    "coprovidefy",
-    "coquality",
-    "coradiation",
-    "corememberward",
-    "coreporttion",
-    "coresource",
-    "coschool",
-    "coscience",
-    "coscreen",
-    "cosecurity",
-    "coseem",
-    "coseemive",
-    "coshipping",
-    "cosociety",
-    "cospeakfy",
-    "cosystem",
-    "cosystemary",
-    "cotakefold",
-    "cotakeist",
-    "cotakeite",
-    "cotechnicaled",
-    "cotechnique",
-    "cotechnology",
-    "coterm",
-    "cotime",
-    "cotool",
-    "cotransport",
-    "cotruck",
-    "counderstand",
-    "couniversity",
-    "counteradapter",
-    "counteradd",
-    "counterappearhood",
-    "counterapplication",
-    "counterask",
-    "counteraudio",
-    "counterbook",
-    "counterbus",
-    "counterbusiness",
-    "countercase",
-    "counterchild",
-    "countercolor",
-    "countercommunication",
-    "countercompany",
-    "counterconcept",
-    "counterconstant",
-    "countercourse",
-    "countercutfy",
-    "counterday",
-    "counterdelivery",
-    "counterdevice",
-    "counterdisplay",
-    "counterdocument",
-    "counterelectricity",
-    "countereverite",
-    "counterexpectteen",
-    "counterfallable",
-    "counterfamily",
-    "counterfeature",
-    "counterfinancialtion",
-    "counterfolder",
-    "counterfoundation",
-    "counterfunction",
-    "countergrow",
-    "countergrowth",
-    "counterhand",
-    "counterhouse",
-    "counterible",
-    "counterinclude",
-    "counterinformation",
-    "counterinnovation",
-    "counterjob",
-    "counterless",
-    "counterlivesion",
-    "countermaintenance",
-    "countermember",
-    "counterment",
-    "countermessage",
-    "countermobile",
-    "countermodel",
-    "countermoney",
-    "countername",
-    "counternatural",
-    "counternaturally",
-    "counternature",
-    "counternumber",
-    "counteroffer",
-    "counteroffice",
-    "counteropen",
-    "counteroperation",
-    "counterorder",
-    "counterpaper",
-    "counterparameter",
-    "counterpass",
-    "counterpattern",
-    "counterpeople",
-    "counterpersonal",
-    "counterpick",
-    "counterpickth",
-    "counterplane",
-    "counterplay",
-    "counterpolitical",
-    "counterpower",
-    "counterprinciple",
-    "counterprinter",
-    "counterprocedure",
-    "counterprogram",
-    "counterproject",
-    "counterpullary",
-    "counterquality",
-    "counterquestion",
-    "counterreport",
-    "counterrequire",
-    "counterresearch",
-    "counterresult",
-    "counterroom",
-    "counterscanner",
-    "counterscreen",
-    "countersell",
-    "countersend",
-    "countersensor",
-    "countershipping",
-    "countersocial",
-    "countersocialism",
-    "countersound",
-    "counterspeakent",
-    "counterstorage",
-    "counterstory",
-    "counterstructure",
-    "counterstudy",
-    "countersupport",
-    "countersystem",
-    "countersystemal",
-    "countertechnology",
-    "counterterm",
-    "counterthink",
-    "countertool",
-    "countertravel",
-    "counteruniversity",
-    "countervoltage",
-    "counterwantsion",
-    "counterwave",
-    "counterweek",
-    "counterwhat",
-    "counterwhenship",
-    "counterwork",
-    "counterworkible",
-    "counteryoung",
-    "country",
-    "countryage",
-    "countryboat",
-    "countrycharger",
-    "countrycomponent",
-    "countrydevice",
-    "countryed",
-    "countryefficiency",
-    "countryer",
-    "countryfold",
-    "countryfuel",
-    "countryful",
-    "countrygraphic",
-    "countryial",
-    "countryible",
-    "countryic",
-    "countryise",
-    "countryism",
-    "countrylike",
-    "countrymachine",
-    "countrymarket",
-    "countrynumber",
-    "countryperformance",
-    "countryplatform",
-    "countryscreen",
-    "countrysion",
-    "countrystudent",
-    "countrytime",
-    "countryty",
-    "course",
-    "courseal",
-    "courseant",
-    "courseboat",
-    "courseed",
-    "courseen",
-    "courseenergy",
-    "courseest",
-    "coursefold",
-    "courseful",
-    "courseial",
-    "courseinstrument",
-    "courseive",
-    "courseize",
-    "coursement",
-    "coursenature",
-    "courseness",
-    "coursepoint",
-    "coursepolicy",
-    "courseship",
-    "coursesion",
-    "coursesome",
-    "coursetool",
-    "courseure",
-    "courseward",
-    "covalue",
-    "covariable",
-    "covideo",
-    "cowalk",
-    "cowalkly",
-    "cowar",
-    "coway",
-    "cowhat",
-    "create",
-    "createfy",
-    "createing",
-    "createive",
-    "createness",
-    "createship",
-    "createsome",
-    "cultural",
-    "culturalal",
-    "culturalant",
-    "culturaler",
-    "current",
-    "currentable",
-    "currentary",
-    "currentdom",
-    "currenthood",
-    "currential",
-    "currenting",
-    "currentise",
-    "currentmaintenance",
-    "currentmaterial",
-    "currentmonitor",
-    "currentmusic",
-    "currentnetwork",
-    "currentoptimization",
-    "currentpattern",
-    "currentphone",
-    "currentprogram",
-    "currentroom",
-    "currentship",
-    "currentsome",
-    "currentteen",
-    "currenttion",
-    "currenttraining",
-    "currentty",
-    "currenture",
-    "currentward",
-    "currentyear",
-    "cut",
-    "cuter",
-    "cutful",
-    "cutial",
-    "cuting",
-    "cutize",
-    "cutlike",
-    "cutship",
-    "cuture",
-    "database",
-    "databaseary",
-    "databaseconnector",
-    "databaseer",
-    "databaseest",
-    "databaseexample",
-    "databasefold",
-    "databaseheadphone",
-    "databasehealth",
-    "databasehood",
-    "databasehouse",
-    "databaseic",
-    "databaseintegration",
-    "databasejob",
-    "databaselike",
-    "databasely",
-    "databasement",
-    "databasemoney",
-    "databasenumber",
-    "databaseoperation",
-    "databaseoptimization",
-    "databaseous",
-    "databaseproject",
-    "databaseship",
-    "databaseside",
-    "databasetransport",
-    "databasety",
-    "databaseure",
-    "databasework",
-    "day",
-    "dayboat",
-    "daycommunication",
-    "daycraft",
-    "dayday",
-    "dayed",
-    "dayent",
-    "dayfolder",
-    "dayfy",
-    "dayhood",
-    "dayite",
-    "dayize",
-    "dayless",
-    "daymouse",
-    "dayness",
-    "dayparty",
-    "dayplace",
-    "dayplatform",
-    "dayth",
-    "deadapter",
-    "deaddress",
-    "deanalysis",
-    "debook",
-    "debuilding",
-    "decase",
-    "decharger",
-    "decide",
-    "decidecraft",
-    "decideial",
-    "decideing",
-    "decidely",
-    "decideness",
-    "decideory",
-    "decideward",
-    "decidewise",
-    "deconnector",
-    "decreate",
-    "deculturalial",
-    "decutteen",
-    "dedesign",
-    "dedevelopment",
-    "dedocument",
-    "deeconomicen",
-    "deend",
-    "deequipment",
-    "deever",
-    "deexample",
-    "deexperience",
-    "defallal",
-    "defeel",
-    "defind",
-    "degiveable",
-    "deglobal",
-    "degraphic",
-    "deheadphone",
-    "dehistory",
-    "deiblelike",
-    "deimage",
-    "deimplementation",
-    "deinnovation",
-    "deinstrument",
-    "deintegration",
-    "deinterface",
-    "dekill",
-    "deknowless",
-    "deknowory",
-    "deleave",
-    "deliveen",
-    "delivery",
-    "deliveryage",
-    "deliveryalgorithm",
-    "deliverycomputer",
-    "deliverycourse",
-    "deliverydom",
-    "deliveryest",
-    "deliveryful",
-    "deliveryial",
-    "deliveryible",
-    "deliveryism",
-    "deliverylight",
-    "deliverymotorcycle",
-    "deliveryous",
-    "deliverypoint",
-    "deliveryquestion",
-    "deliveryresult",
-    "deliverystory",
-    "deliverytreatment",
-    "deliveryvideo",
-    "deliveryvoltage",
-    "deliveryweek",
-    "deliverywoman",
-    "deloveal",
-    "demethod",
-    "demodel",
-    "demonitor",
-    "demotor",
-    "demotorcycle",
-    "demove",
-    "demusic",
-    "dename",
-    "denational",
-    "denatural",
-    "denaturallike",
-    "denews",
-    "deofferly",
-    "deoffice",
-    "deorganization",
-    "depackage",
-    "depart",
-    "depass",
-    "deperformance",
-    "deperson",
-    "dephoto",
-    "depick",
-    "depicture",
-    "deplace",
-    "deplane",
-    "deplayial",
-    "depoint",
-    "depoliticalal",
-    "deprinciple",
-    "deprogram",
-    "deproject",
-    "deproperty",
-    "depublic",
-    "dequestion",
-    "dereachen",
-    "dereport",
-    "dereportive",
-    "deresistance",
-    "deright",
-    "deroom",
-    "descanner",
-    "deschool",
-    "desensor",
-    "deset",
-    "deship",
-    "design",
-    "designcommunication",
-    "designen",
-    "designenergy",
-    "designest",
-    "designfeature",
-    "designise",
-    "designlike",
-    "designly",
-    "designmanagement",
-    "designment",
-    "designmicrophone",
-    "designory",
-    "designpicture",
-    "designplace",
-    "designpoint",
-    "designprice",
-    "designreason",
-    "designship",
-    "designure",
-    "desionest",
-    "desolution",
-    "despend",
-    "destayible",
-    "destrategy",
-    "desystem",
-    "dething",
-    "detrade",
-    "detrain",
-    "detravel",
-    "detruck",
-    "detryite",
-    "deunderstand",
-    "deunderstandship",
-    "devehicle",
-    "development",
-    "developmental",
-    "developmentalgorithm",
-    "developmentent",
-    "developmentequipment",
-    "developmentfold",
-    "developmentful",
-    "developmentfunction",
-    "developmentgrowth",
-    "developmentinternet",
-    "developmentless",
-    "developmentplatform",
-    "developmentstate",
-    "developmenttion",
-    "developmenttraining",
-    "device",
-    "deviceable",
-    "deviceage",
-    "deviceal",
-    "deviceant",
-    "deviceary",
-    "devicecontact",
-    "devicecraft",
-    "deviceen",
-    "deviceengine",
-    "deviceest",
-    "devicefy",
-    "devicegovernment",
-    "devicehood",
-    "deviceial",
-    "deviceive",
-    "deviceize",
-    "devicejob",
-    "deviceless",
-    "devicely",
-    "devicematerial",
-    "devicement",
-    "devicemobile",
-    "deviceness",
-    "deviceproblem",
-    "devicescanner",
-    "deviceship",
-    "devicespace",
-    "devicespeaker",
-    "devicetime",
-    "devicetion",
-    "devicetransport",
-    "deviceure",
-    "deviceweek",
-    "deviceworld",
-    "devideo",
-    "devoltage",
-    "dewar",
-    "dewatchen",
-    "deway",
-    "dewear",
-    "deworld",
-    "deyear",
-    "deyoung",
-    "die",
-    "dieant",
-    "dieer",
-    "diement",
-    "dieness",
-    "diewise",
-    "digital",
-    "digitalant",
-    "digitalic",
-    "digitalness",
-    "digitalory",
-    "digitalsion",
-    "directory",
-    "directorycase",
-    "directorycomponent",
-    "directorycomputer",
-    "directorydom",
-    "directoryinformation",
-    "directoryise",
-    "directoryism",
-    "directoryist",
-    "directoryize",
-    "directoryless",
-    "directoryly",
-    "directorymaintenance",
-    "directoryment",
-    "directoryness",
-    "directorypart",
-    "directorypoint",
-    "directoryradiation",
-    "directorystructure",
-    "directoryteen",
-    "directorytreatment",
-    "directoryure",
-    "directorywise",
-    "disaction",
-    "disallowsome",
-    "disanalysis",
-    "disappear",
-    "disappearteen",
-    "disapplication",
-    "disarchitecture",
-    "disattribute",
-    "disaudio",
-    "disboat",
-    "disbring",
-    "disbuy",
-    "discallty",
-    "discar",
-    "discharacteristic",
-    "dischild",
-    "discircuit",
-    "discomeive",
-    "discommunication",
-    "disconstant",
-    "discreate",
-    "discreateen",
-    "discurrent",
-    "disday",
-    "disdevelopment",
-    "disdevice",
-    "disdigitalive",
-    "disdirectory",
-    "disdocument",
-    "disefficiency",
-    "disemail",
-    "disengine",
-    "disexample",
-    "disfact",
-    "disfinancialwise",
-    "disfind",
-    "disframework",
-    "disfull",
-    "disglobal",
-    "disgovernment",
-    "disgraphic",
-    "dishood",
-    "disiblelike",
-    "disimage",
-    "disincludeent",
-    "disinformation",
-    "disinterface",
-    "disinternet",
-    "diskeyboard",
-    "dislesssome",
-    "dislevel",
-    "dislikeable",
-    "dislikeism",
-    "disline",
-    "dislivefold",
-    "dislocal",
-    "dislook",
-    "dislove",
-    "dismember",
-    "dismessage",
-    "dismethod",
-    "dismoney",
-    "dismonitor",
-    "dismostage",
-    "dismotor",
-    "dismotorcycle",
-    "dismouse",
-    "dismusic",
-    "disnational",
-    "disnationalist",
-    "disnaturalous",
-    "disness",
-    "disnumber",
-    "disoffer",
-    "disofferal",
-    "disparameter",
-    "dispattern",
-    "dispayfy",
-    "dispayward",
-    "dispeople",
-    "disperformance",
-    "disperson",
-    "display",
-    "displayary",
-    "displayboat",
-    "displayent",
-    "displayequipment",
-    "displayest",
-    "displayfold",
-    "displayhood",
-    "displayinternet",
-    "displayise",
-    "displayite",
-    "displayive",
-    "displayless",
-    "displayly",
-    "displaymachine",
-    "displayness",
-    "displayoperation",
-    "displayory",
-    "displayreport",
-    "displayschool",
-    "displayship",
-    "displaysome",
-    "displayterm",
-    "displayty",
-    "displayvalue",
-    "displayvehicle",
-    "displaywebsite",
-    "dispoint",
-    "dispower",
-    "disprinciple",
-    "disprinter",
-    "disproblem",
-    "disprocedure",
-    "disprocess",
-    "disprocessor",
-    "disproductivity",
-    "disprogramship",
-    "disraisewise",
-    "disreport",
-    "disreportth",
-    "disright",
-    "disscience",
-    "disscreen",
-    "dissecurity",
-    "disservice",
-    "disshipping",
-    "dission",
-    "dissocialsion",
-    "dissolution",
-    "dissome",
-    "dissound",
-    "disspeak",
-    "disspeaker",
-    "disspecial",
-    "disstandment",
-    "disstopsion",
-    "disstorage",
-    "disstory",
-    "disstrategy",
-    "disstudy",
-    "distechnique",
-    "distheory",
-    "distime",
-    "distruck",
-    "disvariable",
-    "disvehicle",
-    "diswardwise",
-    "diswin",
-    "disword",
-    "diswork",
-    "disyoung",
-    "document",
-    "documentation",
-    "documentationconcept",
-    "documentationdom",
-    "documentationhood",
-    "documentationible",
-    "documentationing",
-    "documentationist",
-    "documentationite",
-    "documentationize",
-    "documentationless",
-    "documentationness",
-    "documentationprogram",
-    "documentationsound",
-    "documentationure",
-    "documentationward",
-    "documentcable",
-    "documentcomputer",
-    "documentent",
-    "documentfamily",
-    "documentfold",
-    "documenting",
-    "documentinterest",
-    "documently",
-    "documentmoney",
-    "documentorganization",
-    "documentous",
-    "documentplace",
-    "documentposition",
-    "documentprice",
-    "documentship",
-    "documentspecial",
-    "documenttime",
-    "documentword",
-    "economic",
-    "economicage",
-    "economical",
-    "economicteen",
-    "economicwise",
-    "education",
-    "educationaddress",
-    "educational",
-    "educationaled",
-    "educationalist",
-    "educationalless",
-    "educationalment",
-    "educationalness",
-    "educationalous",
-    "educationalsome",
-    "educationalth",
-    "educationattribute",
-    "educationcamera",
-    "educationconstant",
-    "educationdocument",
-    "educationelement",
-    "educationer",
-    "educationfact",
-    "educationfolder",
-    "educationly",
-    "educationous",
-    "educationphoto",
-    "educationpoint",
-    "educationquality",
-    "educationradiation",
-    "educationtravel",
-    "educationty",
-    "educationway",
-    "educationwebsite",
-    "efficiency",
-    "efficiencyable",
-    "efficiencyage",
-    "efficiencyal",
-    "efficiencycable",
-    "efficiencyed",
-    "efficiencyer",
-    "efficiencyfamily",
-    "efficiencyfold",
-    "efficiencyive",
-    "efficiencynature",
-    "efficiencyphone",
-    "efficiencyproject",
-    "efficiencyscreen",
-    "efficiencyth",
-    "efficiencyvehicle",
-    "efficiencywise",
-    "efficiencywork",
-    "electricity",
-    "electricityconcept",
-    "electricityday",
-    "electricityen",
-    "electricityfold",
-    "electricityful",
-    "electricityial",
-    "electricityinterest",
-    "electricityinternet",
-    "electricityize",
-    "electricityless",
-    "electricityly",
-    "electricitymobile",
-    "electricityness",
-    "electricityparty",
-    "electricitysecurity",
-    "electricityship",
-    "electricitytreatment",
-    "electricityure",
-    "element",
-    "elementable",
-    "elementdocument",
-    "elementend",
-    "elementest",
-    "elementfold",
-    "elemential",
-    "elementing",
-    "elementmemory",
-    "elementoptimization",
-    "elementsion",
-    "elementsomething",
-    "elementsound",
-    "elementtion",
-    "elementure",
-    "elementyoung",
-    "email",
-    "emailarchitecture",
-    "emaildocument",
-    "emailest",
-    "emailfy",
-    "emailize",
-    "emailmarket",
-    "emailment",
-    "emailmodel",
-    "emailness",
-    "emailoffice",
-    "emailpath",
-    "emailpoint",
-    "emailpower",
-    "emailprocessor",
-    "emailresearch",
-    "emailship",
-    "emailshipping",
-    "emailsoftware",
-    "emailth",
-    "emailtrain",
-    "emailvalue",
-    "emailworld",
-    "enableory",
-    "enadapter",
-    "enadder",
-    "enaddress",
-    "enapplication",
-    "enarchitecture",
-    "enask",
-    "enattribute",
-    "enbook",
-    "enbringible",
-    "enbringite",
-    "encable",
-    "encase",
-    "encharacteristic",
-    "encharger",
-    "enchild",
-    "encome",
-    "encomputer",
-    "enconsiderent",
-    "enculturaldom",
-    "encurrent",
-    "encut",
-    "end",
-    "enday",
-    "endcompany",
-    "enddevelopment",
-    "endevelopment",
-    "endevice",
-    "endframework",
-    "endfrequency",
-    "endfuel",
-    "endfy",
-    "endic",
-    "endize",
-    "endless",
-    "endmanagement",
-    "endnature",
-    "endocumentation",
-    "endous",
-    "endperformance",
-    "endprinciple",
-    "endsignal",
-    "endtion",
-    "eneconomic",
-    "eneducation",
-    "enelectricity",
-    "enengine",
-    "enequipment",
-    "energy",
-    "energyaction",
-    "energyaddress",
-    "energyal",
-    "energyarea",
-    "energycomputer",
-    "energyelement",
-    "energyemail",
-    "energyen",
-    "energyend",
-    "energyer",
-    "energyfile",
-    "energyframework",
-    "energyhome",
-    "energyhouse",
-    "energyible",
-    "energyite",
-    "energyless",
-    "energymoney",
-    "energyory",
-    "energyproductivity",
-    "energysignal",
-    "energystructure",
-    "energystudent",
-    "energytion",
-    "energyward",
-    "energywise",
-    "enfact",
-    "enfamily",
-    "enfullen",
-    "engine",
-    "enginealgorithm",
-    "enginebicycle",
-    "engineen",
-    "engineest",
-    "enginehome",
-    "engineive",
-    "enginemaintenance",
-    "enginement",
-    "enginemoney",
-    "enginemonitor",
-    "enginenature",
-    "engineoptimization",
-    "engineous",
-    "engineright",
-    "enginesome",
-    "enginetheory",
-    "enginevideo",
-    "engineward",
-    "engraphic",
-    "engroup",
-    "enhand",
-    "enheadphone",
-    "enhealth",
-    "enhoodty",
-    "enhouse",
-    "enibleing",
-    "enintegration",
-    "eninterface",
-    "eninternational",
-    "enjob",
-    "enkeyboard",
-    "enkillsion",
-    "enleadous",
-    "enlearn",
-    "enleavesome",
-    "enlessive",
-    "enletter",
-    "enlevel",
-    "enlook",
-    "enlooker",
-    "enloveing",
-    "enmachine",
-    "enmedicalable",
-    "enmeet",
-    "enment",
-    "enmessage",
-    "enmonitor",
-    "enmotor",
-    "enmouse",
-    "ennation",
-    "ennatural",
-    "enness",
-    "ennetwork",
-    "enoffer",
-    "enofferward",
-    "enopen",
-    "enoperation",
-    "enpart",
-    "enpay",
-    "enperson",
-    "enphone",
-    "enphoto",
-    "enpick",
-    "enpicture",
-    "enplace",
-    "enplane",
-    "enproblem",
-    "enproductivity",
-    "enpublic",
-    "enreachite",
-    "enread",
-    "enreadage",
-    "enremainial",
-    "enrememberwise",
-    "enrequireary",
-    "enresearch",
-    "enscanner",
-    "ensendcraft",
-    "enservice",
-    "enset",
-    "enshipping",
-    "ensit",
-    "ensolution",
-    "ensomething",
-    "ensound",
-    "enspace",
-    "enspeaker",
-    "enstandard",
-    "enstructure",
-    "enstudent",
-    "ensuggest",
-    "ensystem",
-    "ensystemism",
-    "entechnical",
-    "entechnology",
-    "entime",
-    "entrain",
-    "entruck",
-    "entry",
-    "enunderstand",
-    "enunderstandism",
-    "enuniversity",
-    "envariable",
-    "enwait",
-    "enwalk",
-    "enwalksome",
-    "enwater",
-    "enwave",
-    "enway",
-    "enwear",
-    "enweek",
-    "enwhere",
-    "enwhich",
-    "enwiner",
-    "enwinure",
-    "enwiseed",
-    "enyoung",
-    "equipment",
-    "equipmentant",
-    "equipmentapplication",
-    "equipmentary",
-    "equipmentcable",
-    "equipmentcomputer",
-    "equipmentcraft",
-    "equipmentcurrent",
-    "equipmentfold",
-    "equipmentfuel",
-    "equipmentfy",
-    "equipmenthood",
-    "equipmentist",
-    "equipmentite",
-    "equipmentless",
-    "equipmentmicrophone",
-    "equipmentname",
-    "equipmentness",
-    "equipmentous",
-    "equipmentpackage",
-    "equipmentproject",
-    "equipmentpublic",
-    "equipmentradiation",
-    "equipmentroom",
-    "equipmentsion",
-    "equipmentstudent",
-    "equipmenttool",
-    "equipmenture",
-    "equipmentwar",
-    "equipmentward",
-    "ever",
-    "everage",
-    "everary",
-    "everdom",
-    "everfy",
-    "example",
-    "exampleary",
-    "examplecamera",
-    "examplecharger",
-    "examplecontact",
-    "exampleen",
-    "exampleent",
-    "exampleequipment",
-    "exampleest",
-    "examplefy",
-    "exampleing",
-    "exampleinterest",
-    "examplely",
-    "examplemarket",
-    "examplemethod",
-    "exampleness",
-    "exampleprinter",
-    "exampleth",
-    "exampletion",
-    "exampleworld",
-    "exampleyoung",
-    "expect",
-    "expectary",
-    "expecter",
-    "expectize",
-    "experience",
-    "experienceant",
-    "experiencecomputer",
-    "experienceed",
-    "experienceemail",
-    "experienceend",
-    "experienceent",
-    "experienceer",
-    "experienceible",
-    "experienceism",
-    "experienceless",
-    "experiencely",
-    "experiencemachine",
-    "experiencemethod",
-    "experienceory",
-    "experiencepattern",
-    "experiencesupport",
-    "experienceteen",
-    "experiencewise",
-    "extraable",
-    "extraactivity",
-    "extraaddism",
-    "extraaddress",
-    "extraanalysis",
-    "extraapplication",
-    "extrabasis",
-    "extrabicycle",
-    "extrabuild",
-    "extrabus",
-    "extracable",
-    "extracamera",
-    "extracar",
-    "extracontact",
-    "extracontroller",
-    "extracreate",
-    "extraculturalable",
-    "extradesign",
-    "extradisplay",
-    "extradocumentation",
-    "extraeducation",
-    "extraeducational",
-    "extraemail",
-    "extraend",
-    "extraengine",
-    "extrafall",
-    "extrafamily",
-    "extrafile",
-    "extraframework",
-    "extragiveise",
-    "extragively",
-    "extragraphic",
-    "extragroup",
-    "extragrow",
-    "extraheadphone",
-    "extrahistorical",
-    "extraholdite",
-    "extraholdive",
-    "extrahoodteen",
-    "extraincludecraft",
-    "extrainformation",
-    "extrainstrument",
-    "extraintegration",
-    "extrainterest",
-    "extrajob",
-    "extralessary",
-    "extraletter",
-    "extralife",
-    "extralike",
-    "extraliketh",
-    "extraline",
-    "extralive",
-    "extralook",
-    "extralookize",
-    "extramanagement",
-    "extrament",
-    "extramodel",
-    "extramoney",
-    "extramotor",
-    "extramotorcycle",
-    "extranews",
-    "extranumber",
-    "extraparty",
-    "extrapattern",
-    "extrapaylike",
-    "extraphoto",
-    "extrapicture",
-    "extraplayth",
-    "extrapoint",
-    "extraposition",
-    "extraprice",
-    "extraprofessionaler",
-    "extraproperty",
-    "extrapullment",
-    "extraquestionic",
-    "extraquestiontion",
-    "extrareadary",
-    "extraresistance",
-    "extraresult",
-    "extraschool",
-    "extrascientific",
-    "extrasellism",
-    "extrasensor",
-    "extrasetward",
-    "extrashipping",
-    "extrasignal",
-    "extrasocial",
-    "extrasociallike",
-    "extrasolution",
-    "extrasomeise",
-    "extraspace",
-    "extraspeaker",
-    "extraspendant",
-    "extrastand",
-    "extrastandtion",
-    "extrastate",
-    "extrastopward",
-    "extrastrategy",
-    "extrastudy",
-    "extrasuggest",
-    "extrasystem",
-    "extratechnology",
-    "extrathink",
-    "extratime",
-    "extratrade",
-    "extratrain",
-    "extratraining",
-    "extratransport",
-    "extratravel",
-    "extratreatment",
-    "extratruck",
-    "extravalue",
-    "extravehicle",
-    "extraway",
-    "extrawearty",
-    "extrawebsite",
-    "extrawhenic",
-    "extrawhereure",
-    "extraword",
-    "extrawrite",
-    "extrawritetion",
-    "fact",
-    "factelement",
-    "factent",
-    "factise",
-    "factless",
-    "factresource",
-    "factship",
-    "factstory",
-    "facttion",
-    "facttruck",
-    "factty",
-    "facture",
-    "factward",
-    "fall",
-    "falldom",
-    "fallen",
-    "fallent",
-    "fallize",
-    "fallteen",
-    "fallward",
-    "family",
-    "familyable",
-    "familyage",
-    "familycraft",
-    "familyen",
-    "familyent",
-    "familyer",
-    "familyest",
-    "familyful",
-    "familygovernment",
-    "familygrowth",
-    "familyise",
-    "familyism",
-    "familylike",
-    "familyline",
-    "familyment",
-    "familymonitor",
-    "familymotor",
-    "familyprinter",
-    "familyproductivity",
-    "familyschool",
-    "familystate",
-    "familystructure",
-    "familyteen",
-    "familytheory",
-    "familywise",
-    "familywork",
-    "feature",
-    "featureadapter",
-    "featureanalysis",
-    "featureconnector",
-    "featurecraft",
-    "featuredocumentation",
-    "featureeducation",
-    "featureer",
-    "featureest",
-    "featurefold",
-    "featureful",
-    "featuregraphic",
-    "featureise",
-    "featureize",
-    "featureless",
-    "featureness",
-    "featureory",
-    "featureteen",
-    "featureterm",
-    "featureth",
-    "featuretravel",
-    "featuretruck",
-    "featurety",
-    "featurework",
-    "feel",
-    "feelable",
-    "feelal",
-    "feelent",
-    "feelful",
-    "feelive",
-    "feellike",
-    "feelure",
-    "file",
-    "fileaction",
-    "fileant",
-    "fileary",
-    "filecharacteristic",
-    "filecraft",
-    "filedesign",
-    "filedevice",
-    "filedirectory",
-    "filefoundation",
-    "filefy",
-    "filehome",
-    "fileible",
-    "fileing",
-    "fileise",
-    "fileism",
-    "fileive",
-    "fileless",
-    "filelight",
-    "filelike",
-    "filelocation",
-    "filemechanism",
-    "filement",
-    "fileory",
-    "fileprogram",
-    "filesion",
-    "fileteen",
-    "filetheory",
-    "fileward",
-    "financial",
-    "financialable",
-    "financialest",
-    "financialial",
-    "financialism",
-    "financialize",
-    "financialory",
-    "financialteen",
-    "find",
-    "finding",
-    "findism",
-    "findive",
-    "findsome",
-    "findteen",
-    "findure",
-    "folder",
-    "folderant",
-    "folderbook",
-    "foldered",
-    "folderengine",
-    "folderinformation",
-    "folderise",
-    "folderive",
-    "folderize",
-    "foldermicrophone",
-    "folderous",
-    "folderresult",
-    "foldersome",
-    "folderuniversity",
-    "folderway",
-    "folderwebsite",
-    "follow",
-    "followable",
-    "followfold",
-    "followible",
-    "followise",
-    "followless",
-    "followtion",
-    "followure",
-    "followwise",
-    "foreadapter",
-    "foreapparatus",
-    "foreappeared",
-    "foreapproach",
-    "forearchitecture",
-    "forearea",
-    "foreaudio",
-    "forebasis",
-    "forebattery",
-    "forebook",
-    "forebring",
-    "forebusiness",
-    "forecable",
-    "forecharger",
-    "forecometeen",
-    "forecommunication",
-    "forecomponent",
-    "forecomputer",
-    "forecourse",
-    "forecreate",
-    "foreday",
-    "foredelivery",
-    "foredesign",
-    "foredevice",
-    "foredocument",
-    "foreengine",
-    "foreequipment",
-    "forefeelous",
-    "forefinancial",
-    "forefinancialcraft",
-    "forefolder",
-    "forefoundation",
-    "foreframework",
-    "forefunction",
-    "foregraphic",
-    "foregrowed",
-    "foregrowent",
-    "forehealth",
-    "forehistorical",
-    "forehood",
-    "foreinfrastructure",
-    "foreinterface",
-    "forekillward",
-    "forelearnous",
-    "forelife",
-    "forelikeful",
-    "forelocation",
-    "foremake",
-    "foremeet",
-    "foremeethood",
-    "foremethod",
-    "foremoney",
-    "foremouse",
-    "forenatural",
-    "forenews",
-    "foreopen",
-    "foreorganization",
-    "forepattern",
-    "foreperformance",
-    "forepick",
-    "foreplane",
-    "forepoint",
-    "forepolicy",
-    "forepower",
-    "foreprinciple",
-    "foreprinter",
-    "foreprocess",
-    "foreprofessionalth",
-    "foreprogram",
-    "foreprogramage",
-    "foreproperty",
-    "forepublic",
-    "forepull",
-    "forepullfold",
-    "forequestion",
-    "foreread",
-    "foreremember",
-    "foreresearch",
-    "foreresistance",
-    "foreresource",
-    "foreresult",
-    "foreroom",
-    "foreschool",
-    "forescience",
-    "forescientific",
-    "forescreen",
-    "foreseemtion",
-    "foresend",
-    "foreservice",
-    "foreset",
-    "foreside",
-    "foresoftware",
-    "foresolution",
-    "foresome",
-    "forespace",
-    "forespeak",
-    "forespecial",
-    "forespendable",
-    "forestop",
-    "forestrategy",
-    "forestudent",
-    "foresuggest",
-    "foresuggestous",
-    "foresystem",
-    "foretechnique",
-    "foretheory",
-    "forething",
-    "foretime",
-    "foretion",
-    "foretransport",
-    "forevalue",
-    "forewalk",
-    "forewantive",
-    "forewebsite",
-    "forewhere",
-    "forewhereible",
-    "forewoman",
-    "forewriteal",
-    "foreyear",
-    "foreyoung",
-    "foundation",
-    "foundationaudio",
-    "foundationboat",
-    "foundationer",
-    "foundationest",
-    "foundationful",
-    "foundationic",
-    "foundationing",
-    "foundationinnovation",
-    "foundationism",
-    "foundationize",
-    "foundationlike",
-    "foundationment",
-    "foundationname",
-    "foundationorder",
-    "foundationtion",
-    "foundationyear",
-    "framework",
-    "frameworkable",
-    "frameworkage",
-    "frameworkcomputer",
-    "frameworkcontact",
-    "frameworked",
-    "frameworkhealth",
-    "frameworkhood",
-    "frameworkial",
-    "frameworking",
-    "frameworkise",
-    "frameworkism",
-    "frameworkist",
-    "frameworkmemory",
-    "frameworkment",
-    "frameworkproblem",
-    "frameworkprocessor",
-    "frameworkproperty",
-    "frameworkright",
-    "frameworksensor",
-    "frameworksome",
-    "frameworktheory",
-    "frameworktreatment",
-    "frameworkward",
-    "frameworkwave",
-    "frameworkwise",
-    "frequency",
-    "frequencyapparatus",
-    "frequencyary",
-    "frequencycompany",
-    "frequencycraft",
-    "frequencycurrent",
-    "frequencydatabase",
-    "frequencyent",
-    "frequencyequipment",
-    "frequencyfold",
-    "frequencyhome",
-    "frequencyial",
-    "frequencying",
-    "frequencyize",
-    "frequencylike",
-    "frequencymobile",
-    "frequencyphone",
-    "frequencyplane",
-    "frequencyprocess",
-    "frequencysion",
-    "frequencywater",
-    "fuel",
-    "fuelage",
-    "fuelary",
-    "fuelent",
-    "fuelest",
-    "fuelfold",
-    "fuelful",
-    "fuelhealth",
-    "fuelinfrastructure",
-    "fuelist",
-    "fuelmaintenance",
-    "fuelment",
-    "fuelness",
-    "fuelpath",
-    "fuelpeople",
-    "fuelplatform",
-    "fuelproblem",
-    "fuelsion",
-    "fuelsound",
-    "fuelspeaker",
-    "fueltime",
-    "fueltion",
-    "fuelty",
-    "fuelwise",
-    "full",
-    "fullable",
-    "fulled",
-    "fullfy",
-    "fulling",
-    "fullite",
-    "fullous",
-    "fullsome",
-    "fullure",
-    "fullward",
-    "function",
-    "functionant",
-    "functionary",
-    "functioncharger",
-    "functioncourse",
-    "functiondom",
-    "functionen",
-    "functionent",
-    "functionful",
-    "functiongovernment",
-    "functionhood",
-    "functionial",
-    "functioninstrument",
-    "functioninterface",
-    "functionise",
-    "functionlife",
-    "functionlike",
-    "functionly",
-    "functionmachine",
-    "functionment",
-    "functionradiation",
-    "functionright",
-    "functionschool",
-    "functionsome",
-    "functionstory",
-    "functionteen",
-    "functiontion",
-    "functionure",
-    "functionward",
-    "functionyoung",
-    "give",
-    "giveal",
-    "giveent",
-    "giveful",
-    "giveing",
-    "giveite",
-    "giveless",
-    "global",
-    "globalent",
-    "globalial",
-    "globalism",
-    "globalist",
-    "government",
-    "governmentage",
-    "governmentant",
-    "governmentaudio",
-    "governmentbus",
-    "governmented",
-    "governmentefficiency",
-    "governmenten",
-    "governmentent",
-    "governmentfamily",
-    "governmentfold",
-    "governmentgrowth",
-    "governmentory",
-    "governmentpart",
-    "governmentpattern",
-    "governmentpublic",
-    "governmentreport",
-    "governmentship",
-    "governmentshipping",
-    "governmentsion",
-    "governmenture",
-    "graphic",
-    "graphicage",
-    "graphicbasis",
-    "graphiccable",
-    "graphiccraft",
-    "graphiced",
-    "graphicest",
-    "graphicfeature",
-    "graphichood",
-    "graphicly",
-    "graphicmachine",
-    "graphicmarket",
-    "graphicmoney",
-    "graphicorganization",
-    "graphicory",
-    "graphicous",
-    "graphicpattern",
-    "graphicship",
-    "graphicsound",
-    "graphicteen",
-    "graphicty",
-    "graphicuniversity",
-    "graphicvariable",
-    "graphicvideo",
-    "graphicwebsite",
-    "group",
-    "groupant",
-    "groupapparatus",
-    "groupary",
-    "groupbook",
-    "groupcurrent",
-    "groupdocumentation",
-    "grouped",
-    "groupent",
-    "grouper",
-    "groupfold",
-    "groupful",
-    "groupial",
-    "groupimage",
-    "groupinstrument",
-    "groupise",
-    "groupive",
-    "groupness",
-    "groupous",
-    "groupphone",
-    "groupproperty",
-    "groupreport",
-    "groupright",
-    "groupsolution",
-    "groupsome",
-    "groupteen",
-    "groupward",
-    "groupway",
-    "grow",
-    "growable",
-    "growant",
-    "growary",
-    "growful",
-    "growism",
-    "growship",
-    "growteen",
-    "growth",
-    "growthable",
-    "growthaddress",
-    "growthal",
-    "growthend",
-    "growthequipment",
-    "growthexample",
-    "growthfold",
-    "growthfy",
-    "growthhood",
-    "growthial",
-    "growthimage",
-    "growthinterface",
-    "growthise",
-    "growthist",
-    "growthmobile",
-    "growthname",
-    "growthness",
-    "growthpoint",
-    "growthproperty",
-    "growthsome",
-    "growthth",
-    "growthtime",
-    "growthure",
-    "growthwise",
-    "growthword",
-    "growthyoung",
-    "hand",
-    "handcable",
-    "handcraft",
-    "handdom",
-    "handful",
-    "handgovernment",
-    "handgraphic",
-    "handible",
-    "handinternet",
-    "handism",
-    "handoperation",
-    "handorder",
-    "handphoto",
-    "handpublic",
-    "handship",
-    "handsion",
-    "handsociety",
-    "handspace",
-    "handtion",
-    "handtransport",
-    "handure",
-    "handward",
-    "handway",
-    "handword",
-    "happen",
-    "happenen",
-    "happenize",
-    "happenship",
-    "happenty",
-    "headphone",
-    "headphoneage",
-    "headphoneal",
-    "headphoneant",
-    "headphoneequipment",
-    "headphoneer",
-    "headphonefuel",
-    "headphoneful",
-    "headphonehood",
-    "headphoneial",
-    "headphoneible",
-    "headphoneise",
-    "headphoneite",
-    "headphoneive",
-    "headphoneless",
-    "headphonely",
-    "headphonemember",
-    "headphonemessage",
-    "headphoneness",
-    "headphoneperson",
-    "headphoneplatform",
-    "headphoneprinciple",
-    "headphonestrategy",
-    "headphonetheory",
-    "headphonetraining",
-    "health",
-    "healthant",
-    "healthboat",
-    "healthcommunication",
-    "healthcontroller",
-    "healthdesign",
-    "healthdevice",
-    "healthdom",
-    "healthent",
-    "healthest",
-    "healthexperience",
-    "healthfold",
-    "healthfrequency",
-    "healthfuel",
-    "healthism",
-    "healthize",
-    "healthmaintenance",
-    "healthmanagement",
-    "healthory",
-    "healthright",
-    "healthshipping",
-    "healthweek",
-    "historical",
-    "historicalible",
-    "historicalment",
-    "historicalure",
-    "history",
-    "historyant",
-    "historyary",
-    "historybicycle",
-    "historyconnector",
-    "historyconstant",
-    "historydesign",
-    "historyen",
-    "historyfile",
-    "historyfy",
-    "historyial",
-    "historyise",
-    "historyite",
-    "historylike",
-    "historyline",
-    "historyment",
-    "historyous",
-    "historyparameter",
-    "historyresistance",
-    "historysion",
-    "historysome",
-    "historystudent",
-    "historyth",
-    "historytime",
-    "historytravel",
-    "historyvalue",
-    "historyward",
-    "hold",
-    "holdable",
-    "holdial",
-    "holdous",
-    "home",
-    "homecircuit",
-    "homeed",
-    "homeen",
-    "homeer",
-    "homefrequency",
-    "homeial",
-    "homeic",
-    "homeite",
-    "homenature",
-    "homepower",
-    "homeprocedure",
-    "homereason",
-    "homesion",
-    "homesystem",
-    "homething",
-    "hometreatment",
-    "homety",
-    "homewise",
-    "hood",
-    "hoodcraft",
-    "hoodest",
-    "hoodful",
-    "hoodite",
-    "hoodment",
-    "house",
-    "housebicycle",
-    "housecraft",
-    "houseengine",
-    "houseest",
-    "houseexperience",
-    "houseinfrastructure",
-    "houseinterface",
-    "housement",
-    "housemotorcycle",
-    "houseprinciple",
-    "houseproperty",
-    "housereason",
-    "houseship",
-    "housetransport",
-    "ible",
-    "ibleal",
-    "ibleing",
-    "iblelike",
-    "image",
-    "imageactivity",
-    "imageconcept",
-    "imagecraft",
-    "imagedatabase",
-    "imagedocumentation",
-    "imagefuel",
-    "imageful",
-    "imagehood",
-    "imageial",
-    "imageist",
-    "imageite",
-    "imagely",
-    "imagement",
-    "imageous",
-    "imagephoto",
-    "imagepower",
-    "imagereason",
-    "imageteen",
-    "imageth",
-    "implementation",
-    "implementationdesign",
-    "implementationdom",
-    "implementationend",
-    "implementationfile",
-    "implementationful",
-    "implementationhood",
-    "implementationhouse",
-    "implementationly",
-    "implementationmarket",
-    "implementationmethod",
-    "implementationparty",
-    "implementationsensor",
-    "implementationwise",
-    "implementationworld",
-    "inable",
-    "inadapter",
-    "inaddress",
-    "inapparatus",
-    "inaskism",
-    "inattribute",
-    "inaudio",
-    "inbicycle",
-    "inbook",
-    "inbring",
-    "inbuild",
-    "incar",
-    "incase",
-    "incharacteristic",
-    "incharger",
-    "incircuit",
-    "include",
-    "incolor",
-    "income",
-    "incompany",
-    "incomputer",
-    "inconcept",
-    "inconstant",
-    "increateary",
-    "indatabase",
-    "inday",
-    "indelivery",
-    "indesign",
-    "indie",
-    "indisplay",
-    "indocumentation",
-    "ineconomichood",
-    "ineducationaling",
-    "inelectricity",
-    "inelement",
-    "inemail",
-    "inexpect",
-    "infallant",
-    "infamily",
-    "infeel",
-    "infindfy",
-    "infollowful",
-    "information",
-    "informationable",
-    "informational",
-    "informationary",
-    "informationent",
-    "informationexample",
-    "informationfile",
-    "informationhouse",
-    "informationible",
-    "informationless",
-    "informationlike",
-    "informationmarket",
-    "informationproblem",
-    "informationstrategy",
-    "informationstudy",
-    "informationsupport",
-    "informationtechnique",
-    "informationward",
-    "inframework",
-    "infrastructure",
-    "infrastructureable",
-    "infrastructureage",
-    "infrastructurebook",
-    "infrastructurecolor",
-    "infrastructureed",
-    "infrastructureer",
-    "infrastructureest",
-    "infrastructuregroup",
-    "infrastructureic",
-    "infrastructureing",
-    "infrastructureise",
-    "infrastructureive",
-    "infrastructurelight",
-    "infrastructurenation",
-    "infrastructurepeople",
-    "infrastructuresignal",
-    "infrastructurewave",
-    "infrastructurewise",
-    "infunction",
-    "inglobaler",
-    "ingrowth",
-    "inhealth",
-    "inhistorical",
-    "inhome",
-    "inhoodism",
-    "inintegration",
-    "inkillsome",
-    "inlead",
-    "inlearndom",
-    "inleave",
-    "inlesscraft",
-    "inletter",
-    "inlevel",
-    "inlike",
-    "inmachine",
-    "inmaintenance",
-    "inmake",
-    "inmanagement",
-    "inmember",
-    "inmemory",
-    "inmethod",
-    "inmost",
-    "inmostism",
-    "inmouse",
-    "inmove",
-    "innaturalous",
-    "innovation",
-    "innovationant",
-    "innovationcable",
-    "innovationcamera",
-    "innovationer",
-    "innovationfamily",
-    "innovationfold",
-    "innovationfunction",
-    "innovationhouse",
-    "innovationial",
-    "innovationism",
-    "innovationist",
-    "innovationjob",
-    "innovationmechanism",
-    "innovationment",
-    "innovationparty",
-    "innovationphone",
-    "innovationplatform",
-    "innovationradiation",
-    "innovationship",
-    "innovationtrain",
-    "innumber",
-    "inpattern",
-    "inpay",
-    "inpayive",
-    "inpeople",
-    "inphoto",
-    "inpick",
-    "inpicture",
-    "inplan",
-    "inplatform",
-    "inposition",
-    "inprice",
-    "inproblem",
-    "inproperty",
-    "inprotocol",
-    "inradiation",
-    "inreach",
-    "inremember",
-    "inreport",
-    "inresearch",
-    "inresult",
-    "inschool",
-    "inscientificwise",
-    "insecurity",
-    "inserve",
-    "inship",
-    "inshipping",
-    "insocialable",
-    "insolution",
-    "insomething",
-    "insound",
-    "inspace",
-    "inspendize",
-    "instate",
-    "instayise",
-    "instaysion",
-    "instop",
-    "instopory",
-    "instrategy",
-    "instructure",
-    "instrument",
-    "instrumentable",
-    "instrumentarea",
-    "instrumented",
-    "instrumentgroup",
-    "instrumential",
-    "instrumentic",
-    "instrumentinterface",
-    "instrumentist",
-    "instrumentive",
-    "instrumentmethod",
-    "instrumentous",
-    "instrumentpart",
-    "instrumentreport",
-    "instrumentresource",
-    "instrumentscience",
-    "instrumentship",
-    "instrumentside",
-    "instrumentsome",
-    "instrumentteen",
-    "instrumentth",
-    "instrumentthing",
-    "instrumenttrain",
-    "instrumenttruck",
-    "instudent",
-    "insuggestest",
-    "insupport",
-    "insystem",
-    "integration",
-    "integrationage",
-    "integrationant",
-    "integrationdocument",
-    "integrationdom",
-    "integrationed",
-    "integrationen",
-    "integrationest",
-    "integrationfamily",
-    "integrationgrowth",
-    "integrationible",
-    "integrationite",
-    "integrationize",
-    "integrationkeyboard",
-    "integrationous",
-    "integrationprinciple",
-    "integrationproperty",
-    "integrationquestion",
-    "integrationreport",
-    "integrationstandard",
-    "integrationtechnique",
-    "integrationtion",
-    "integrationvideo",
-    "integrationwork",
-    "intell",
-    "interactivity",
-    "interadd",
-    "interallow",
-    "interapparatus",
-    "interappear",
-    "interattribute",
-    "interaudio",
-    "interboat",
-    "intercable",
-    "intercamera",
-    "intercar",
-    "intercharacteristic",
-    "intercharger",
-    "intercompany",
-    "interconcept",
-    "intercountry",
-    "intercreateen",
-    "intercut",
-    "interdevice",
-    "interdieable",
-    "interdisplay",
-    "interdocumentation",
-    "intereconomic",
-    "intereducationaldom",
-    "interenergy",
-    "interequipment",
-    "interest",
-    "interestage",
-    "interestal",
-    "interestary",
-    "interestattribute",
-    "interestcontroller",
-    "interestcraft",
-    "interested",
-    "interesten",
-    "interestment",
-    "interestnetwork",
-    "interestparty",
-    "interestperformance",
-    "interestperson",
-    "interesture",
-    "interestward",
-    "interestwise",
-    "interexpect",
-    "interface",
-    "interfaceant",
-    "interfaceary",
-    "interfacecar",
-    "interfacedom",
-    "interfaceent",
-    "interfacefy",
-    "interfacegraphic",
-    "interfaceible",
-    "interfaceinformation",
-    "interfaceinterface",
-    "interfaceise",
-    "interfaceist",
-    "interfaceive",
-    "interfaceletter",
-    "interfacely",
-    "interfaceness",
-    "interfaceoperation",
-    "interfaceous",
-    "interfaceparty",
-    "interfacestate",
-    "interfacetool",
-    "interfaceure",
-    "interfinancialent",
-    "interfollowent",
-    "interfollowial",
-    "interframework",
-    "interfull",
-    "interfunction",
-    "intergive",
-    "intergrowous",
-    "interhappening",
-    "interheadphone",
-    "interhoodous",
-    "interhouse",
-    "interimage",
-    "interimplementation",
-    "interinformation",
-    "interintegration",
-    "interinterface",
-    "interjob",
-    "interlead",
-    "interless",
-    "interletter",
-    "interlife",
-    "interlocation",
-    "interloseward",
-    "intermakeous",
-    "intermanagement",
-    "intermarket",
-    "intermedicalal",
-    "intermember",
-    "intermemory",
-    "intermessage",
-    "intermethod",
-    "intermobile",
-    "intermotor",
-    "intermotorcycle",
-    "intermouse",
-    "internation",
-    "international",
-    "internationalable",
-    "internationalary",
-    "internationaldom",
-    "internationaled",
-    "internationalful",
-    "internationalial",
-    "internationalness",
-    "internationalory",
-    "internationalship",
-    "internationalth",
-    "internaturalary",
-    "internet",
-    "internetbook",
-    "internetbusiness",
-    "internetcase",
-    "internetcircuit",
-    "internetdirectory",
-    "internetdisplay",
-    "internetexample",
-    "internetfold",
-    "internetframework",
-    "internetintegration",
-    "internetinterest",
-    "internetist",
-    "internetive",
-    "internetnews",
-    "internetorganization",
-    "internetproperty",
-    "internetresistance",
-    "internetroom",
-    "internetsoftware",
-    "internetth",
-    "internetwork",
-    "interoffer",
-    "interopen",
-    "interpath",
-    "interpeople",
-    "interpicture",
-    "interposition",
-    "interpower",
-    "interprice",
-    "interprinciple",
-    "interproject",
-    "interprovide",
-    "interprovideize",
-    "interquality",
-    "interquestion",
-    "interreason",
-    "interremainent",
-    "interremember",
-    "interrememberwise",
-    "interreport",
-    "interresource",
-    "interscience",
-    "interscreen",
-    "intersell",
-    "interseture",
-    "intershipping",
-    "intersion",
-    "intersocial",
-    "intersoftware",
-    "interspeaker",
-    "interstructure",
-    "interterm",
-    "interthinkous",
-    "intertion",
-    "intertool",
-    "intertrain",
-    "intertravel",
-    "intertreatment",
-    "intertry",
-    "intertryism",
-    "interuniversity",
-    "interuse",
-    "intervalue",
-    "intervariable",
-    "intervideo",
-    "interway",
-    "interwebsite",
-    "interwhere",
-    "interwhich",
-    "interwin",
-    "interwiseal",
-    "interwork",
-    "interyear",
-    "interyoung",
-    "intext",
-    "intheory",
-    "intrain",
-    "intraining",
-    "inuse",
-    "invariable",
-    "involtage",
-    "inwave",
-    "inwebsite",
-    "inwheresion",
-    "inwhichite",
-    "inwise",
-    "inwiseist",
-    "inwiseteen",
-    "inwork",
-    "job",
-    "jobal",
-    "jobary",
-    "jobconstant",
-    "jobed",
-    "joben",
-    "jobequipment",
-    "jobful",
-    "jobfy",
-    "jobgroup",
-    "jobly",
-    "jobment",
-    "jobprocess",
-    "jobroom",
-    "jobscanner",
-    "jobsoftware",
-    "jobth",
-    "jobtruck",
-    "jobure",
-    "jobword",
-    "keyboard",
-    "keyboardary",
-    "keyboardaudio",
-    "keyboardent",
-    "keyboardfold",
-    "keyboardism",
-    "keyboardlight",
-    "keyboardlike",
-    "keyboardment",
-    "keyboardmicrophone",
-    "keyboardness",
-    "keyboardpackage",
-    "keyboardphoto",
-    "keyboardsion",
-    "keyboardteen",
-    "keyboardth",
-    "keyboardwebsite",
-    "keyboardwise",
-    "kill",
-    "killant",
-    "killest",
-    "killhood",
-    "killize",
-    "killness",
-    "killory",
-    "killsome",
-    "killure",
-    "killward",
-    "killwise",
-    "know",
-    "knowed",
-    "knowful",
-    "lead",
-    "leaddom",
-    "leader",
-    "leadest",
-    "leading",
-    "leadous",
-    "leadsion",
-    "leadteen",
-    "leadth",
-    "leadure",
-    "leadward",
-    "learn",
-    "learnent",
-    "learnfold",
-    "leave",
-    "leavefy",
-    "leaveism",
-    "leaveive",
-    "leaveory",
-    "less",
-    "lesshood",
-    "lessness",
-    "lessth",
-    "lessure",
-    "lessward",
-    "letter",
-    "letteral",
-    "letterant",
-    "letterbus",
-    "lettercircuit",
-    "letterest",
-    "letterhealth",
-    "letterimplementation",
-    "letterite",
-    "letterize",
-    "letterkeyboard",
-    "letterless",
-    "letterorder",
-    "letterory",
-    "letterous",
-    "letterprinciple",
-    "letterprinter",
-    "letterth",
-    "letterure",
-    "lettervariable",
-    "letteryear",
-    "level",
-    "levelapproach",
-    "levelcharacteristic",
-    "levelcurrent",
-    "leveldom",
-    "leveled",
-    "leveler",
-    "levelfile",
-    "levelial",
-    "levelible",
-    "leveling",
-    "levelism",
-    "levelmethod",
-    "levelmodel",
-    "levelmonitor",
-    "levelmouse",
-    "levelnetwork",
-    "levelous",
-    "levelparameter",
-    "levelperson",
-    "levelsome",
-    "levelspeaker",
-    "leveltion",
-    "levelvehicle",
-    "life",
-    "lifeactivity",
-    "lifeage",
-    "lifecable",
-    "lifeconstant",
-    "lifeefficiency",
-    "lifeen",
-    "lifeest",
-    "lifefold",
-    "lifefuel",
-    "lifegovernment",
-    "lifeinfrastructure",
-    "lifeism",
-    "lifeive",
-    "lifeize",
-    "lifelife",
-    "lifemoney",
-    "lifemonitor",
-    "lifeoffice",
-    "lifeory",
-    "lifeplace",
-    "lifeproductivity",
-    "lifequality",
-    "liferesistance",
-    "lifeside",
-    "lifesound",
-    "lifetion",
-    "lifeuniversity",
-    "light",
-    "lightadapter",
-    "lightal",
-    "lightanalysis",
-    "lightary",
-    "lightbook",
-    "lightbusiness",
-    "lightcraft",
-    "lightdelivery",
-    "lightdocumentation",
-    "lighted",
-    "lighten",
-    "lightent",
-    "lightest",
-    "lightfy",
-    "lighthood",
-    "lightinnovation",
-    "lightive",
-    "lightmaintenance",
-    "lightmethod",
-    "lightory",
-    "lightphone",
-    "lightship",
-    "lightthing",
-    "lightty",
-    "lightwebsite",
-    "like",
-    "likeary",
-    "likeest",
-    "likeless",
-    "likely",
-    "likeory",
-    "likeship",
-    "likesion",
-    "liketeen",
-    "line",
-    "lineal",
-    "lineary",
-    "linebicycle",
-    "linecontroller",
-    "linecraft",
-    "linedevice",
-    "linedom",
-    "lineed",
-    "lineible",
-    "lineing",
-    "lineinterface",
-    "lineise",
-    "lineism",
-    "lineive",
-    "lineize",
-    "linekeyboard",
-    "lineless",
-    "linement",
-    "lineness",
-    "lineorder",
-    "lineory",
-    "linepublic",
-    "linesion",
-    "linesolution",
-    "linesome",
-    "lineteen",
-    "linety",
-    "live",
-    "liveible",
-    "liveic",
-    "liveite",
-    "livesome",
-    "local",
-    "localfold",
-    "localism",
-    "locally",
-    "localship",
-    "localtion",
-    "location",
-    "locationant",
-    "locationdatabase",
-    "locationdevice",
-    "locationdom",
-    "locationed",
-    "locationeducation",
-    "locationer",
-    "locationfold",
-    "locationfy",
-    "locationhood",
-    "locationing",
-    "locationinterest",
-    "locationist",
-    "locationless",
-    "locationmethod",
-    "locationness",
-    "locationory",
-    "locationous",
-    "locationplane",
-    "locationschool",
-    "locationth",
-    "locationure",
-    "locationway",
-    "locationworld",
-    "look",
-    "lookest",
-    "lookly",
-    "looksion",
-    "lookty",
-    "lose",
-    "loseing",
-    "loseive",
-    "loseless",
-    "loselike",
-    "loseness",
-    "love",
-    "loveage",
-    "loveal",
-    "loveant",
-    "loveise",
-    "loveite",
-    "loveory",
-    "loveous",
-    "loveship",
-    "machine",
-    "machineable",
-    "machineal",
-    "machinebicycle",
-    "machinecamera",
-    "machineest",
-    "machinefold",
-    "machinefolder",
-    "machineism",
-    "machinelike",
-    "machinely",
-    "machinemachine",
-    "machinemotor",
-    "machineness",
-    "machineprocedure",
-    "machineprocess",
-    "machineteen",
-    "machineure",
-    "machinewar",
-    "machinewise",
-    "maintenance",
-    "maintenanceable",
-    "maintenancecharger",
-    "maintenancechild",
-    "maintenancecraft",
-    "maintenanceest",
-    "maintenancefold",
-    "maintenanceful",
-    "maintenancehood",
-    "maintenanceing",
-    "maintenanceline",
-    "maintenancemechanism",
-    "maintenanceoffice",
-    "maintenancepart",
-    "maintenanceprinter",
-    "maintenanceschool",
-    "maintenancescreen",
-    "maintenanceship",
-    "maintenancespace",
-    "make",
-    "makeable",
-    "makeant",
-    "makeness",
-    "makeward",
-    "management",
-    "managemental",
-    "managementbattery",
-    "managementcamera",
-    "managementcomputer",
-    "managementcraft",
-    "managementfact",
-    "managementheadphone",
-    "managementise",
-    "managementist",
-    "managementive",
-    "managementmemory",
-    "managementment",
-    "managementmouse",
-    "managementmusic",
-    "managementnetwork",
-    "managementprice",
-    "managementservice",
-    "managementstudent",
-    "managementsystem",
-    "managementwise",
-    "market",
-    "marketenergy",
-    "marketism",
-    "marketlike",
-    "marketmanagement",
-    "marketment",
-    "marketmobile",
-    "marketnature",
-    "marketproperty",
-    "marketresearch",
-    "marketship",
-    "marketteen",
-    "marketth",
-    "marketthing",
-    "markettion",
-    "marketty",
-    "marketwater",
-    "material",
-    "materialage",
-    "materialant",
-    "materialcamera",
-    "materialen",
-    "materialer",
-    "materialfamily",
-    "materialful",
-    "materialhood",
-    "materialinnovation",
-    "materialism",
-    "materialize",
-    "materialless",
-    "materiallife",
-    "materially",
-    "materialory",
-    "materialprinciple",
-    "materialsion",
-    "materialsociety",
-    "materialstudent",
-    "materialteen",
-    "mechanism",
-    "mechanismarea",
-    "mechanismcompany",
-    "mechanismconcept",
-    "mechanismdevice",
-    "mechanismend",
-    "mechanismest",
-    "mechanismexample",
-    "mechanismframework",
-    "mechanismhood",
-    "mechanismible",
-    "mechanisming",
-    "mechanismism",
-    "mechanismive",
-    "mechanismly",
-    "mechanismmotorcycle",
-    "mechanismoffice",
-    "mechanismparty",
-    "mechanismperson",
-    "mechanismprocessor",
-    "mechanismradiation",
-    "mechanismreason",
-    "mechanismresistance",
-    "mechanismsolution",
-    "mechanismsome",
-    "mechanismuniversity",
-    "medical",
-    "medicalment",
-    "medicalsome",
-    "medicalty",
-    "meet",
-    "meetal",
-    "meetible",
-    "meetist",
-    "meetous",
-    "meetteen",
-    "member",
-    "memberage",
-    "memberarea",
-    "memberbicycle",
-    "membercamera",
-    "membercomputer",
-    "membered",
-    "memberent",
-    "memberfuel",
-    "membergraphic",
-    "memberhealth",
-    "memberhood",
-    "memberial",
-    "membering",
-    "memberinterest",
-    "memberinterface",
-    "memberism",
-    "memberjob",
-    "membermaintenance",
-    "membermessage",
-    "membermonitor",
-    "membermotor",
-    "memberness",
-    "memberoptimization",
-    "memberory",
-    "memberstory",
-    "memberstudent",
-    "memberth",
-    "memberty",
-    "memberweek",
-    "memberwork",
-    "memory",
-    "memoryable",
-    "memoryarchitecture",
-    "memorybasis",
-    "memorycontroller",
-    "memorydocument",
-    "memorydom",
-    "memoryist",
-    "memorylife",
-    "memorylike",
-    "memorymicrophone",
-    "memoryprice",
-    "memorypublic",
-    "memorysion",
-    "memoryspecial",
-    "memorystandard",
-    "memorystrategy",
-    "memorytrain",
-    "memoryward",
-    "ment",
-    "mentant",
-    "mential",
-    "mently",
-    "mentth",
-    "message",
-    "messageable",
-    "messageant",
-    "messagecase",
-    "messageconcept",
-    "messageconnector",
-    "messageest",
-    "messageful",
-    "messagegrowth",
-    "messagehood",
-    "messageible",
-    "messageic",
-    "messageing",
-    "messageintegration",
-    "messageinterest",
-    "messageist",
-    "messagemachine",
-    "messagemaintenance",
-    "messagemember",
-    "messagemotorcycle",
-    "messageous",
-    "messageposition",
-    "messagevoltage",
-    "messageward",
-    "messagewise",
-    "metaadddom",
-    "metaallowward",
-    "metaanalysis",
-    "metaappear",
-    "metaapproach",
-    "metaaskent",
-    "metaattribute",
-    "metaaudio",
-    "metabasis",
-    "metabook",
-    "metabreaklike",
-    "metabringer",
-    "metabringic",
-    "metabringment",
-    "metabus",
-    "metacamera",
-    "metachange",
-    "metacommunication",
-    "metacomputer",
-    "metaconsiderdom",
-    "metacontinue",
-    "metacontroller",
-    "metacountry",
-    "metacreateant",
-    "metacut",
-    "metadatabase",
-    "metadecidely",
-    "metadesign",
-    "metadevelopment",
-    "metadie",
-    "metadieible",
-    "metadisplay",
-    "metadocument",
-    "metadocumentation",
-    "metaeducation",
-    "metaeducational",
-    "metaefficiency",
-    "metaelement",
-    "metaemail",
-    "metaexample",
-    "metafamily",
-    "metafeel",
-    "metafile",
-    "metafollow",
-    "metafoundation",
-    "metafull",
-    "metagraphic",
-    "metagrow",
-    "metahappenth",
-    "metaheadphone",
-    "metahold",
-    "metainterface",
-    "metainternational",
-    "metainternet",
-    "metaknow",
-    "metalessage",
-    "metaletter",
-    "metalike",
-    "metalikeic",
-    "metaliketh",
-    "metalocation",
-    "metamaintenance",
-    "metameetship",
-    "metamessage",
-    "metamethod",
-    "metamobile",
-    "metamonitor",
-    "metamostsome",
-    "metamotor",
-    "metamovesome",
-    "metamusic",
-    "metanation",
-    "metanaturalsome",
-    "metanetwork",
-    "metanews",
-    "metaoperation",
-    "metaorder",
-    "metapackage",
-    "metaparty",
-    "metapassive",
-    "metaperson",
-    "metaplan",
-    "metaplatform",
-    "metaplay",
-    "metapoint",
-    "metapolitical",
-    "metapower",
-    "metaproblem",
-    "metaprocessor",
-    "metaprofessional",
-    "metaprogramfy",
-    "metaproperty",
-    "metapublic",
-    "metaquestionship",
-    "metaradiation",
-    "metaraisewise",
-    "metareach",
-    "metareport",
-    "metareportous",
-    "metaresearch",
-    "metaright",
-    "metaroom",
-    "metasecurity",
-    "metasell",
-    "metasend",
-    "metasensor",
-    "metaset",
-    "metasocialwise",
-    "metasoftware",
-    "metaspecial",
-    "metaspend",
-    "metastandard",
-    "metastrategy",
-    "metasystem",
-    "metasystemal",
-    "metatechnicalful",
-    "metatechnique",
-    "metatext",
-    "metatheory",
-    "metathinktion",
-    "metatime",
-    "metauniversity",
-    "metauseed",
-    "metavalue",
-    "metavideo",
-    "metawear",
-    "metaweek",
-    "metawhichism",
-    "metaword",
-    "metawork",
-    "metayear",
-    "method",
-    "methodant",
-    "methodapparatus",
-    "methodbook",
-    "methodcircuit",
-    "methoded",
-    "methodful",
-    "methodial",
-    "methodible",
-    "methodinformation",
-    "methodism",
-    "methodite",
-    "methodive",
-    "methodlight",
-    "methodline",
-    "methodnature",
-    "methodness",
-    "methodorder",
-    "methodpower",
-    "methodradiation",
-    "methodsolution",
-    "methodsome",
-    "methodty",
-    "methodvehicle",
-    "microaction",
-    "microactivity",
-    "microanalysis",
-    "microapparatus",
-    "microappearic",
-    "microapplication",
-    "microarchitecture",
-    "microbattery",
-    "microboat",
-    "microbook",
-    "microbreak",
-    "microcall",
-    "microcharger",
-    "microchild",
-    "microcolor",
-    "microcompany",
-    "microconcept",
-    "microcontinueible",
-    "microcontroller",
-    "microcreateary",
-    "microcreateward",
-    "microdelivery",
-    "microdevice",
-    "microdigital",
-    "microdisplay",
-    "microelectricity",
-    "microelement",
-    "microemail",
-    "microequipment",
-    "microeverory",
-    "microexpect",
-    "microfact",
-    "microfamily",
-    "microfeel",
-    "microfinancial",
-    "microfollow",
-    "microfoundation",
-    "microfrequency",
-    "microgloballike",
-    "microgovernment",
-    "microhealth",
-    "microimage",
-    "microimplementation",
-    "microinclude",
-    "microinterest",
-    "microinterface",
-    "microinternational",
-    "microlead",
-    "microletter",
-    "microlife",
-    "microlocal",
-    "microloseite",
-    "microloseship",
-    "micromeet",
-    "micromember",
-    "micromessage",
-    "micromoney",
-    "micromotorcycle",
-    "micronation",
-    "micronews",
-    "microorder",
-    "micropackage",
-    "micropart",
-    "microparty",
-    "micropeople",
-    "microperformance",
-    "microphone",
-    "microphoneant",
-    "microphonecase",
-    "microphonecraft",
-    "microphoneelement",
-    "microphonefact",
-    "microphonehood",
-    "microphoneinterface",
-    "microphoneism",
-    "microphoneorder",
-    "microphonepicture",
-    "microphoneplace",
-    "microphoneright",
-    "microphonesignal",
-    "microphonesome",
-    "microphoneure",
-    "microphonevoltage",
-    "microphoneward",
-    "microphoneworld",
-    "microphoto",
-    "microplatform",
-    "micropoint",
-    "microprinciple",
-    "microproblem",
-    "microproductivity",
-    "microprogramous",
-    "microprovideen",
-    "microquestion",
-    "microquestionship",
-    "microraiseed",
-    "microreach",
-    "microreachage",
-    "microreason",
-    "microreport",
-    "microreportsome",
-    "microresistance",
-    "microright",
-    "microschool",
-    "microscreen",
-    "microseem",
-    "microserve",
-    "microservice",
-    "microship",
-    "micrositwise",
-    "microsocial",
-    "microsociety",
-    "microsome",
-    "microsomefold",
-    "microspeaker",
-    "microstandard",
-    "microstandible",
-    "microstate",
-    "microstay",
-    "microstory",
-    "microsuggest",
-    "microsystem",
-    "microtechnical",
-    "microtechnology",
-    "microterm",
-    "microthing",
-    "microtionous",
-    "microtool",
-    "microtravel",
-    "microtryist",
-    "microvariable",
-    "microwater",
-    "microwebsite",
-    "microwhichure",
-    "microwork",
-    "minialgorithm",
-    "minianalysis",
-    "miniapproach",
-    "miniaskth",
-    "minibelieve",
-    "minibuildsion",
-    "minibuildth",
-    "minibus",
-    "minicable",
-    "minicharacteristic",
-    "minicircuit",
-    "minicolor",
-    "minicommunication",
-    "minicompany",
-    "miniconcept",
-    "miniconnector",
-    "minicutment",
-    "miniday",
-    "minidigitalen",
-    "minidirectory",
-    "minidisplay",
-    "minidocument",
-    "minieconomic",
-    "miniefficiency",
-    "miniend",
-    "miniever",
-    "miniexpect",
-    "minifeel",
-    "minifindsion",
-    "minifuel",
-    "minifunction",
-    "minigraphic",
-    "minigrowtion",
-    "minihappen",
-    "minihouse",
-    "miniimage",
-    "miniinstrument",
-    "miniintegration",
-    "miniinterest",
-    "minileadteen",
-    "minilearnant",
-    "minileave",
-    "minileaveory",
-    "miniletter",
-    "minilife",
-    "minimake",
-    "minimechanism",
-    "minimentfold",
-    "minimessage",
-    "minimethod",
-    "minimoney",
-    "minimostth",
-    "minimoveite",
-    "mininame",
-    "mininaturalhood",
-    "mininumber",
-    "minioffice",
-    "miniorganization",
-    "minipackage",
-    "miniparameter",
-    "minipart",
-    "minipath",
-    "minipayfold",
-    "minipicture",
-    "miniplace",
-    "minipoliticalest",
-    "minipower",
-    "miniprinter",
-    "miniproblem",
-    "miniproject",
-    "miniraise",
-    "minireach",
-    "miniread",
-    "minireason",
-    "miniremainer",
-    "minireport",
-    "miniresistance",
-    "miniscanner",
-    "minischool",
-    "miniscience",
-    "minisecurity",
-    "minisell",
-    "minisensor",
-    "miniserveest",
-    "miniservice",
-    "minishiphood",
-    "minisit",
-    "ministory",
-    "minisuggest",
-    "minisystem",
-    "minisystemible",
-    "minitechnology",
-    "miniterm",
-    "minithing",
-    "minitime",
-    "minition",
-    "minitrain",
-    "minitravel",
-    "miniuniversity",
-    "minivoltage",
-    "miniwaitly",
-    "miniwar",
-    "miniward",
-    "miniwardsion",
-    "miniwear",
-    "miniwhatible",
-    "miniwinty",
-    "miniwork",
-    "miniyoung",
-    "misaddive",
-    "misalgorithm",
-    "misallowdom",
-    "misanalysis",
-    "misapparatus",
-    "misappear",
-    "misapproach",
-    "misarea",
-    "misaudio",
-    "miscamera",
-    "mischaracteristic",
-    "mischarger",
-    "mischild",
-    "miscircuit",
-    "miscolor",
-    "miscome",
-    "miscommunication",
-    "miscomputer",
-    "misconcept",
-    "miscountry",
-    "miscourse",
-    "miscreatefy",
-    "miscuten",
-    "misdatabase",
-    "misdelivery",
-    "misdevice",
-    "misdocument",
-    "miseducation",
-    "miselectricity",
-    "misemail",
-    "misenergy",
-    "misexample",
-    "misexperience",
-    "misfeature",
-    "misfile",
-    "misfinancialary",
-    "misfunction",
-    "misgrowth",
-    "mishappen",
-    "misiblefy",
-    "misinterface",
-    "misinternet",
-    "misjob",
-    "misleave",
-    "mislevel",
-    "mislife",
-    "mismachine",
-    "mismicrophone",
-    "mismobile",
-    "mismonitor",
-    "mismusic",
-    "misname",
-    "misnation",
-    "misoffer",
-    "misofferible",
-    "misoperation",
-    "mispass",
-    "mispattern",
-    "mispay",
-    "mispayhood",
-    "mispersonalory",
-    "mispersonalsome",
-    "misphone",
-    "mispick",
-    "misplatform",
-    "mispower",
-    "misprinter",
-    "misprotocol",
-    "misprovideant",
-    "mispublic",
-    "misquestion",
-    "misraise",
-    "misremember",
-    "misrequire",
-    "misresistance",
-    "misscience",
-    "misselling",
-    "misserve",
-    "misservice",
-    "missignal",
-    "misspeak",
-    "misspeaker",
-    "misspeakise",
-    "misspecial",
-    "misspend",
-    "misspendable",
-    "misspendly",
-    "misstand",
-    "misstandard",
-    "misstorage",
-    "misstudent",
-    "missystement",
-    "missystemness",
-    "missystemth",
-    "mistake",
-    "mistellment",
-    "mistion",
-    "mistiondom",
-    "mistool",
-    "mistrade",
-    "misuse",
-    "misvehicle",
-    "miswantsome",
-    "miswar",
-    "miswater",
-    "misway",
-    "miswhichlike",
-    "miswise",
-    "miswiseful",
-    "misworkest",
-    "misyoung",
-    "mobile",
-    "mobilealgorithm",
-    "mobileant",
-    "mobileapproach",
-    "mobilecomponent",
-    "mobilecraft",
-    "mobileelectricity",
-    "mobileent",
-    "mobileimage",
-    "mobileite",
-    "mobilemarket",
-    "mobilemicrophone",
-    "mobileness",
-    "mobileproductivity",
-    "mobileside",
-    "mobilestudy",
-    "mobileth",
-    "mobiletool",
-    "mobileure",
-    "model",
-    "modelable",
-    "modelant",
-    "modelapparatus",
-    "modelarchitecture",
-    "modelbus",
-    "modelconnector",
-    "modelial",
-    "modelic",
-    "modelimplementation",
-    "modelinstrument",
-    "modelive",
-    "modelletter",
-    "modelline",
-    "modelorder",
-    "modelreason",
-    "modelsion",
-    "modelsomething",
-    "modelty",
-    "modelvideo",
-    "modelward",
-    "modelword",
-    "modelyear",
-    "money",
-    "moneyable",
-    "moneyarea",
-    "moneycase",
-    "moneycontact",
-    "moneydesign",
-    "moneydevice",
-    "moneyen",
-    "moneyent",
-    "moneyer",
-    "moneyfold",
-    "moneying",
-    "moneyist",
-    "moneyive",
-    "moneymicrophone",
-    "moneypicture",
-    "moneyprinciple",
-    "moneyresearch",
-    "moneyscreen",
-    "moneyshipping",
-    "moneysion",
-    "moneysound",
-    "moneystrategy",
-    "moneyth",
-    "moneyty",
-    "moneyvalue",
-    "moneyvariable",
-    "monitor",
-    "monitorary",
-    "monitordisplay",
-    "monitordocumentation",
-    "monitorfy",
-    "monitorhood",
-    "monitorism",
-    "monitorless",
-    "monitorlike",
-    "monitorline",
-    "monitorous",
-    "monitorpart",
-    "monitorperson",
-    "monitorproblem",
-    "monitorship",
-    "monitorsome",
-    "monitorsupport",
-    "monitorure",
-    "monitorwise",
-    "most",
-    "mostant",
-    "mostary",
-    "mostible",
-    "mosting",
-    "mostise",
-    "mostive",
-    "mostwise",
-    "motor",
-    "motorable",
-    "motorary",
-    "motorchild",
-    "motorcycle",
-    "motorcycleable",
-    "motorcycleant",
-    "motorcycleary",
-    "motorcyclecable",
-    "motorcyclecase",
-    "motorcycleed",
-    "motorcycleism",
-    "motorcyclemotorcycle",
-    "motorcycleparameter",
-    "motorcyclereport",
-    "motorcycleship",
-    "motorcycleside",
-    "motorcyclesome",
-    "motorcyclestory",
-    "motorcycleth",
-    "motorenergy",
-    "motorist",
-    "motorless",
-    "motoroptimization",
-    "motorous",
-    "motorperson",
-    "motortime",
-    "motorward",
-    "mouse",
-    "mouseable",
-    "mousealgorithm",
-    "mouseant",
-    "mousedom",
-    "mouseed",
-    "mouseeducation",
-    "mouseelectricity",
-    "mousegraphic",
-    "mousehood",
-    "mouseic",
-    "mouseinformation",
-    "mouseise",
-    "mouseism",
-    "mousely",
-    "mousement",
-    "mousemobile",
-    "mousemouse",
-    "mouseory",
-    "mousepolicy",
-    "mousesion",
-    "mousesolution",
-    "mousesome",
-    "mousestate",
-    "mousestudy",
-    "mouseteen",
-    "mousety",
-    "move",
-    "moveen",
-    "moveite",
-    "moveteen",
-    "movewise",
-    "multiable",
-    "multialgorithm",
-    "multiallow",
-    "multianalysis",
-    "multiapplication",
-    "multiarchitecture",
-    "multiarea",
-    "multiask",
-    "multibicycle",
-    "multiboat",
-    "multibreak",
-    "multibusiness",
-    "multicar",
-    "multichange",
-    "multicompany",
-    "multicomputer",
-    "multiconcept",
-    "multicreate",
-    "multicultural",
-    "multiday",
-    "multidecideent",
-    "multidelivery",
-    "multidevice",
-    "multidisplay",
-    "multieducation",
-    "multiemail",
-    "multiequipment",
-    "multiexample",
-    "multiexpectism",
-    "multifamily",
-    "multifeature",
-    "multifeelfy",
-    "multifeelic",
-    "multifinancialed",
-    "multifoundation",
-    "multiframework",
-    "multigiveory",
-    "multigovernment",
-    "multigrow",
-    "multigrowth",
-    "multihistorical",
-    "multihouse",
-    "multiible",
-    "multiibleible",
-    "multiinclude",
-    "multiinformation",
-    "multiinternational",
-    "multiinternet",
-    "multileading",
-    "multileaveite",
-    "multilevel",
-    "multimaintenance",
-    "multimarket",
-    "multimechanism",
-    "multimember",
-    "multimentage",
-    "multimicrophone",
-    "multimodel",
-    "multimostship",
-    "multimotor",
-    "multinetwork",
-    "multioffice",
-    "multiphone",
-    "multipickism",
-    "multipicture",
-    "multiplace",
-    "multipolicy",
-    "multipower",
-    "multiprice",
-    "multiprocedure",
-    "multiprocess",
-    "multiprocessor",
-    "multiprofessional",
-    "multiprogram",
-    "multiproject",
-    "multiproperty",
-    "multiprovide",
-    "multiprovideent",
-    "multipublic",
-    "multiquestion",
-    "multireason",
-    "multireport",
-    "multirequireable",
-    "multirequirefy",
-    "multiresource",
-    "multiresult",
-    "multiscience",
-    "multiship",
-    "multisignal",
-    "multisocial",
-    "multisoftware",
-    "multisolution",
-    "multisomething",
-    "multispeak",
-    "multispecial",
-    "multistorage",
-    "multistudy",
-    "multitechnicalfy",
-    "multitechnique",
-    "multitheory",
-    "multitool",
-    "multitraining",
-    "multitransport",
-    "multitravel",
-    "multitruck",
-    "multivalue",
-    "multivideo",
-    "multiwalk",
-    "multiwardent",
-    "multiwatchness",
-    "multiway",
-    "multiwear",
-    "multiwhen",
-    "multiwhere",
-    "multiwhereous",
-    "multiwinism",
-    "multiwinsome",
-    "multiwisewise",
-    "multiworker",
-    "multiwrite",
-    "multiyear",
-    "music",
-    "musicable",
-    "musicen",
-    "musicfy",
-    "musichood",
-    "musicise",
-    "musicless",
-    "musicmotorcycle",
-    "musicory",
-    "musicpublic",
-    "musicsensor",
-    "musicstate",
-    "musicstrategy",
-    "musicth",
-    "musictheory",
-    "musiction",
-    "musictrain",
-    "musicure",
-    "musicward",
-    "name",
-    "nameapparatus",
-    "nameary",
-    "namedesign",
-    "nameed",
-    "nameexperience",
-    "namefold",
-    "namehealth",
-    "namehouse",
-    "nameial",
-    "nameism",
-    "nameist",
-    "nameite",
-    "nameive",
-    "nameize",
-    "nameless",
-    "namemicrophone",
-    "nameous",
-    "nameresource",
-    "nameroom",
-    "namesupport",
-    "nameteen",
-    "nation",
-    "national",
-    "nationalage",
-    "nationalcraft",
-    "nationaldom",
-    "nationaled",
-    "nationalfy",
-    "nationalous",
-    "nationalwise",
-    "nationary",
-    "nationbook",
-    "nationcraft",
-    "nationdisplay",
-    "nationdocumentation",
-    "nationdom",
-    "nationen",
-    "nationer",
-    "nationful",
-    "nationgraphic",
-    "nationial",
-    "nationise",
-    "nationist",
-    "nationite",
-    "nationize",
-    "nationlight",
-    "nationoffice",
-    "nationoperation",
-    "nationparameter",
-    "nationproperty",
-    "nationresearch",
-    "nationsion",
-    "nationtion",
-    "nationvehicle",
-    "nationwoman",
-    "nationyear",
-    "natural",
-    "naturalant",
-    "naturalful",
-    "naturalhood",
-    "naturalism",
-    "naturalive",
-    "naturalty",
-    "nature",
-    "natureable",
-    "naturearchitecture",
-    "naturecompany",
-    "naturecraft",
-    "natureen",
-    "natureer",
-    "naturefold",
-    "natureful",
-    "natureible",
-    "natureic",
-    "natureing",
-    "natureinternet",
-    "natureist",
-    "natureless",
-    "natureline",
-    "naturelocation",
-    "naturely",
-    "naturemodel",
-    "naturemonitor",
-    "naturename",
-    "natureory",
-    "natureplace",
-    "natureprinter",
-    "natureship",
-    "naturespeaker",
-    "naturevoltage",
-    "natureweek",
-    "naturewise",
-    "ness",
-    "nesscraft",
-    "nessdom",
-    "nesser",
-    "nessial",
-    "nessism",
-    "nessly",
-    "nessship",
-    "nessure",
-    "network",
-    "networkattribute",
-    "networkaudio",
-    "networkcolor",
-    "networkcontact",
-    "networkent",
-    "networkfold",
-    "networkhood",
-    "networkise",
-    "networkive",
-    "networkless",
-    "networkmobile",
-    "networkproblem",
-    "networkship",
-    "networksomething",
-    "networkstudent",
-    "networkstudy",
-    "networkth",
-    "news",
-    "newsadapter",
-    "newsage",
-    "newsapplication",
-    "newsarea",
-    "newscraft",
-    "newsenergy",
-    "newsent",
-    "newsful",
-    "newsic",
-    "newsinternet",
-    "newsise",
-    "newsist",
-    "newsite",
-    "newslight",
-    "newsnation",
-    "newsness",
-    "newsnews",
-    "newsous",
-    "newspicture",
-    "newssecurity",
-    "newsstandard",
-    "newsth",
-    "newsure",
-    "newsward",
-    "newswave",
-    "newsweek",
-    "nonable",
-    "nonableed",
-    "nonactivity",
-    "nonadapter",
-    "nonadd",
-    "nonaddic",
-    "nonaddite",
-    "nonalgorithm",
-    "nonanalysis",
-    "nonapparatus",
-    "nonappearure",
-    "nonaskly",
-    "nonaudio",
-    "nonbasis",
-    "nonbicycle",
-    "nonboat",
-    "nonbuild",
-    "noncase",
-    "noncircuit",
-    "noncomeism",
-    "noncommunication",
-    "noncomponent",
-    "nonconcept",
-    "noncontinueic",
-    "noncountry",
-    "noncultural",
-    "nondelivery",
-    "nondesign",
-    "nondie",
-    "nondirectory",
-    "nonelement",
-    "nonenergy",
-    "nonequipment",
-    "nonfact",
-    "nonfalldom",
-    "nonfallfold",
-    "nonfile",
-    "nonfolder",
-    "nonfuel",
-    "nonfullen",
-    "nongraphic",
-    "nongroup",
-    "nonheadphone",
-    "nonhistorical",
-    "nonhistoricalial",
-    "nonhistory",
-    "nonhouse",
-    "nonimage",
-    "noninstrument",
-    "noninterest",
-    "noninternational",
-    "nonknow",
-    "nonlearn",
-    "nonlearnly",
-    "nonlife",
-    "nonlight",
-    "nonline",
-    "nonlocalent",
-    "nonlocation",
-    "nonlook",
-    "nonlosesome",
-    "nonlovewise",
-    "nonmachine",
-    "nonmaintenance",
-    "nonmanagement",
-    "nonmoney",
-    "nonmost",
-    "nonmotorcycle",
-    "nonmoveest",
-    "nonmusic",
-    "nonnature",
-    "nonnumber",
-    "nonoffice",
-    "nonopenfy",
-    "nonorder",
-    "nonpaper",
-    "nonpass",
-    "nonpassage",
-    "nonphoto",
-    "nonpoint",
-    "nonpolicy",
-    "nonposition",
-    "nonpower",
-    "nonprocessor",
-    "nonprofessional",
-    "nonproject",
-    "nonproperty",
-    "nonprotocol",
-    "nonpublic",
-    "nonpullteen",
-    "nonquestion",
-    "nonradiation",
-    "nonraise",
-    "nonremainsome",
-    "nonremainure",
-    "nonreport",
-    "nonresearch",
-    "nonroom",
-    "nonseemfy",
-    "nonserveent",
-    "nonship",
-    "nonshipping",
-    "nonside",
-    "nonsionure",
-    "nonsit",
-    "nonspace",
-    "nonspeaker",
-    "nonstandard",
-    "nonstandous",
-    "nonstrategy",
-    "nonstructure",
-    "nontechnique",
-    "nontext",
-    "nontheory",
-    "nontime",
-    "nontrain",
-    "nontraining",
-    "nontravel",
-    "nontryhood",
-    "nontrying",
-    "nonunderstandory",
-    "nonuniversity",
-    "nonvalue",
-    "nonvariable",
-    "nonwantize",
-    "nonwebsite",
-    "nonweek",
-    "nonwhat",
-    "nonwhen",
-    "nonwhere",
-    "nonworkous",
-    "nonwrite",
-    "number",
-    "numberant",
-    "numbercable",
-    "numbercar",
-    "numberconcept",
-    "numberdevice",
-    "numberdocumentation",
-    "numberen",
-    "numberenergy",
-    "numberer",
-    "numberfy",
-    "numberhood",
-    "numberial",
-    "numbering",
-    "numberive",
-    "numberlife",
-    "numbermarket",
-    "numbermonitor",
-    "numberparameter",
-    "numberreport",
-    "numberresult",
-    "numberroom",
-    "numbersolution",
-    "numberspecial",
-    "numbertechnique",
-    "numbertransport",
-    "numbervideo",
-    "offer",
-    "offerable",
-    "offerant",
-    "offerfold",
-    "offeric",
-    "offersion",
-    "offerward",
-    "office",
-    "officealgorithm",
-    "officeary",
-    "officebattery",
-    "officeboat",
-    "officebus",
-    "officecolor",
-    "officeed",
-    "officeen",
-    "officefy",
-    "officeive",
-    "officelight",
-    "officelike",
-    "officelocation",
-    "officemodel",
-    "officeprocedure",
-    "officespeaker",
-    "officeure",
-    "open",
-    "openary",
-    "openful",
-    "openial",
-    "openous",
-    "openship",
-    "opention",
-    "openwise",
-    "operation",
-    "operational",
-    "operationdesign",
-    "operationdevice",
-    "operationed",
-    "operationent",
-    "operationframework",
-    "operationhood",
-    "operationive",
-    "operationmaterial",
-    "operationmethod",
-    "operationnation",
-    "operationory",
-    "operationous",
-    "operationstate",
-    "operationterm",
-    "operationward",
-    "operationwebsite",
-    "optimization",
-    "optimizationable",
-    "optimizationage",
-    "optimizationary",
-    "optimizationelement",
-    "optimizationemail",
-    "optimizationful",
-    "optimizationgroup",
-    "optimizationible",
-    "optimizationic",
-    "optimizationism",
-    "optimizationite",
-    "optimizationly",
-    "optimizationmachine",
-    "optimizationname",
-    "optimizationside",
-    "optimizationterm",
-    "optimizationth",
-    "optimizationwise",
-    "order",
-    "orderable",
-    "orderaction",
-    "orderboat",
-    "ordercraft",
-    "orderdisplay",
-    "ordered",
-    "orderefficiency",
-    "orderfile",
-    "orderfold",
-    "orderial",
-    "orderise",
-    "orderist",
-    "orderite",
-    "orderive",
-    "orderize",
-    "orderly",
-    "ordermicrophone",
-    "orderory",
-    "ordersion",
-    "ordersolution",
-    "ordersome",
-    "orderspace",
-    "ordersystem",
-    "ordervehicle",
-    "ordervideo",
-    "orderworld",
-    "organization",
-    "organizationbusiness",
-    "organizationcamera",
-    "organizationdocument",
-    "organizationdom",
-    "organizationemail",
-    "organizationer",
-    "organizationfeature",
-    "organizationfy",
-    "organizationic",
-    "organizationive",
-    "organizationize",
-    "organizationlike",
-    "organizationory",
-    "organizationous",
-    "organizationpart",
-    "organizationteen",
-    "outadd",
-    "outaddress",
-    "outalgorithm",
-    "outanalysis",
-    "outarchitecture",
-    "outbicycle",
-    "outboat",
-    "outbook",
-    "outbusiness",
-    "outcar",
-    "outchangeible",
-    "outchild",
-    "outcircuit",
-    "outcolor",
-    "outcommunication",
-    "outcomponent",
-    "outcomputer",
-    "outconcept",
-    "outcontinuement",
-    "outcountry",
-    "outcourse",
-    "outcreateism",
-    "outdecide",
-    "outdevelopment",
-    "outdevice",
-    "outdiewise",
-    "outdocument",
-    "outeducational",
-    "outelectricity",
-    "outexample",
-    "outexpectable",
-    "outexperience",
-    "outfact",
-    "outfoundation",
-    "outfullory",
-    "outglobalteen",
-    "outgroup",
-    "outhealth",
-    "outhistory",
-    "outhooding",
-    "outibleure",
-    "outimage",
-    "outinterest",
-    "outinternet",
-    "outkeyboard",
-    "outlead",
-    "outlearn",
-    "outlessen",
-    "outlevel",
-    "outlike",
-    "outlive",
-    "outmake",
-    "outmakeant",
-    "outmechanism",
-    "outmember",
-    "outment",
-    "outmicrophone",
-    "outmobile",
-    "outmoney",
-    "outmost",
-    "outmouse",
-    "outnation",
-    "outnationalen",
-    "outnaturalable",
-    "outnumber",
-    "outoperation",
-    "outorder",
-    "outorganization",
-    "outpaperer",
-    "outpart",
-    "outpath",
-    "outperson",
-    "outpersonalize",
-    "outplane",
-    "outplatform",
-    "outplay",
-    "outposition",
-    "outpower",
-    "outprinciple",
-    "outproblem",
-    "outprogram",
-    "outproject",
-    "outproperty",
-    "outprovideant",
-    "outroom",
-    "outscanner",
-    "outscience",
-    "outsensor",
-    "outservice",
-    "outsetcraft",
-    "outship",
-    "outsitible",
-    "outsitlike",
-    "outspecial",
-    "outstory",
-    "outstudent",
-    "outstudy",
-    "outsuggest",
-    "outtechnicalcraft",
-    "outtechnology",
-    "outtime",
-    "outtion",
-    "outtraining",
-    "outtransport",
-    "outtravel",
-    "outtreatment",
-    "outtruck",
-    "outusedom",
-    "outvalue",
-    "outwalk",
-    "outwatchth",
-    "outwater",
-    "outwear",
-    "outwebsite",
-    "outwhat",
-    "outwhereure",
-    "outwhichdom",
-    "outwoman",
-    "outwork",
-    "outworked",
-    "outworkment",
-    "outyear",
-    "overadapter",
-    "overalgorithm",
-    "overanalysis",
-    "overarchitecture",
-    "overask",
-    "overattribute",
-    "overaudio",
-    "overbattery",
-    "overbicycle",
-    "overboat",
-    "overbook",
-    "overbuild",
-    "overbusiness",
-    "overbuy",
-    "overcall",
-    "overcallen",
-    "overcamera",
-    "overcase",
-    "overcolor",
-    "overcomeent",
-    "overcompany",
-    "overcourse",
-    "overcreatecraft",
-    "overdieless",
-    "overdigital",
-    "overdocument",
-    "overeducationalty",
-    "overelement",
-    "overend",
-    "overengine",
-    "overequipment",
-    "overexpectment",
-    "overfollow",
-    "overglobalous",
-    "overgovernment",
-    "overgraphic",
-    "overhealth",
-    "overhistorical",
-    "overhistory",
-    "overhood",
-    "overimage",
-    "overinclude",
-    "overinstrument",
-    "overinternationaling",
-    "overjob",
-    "overknow",
-    "overlead",
-    "overlearn",
-    "overleave",
-    "overlight",
-    "overlocation",
-    "overmaintenance",
-    "overmanagement",
-    "overmaterial",
-    "overmeet",
-    "overmemory",
-    "overmethod",
-    "overmobile",
-    "overmoney",
-    "overmonitor",
-    "overmostic",
-    "overmouse",
-    "overmove",
-    "overname",
-    "overnation",
-    "overnational",
-    "overnaturalant",
-    "overnumber",
-    "overorder",
-    "overpackage",
-    "overpapersion",
-    "overperformance",
-    "overpick",
-    "overpickory",
-    "overplan",
-    "overplane",
-    "overpolicy",
-    "overpower",
-    "overprice",
-    "overprinciple",
-    "overprocess",
-    "overprogram",
-    "overproperty",
-    "overpull",
-    "overraiseful",
-    "overremember",
-    "overreport",
-    "overreportteen",
-    "overrequire",
-    "overresistance",
-    "overright",
-    "overscanner",
-    "overschool",
-    "overscience",
-    "overscreen",
-    "overseemhood",
-    "overservice",
-    "overside",
-    "oversionism",
-    "oversitous",
-    "oversocial",
-    "oversoftware",
-    "overspeakise",
-    "overspendsion",
-    "overstand",
-    "overstaysome",
-    "overstorage",
-    "overstructure",
-    "overtakedom",
-    "overtechnique",
-    "overtechnology",
-    "overtheory",
-    "overthing",
-    "overthink",
-    "overtime",
-    "overtionful",
-    "overtool",
-    "overtryous",
-    "overvariable",
-    "overvehicle",
-    "overvideo",
-    "overwalkdom",
-    "overwar",
-    "overwebsite",
-    "overweek",
-    "overwhere",
-    "overwin",
-    "overwoman",
-    "overwork",
-    "overyear",
-    "package",
-    "packageable",
-    "packagebattery",
-    "packagecraft",
-    "packagedevice",
-    "packagedom",
-    "packageest",
-    "packagefoundation",
-    "packagefy",
-    "packagegraphic",
-    "packagehood",
-    "packageible",
-    "packageic",
-    "packageive",
-    "packagely",
-    "packageory",
-    "packageprinter",
-    "packagereason",
-    "packagereport",
-    "packageship",
-    "packageshipping",
-    "packagesome",
-    "packagesupport",
-    "packagetheory",
-    "packagetion",
-    "packagety",
-    "paper",
-    "papered",
-    "paperen",
-    "paperest",
-    "paperful",
-    "paperhood",
-    "paperial",
-    "paperize",
-    "parameter",
-    "parameterage",
-    "parameterbasis",
-    "parameterdom",
-    "parametered",
-    "parameterelement",
-    "parameterer",
-    "parameterful",
-    "parameterimage",
-    "parameterinnovation",
-    "parameterinstrument",
-    "parameterism",
-    "parameterive",
-    "parameterjob",
-    "parameterless",
-    "parameterlike",
-    "parametermonitor",
-    "parameterory",
-    "parameterpath",
-    "parameterpoint",
-    "parameterprocedure",
-    "parameterprocess",
-    "parametersion",
-    "parameterspecial",
-    "parametertext",
-    "parametertravel",
-    "parameterure",
-    "parametervideo",
-    "parameterwise",
-    "part",
-    "partarchitecture",
-    "partbasis",
-    "partcar",
-    "parted",
-    "partelectricity",
-    "parter",
-    "partfy",
-    "parthand",
-    "parthome",
-    "partial",
-    "partible",
-    "partize",
-    "partless",
-    "partmobile",
-    "partmotor",
-    "partprice",
-    "partright",
-    "partsome",
-    "partstudent",
-    "parttravel",
-    "parttruck",
-    "parture",
-    "party",
-    "partyaddress",
-    "partyage",
-    "partyal",
-    "partyary",
-    "partyaudio",
-    "partycable",
-    "partycharger",
-    "partyed",
-    "partyelectricity",
-    "partyen",
-    "partyent",
-    "partyest",
-    "partyfold",
-    "partyfy",
-    "partyial",
-    "partyise",
-    "partyive",
-    "partyly",
-    "partymodel",
-    "partyory",
-    "partypublic",
-    "partyschool",
-    "partysolution",
-    "partyspace",
-    "partytransport",
-    "partyuniversity",
-    "partyure",
-    "partyvalue",
-    "partywise",
-    "pass",
-    "passory",
-    "path",
-    "pathal",
-    "pathapparatus",
-    "pathcharger",
-    "pathcolor",
-    "pathcurrent",
-    "pathdisplay",
-    "pathend",
-    "pathexperience",
-    "pathfeature",
-    "pathfuel",
-    "pathful",
-    "pathhood",
-    "pathise",
-    "pathite",
-    "pathkeyboard",
-    "pathmember",
-    "pathment",
-    "pathness",
-    "pathproperty",
-    "pathsome",
-    "pathstory",
-    "pathtransport",
-    "pathty",
-    "pathvehicle",
-    "pathwise",
-    "pattern",
-    "patternage",
-    "patternal",
-    "patterncircuit",
-    "patternent",
-    "patternexperience",
-    "patternhood",
-    "patterning",
-    "patternise",
-    "patternive",
-    "patternless",
-    "patternletter",
-    "patternlike",
-    "patternment",
-    "patternmouse",
-    "patternpeople",
-    "patternreport",
-    "patternscanner",
-    "patternship",
-    "patternspace",
-    "patternth",
-    "patterntion",
-    "patternward",
-    "patternwave",
-    "pay",
-    "paylike",
-    "payteen",
-    "people",
-    "peopleable",
-    "peopleant",
-    "peoplearchitecture",
-    "peoplebus",
-    "peopleconstant",
-    "peopleemail",
-    "peoplehood",
-    "peopleic",
-    "peopleinterest",
-    "peopleinterface",
-    "peopleise",
-    "peopleive",
-    "peoplemessage",
-    "peopleness",
-    "peopleous",
-    "peoplephone",
-    "peoplescience",
-    "peopleship",
-    "peoplestandard",
-    "peoplesystem",
-    "peopletechnique",
-    "peopletransport",
-    "peoplewave",
-    "performance",
-    "performanceable",
-    "performancearea",
-    "performanceday",
-    "performanceeducation",
-    "performanceen",
-    "performancefold",
-    "performancefy",
-    "performanceial",
-    "performanceism",
-    "performanceite",
-    "performanceive",
-    "performanceless",
-    "performancely",
-    "performancemember",
-    "performancement",
-    "performanceory",
-    "performanceperson",
-    "performanceresult",
-    "performanceship",
-    "performancesion",
-    "performancesoftware",
-    "performancetext",
-    "performancevoltage",
-    "performancewise",
-    "person",
-    "personal",
-    "personalable",
-    "personalage",
-    "personalite",
-    "personalth",
-    "personalty",
-    "personalwise",
-    "personary",
-    "personboat",
-    "personcraft",
-    "persondelivery",
-    "persondom",
-    "personengine",
-    "personest",
-    "personexperience",
-    "personfy",
-    "personhood",
-    "personial",
-    "personible",
-    "personinterface",
-    "personise",
-    "personism",
-    "personist",
-    "personline",
-    "personly",
-    "personmachine",
-    "personmaterial",
-    "personmechanism",
-    "personmember",
-    "personmicrophone",
-    "personness",
-    "personory",
-    "personplan",
-    "personside",
-    "personsion",
-    "personsociety",
-    "persontion",
-    "persontool",
-    "persontrade",
-    "persontravel",
-    "personward",
-    "phone",
-    "phoneable",
-    "phoneary",
-    "phonebook",
-    "phonecolor",
-    "phonedatabase",
-    "phoneer",
-    "phonefact",
-    "phonegovernment",
-    "phoneible",
-    "phoneic",
-    "phoneorder",
-    "phonepoint",
-    "phoneprinter",
-    "phoneproductivity",
-    "phoneresearch",
-    "phoneschool",
-    "phoneship",
-    "phonestate",
-    "phonestorage",
-    "phonety",
-    "phoneway",
-    "photo",
-    "photoal",
-    "photocraft",
-    "photodirectory",
-    "photoent",
-    "photoer",
-    "photofold",
-    "photofunction",
-    "photofy",
-    "photogroup",
-    "photoible",
-    "photoic",
-    "photoing",
-    "photoise",
-    "photoism",
-    "photoist",
-    "photojob",
-    "photoletter",
-    "photolevel",
-    "photomaterial",
-    "photomechanism",
-    "photomobile",
-    "photomotorcycle",
-    "photonation",
-    "photoory",
-    "photoroom",
-    "photoservice",
-    "photosome",
-    "photostory",
-    "phototeen",
-    "phototion",
-    "phototy",
-    "photowise",
-    "photoworld",
-    "pick",
-    "pickal",
-    "picked",
-    "pickhood",
-    "pickless",
-    "pickty",
-    "picture",
-    "pictureage",
-    "pictureal",
-    "pictureant",
-    "pictureapparatus",
-    "picturecomponent",
-    "pictureed",
-    "pictureen",
-    "pictureer",
-    "pictureest",
-    "picturefrequency",
-    "pictureful",
-    "picturegraphic",
-    "pictureial",
-    "pictureible",
-    "pictureinnovation",
-    "pictureise",
-    "pictureism",
-    "pictureive",
-    "pictureless",
-    "picturelocation",
-    "picturely",
-    "picturemusic",
-    "pictureness",
-    "pictureposition",
-    "picturepower",
-    "picturequality",
-    "pictureradiation",
-    "pictureresult",
-    "picturesome",
-    "pictureteen",
-    "picturetheory",
-    "picturewise",
-    "place",
-    "placeactivity",
-    "placeary",
-    "placeaudio",
-    "placeboat",
-    "placecharacteristic",
-    "placecharger",
-    "placecomputer",
-    "placecraft",
-    "placedom",
-    "placeequipment",
-    "placeest",
-    "placefy",
-    "placeial",
-    "placeic",
-    "placeinterface",
-    "placeism",
-    "placelike",
-    "placemotor",
-    "placeous",
-    "placeprocedure",
-    "placeright",
-    "placeth",
-    "placety",
-    "placeure",
-    "placeweek",
-    "plan",
-    "plancharger",
-    "plandocumentation",
-    "plane",
-    "planeage",
-    "planeapparatus",
-    "planechild",
-    "planed",
-    "planedevelopment",
-    "planeen",
-    "planeexample",
-    "planefold",
-    "planegovernment",
-    "planeheadphone",
-    "planehood",
-    "planeimplementation",
-    "planeise",
-    "planeist",
-    "planelevel",
-    "planemechanism",
-    "planement",
-    "planen",
-    "planeparameter",
-    "planeposition",
-    "planeprocess",
-    "planeproject",
-    "planer",
-    "planesome",
-    "planest",
-    "planeward",
-    "planewise",
-    "planhood",
-    "planial",
-    "planist",
-    "planize",
-    "planory",
-    "planous",
-    "planradiation",
-    "planresistance",
-    "planship",
-    "plansion",
-    "plansome",
-    "planspace",
-    "planspeaker",
-    "planteen",
-    "planth",
-    "plantruck",
-    "planvoltage",
-    "planwork",
-    "platform",
-    "platformal",
-    "platformant",
-    "platformarchitecture",
-    "platformbattery",
-    "platformcar",
-    "platformcomponent",
-    "platformdesign",
-    "platformdom",
-    "platformed",
-    "platformend",
-    "platformer",
-    "platformest",
-    "platformfoundation",
-    "platformfuel",
-    "platformhistory",
-    "platforminformation",
-    "platformize",
-    "platformmodel",
-    "platformness",
-    "platformous",
-    "platformpath",
-    "platformperformance",
-    "platformpoint",
-    "platformship",
-    "platformteen",
-    "play",
-    "playable",
-    "played",
-    "playic",
-    "playlike",
-    "playship",
-    "point",
-    "pointable",
-    "pointage",
-    "pointant",
-    "pointapplication",
-    "pointcase",
-    "pointcountry",
-    "pointdom",
-    "pointed",
-    "pointen",
-    "pointenergy",
-    "pointent",
-    "pointest",
-    "pointfold",
-    "pointfolder",
-    "pointgovernment",
-    "pointhood",
-    "pointic",
-    "pointinternet",
-    "pointive",
-    "pointize",
-    "pointlife",
-    "pointposition",
-    "pointpublic",
-    "pointship",
-    "pointsignal",
-    "pointsion",
-    "pointsomething",
-    "pointterm",
-    "pointtion",
-    "pointtravel",
-    "pointward",
-    "pointwebsite",
-    "policy",
-    "policycourse",
-    "policyen",
-    "policyest",
-    "policyfile",
-    "policyfrequency",
-    "policygrowth",
-    "policyhistory",
-    "policyhood",
-    "policyial",
-    "policyic",
-    "policying",
-    "policyjob",
-    "policymethod",
-    "policyory",
-    "policysome",
-    "policystorage",
-    "policytion",
-    "policytreatment",
-    "political",
-    "politicalable",
-    "politicalcraft",
-    "politicalible",
-    "politicaling",
-    "politicalory",
-    "politicalous",
-    "politicalship",
-    "politicalth",
-    "politicaltion",
-    "politicalwise",
-    "position",
-    "positionalgorithm",
-    "positionbattery",
-    "positionbook",
-    "positionbusiness",
-    "positionconnector",
-    "positionframework",
-    "positiongraphic",
-    "positionise",
-    "positionism",
-    "positionist",
-    "positionive",
-    "positionly",
-    "positionpeople",
-    "positionphone",
-    "positionproblem",
-    "positionproject",
-    "positionsignal",
-    "positionsome",
-    "power",
-    "poweraction",
-    "poweradapter",
-    "powerage",
-    "powerapproach",
-    "powerary",
-    "poweraudio",
-    "powerbus",
-    "powerbusiness",
-    "powercharger",
-    "powercolor",
-    "powercountry",
-    "powercourse",
-    "powerdesign",
-    "powered",
-    "powereducation",
-    "powerfold",
-    "powerfolder",
-    "powerfunction",
-    "powerfy",
-    "powerhand",
-    "powerhood",
-    "powerible",
-    "powerimage",
-    "powerise",
-    "powerize",
-    "powerlife",
-    "powerlight",
-    "powerlike",
-    "powermember",
-    "powernation",
-    "powerness",
-    "powerory",
-    "powerpath",
-    "powerproductivity",
-    "powerproject",
-    "powerreport",
-    "powerschool",
-    "powership",
-    "powerside",
-    "powerspeaker",
-    "powerstudy",
-    "powertheory",
-    "powertime",
-    "powertool",
-    "powerty",
-    "powerure",
-    "powerwar",
-    "powerward",
-    "powerwise",
-    "powerword",
-    "preaction",
-    "prealgorithm",
-    "preallowible",
-    "prearea",
-    "prebattery",
-    "prebreak",
-    "prebreakty",
-    "prebuildless",
-    "prebusiness",
-    "precamera",
-    "prechangeive",
-    "prechild",
-    "precompany",
-    "preconnector",
-    "preconstant",
-    "precreate",
-    "preculturalful",
-    "predevelopment",
-    "predigitaldom",
-    "preeducation",
-    "preefficiency",
-    "preelectricity",
-    "preengine",
-    "preequipment",
-    "preexample",
-    "preexperience",
-    "prefact",
-    "prefeeler",
-    "prefindsome",
-    "preframework",
-    "prehome",
-    "preimplementation",
-    "preinstrument",
-    "preinterest",
-    "preinterface",
-    "prelearn",
-    "preleave",
-    "prelevel",
-    "preliveful",
-    "preliveize",
-    "prelocalable",
-    "prelocalward",
-    "prelose",
-    "preloseive",
-    "preloveal",
-    "premaintenance",
-    "premechanism",
-    "premost",
-    "premouse",
-    "premove",
-    "prenationalen",
-    "prenetwork",
-    "prenumber",
-    "preoperation",
-    "prepart",
-    "prepath",
-    "prepayless",
-    "prepeople",
-    "preplace",
-    "preplatform",
-    "prepower",
-    "preprice",
-    "preproblem",
-    "preprocedure",
-    "preproductivity",
-    "preprofessional",
-    "preprovide",
-    "preprovidely",
-    "prepublic",
-    "prequality",
-    "preread",
-    "preremainhood",
-    "prereportness",
-    "preright",
-    "prescientific",
-    "presecurity",
-    "preseem",
-    "presell",
-    "presendial",
-    "presendly",
-    "preservice",
-    "preset",
-    "presetful",
-    "preshipping",
-    "presitist",
-    "presocial",
-    "presolution",
-    "presomething",
-    "presound",
-    "prespeak",
-    "prespeakless",
-    "prespecial",
-    "prestopness",
-    "prestopty",
-    "prestory",
-    "prestructure",
-    "prestudent",
-    "presystem",
-    "pretell",
-    "preterm",
-    "pretime",
-    "pretrade",
-    "pretrain",
-    "pretravel",
-    "pretreatment",
-    "pretruck",
-    "prevideo",
-    "prevoltage",
-    "prewalkship",
-    "prewar",
-    "prewatch",
-    "prewave",
-    "prewear",
-    "prewhen",
-    "prewhereial",
-    "prewhich",
-    "prework",
-    "price",
-    "pricebus",
-    "pricecolor",
-    "pricedom",
-    "pricefold",
-    "priceframework",
-    "priceheadphone",
-    "priceise",
-    "pricemanagement",
-    "pricemobile",
-    "priceory",
-    "priceous",
-    "pricepeople",
-    "priceship",
-    "pricesome",
-    "priceteen",
-    "priceth",
-    "pricety",
-    "pricevoltage",
-    "principle",
-    "principleant",
-    "principleaudio",
-    "principlebattery",
-    "principlebook",
-    "principlecraft",
-    "principleed",
-    "principleequipment",
-    "principleest",
-    "principlehood",
-    "principleing",
-    "principleite",
-    "principleive",
-    "principleize",
-    "principlekeyboard",
-    "principlelight",
-    "principlelocation",
-    "principleparty",
-    "principleprocedure",
-    "principlequality",
-    "principleterm",
-    "principletion",
-    "principletreatment",
-    "principlety",
-    "printer",
-    "printerage",
-    "printeral",
-    "printerapparatus",
-    "printercolor",
-    "printercompany",
-    "printercraft",
-    "printerdom",
-    "printergovernment",
-    "printerible",
-    "printeric",
-    "printerise",
-    "printerite",
-    "printerize",
-    "printerkeyboard",
-    "printerless",
-    "printerlike",
-    "printerpath",
-    "printerproject",
-    "printerproperty",
-    "printerscreen",
-    "printersensor",
-    "printertechnique",
-    "printerteen",
-    "printervoltage",
-    "printerwise",
-    "problem",
-    "problemant",
-    "problemary",
-    "problemcable",
-    "problemcar",
-    "problemed",
-    "problemen",
-    "problemenergy",
-    "problemgraphic",
-    "problemhand",
-    "problemial",
-    "problemic",
-    "probleminformation",
-    "probleming",
-    "problemjob",
-    "problemname",
-    "problemness",
-    "problemory",
-    "problemprinter",
-    "problemresearch",
-    "problemschool",
-    "problemsociety",
-    "problemsoftware",
-    "problemteen",
-    "problemthing",
-    "problemuniversity",
-    "problemure",
-    "procedure",
-    "procedureage",
-    "procedureconnector",
-    "proceduredom",
-    "procedureest",
-    "procedurefeature",
-    "procedurefold",
-    "procedureful",
-    "procedurehood",
-    "procedureial",
-    "procedureinstrument",
-    "procedurelike",
-    "proceduremouse",
-    "procedurepower",
-    "procedureship",
-    "proceduresion",
-    "proceduresupport",
-    "procedureteen",
-    "procedureth",
-    "proceduretion",
-    "proceduretool",
-    "proceduretransport",
-    "procedureure",
-    "procedurewise",
-    "process",
-    "processage",
-    "processant",
-    "processchild",
-    "processen",
-    "processfy",
-    "processinterest",
-    "processist",
-    "processly",
-    "processmarket",
-    "processmessage",
-    "processor",
-    "processoradapter",
-    "processorbicycle",
-    "processorder",
-    "processordom",
-    "processored",
-    "processorent",
-    "processorer",
-    "processorfy",
-    "processorible",
-    "processorite",
-    "processorlevel",
-    "processorlike",
-    "processororder",
-    "processorpublic",
-    "processorscience",
-    "processorsensor",
-    "processorsociety",
-    "processorterm",
-    "processorth",
-    "processortool",
-    "processorty",
-    "processorvoltage",
-    "processorwise",
-    "processoryoung",
-    "processplane",
-    "processprinter",
-    "processresearch",
-    "processsome",
-    "processtion",
-    "processty",
-    "processward",
-    "processwise",
-    "productivity",
-    "productivitydelivery",
-    "productivityer",
-    "productivityful",
-    "productivityise",
-    "productivityite",
-    "productivityize",
-    "productivityly",
-    "productivitypicture",
-    "productivitypolicy",
-    "productivitysion",
-    "productivitysystem",
-    "productivityth",
-    "productivitything",
-    "productivitywise",
-    "professional",
-    "professionaler",
-    "professionalial",
-    "professionalize",
-    "professionalous",
-    "professionalth",
-    "program",
-    "programage",
-    "programal",
-    "programary",
-    "programbus",
-    "programcraft",
-    "programdocumentation",
-    "programdom",
-    "programen",
-    "programer",
-    "programfamily",
-    "programhistory",
-    "programial",
-    "programite",
-    "programless",
-    "programlevel",
-    "programmessage",
-    "programmusic",
-    "programness",
-    "programory",
-    "programous",
-    "programresearch",
-    "programscreen",
-    "programship",
-    "programsociety",
-    "programstory",
-    "programteen",
-    "programty",
-    "programway",
-    "programwise",
-    "project",
-    "projectary",
-    "projectbasis",
-    "projectbus",
-    "projectefficiency",
-    "projectelement",
-    "projectent",
-    "projecter",
-    "projecthood",
-    "projectize",
-    "projectmaintenance",
-    "projectment",
-    "projectmotor",
-    "projectness",
-    "projectside",
-    "projectsystem",
-    "projectteen",
-    "projecttion",
-    "property",
-    "propertyaddress",
-    "propertyboat",
-    "propertycamera",
-    "propertydatabase",
-    "propertydom",
-    "propertyelement",
-    "propertyequipment",
-    "propertyfeature",
-    "propertyfold",
-    "propertyfy",
-    "propertyhood",
-    "propertyic",
-    "propertying",
-    "propertyinnovation",
-    "propertyintegration",
-    "propertyise",
-    "propertyite",
-    "propertyive",
-    "propertyless",
-    "propertylike",
-    "propertyness",
-    "propertyory",
-    "propertyparameter",
-    "propertypath",
-    "propertypeople",
-    "propertyscience",
-    "propertysecurity",
-    "propertysion",
-    "propertystudy",
-    "propertytext",
-    "propertything",
-    "propertytion",
-    "propertyward",
-    "propertywise",
-    "protoaddress",
-    "protoaddty",
-    "protoapparatus",
-    "protoapplication",
-    "protobus",
-    "protobusiness",
-    "protocallite",
-    "protocharger",
-    "protochild",
-    "protocol",
-    "protocolage",
-    "protocolconnector",
-    "protocolcraft",
-    "protocolent",
-    "protocolest",
-    "protocolfold",
-    "protocolic",
-    "protocoling",
-    "protocolise",
-    "protocolive",
-    "protocolly",
-    "protocolmoney",
-    "protocolnature",
-    "protocolperson",
-    "protocolpoint",
-    "protocolsomething",
-    "protocolstructure",
-    "protocolth",
-    "protocoltion",
-    "protocolwise",
-    "protocomponent",
-    "protoconnector",
-    "protocontact",
-    "protocourse",
-    "protocreate",
-    "protocurrent",
-    "protodatabase",
-    "protodigital",
-    "protodirectory",
-    "protodisplay",
-    "protoeducation",
-    "protoefficiency",
-    "protoend",
-    "protoequipment",
-    "protoever",
-    "protofallwise",
-    "protofeel",
-    "protofinancial",
-    "protofinancialdom",
-    "protofollower",
-    "protofoundation",
-    "protogive",
-    "protogivehood",
-    "protoglobal",
-    "protographic",
-    "protogroup",
-    "protohand",
-    "protoheadphone",
-    "protointerface",
-    "protojob",
-    "protokeyboard",
-    "protolead",
-    "protoleave",
-    "protoleaveteen",
-    "protolevel",
-    "protoline",
-    "protolocation",
-    "protolook",
-    "protolose",
-    "protomake",
-    "protomeet",
-    "protomemory",
-    "protomentcraft",
-    "protomethod",
-    "protomicrophone",
-    "protomobile",
-    "protomotor",
-    "protomove",
-    "protomusic",
-    "protonation",
-    "protoness",
-    "protonetwork",
-    "protonews",
-    "protooffice",
-    "protooperation",
-    "protoorder",
-    "protoorganization",
-    "protoparameter",
-    "protoparty",
-    "protopeople",
-    "protoperson",
-    "protoplay",
-    "protopoliticalty",
-    "protoprocess",
-    "protoprocessor",
-    "protoprotocol",
-    "protopublic",
-    "protoreason",
-    "protoresult",
-    "protoscience",
-    "protoscientificdom",
-    "protoscientificward",
-    "protoseem",
-    "protosellly",
-    "protoshipping",
-    "protosignal",
-    "protosome",
-    "protosound",
-    "protospace",
-    "protospeaker",
-    "protostand",
-    "protostopcraft",
-    "protostory",
-    "protostrategy",
-    "protostructure",
-    "prototerm",
-    "protothink",
-    "protothinkfy",
-    "prototime",
-    "prototrade",
-    "prototreatment",
-    "protovoltage",
-    "protowant",
-    "protowatch",
-    "protowater",
-    "protowave",
-    "protoway",
-    "protowear",
-    "protowebsite",
-    "protowhatteen",
-    "protowork",
-    "protowrite",
-    "protoyoung",
-    "provide",
-    "provideal",
-    "providedom",
-    "provideed",
-    "provideible",
-    "provideize",
-    "provideward",
-    "pseudoallower",
-    "pseudoapparatus",
-    "pseudoapplication",
-    "pseudoask",
-    "pseudoattribute",
-    "pseudoaudio",
-    "pseudobasis",
-    "pseudobicycle",
-    "pseudobuildic",
-    "pseudobus",
-    "pseudocamera",
-    "pseudocar",
-    "pseudocase",
-    "pseudochange",
-    "pseudocharger",
-    "pseudocolor",
-    "pseudocommunication",
-    "pseudoconcept",
-    "pseudoconnector",
-    "pseudoconstant",
-    "pseudocountry",
-    "pseudocourse",
-    "pseudocurrent",
-    "pseudodatabase",
-    "pseudodelivery",
-    "pseudodesign",
-    "pseudodie",
-    "pseudodocument",
-    "pseudoeducation",
-    "pseudoend",
-    "pseudoeverment",
-    "pseudoexample",
-    "pseudoexperience",
-    "pseudofact",
-    "pseudofeature",
-    "pseudofile",
-    "pseudofinancial",
-    "pseudofolder",
-    "pseudofoundation",
-    "pseudofunction",
-    "pseudogive",
-    "pseudographic",
-    "pseudogroup",
-    "pseudogrowen",
-    "pseudohappen",
-    "pseudohealth",
-    "pseudohistorical",
-    "pseudohistory",
-    "pseudohome",
-    "pseudoible",
-    "pseudoimage",
-    "pseudoimplementation",
-    "pseudoinclude",
-    "pseudoinformation",
-    "pseudoinnovation",
-    "pseudoinstrument",
-    "pseudointegration",
-    "pseudointernet",
-    "pseudoknowest",
-    "pseudolearn",
-    "pseudolikeize",
-    "pseudolocalant",
-    "pseudolosehood",
-    "pseudomaintenance",
-    "pseudomake",
-    "pseudomanagement",
-    "pseudomarket",
-    "pseudomechanism",
-    "pseudomember",
-    "pseudomessage",
-    "pseudomicrophone",
-    "pseudomoney",
-    "pseudomost",
-    "pseudoname",
-    "pseudonature",
-    "pseudonews",
-    "pseudooffice",
-    "pseudoopen",
-    "pseudooptimization",
-    "pseudoorder",
-    "pseudoorganization",
-    "pseudopass",
-    "pseudoperformance",
-    "pseudopersonal",
-    "pseudophone",
-    "pseudophoto",
-    "pseudopickite",
-    "pseudopicture",
-    "pseudoplan",
-    "pseudoplane",
-    "pseudoplay",
-    "pseudoplaysion",
-    "pseudopoint",
-    "pseudopolicy",
-    "pseudopolitical",
-    "pseudoposition",
-    "pseudoprice",
-    "pseudoprinciple",
-    "pseudoprocessor",
-    "pseudoproductivity",
-    "pseudoprogram",
-    "pseudoquality",
-    "pseudoradiation",
-    "pseudoraise",
-    "pseudoreach",
-    "pseudoreason",
-    "pseudoreport",
-    "pseudoresearch",
-    "pseudoresistance",
-    "pseudoright",
-    "pseudoscience",
-    "pseudoscreen",
-    "pseudosecurity",
-    "pseudoseemible",
-    "pseudosender",
-    "pseudoside",
-    "pseudosociety",
-    "pseudosoftware",
-    "pseudosome",
-    "pseudosometeen",
-    "pseudosomety",
-    "pseudosound",
-    "pseudospeak",
-    "pseudospecial",
-    "pseudospendible",
-    "pseudostorage",
-    "pseudostory",
-    "pseudosupport",
-    "pseudotakement",
-    "pseudotechnical",
-    "pseudotechnique",
-    "pseudoterm",
-    "pseudotheory",
-    "pseudotime",
-    "pseudotionise",
-    "pseudotool",
-    "pseudotransport",
-    "pseudotruck",
-    "pseudouniversity",
-    "pseudouse",
-    "pseudovalue",
-    "pseudovehicle",
-    "pseudowant",
-    "pseudoway",
-    "pseudoweek",
-    "pseudowhich",
-    "pseudowin",
-    "pseudoword",
-    "pseudowriteteen",
-    "pseudowritewise",
-    "pseudoyear",
-    "public",
-    "publicary",
-    "publicconcept",
-    "publicdom",
-    "publiced",
-    "publiceducation",
-    "publicen",
-    "publicent",
-    "publicfold",
-    "publichood",
-    "publicic",
-    "publicing",
-    "publicist",
-    "publicless",
-    "publicmarket",
-    "publicment",
-    "publicnation",
-    "publicous",
-    "publicsupport",
-    "publicteen",
-    "publicthing",
-    "publicty",
-    "publicweek",
-    "pull",
-    "pullage",
-    "pullest",
-    "pullist",
-    "pullous",
-    "pullth",
-    "pulltion",
-    "pullward",
-    "quality",
-    "qualitycraft",
-    "qualitydevice",
-    "qualitydom",
-    "qualityed",
-    "qualityent",
-    "qualityfold",
-    "qualityible",
-    "qualityist",
-    "qualityive",
-    "qualityless",
-    "qualityline",
-    "qualitymotor",
-    "qualitynation",
-    "qualityness",
-    "qualitynews",
-    "qualityplan",
-    "qualityship",
-    "qualitysome",
-    "qualityteen",
-    "qualityth",
-    "question",
-    "questionable",
-    "questional",
-    "questionant",
-    "questionary",
-    "questionattribute",
-    "questionconnector",
-    "questioncontact",
-    "questionen",
-    "questionfile",
-    "questionfold",
-    "questionfy",
-    "questionheadphone",
-    "questioninnovation",
-    "questionise",
-    "questionize",
-    "questionless",
-    "questionnature",
-    "questionorganization",
-    "questionpattern",
-    "questionperson",
-    "questionprogram",
-    "questionservice",
-    "questionship",
-    "questionshipping",
-    "questionsoftware",
-    "questionspecial",
-    "questionteen",
-    "questionth",
-    "questiontion",
-    "questiontrain",
-    "questiontraining",
-    "questiontravel",
-    "questionure",
-    "questionwise",
-    "radiation",
-    "radiationanalysis",
-    "radiationdocument",
-    "radiationent",
-    "radiationest",
-    "radiationhand",
-    "radiationinterface",
-    "radiationinternet",
-    "radiationlike",
-    "radiationmobile",
-    "radiationmoney",
-    "radiationnews",
-    "radiationpicture",
-    "radiationright",
-    "radiationship",
-    "radiationsignal",
-    "radiationstructure",
-    "radiationure",
-    "radiationward",
-    "radiationway",
-    "radiationwise",
-    "raise",
-    "raiseable",
-    "raiseest",
-    "raisefy",
-    "raiseous",
-    "reable",
-    "reach",
-    "reachal",
-    "reachfold",
-    "reachize",
-    "reachlike",
-    "reachwise",
-    "reaction",
-    "read",
-    "readable",
-    "readapter",
-    "readfold",
-    "readial",
-    "readth",
-    "readwise",
-    "realgorithm",
-    "reapplication",
-    "rearchitecture",
-    "reason",
-    "reasoncircuit",
-    "reasonen",
-    "reasonful",
-    "reasonfy",
-    "reasongrowth",
-    "reasoning",
-    "reasoninterface",
-    "reasonism",
-    "reasonize",
-    "reasonlight",
-    "reasonment",
-    "reasonside",
-    "reasonsion",
-    "reasonteen",
-    "reasontext",
-    "reasontime",
-    "reasonure",
-    "reasonyoung",
-    "rebasis",
-    "rebattery",
-    "rebook",
-    "rebreak",
-    "rebus",
-    "recar",
-    "recircuit",
-    "recolor",
-    "reconsider",
-    "recontact",
-    "recontroller",
-    "recourse",
-    "recreate",
-    "reculturalage",
-    "recurrent",
-    "redecide",
-    "redelivery",
-    "redocument",
-    "reeconomic",
-    "reeconomicen",
-    "reeducational",
-    "reelement",
-    "reengine",
-    "reequipment",
-    "reever",
-    "reexpect",
-    "reexperience",
-    "refeature",
-    "refoundation",
-    "regiveth",
-    "regrowsome",
-    "rehand",
-    "rehappen",
-    "rehealth",
-    "rehistory",
-    "rehouse",
-    "reibleteen",
-    "reimage",
-    "reinternet",
-    "rejob",
-    "rekilled",
-    "releadwise",
-    "releave",
-    "relife",
-    "relight",
-    "relocalcraft",
-    "remain",
-    "remaindom",
-    "remainial",
-    "remainise",
-    "remainism",
-    "remanagement",
-    "remechanism",
-    "remedicalfold",
-    "remember",
-    "rememberdom",
-    "rememberise",
-    "rememberist",
-    "rememberite",
-    "remembersion",
-    "rementing",
-    "remessage",
-    "remethod",
-    "remobile",
-    "remodel",
-    "remotor",
-    "remusic",
-    "renews",
-    "renumber",
-    "reopenless",
-    "repath",
-    "repeople",
-    "rephoto",
-    "replatform",
-    "replaysion",
-    "replayteen",
-    "repoint",
-    "repolicy",
-    "report",
-    "reportable",
-    "reportage",
-    "reportant",
-    "reportbus",
-    "reportcraft",
-    "reporten",
-    "reporter",
-    "reportfact",
-    "reportfeature",
-    "reportful",
-    "reportist",
-    "reportite",
-    "reportize",
-    "reportmanagement",
-    "reportment",
-    "reportmodel",
-    "reportness",
-    "reportory",
-    "reportpeople",
-    "reportresistance",
-    "reportship",
-    "reportteen",
-    "reportthing",
-    "reportty",
-    "reportwise",
-    "reposition",
-    "repower",
-    "reprice",
-    "reprinciple",
-    "reproblem",
-    "reprocess",
-    "reprogram",
-    "reprovide",
-    "reprovideant",
-    "republic",
-    "repull",
-    "requestion",
-    "require",
-    "requiredom",
-    "requireful",
-    "requireial",
-    "requireless",
-    "requirely",
-    "requireous",
-    "requiretion",
-    "requireward",
-    "reradiation",
-    "rereport",
-    "rerequire",
-    "reresearch",
-    "reresource",
-    "rescanner",
-    "rescience",
-    "research",
-    "researchage",
-    "researchapplication",
-    "researchcraft",
-    "researchelement",
-    "researchent",
-    "researcher",
-    "researchfoundation",
-    "researchhome",
-    "researchhood",
-    "researchial",
-    "researchic",
-    "researchite",
-    "researchly",
-    "researchmotorcycle",
-    "researchory",
-    "researchparty",
-    "researchstructure",
-    "researchteen",
-    "researchtransport",
-    "researchvehicle",
-    "researchward",
-    "researchwave",
-    "resecurity",
-    "resell",
-    "resendary",
-    "reserveous",
-    "reship",
-    "reside",
-    "resistance",
-    "resistancealgorithm",
-    "resistanceen",
-    "resistanceer",
-    "resistanceest",
-    "resistancefeature",
-    "resistanceible",
-    "resistanceism",
-    "resistanceous",
-    "resistancepart",
-    "resistancesignal",
-    "resistanceteen",
-    "resistancetion",
-    "resistancetrade",
-    "resistancety",
-    "resocialtion",
-    "resociety",
-    "resolution",
-    "resource",
-    "resourcebusiness",
-    "resourceen",
-    "resourceend",
-    "resourceent",
-    "resourceer",
-    "resourceful",
-    "resourcegraphic",
-    "resourceheadphone",
-    "resourceible",
-    "resourceive",
-    "resourcenature",
-    "resourcestate",
-    "resourceth",
-    "resourcetruck",
-    "resourcety",
-    "respace",
-    "respeak",
-    "respecial",
-    "restrategy",
-    "restructure",
-    "restudent",
-    "result",
-    "resultcase",
-    "resultdelivery",
-    "resultdesign",
-    "resultdisplay",
-    "resulted",
-    "resulten",
-    "resultfolder",
-    "resultful",
-    "resulthistory",
-    "resultism",
-    "resultist",
-    "resultite",
-    "resultive",
-    "resultize",
-    "resultless",
-    "resultlevel",
-    "resultous",
-    "resultpattern",
-    "resultperson",
-    "resultphoto",
-    "resultproblem",
-    "resultprocessor",
-    "resultpublic",
-    "resultresult",
-    "resultschool",
-    "resultstorage",
-    "resultsupport",
-    "resultth",
-    "resulture",
-    "resultyoung",
-    "resystem",
-    "reterm",
-    "rething",
-    "retion",
-    "retool",
-    "retrain",
-    "retraining",
-    "retreatment",
-    "reunderstand",
-    "reuniversity",
-    "reusewise",
-    "rewait",
-    "rewalkship",
-    "rewar",
-    "rewave",
-    "rewear",
-    "rewhich",
-    "rewise",
-    "reword",
-    "reyear",
-    "reyoung",
-    "right",
-    "rightable",
-    "rightbook",
-    "rightcraft",
-    "rightdom",
-    "rightgrowth",
-    "rightism",
-    "rightive",
-    "rightkeyboard",
-    "rightletter",
-    "rightlike",
-    "rightlocation",
-    "rightmachine",
-    "rightment",
-    "rightnation",
-    "rightorganization",
-    "rightory",
-    "rightpicture",
-    "rightplane",
-    "rightprogram",
-    "rightship",
-    "rightsion",
-    "rightsystem",
-    "rightteen",
-    "rightweek",
-    "room",
-    "roomal",
-    "roomed",
-    "roomfact",
-    "roomfy",
-    "roomial",
-    "rooming",
-    "roomism",
-    "roomive",
-    "roomlife",
-    "roomlocation",
-    "roomly",
-    "roomment",
-    "roommonitor",
-    "roomparty",
-    "roomprogram",
-    "roomreport",
-    "roomsion",
-    "roomsolution",
-    "roomsupport",
-    "roomterm",
-    "scanner",
-    "scannerage",
-    "scanneralgorithm",
-    "scannerapproach",
-    "scannerary",
-    "scannereducation",
-    "scanneren",
-    "scannerer",
-    "scannerfold",
-    "scannerfrequency",
-    "scanneric",
-    "scannerite",
-    "scannerless",
-    "scannerment",
-    "scannerquestion",
-    "scannerradiation",
-    "scannerroom",
-    "scannersociety",
-    "scannersome",
-    "scannerspeaker",
-    "scannerstrategy",
-    "scannerth",
-    "scannertion",
-    "scannerty",
-    "scannerure",
-    "scannervariable",
-    "scannerwise",
-    "scannerword",
-    "school",
-    "schoolable",
-    "schoolal",
-    "schoolalgorithm",
-    "schooldirectory",
-    "schoolial",
-    "schoolinternet",
-    "schoolist",
-    "schoolite",
-    "schoollike",
-    "schoolmobile",
-    "schoolnetwork",
-    "schoolnumber",
-    "schoolprocedure",
-    "schoolreport",
-    "schoolservice",
-    "schoolteen",
-    "schoolward",
-    "science",
-    "scienceary",
-    "sciencedirectory",
-    "scienceelectricity",
-    "scienceen",
-    "sciencefold",
-    "sciencefuel",
-    "scienceful",
-    "sciencefunction",
-    "sciencegovernment",
-    "sciencehood",
-    "scienceial",
-    "scienceic",
-    "scienceing",
-    "scienceintegration",
-    "scienceism",
-    "sciencemachine",
-    "sciencemonitor",
-    "scienceous",
-    "sciencestate",
-    "sciencestudy",
-    "scienceth",
-    "scienceyear",
-    "scientific",
-    "scientificfold",
-    "scientificism",
-    "scientificlike",
-    "scientificment",
-    "screen",
-    "screenaddress",
-    "screenary",
-    "screenbasis",
-    "screencamera",
-    "screencharger",
-    "screenconcept",
-    "screencraft",
-    "screenday",
-    "screenframework",
-    "screenful",
-    "screenible",
-    "screenism",
-    "screenite",
-    "screenness",
-    "screenory",
-    "screentext",
-    "screentheory",
-    "screentraining",
-    "security",
-    "securityary",
-    "securityed",
-    "securityfy",
-    "securitygroup",
-    "securityible",
-    "securityinformation",
-    "securitying",
-    "securitylight",
-    "securitymanagement",
-    "securityness",
-    "securitypoint",
-    "securityprocess",
-    "securitysion",
-    "securitysociety",
-    "securityspace",
-    "securityteen",
-    "securityty",
-    "seem",
-    "seemant",
-    "seemed",
-    "seemer",
-    "seemful",
-    "seemfy",
-    "seemise",
-    "seemness",
-    "seemory",
-    "seemure",
-    "sell",
-    "sellal",
-    "sellful",
-    "semiable",
-    "semiadapter",
-    "semiaddress",
-    "semiapplication",
-    "semiarea",
-    "semibasis",
-    "semibicycle",
-    "semibook",
-    "semibusiness",
-    "semibuy",
-    "semicable",
-    "semichangewise",
-    "semicolor",
-    "semicommunication",
-    "semicomputer",
-    "semiconcept",
-    "semicontact",
-    "semicontinue",
-    "semicontinuetion",
-    "semicourse",
-    "semidatabase",
-    "semidelivery",
-    "semidesign",
-    "semiefficiency",
-    "semielement",
-    "semienergy",
-    "semieveren",
-    "semiexample",
-    "semiexpect",
-    "semifile",
-    "semifind",
-    "semifolder",
-    "semiframework",
-    "semifullful",
-    "semigiveant",
-    "semigrowth",
-    "semihand",
-    "semiheadphone",
-    "semihistory",
-    "semiimage",
-    "semiimplementation",
-    "semiinstrument",
-    "semiinterest",
-    "semiinternet",
-    "semikeyboard",
-    "semileave",
-    "semilevel",
-    "semilookless",
-    "semimaintenance",
-    "semimechanism",
-    "semimedicalest",
-    "semimemory",
-    "semimicrophone",
-    "semimonitor",
-    "semimouse",
-    "semioptimization",
-    "semiorganization",
-    "semiparty",
-    "semipass",
-    "semipath",
-    "semipeople",
-    "semipick",
-    "semipicture",
-    "semiplace",
-    "semiplatform",
-    "semipower",
-    "semiprocedure",
-    "semiproductivity",
-    "semiprogram",
-    "semiproject",
-    "semiquality",
-    "semireason",
-    "semireport",
-    "semiresistance",
-    "semiresource",
-    "semiright",
-    "semiroom",
-    "semisetage",
-    "semiship",
-    "semishipest",
-    "semisignal",
-    "semisociety",
-    "semisoftware",
-    "semisome",
-    "semisomething",
-    "semispace",
-    "semispeaker",
-    "semispend",
-    "semistate",
-    "semistorage",
-    "semistudy",
-    "semisupport",
-    "semiterm",
-    "semithing",
-    "semitrain",
-    "semitravel",
-    "semitruck",
-    "semitry",
-    "semiuniversity",
-    "semivalue",
-    "semivariable",
-    "semivehicle",
-    "semivoltage",
-    "semiwaittion",
-    "semiwantlike",
-    "semiwatch",
-    "semiwatching",
-    "semiwearible",
-    "semiwhatent",
-    "semiworld",
-    "send",
-    "senden",
-    "sendlike",
-    "sendly",
-    "sendwise",
-    "sensor",
-    "sensorcraft",
-    "sensorelement",
-    "sensorexperience",
-    "sensorfold",
-    "sensorial",
-    "sensorible",
-    "sensorinformation",
-    "sensorkeyboard",
-    "sensorlocation",
-    "sensormaintenance",
-    "sensormoney",
-    "sensornation",
-    "sensorperson",
-    "sensorpicture",
-    "sensorprocedure",
-    "sensorresource",
-    "sensorsecurity",
-    "sensortechnique",
-    "sensortheory",
-    "sensorvehicle",
-    "serve",
-    "serveal",
-    "serveise",
-    "serveism",
-    "serveless",
-    "servement",
-    "serveory",
-    "service",
-    "servicearea",
-    "servicecable",
-    "servicecomputer",
-    "servicedocumentation",
-    "servicedom",
-    "serviceent",
-    "serviceest",
-    "serviceheadphone",
-    "serviceible",
-    "serviceism",
-    "servicelike",
-    "serviceprice",
-    "serviceprinciple",
-    "serviceschool",
-    "serviceship",
-    "servicespace",
-    "servicestudent",
-    "servicetion",
-    "serviceway",
-    "serviceword",
-    "set",
-    "seten",
-    "setlike",
-    "setness",
-    "ship",
-    "shipal",
-    "shipary",
-    "shipcomponent",
-    "shipcountry",
-    "shiped",
-    "shipent",
-    "shiper",
-    "shipfolder",
-    "shipfuel",
-    "shipful",
-    "shipheadphone",
-    "shipial",
-    "shipic",
-    "shipinformation",
-    "shiping",
-    "shipive",
-    "shipize",
-    "shiplike",
-    "shiply",
-    "shipnation",
-    "shipnature",
-    "shipness",
-    "shipping",
-    "shippingable",
-    "shippingcircuit",
-    "shippingcurrent",
-    "shippinged",
-    "shippingest",
-    "shippinggrowth",
-    "shippingist",
-    "shippingive",
-    "shippingless",
-    "shippingly",
-    "shippingpackage",
-    "shippingparty",
-    "shippingpattern",
-    "shippingphone",
-    "shippingquality",
-    "shippingresource",
-    "shippingscreen",
-    "shippingsensor",
-    "shippingsystem",
-    "shippingtion",
-    "shippingwar",
-    "shippingward",
-    "shippingwater",
-    "shippingwise",
-    "shipprocess",
-    "shipreport",
-    "shipship",
-    "shiptheory",
-    "shiptravel",
-    "shipwoman",
-    "side",
-    "sideage",
-    "sideal",
-    "sidearchitecture",
-    "sideattribute",
-    "sidecraft",
-    "sidedom",
-    "sidefoundation",
-    "sidefy",
-    "sidegrowth",
-    "sidehood",
-    "sideive",
-    "sideize",
-    "sidemaintenance",
-    "sideness",
-    "sideory",
-    "sideplan",
-    "sideproblem",
-    "sidereason",
-    "sidesolution",
-    "sidespeaker",
-    "sideth",
-    "sidety",
-    "sidevalue",
-    "sidewebsite",
-    "signal",
-    "signalal",
-    "signalapplication",
-    "signalarchitecture",
-    "signalcamera",
-    "signalent",
-    "signalful",
-    "signalgraphic",
-    "signalheadphone",
-    "signalic",
-    "signalise",
-    "signalism",
-    "signalive",
-    "signalmemory",
-    "signalous",
-    "signalpoint",
-    "signalresearch",
-    "signalroom",
-    "signalspecial",
-    "signalwater",
-    "sion",
-    "sionfy",
-    "sionhood",
-    "sionize",
-    "sionly",
-    "sionwise",
-    "sit",
-    "sitable",
-    "siten",
-    "sitic",
-    "sitise",
-    "sitist",
-    "sitite",
-    "sitment",
-    "social",
-    "socialfy",
-    "socialism",
-    "socialive",
-    "socialless",
-    "socially",
-    "socialment",
-    "society",
-    "societyal",
-    "societyarea",
-    "societycomputer",
-    "societyed",
-    "societyent",
-    "societyfold",
-    "societyful",
-    "societyhood",
-    "societyial",
-    "societyible",
-    "societyinternet",
-    "societyist",
-    "societyjob",
-    "societyless",
-    "societyory",
-    "societyous",
-    "societyplace",
-    "societyquestion",
-    "societyresource",
-    "societyschool",
-    "societyservice",
-    "societyship",
-    "societytechnique",
-    "societytheory",
-    "societytion",
-    "societyure",
-    "software",
-    "softwareary",
-    "softwareconstant",
-    "softwarecontroller",
-    "softwareed",
-    "softwareen",
-    "softwareent",
-    "softwareer",
-    "softwareexperience",
-    "softwarehome",
-    "softwareial",
-    "softwareible",
-    "softwareise",
-    "softwareite",
-    "softwarement",
-    "softwareness",
-    "softwareoffice",
-    "softwarepicture",
-    "softwareroom",
-    "softwareship",
-    "softwaresound",
-    "softwarestandard",
-    "softwareteen",
-    "softwaretransport",
-    "solution",
-    "solutionant",
-    "solutionbattery",
-    "solutioncomputer",
-    "solutionfile",
-    "solutionful",
-    "solutionfy",
-    "solutionhome",
-    "solutionible",
-    "solutionic",
-    "solutionist",
-    "solutionive",
-    "solutionment",
-    "solutionoffice",
-    "solutionperson",
-    "solutionsensor",
-    "solutionservice",
-    "solutionsion",
-    "solutionteen",
-    "solutionterm",
-    "solutiontraining",
-    "solutionty",
-    "some",
-    "someant",
-    "someed",
-    "someent",
-    "something",
-    "somethingcomputer",
-    "somethingconcept",
-    "somethingcourse",
-    "somethingdelivery",
-    "somethingeducation",
-    "somethinger",
-    "somethingest",
-    "somethingframework",
-    "somethingfy",
-    "somethinggovernment",
-    "somethingic",
-    "somethingmaterial",
-    "somethingory",
-    "somethingparty",
-    "somethingpath",
-    "somethingpower",
-    "somethingpublic",
-    "somethingschool",
-    "somethingstorage",
-    "sometion",
-    "sound",
-    "soundapplication",
-    "soundapproach",
-    "soundary",
-    "soundbicycle",
-    "soundcraft",
-    "sounded",
-    "sounden",
-    "soundequipment",
-    "soundest",
-    "soundfold",
-    "soundfoundation",
-    "soundgrowth",
-    "soundhand",
-    "soundible",
-    "soundinnovation",
-    "soundise",
-    "soundite",
-    "soundive",
-    "soundize",
-    "soundmaintenance",
-    "soundmechanism",
-    "soundnetwork",
-    "soundory",
-    "soundous",
-    "soundprinter",
-    "soundresistance",
-    "soundsion",
-    "soundstandard",
-    "soundtechnology",
-    "soundth",
-    "soundtion",
-    "soundtrade",
-    "space",
-    "spaceage",
-    "spaceal",
-    "spacecamera",
-    "spacecar",
-    "spacefile",
-    "spacefolder",
-    "spaceful",
-    "spacefy",
-    "spacehistory",
-    "spaceimage",
-    "spaceinterface",
-    "spaceise",
-    "spaceism",
-    "spaceletter",
-    "spacemouse",
-    "spaceprogram",
-    "spacesion",
-    "spacetheory",
-    "speak",
-    "speaker",
-    "speakercamera",
-    "speakercircuit",
-    "speakercountry",
-    "speakerday",
-    "speakerdocument",
-    "speakerdom",
-    "speakerent",
-    "speakerest",
-    "speakerfold",
-    "speakerfy",
-    "speakerhood",
-    "speakerletter",
-    "speakerlike",
-    "speakerpackage",
-    "speakerprocedure",
-    "speakerschool",
-    "speakersignal",
-    "speakersome",
-    "speakerspecial",
-    "speakertechnique",
-    "speakerweek",
-    "speakerwise",
-    "speakite",
-    "speakness",
-    "speaksome",
-    "speakty",
-    "special",
-    "specialactivity",
-    "specialapparatus",
-    "specialary",
-    "specialconnector",
-    "specialday",
-    "specialemail",
-    "specialfy",
-    "specialible",
-    "specialinternet",
-    "specialist",
-    "specialize",
-    "speciallevel",
-    "specialness",
-    "specialoptimization",
-    "specialspeaker",
-    "specialspecial",
-    "specialty",
-    "specialvariable",
-    "specialward",
-    "spend",
-    "spendfy",
-    "spendise",
-    "spendly",
-    "spendment",
-    "spendsion",
-    "spendward",
-    "stand",
-    "standard",
-    "standardal",
-    "standardant",
-    "standardbook",
-    "standardcompany",
-    "standardcraft",
-    "standardend",
-    "standardest",
-    "standardfolder",
-    "standardhand",
-    "standardial",
-    "standardible",
-    "standardise",
-    "standardist",
-    "standardjob",
-    "standardlight",
-    "standardmachine",
-    "standardment",
-    "standardnation",
-    "standardory",
-    "standardous",
-    "standardpower",
-    "standardresearch",
-    "standardservice",
-    "standardth",
-    "standardtheory",
-    "standardtion",
-    "standardure",
-    "standardyoung",
-    "standdom",
-    "standed",
-    "standhood",
-    "standic",
-    "standly",
-    "standteen",
-    "state",
-    "stateant",
-    "stateful",
-    "statehand",
-    "stateic",
-    "stateinterface",
-    "stateist",
-    "stateite",
-    "stateive",
-    "statemechanism",
-    "statement",
-    "statenation",
-    "stateperformance",
-    "stateproperty",
-    "stateradiation",
-    "stateroom",
-    "statescience",
-    "stateship",
-    "statething",
-    "statewise",
-    "stay",
-    "stayable",
-    "stayed",
-    "stayic",
-    "stayise",
-    "stayize",
-    "stayness",
-    "staytion",
-    "stayward",
-    "stop",
-    "stopcraft",
-    "stopfy",
-    "stopial",
-    "stopize",
-    "stopship",
-    "storage",
-    "storagecontroller",
-    "storagedevice",
-    "storageed",
-    "storageent",
-    "storagefold",
-    "storagehand",
-    "storageible",
-    "storageless",
-    "storagely",
-    "storageperson",
-    "storageprinciple",
-    "storageroom",
-    "storageservice",
-    "storageship",
-    "storageside",
-    "storagestudy",
-    "storagetechnology",
-    "storagevoltage",
-    "storageward",
-    "storagewater",
-    "story",
-    "storyaddress",
-    "storyage",
-    "storyant",
-    "storycircuit",
-    "storycommunication",
-    "storyed",
-    "storyer",
-    "storyfact",
-    "storyism",
-    "storyless",
-    "storylevel",
-    "storymarket",
-    "storyment",
-    "storyname",
-    "storyness",
-    "storyous",
-    "storypeople",
-    "storyprice",
-    "storypublic",
-    "storyroom",
-    "storytechnique",
-    "storytion",
-    "storyty",
-    "storyure",
-    "storyweek",
-    "strategy",
-    "strategyable",
-    "strategyaction",
-    "strategyant",
-    "strategyarchitecture",
-    "strategyaudio",
-    "strategygrowth",
-    "strategying",
-    "strategyism",
-    "strategyist",
-    "strategyite",
-    "strategyless",
-    "strategylike",
-    "strategyly",
-    "strategyness",
-    "strategyous",
-    "strategyprogram",
-    "strategyproject",
-    "strategyproperty",
-    "strategyresearch",
-    "strategyresource",
-    "strategyresult",
-    "strategytechnology",
-    "strategyterm",
-    "strategyth",
-    "strategytion",
-    "strategytruck",
-    "strategyweek",
-    "strategywise",
-    "structure",
-    "structurearea",
-    "structureconnector",
-    "structuredelivery",
-    "structuredesign",
-    "structureen",
-    "structureent",
-    "structureest",
-    "structurefact",
-    "structurefunction",
-    "structureist",
-    "structuremachine",
-    "structurematerial",
-    "structuremodel",
-    "structurename",
-    "structurepart",
-    "structurepolicy",
-    "structureradiation",
-    "structureship",
-    "structuresome",
-    "structureteen",
-    "structurething",
-    "structuretion",
-    "structurety",
-    "student",
-    "studentable",
-    "studentant",
-    "studentapparatus",
-    "studentary",
-    "studentcamera",
-    "studentcourse",
-    "studentcraft",
-    "studented",
-    "studentemail",
-    "studenten",
-    "studentengine",
-    "studenthood",
-    "studentic",
-    "studentinformation",
-    "studenting",
-    "studentise",
-    "studentism",
-    "studentist",
-    "studentorder",
-    "studentsoftware",
-    "studentsolution",
-    "studentsome",
-    "studentstory",
-    "studentterm",
-    "studentth",
-    "studenttruck",
-    "studentwise",
-    "study",
-    "studyage",
-    "studyant",
-    "studybasis",
-    "studybusiness",
-    "studycontroller",
-    "studydocument",
-    "studydom",
-    "studyed",
-    "studyeducation",
-    "studyelement",
-    "studyent",
-    "studyfeature",
-    "studyfy",
-    "studyheadphone",
-    "studyial",
-    "studylevel",
-    "studymanagement",
-    "studymaterial",
-    "studymessage",
-    "studymoney",
-    "studypackage",
-    "studyquality",
-    "studyschool",
-    "studysion",
-    "studyyear",
-    "subalgorithm",
-    "subanalysis",
-    "subappear",
-    "subapplication",
-    "subarchitecture",
-    "subattribute",
-    "subaudio",
-    "subbattery",
-    "subbicycle",
-    "subboat",
-    "subbook",
-    "subbuildward",
-    "subbus",
-    "subcable",
-    "subcamera",
-    "subcase",
-    "subcircuit",
-    "subcolor",
-    "subcommunication",
-    "subcompany",
-    "subcomputer",
-    "subconstant",
-    "subculturalic",
-    "subdatabase",
-    "subday",
-    "subdecide",
-    "subdelivery",
-    "subdevelopment",
-    "subdigitalous",
-    "subeconomic",
-    "subeducational",
-    "subemail",
-    "subenergy",
-    "subengine",
-    "subexpecter",
-    "subfeelite",
-    "subfolder",
-    "subfrequency",
-    "subfuel",
-    "subglobal",
-    "subgovernment",
-    "subgrowth",
-    "subhistory",
-    "subhold",
-    "subhood",
-    "subibleic",
-    "subinterface",
-    "subknow",
-    "sublearnth",
-    "sublevel",
-    "sublivehood",
-    "subloveure",
-    "submaintenance",
-    "submakeest",
-    "submanagement",
-    "submedical",
-    "submemory",
-    "submessage",
-    "submethod",
-    "submobile",
-    "submodel",
-    "subnature",
-    "subnessant",
-    "suboffice",
-    "suboperation",
-    "suborder",
-    "subpaper",
-    "subpart",
-    "subpass",
-    "subpattern",
-    "subperformance",
-    "subperson",
-    "subphone",
-    "subplay",
-    "subpolitical",
-    "subposition",
-    "subpower",
-    "subprinciple",
-    "subprinter",
-    "subprocedure",
-    "subprocess",
-    "subprocessor",
-    "subprofessional",
-    "subprogram",
-    "subprogramdom",
-    "subprogramhood",
-    "subprogramsion",
-    "subproperty",
-    "subprovide",
-    "subpublic",
-    "subreachship",
-    "subreadise",
-    "subreadous",
-    "subreason",
-    "subrememberteen",
-    "subroom",
-    "subschool",
-    "subshipping",
-    "subside",
-    "subsion",
-    "subsoftware",
-    "subspendite",
-    "substudent",
-    "subsystem",
-    "subtake",
-    "subtakeen",
-    "subtool",
-    "subtrain",
-    "subtravel",
-    "subuniversity",
-    "subwalk",
-    "subwar",
-    "subwatchlike",
-    "subweek",
-    "subwoman",
-    "subword",
-    "subwork",
-    "subworld",
-    "subwrite",
-    "subyear",
-    "suggest",
-    "suggestful",
-    "suggestic",
-    "suggestth",
-    "suggesttion",
-    "suggestward",
-    "suggestwise",
-    "superable",
-    "superactivity",
-    "superaddress",
-    "superanalysis",
-    "superappear",
-    "superarchitecture",
-    "superarea",
-    "superattribute",
-    "superaudio",
-    "superbattery",
-    "superboat",
-    "superbringing",
-    "superbus",
-    "superbusiness",
-    "superbuy",
-    "supercable",
-    "supercharacteristic",
-    "supercommunication",
-    "supercomponent",
-    "superconcept",
-    "superconnector",
-    "superconstant",
-    "supercontinue",
-    "supercontroller",
-    "supercreatefy",
-    "superdevice",
-    "superdiehood",
-    "superdigital",
-    "superdigitalfy",
-    "superdocument",
-    "supereducation",
-    "supereducational",
-    "superelement",
-    "superemail",
-    "superenergy",
-    "superequipment",
-    "superever",
-    "superexpect",
-    "superexperience",
-    "superfact",
-    "superfeature",
-    "superfinancialfold",
-    "superfrequency",
-    "superfull",
-    "supergroup",
-    "supergrowth",
-    "superhappen",
-    "superheadphone",
-    "superhealth",
-    "superhistorical",
-    "superhistory",
-    "superholdal",
-    "superholdtion",
-    "superibleteen",
-    "superinformation",
-    "superinstrument",
-    "superintegration",
-    "superinterest",
-    "superinternational",
-    "superinternet",
-    "superknowic",
-    "superless",
-    "superlive",
-    "superliveure",
-    "superlocation",
-    "superlook",
-    "superlose",
-    "superloveary",
-    "supermedical",
-    "supermemory",
-    "supermoney",
-    "supermonitor",
-    "supermotor",
-    "supermotorcycle",
-    "supermove",
-    "supermusic",
-    "supername",
-    "supernation",
-    "supernationalise",
-    "supernaturaler",
-    "supernature",
-    "superoffice",
-    "superorganization",
-    "superpackage",
-    "superpart",
-    "superpass",
-    "superpath",
-    "superpeople",
-    "superperformance",
-    "superphone",
-    "superpick",
-    "superpickcraft",
-    "superplace",
-    "superplayize",
-    "superpolicy",
-    "superpolitical",
-    "superpoliticaldom",
-    "superpower",
-    "superproblem",
-    "superprocedure",
-    "superprocess",
-    "superprogram",
-    "superproperty",
-    "superpublic",
-    "superpull",
-    "superquestion",
-    "superradiation",
-    "superraise",
-    "superreason",
-    "superresource",
-    "superroom",
-    "superschool",
-    "supersecurity",
-    "supersell",
-    "supersensor",
-    "supership",
-    "supersolution",
-    "superstop",
-    "supersystemal",
-    "supertechnicalal",
-    "supertechnicaled",
-    "supertechnicalhood",
-    "supertell",
-    "superterm",
-    "supertool",
-    "supertrade",
-    "supertravel",
-    "supertruck",
-    "superuniversity",
-    "superuseic",
-    "supervalue",
-    "supervariable",
-    "supervideo",
-    "supervoltage",
-    "superwaitable",
-    "superwaitory",
-    "superwant",
-    "superwantfold",
-    "superwater",
-    "superwebsite",
-    "superwhatial",
-    "superwoman",
-    "superwrite",
-    "support",
-    "supportable",
-    "supportcar",
-    "supported",
-    "supportexperience",
-    "supportfile",
-    "supportfold",
-    "supportfy",
-    "supportgroup",
-    "supporthood",
-    "supportimage",
-    "supportintegration",
-    "supportism",
-    "supportive",
-    "supportless",
-    "supportly",
-    "supportmachine",
-    "supportness",
-    "supportnetwork",
-    "supportous",
-    "supportpath",
-    "supportscreen",
-    "supportship",
-    "supportsion",
-    "supportstandard",
-    "supportth",
-    "supportweek",
-    "system",
-    "systemage",
-    "systembicycle",
-    "systemboat",
-    "systemconnector",
-    "systemcraft",
-    "systemdom",
-    "systemfold",
-    "systemial",
-    "systemible",
-    "systemic",
-    "systeminnovation",
-    "systemise",
-    "systemly",
-    "systemment",
-    "systemmoney",
-    "systemory",
-    "systemous",
-    "systemplane",
-    "systemreport",
-    "systemsome",
-    "systemtechnique",
-    "systemteen",
-    "systemthing",
-    "systemure",
-    "systemward",
-    "systemwise",
-    "take",
-    "takeant",
-    "takehood",
-    "technical",
-    "technicalable",
-    "technicalary",
-    "technicalcraft",
-    "technicalen",
-    "technicalible",
-    "technicalic",
-    "technicalism",
-    "technicalment",
-    "technique",
-    "techniquecase",
-    "techniquechild",
-    "techniqueed",
-    "techniqueelectricity",
-    "techniqueexperience",
-    "techniquehood",
-    "techniqueible",
-    "techniqueise",
-    "techniqueite",
-    "techniqueive",
-    "techniqueize",
-    "techniquelike",
-    "techniquely",
-    "techniquemaintenance",
-    "techniqueprinciple",
-    "techniquereason",
-    "techniqueresult",
-    "techniquesecurity",
-    "techniquesomething",
-    "techniqueure",
-    "techniquevalue",
-    "techniquevariable",
-    "techniquewise",
-    "techniquework",
-    "technology",
-    "technologyage",
-    "technologyant",
-    "technologyary",
-    "technologycraft",
-    "technologydesign",
-    "technologydom",
-    "technologyent",
-    "technologyequipment",
-    "technologyfact",
-    "technologygrowth",
-    "technologyhood",
-    "technologyible",
-    "technologyinterest",
-    "technologyism",
-    "technologyive",
-    "technologyize",
-    "technologylike",
-    "technologymarket",
-    "technologymaterial",
-    "technologyness",
-    "technologyory",
-    "technologyous",
-    "technologyprocess",
-    "technologytime",
-    "technologyure",
-    "tell",
-    "tellen",
-    "tellless",
-    "tellteen",
-    "term",
-    "termactivity",
-    "termalgorithm",
-    "termary",
-    "termboat",
-    "termbusiness",
-    "termcar",
-    "termcomponent",
-    "termed",
-    "terment",
-    "termfolder",
-    "termframework",
-    "termhand",
-    "termlevel",
-    "termlight",
-    "termlike",
-    "termmemory",
-    "termsensor",
-    "termsion",
-    "termsound",
-    "termwave",
-    "termwise",
-    "text",
-    "textcable",
-    "textcomponent",
-    "textdelivery",
-    "textdom",
-    "textent",
-    "textest",
-    "textfold",
-    "textful",
-    "textintegration",
-    "textize",
-    "textlike",
-    "textmodel",
-    "textmoney",
-    "textness",
-    "textprogram",
-    "texttechnique",
-    "texture",
-    "theory",
-    "theoryable",
-    "theoryaudio",
-    "theorybusiness",
-    "theorycircuit",
-    "theorycountry",
-    "theorydom",
-    "theoryed",
-    "theoryelectricity",
-    "theoryen",
-    "theoryible",
-    "theoryimage",
-    "theoryinformation",
-    "theoryize",
-    "theoryjob",
-    "theoryletter",
-    "theorylike",
-    "theorymethod",
-    "theoryory",
-    "theorypath",
-    "theoryscreen",
-    "theorysecurity",
-    "theorysignal",
-    "theorytion",
-    "theorytravel",
-    "theoryway",
-    "thing",
-    "thingant",
-    "thingattribute",
-    "thingboat",
-    "thingcharacteristic",
-    "thingconcept",
-    "thingcraft",
-    "thingfold",
-    "thingful",
-    "thinghood",
-    "thinginfrastructure",
-    "thingless",
-    "thingname",
-    "thingpoint",
-    "thingship",
-    "thingsome",
-    "thingspeaker",
-    "thingtime",
-    "thingtion",
-    "thingure",
-    "thingwebsite",
-    "thingwise",
-    "think",
-    "thinkhood",
-    "thinking",
-    "thinkise",
-    "thinkless",
-    "thinkness",
-    "thinktion",
-    "time",
-    "timeary",
-    "timecharger",
-    "timeest",
-    "timefolder",
-    "timekeyboard",
-    "timelike",
-    "timemodel",
-    "timeory",
-    "timeous",
-    "timeplan",
-    "timeproperty",
-    "timespecial",
-    "timetechnology",
-    "timetheory",
-    "timething",
-    "timetraining",
-    "timeward",
-    "timewise",
-    "timeworld",
-    "tion",
-    "tionage",
-    "tionen",
-    "tionent",
-    "tool",
-    "tooladapter",
-    "toolage",
-    "toolalgorithm",
-    "tooldirectory",
-    "toolfold",
-    "toolhistory",
-    "toolhood",
-    "toolic",
-    "toolletter",
-    "toolline",
-    "toolmarket",
-    "toolory",
-    "toolpicture",
-    "toolprotocol",
-    "toolship",
-    "toolsoftware",
-    "toolstudy",
-    "toolth",
-    "toolty",
-    "toolure",
-    "toolward",
-    "toolwater",
-    "trade",
-    "tradeal",
-    "tradearchitecture",
-    "tradeary",
-    "tradeed",
-    "tradeelement",
-    "tradeer",
-    "tradefold",
-    "tradegovernment",
-    "tradehand",
-    "tradeial",
-    "tradeible",
-    "tradeic",
-    "tradeimage",
-    "tradeimplementation",
-    "tradeing",
-    "tradeite",
-    "tradejob",
-    "tradement",
-    "tradeparty",
-    "traderight",
-    "tradeth",
-    "tradeuniversity",
-    "train",
-    "trainaddress",
-    "trainage",
-    "trainalgorithm",
-    "trainapplication",
-    "traincraft",
-    "traindesign",
-    "traindisplay",
-    "trained",
-    "trainen",
-    "trainenergy",
-    "trainent",
-    "trainfold",
-    "training",
-    "trainingage",
-    "trainingary",
-    "trainingbattery",
-    "trainingboat",
-    "trainingcamera",
-    "trainingdesign",
-    "traininged",
-    "trainingfold",
-    "traininghood",
-    "trainingial",
-    "trainingic",
-    "traininginformation",
-    "trainingise",
-    "trainingism",
-    "trainingize",
-    "trainingless",
-    "trainingpower",
-    "trainingship",
-    "trainingsoftware",
-    "trainingtion",
-    "traininguniversity",
-    "trainingvehicle",
-    "trainingvoltage",
-    "trainingway",
-    "trainingwise",
-    "trainism",
-    "trainist",
-    "trainite",
-    "trainly",
-    "trainmarket",
-    "trainnation",
-    "trainoptimization",
-    "trainpackage",
-    "trainparameter",
-    "trainprocess",
-    "trainquestion",
-    "trainresult",
-    "trainsion",
-    "trainth",
-    "traintion",
-    "traintraining",
-    "transanalysis",
-    "transapplication",
-    "transaskful",
-    "transaudio",
-    "transcall",
-    "transcallsome",
-    "transcar",
-    "transcharacteristic",
-    "transcommunication",
-    "transcompany",
-    "transcourse",
-    "transcreateable",
-    "transcurrent",
-    "transcut",
-    "transdelivery",
-    "transdevelopment",
-    "transeducational",
-    "transequipment",
-    "transexpect",
-    "transfallfy",
-    "transfeature",
-    "transfeel",
-    "transhealth",
-    "transhistory",
-    "transhold",
-    "transhood",
-    "transhouse",
-    "transimage",
-    "transinstrument",
-    "transinterest",
-    "transknow",
-    "transknowant",
-    "translevel",
-    "translife",
-    "translike",
-    "translose",
-    "translosewise",
-    "transmarket",
-    "transmedical",
-    "transmedicalward",
-    "transmeet",
-    "transmentless",
-    "transmenttion",
-    "transmicrophone",
-    "transmodel",
-    "transnation",
-    "transnatural",
-    "transness",
-    "transopen",
-    "transopenless",
-    "transoperation",
-    "transorganization",
-    "transpaper",
-    "transparty",
-    "transpass",
-    "transpattern",
-    "transpay",
-    "transphoto",
-    "transpicture",
-    "transpoint",
-    "transpolicy",
-    "transpolitical",
-    "transport",
-    "transportable",
-    "transportcraft",
-    "transportdom",
-    "transported",
-    "transportelectricity",
-    "transporter",
-    "transportest",
-    "transportexperience",
-    "transportfold",
-    "transportful",
-    "transportfy",
-    "transporthand",
-    "transportial",
-    "transportmarket",
-    "transportment",
-    "transportness",
-    "transportphoto",
-    "transportship",
-    "transportsion",
-    "transportstrategy",
-    "transportstudent",
-    "transportth",
-    "transporttion",
-    "transporttruck",
-    "transpower",
-    "transprinciple",
-    "transprocedure",
-    "transprocess",
-    "transprofessional",
-    "transprogram",
-    "transproperty",
-    "transprovide",
-    "transpublic",
-    "transquestion",
-    "transquestioned",
-    "transraiseer",
-    "transraisefold",
-    "transreason",
-    "transresult",
-    "transscanner",
-    "transscreen",
-    "transsecurity",
-    "transseem",
-    "transsensor",
-    "transset",
-    "transside",
-    "transsignal",
-    "transsioner",
-    "transsit",
-    "transsociety",
-    "transspeaker",
-    "transstay",
-    "transstop",
-    "transstorage",
-    "transstrategy",
-    "transstructure",
-    "transsupport",
-    "transthing",
-    "transtime",
-    "transtion",
-    "transtool",
-    "transtrade",
-    "transuse",
-    "transusesome",
-    "transvehicle",
-    "transwalk",
-    "transwar",
-    "transwatchful",
-    "transway",
-    "transwear",
-    "transwhere",
-    "transwhereous",
-    "transwhich",
-    "travel",
-    "travelable",
-    "travelarchitecture",
-    "travelary",
-    "travelchild",
-    "travelequipment",
-    "travelfeature",
-    "travelfold",
-    "travelful",
-    "travelgroup",
-    "travelial",
-    "traveling",
-    "travelist",
-    "travelkeyboard",
-    "travelment",
-    "travelness",
-    "travelorder",
-    "travelphone",
-    "travelpolicy",
-    "travelprotocol",
-    "travelquality",
-    "travelscience",
-    "travelteen",
-    "travelth",
-    "traveltravel",
-    "travelward",
-    "travelway",
-    "travelword",
-    "treatment",
-    "treatmentary",
-    "treatmentcase",
-    "treatmentconnector",
-    "treatmentcourse",
-    "treatmentdelivery",
-    "treatmentdisplay",
-    "treatmentequipment",
-    "treatmenter",
-    "treatmentfeature",
-    "treatmentfold",
-    "treatmentful",
-    "treatmentfy",
-    "treatmentist",
-    "treatmentize",
-    "treatmentlike",
-    "treatmentmouse",
-    "treatmentory",
-    "treatmentous",
-    "treatmentpublic",
-    "treatmentsome",
-    "treatmenttext",
-    "treatmenttion",
-    "treatmentward",
-    "treatmentwork",
-    "truck",
-    "truckary",
-    "truckcharger",
-    "trucked",
-    "truckest",
-    "truckfact",
-    "truckframework",
-    "truckise",
-    "truckite",
-    "truckize",
-    "truckname",
-    "truckoperation",
-    "truckpoint",
-    "truckprocedure",
-    "truckquestion",
-    "truckspeaker",
-    "truckteen",
-    "trucktrade",
-    "truckure",
-    "truckwar",
-    "try",
-    "tryal",
-    "tryer",
-    "tryfold",
-    "ultraableial",
-    "ultraaction",
-    "ultraactivity",
-    "ultraadd",
-    "ultraalgorithm",
-    "ultraanalysis",
-    "ultraapparatus",
-    "ultraapplication",
-    "ultraapproach",
-    "ultraarea",
-    "ultraaskfold",
-    "ultraattribute",
-    "ultrabelieve",
-    "ultrabook",
-    "ultrabuild",
-    "ultracall",
-    "ultrachangely",
-    "ultracharacteristic",
-    "ultracircuit",
-    "ultracolor",
-    "ultracomehood",
-    "ultracommunication",
-    "ultraconcept",
-    "ultraconnector",
-    "ultracontact",
-    "ultracontinueive",
-    "ultracontroller",
-    "ultracountry",
-    "ultracurrent",
-    "ultraday",
-    "ultradelivery",
-    "ultradevelopment",
-    "ultradevice",
-    "ultradisplay",
-    "ultradocument",
-    "ultradocumentation",
-    "ultraeducation",
-    "ultraemail",
-    "ultraexample",
-    "ultrafallize",
-    "ultrafeature",
-    "ultrafolder",
-    "ultraframework",
-    "ultrafuel",
-    "ultrafullal",
-    "ultraglobal",
-    "ultrahand",
-    "ultrahappenage",
-    "ultrahappened",
-    "ultrahood",
-    "ultrahouse",
-    "ultraimage",
-    "ultrainfrastructure",
-    "ultrainterest",
-    "ultrainterface",
-    "ultrajob",
-    "ultrakeyboard",
-    "ultraknow",
-    "ultraletter",
-    "ultralevel",
-    "ultralife",
-    "ultralight",
-    "ultralike",
-    "ultralikewise",
-    "ultraline",
-    "ultraloveial",
-    "ultramaintenance",
-    "ultramakeous",
-    "ultramaterial",
-    "ultramember",
-    "ultramentlike",
-    "ultramessage",
-    "ultramodel",
-    "ultramoney",
-    "ultramost",
-    "ultramotorcycle",
-    "ultramouse",
-    "ultramove",
-    "ultraness",
-    "ultraoperation",
-    "ultrapaper",
-    "ultrapaperlike",
-    "ultraparameter",
-    "ultrapath",
-    "ultrapersonalship",
-    "ultraplan",
-    "ultraposition",
-    "ultraprinciple",
-    "ultraprogram",
-    "ultraproject",
-    "ultraprotocol",
-    "ultrapullial",
-    "ultraquestionist",
-    "ultrareach",
-    "ultrareadary",
-    "ultrareason",
-    "ultraremain",
-    "ultrareport",
-    "ultraresearch",
-    "ultraresource",
-    "ultraresult",
-    "ultrascanner",
-    "ultraschool",
-    "ultrascience",
-    "ultrascreen",
-    "ultrasecurity",
-    "ultraship",
-    "ultraside",
-    "ultrasionlike",
-    "ultrasitly",
-    "ultrasociety",
-    "ultrasomething",
-    "ultrasound",
-    "ultrastand",
-    "ultrastay",
-    "ultrasystem",
-    "ultrasystemible",
-    "ultratechnology",
-    "ultrathing",
-    "ultrathinkize",
-    "ultratime",
-    "ultratraining",
-    "ultratransport",
-    "ultratravel",
-    "ultratruck",
-    "ultrawant",
-    "ultrawatch",
-    "ultrawave",
-    "ultrawebsite",
-    "ultraweek",
-    "ultrawhere",
-    "ultrawinure",
-    "ultraworld",
-    "ultrayear",
-    "unaction",
-    "unactivity",
-    "unadapter",
-    "unallowsome",
-    "unanalysis",
-    "unappear",
-    "unapproach",
-    "unaskly",
-    "unbasis",
-    "unboat",
-    "unbuild",
-    "unbuildous",
-    "unbus",
-    "uncamera",
-    "uncase",
-    "uncommunication",
-    "unconstant",
-    "uncontact",
-    "uncontroller",
-    "uncreateness",
-    "undelivery",
-    "underactivity",
-    "underalgorithm",
-    "underallow",
-    "underbasis",
-    "underbelievedom",
-    "underbringness",
-    "underbuild",
-    "undercallwise",
-    "undercharger",
-    "undercompany",
-    "underconcept",
-    "underconnector",
-    "undercontact",
-    "undercontinue",
-    "undercontroller",
-    "undercountry",
-    "undercourse",
-    "undercultural",
-    "underdevice",
-    "underdie",
-    "undereconomicsome",
-    "underend",
-    "underenergy",
-    "underexample",
-    "underexpect",
-    "underexperience",
-    "underfact",
-    "underfall",
-    "underfeelless",
-    "underfile",
-    "underfindible",
-    "underfrequency",
-    "undergovernment",
-    "undergroup",
-    "underhooder",
-    "underhouse",
-    "underimplementation",
-    "underinformation",
-    "underinfrastructure",
-    "underinnovation",
-    "underlead",
-    "underlearnment",
-    "underlearntion",
-    "underleaveive",
-    "underlessary",
-    "underlevel",
-    "underlight",
-    "underlook",
-    "undermanagement",
-    "undermemory",
-    "undermethod",
-    "undermicrophone",
-    "undermost",
-    "undermotor",
-    "undermotorcycle",
-    "undermouse",
-    "undernationalfold",
-    "undernessable",
-    "undernetwork",
-    "underofferer",
-    "underoffice",
-    "underorganization",
-    "underparty",
-    "underpass",
-    "underpattern",
-    "underpersonal",
-    "underplane",
-    "underprice",
-    "underproblem",
-    "underprogram",
-    "underproperty",
-    "underraise",
-    "underremember",
-    "underroom",
-    "underserve",
-    "underset",
-    "underside",
-    "undersignal",
-    "underspace",
-    "understand",
-    "understandard",
-    "understandfold",
-    "understandhood",
-    "understandite",
-    "understandness",
-    "understop",
-    "understudent",
-    "undersystem",
-    "undertechnique",
-    "underterm",
-    "undertext",
-    "undertheory",
-    "underthinkous",
-    "underthinksome",
-    "undertool",
-    "undertrade",
-    "undertraining",
-    "undertransport",
-    "undertravel",
-    "undertreatment",
-    "undertruck",
-    "underunderstander",
-    "undervalue",
-    "undervoltage",
-    "underwait",
-    "underwater",
-    "underwebsite",
-    "underwhereen",
-    "underword",
-    "underyoung",
-    "undigitalen",
-    "undocument",
-    "unelectricity",
-    "unequipment",
-    "unexample",
-    "unexperience",
-    "unfeelsome",
-    "ungiveward",
-    "ungraphic",
-    "ungrowth",
-    "unhealth",
-    "unimage",
-    "uninfrastructure",
-    "uninterface",
-    "university",
-    "universityable",
-    "universityboat",
-    "universitycraft",
-    "universityfold",
-    "universityfolder",
-    "universitying",
-    "universityist",
-    "universityive",
-    "universitymessage",
-    "universityquality",
-    "universityresource",
-    "universitystorage",
-    "universitytext",
-    "universitything",
-    "universityure",
-    "universityway",
-    "universitywise",
-    "unlead",
-    "unlike",
-    "unlookage",
-    "unlooktion",
-    "unlose",
-    "unlosecraft",
-    "unloseible",
-    "unmake",
-    "unmarket",
-    "unmaterial",
-    "unmented",
-    "unmessage",
-    "unmethod",
-    "unmodel",
-    "unnation",
-    "unnationalial",
-    "unnatural",
-    "unness",
-    "unnumber",
-    "unopenise",
-    "unoptimization",
-    "unpattern",
-    "unpayary",
-    "unpeople",
-    "unpersonal",
-    "unphone",
-    "unpicture",
-    "unplane",
-    "unplaywise",
-    "unpower",
-    "unprinter",
-    "unproblem",
-    "unprocess",
-    "unproductivity",
-    "unproject",
-    "unquality",
-    "unradiation",
-    "unraise",
-    "unraiseen",
-    "unreason",
-    "unremainite",
-    "unreport",
-    "unright",
-    "unschool",
-    "unseemist",
-    "unsended",
-    "unservice",
-    "unsignal",
-    "unsociety",
-    "unsolution",
-    "unsound",
-    "unspeaker",
-    "unstandard",
-    "unstate",
-    "unstudy",
-    "unsystem",
-    "untechnology",
-    "untell",
-    "unterm",
-    "untheory",
-    "untool",
-    "untravel",
-    "ununiversity",
-    "unuse",
-    "unvehicle",
-    "unwatch",
-    "unway",
-    "unwhat",
-    "unwhatcraft",
-    "unwin",
-    "unwork",
-    "unyoung",
-    "upablecraft",
-    "upablesion",
-    "upaction",
-    "upadapter",
-    "upapparatus",
-    "upapproach",
-    "upaudio",
-    "upbattery",
-    "upbook",
-    "upbreak",
-    "upbring",
-    "upbringant",
-    "upbusiness",
-    "upcall",
-    "upcamera",
-    "upcase",
-    "upcharger",
-    "upcircuit",
-    "upcolor",
-    "upcometh",
-    "upcomponent",
-    "upconnector",
-    "upcontact",
-    "upcontroller",
-    "upcourse",
-    "upcreate",
-    "upcultural",
-    "upcut",
-    "updocument",
-    "updocumentation",
-    "upelement",
-    "upemail",
-    "upenergy",
-    "upexample",
-    "upexpect",
-    "upfeeled",
-    "upfollow",
-    "upframework",
-    "upfullcraft",
-    "upfullive",
-    "upfunction",
-    "upglobal",
-    "upgraphic",
-    "upgroup",
-    "upgrowize",
-    "upheadphone",
-    "uphold",
-    "uphood",
-    "upible",
-    "upinternationaldom",
-    "upjob",
-    "upless",
-    "uplessward",
-    "upliveful",
-    "uplocalsome",
-    "uplocation",
-    "uploveness",
-    "uploveward",
-    "upmachine",
-    "upmakeal",
-    "upmanagement",
-    "upmarket",
-    "upmechanism",
-    "upmeet",
-    "upmeeting",
-    "upmemory",
-    "upmodel",
-    "upname",
-    "upnature",
-    "upnetwork",
-    "upnews",
-    "upopenen",
-    "upoperation",
-    "uporder",
-    "uppayen",
-    "uppayhood",
-    "upperformance",
-    "uppersonal",
-    "upphone",
-    "upphoto",
-    "upplane",
-    "upplay",
-    "uppoint",
-    "upposition",
-    "upprice",
-    "upprinciple",
-    "upproblem",
-    "upprofessional",
-    "upprofessionalness",
-    "upquestion",
-    "upquestionial",
-    "upraise",
-    "upraiseable",
-    "upraiseist",
-    "upreachous",
-    "upreason",
-    "upresource",
-    "upright",
-    "upscanner",
-    "upscience",
-    "upsendary",
-    "upserve",
-    "upshipping",
-    "upsionest",
-    "upsocialite",
-    "upsocialwise",
-    "upsoftware",
-    "upsolution",
-    "upsome",
-    "upsomething",
-    "upstandard",
-    "upstudent",
-    "upsuggest",
-    "uptechnicalory",
-    "uptechnicalure",
-    "uptellic",
-    "uptellory",
-    "uptheory",
-    "upthing",
-    "uptime",
-    "uption",
-    "uptool",
-    "uptravel",
-    "upvalue",
-    "upvehicle",
-    "upwaitdom",
-    "upwantable",
-    "upwater",
-    "upway",
-    "upwear",
-    "upweek",
-    "upwhich",
-    "upworksome",
-    "upworkure",
-    "upworld",
-    "upwriteist",
-    "use",
-    "useer",
-    "useest",
-    "usefold",
-    "useial",
-    "value",
-    "valueage",
-    "valuebus",
-    "valuecontact",
-    "valueed",
-    "valueent",
-    "valueest",
-    "valueful",
-    "valuefunction",
-    "valuegraphic",
-    "valueic",
-    "valueise",
-    "valueism",
-    "valuelevel",
-    "valuelike",
-    "valuely",
-    "valueoperation",
-    "valueory",
-    "valueparty",
-    "valuepublic",
-    "valuescreen",
-    "valueteen",
-    "valuetraining",
-    "valueyoung",
-    "variable",
-    "variableapplication",
-    "variablecomputer",
-    "variableconnector",
-    "variablecontact",
-    "variabledatabase",
-    "variableent",
-    "variablefrequency",
-    "variablefy",
-    "variablehood",
-    "variableic",
-    "variableist",
-    "variablelike",
-    "variablemonitor",
-    "variablenetwork",
-    "variableory",
-    "variablesion",
-    "vehicle",
-    "vehicleal",
-    "vehiclecontact",
-    "vehicledisplay",
-    "vehicleen",
-    "vehiclefold",
-    "vehicleful",
-    "vehicleic",
-    "vehicleise",
-    "vehicleism",
-    "vehicleness",
-    "vehicleplatform",
-    "vehicleproject",
-    "vehiclequestion",
-    "vehicleservice",
-    "vehicletheory",
-    "video",
-    "videoable",
-    "videocraft",
-    "videodelivery",
-    "videoelectricity",
-    "videoent",
-    "videoism",
-    "videoive",
-    "videolike",
-    "videomoney",
-    "videoname",
-    "videoness",
-    "videooperation",
-    "videoous",
-    "videoresearch",
-    "videosion",
-    "videosome",
-    "videostate",
-    "videostudent",
-    "videowave",
-    "videoway",
-    "videowise",
-    "voltage",
-    "voltageable",
-    "voltagecraft",
-    "voltageent",
-    "voltageest",
-    "voltagefy",
-    "voltagehand",
-    "voltageial",
-    "voltageic",
-    "voltageite",
-    "voltageive",
-    "voltageize",
-    "voltagemethod",
-    "voltagename",
-    "voltageoperation",
-    "voltageous",
-    "voltageperformance",
-    "voltageproductivity",
-    "voltagequestion",
-    "voltagescreen",
-    "voltagesound",
-    "voltagestrategy",
-    "voltageth",
-    "voltagetrain",
-    "wait",
-    "waitic",
-    "waitsome",
-    "walk",
-    "walkdom",
-    "walked",
-    "walkism",
-    "walkite",
-    "walksome",
-    "walktion",
-    "want",
-    "wantful",
-    "wantist",
-    "wantize",
-    "wantship",
-    "wantteen",
-    "wanttion",
-    "war",
-    "warable",
-    "warant",
-    "warbattery",
-    "warcase",
-    "warcircuit",
-    "ward",
-    "warder",
-    "wardic",
-    "wardwise",
-    "waremail",
-    "waren",
-    "warequipment",
-    "warer",
-    "warful",
-    "wargroup",
-    "warhood",
-    "warize",
-    "warmouse",
-    "warness",
-    "warphoto",
-    "warproperty",
-    "warscience",
-    "warteen",
-    "warward",
-    "watch",
-    "watchage",
-    "watchen",
-    "watcher",
-    "watchfy",
-    "watchsion",
-    "water",
-    "watercurrent",
-    "watered",
-    "wateremail",
-    "wateren",
-    "waterfold",
-    "waterfuel",
-    "waterimage",
-    "waterinfrastructure",
-    "waterinterest",
-    "waterite",
-    "waterlocation",
-    "watermoney",
-    "waterplace",
-    "waterpoint",
-    "waterprotocol",
-    "waterquality",
-    "waterradiation",
-    "watersion",
-    "watertreatment",
-    "waterure",
-    "wave",
-    "waveable",
-    "waveage",
-    "waveanalysis",
-    "waveant",
-    "wavecharacteristic",
-    "wavecraft",
-    "wavedesign",
-    "wavedocument",
-    "waveed",
-    "wavefact",
-    "wavegrowth",
-    "waveic",
-    "waveinterest",
-    "waveise",
-    "waveist",
-    "waveless",
-    "wavelike",
-    "wavenation",
-    "waveory",
-    "waveprotocol",
-    "waveschool",
-    "waveship",
-    "wavesion",
-    "wavestrategy",
-    "waveteen",
-    "waveth",
-    "wavetion",
-    "waveure",
-    "waveword",
-    "way",
-    "wayal",
-    "waycable",
-    "waycase",
-    "wayed",
-    "wayfoundation",
-    "wayful",
-    "wayfy",
-    "wayic",
-    "wayism",
-    "wayist",
-    "waylocation",
-    "wayly",
-    "waymaintenance",
-    "waymaterial",
-    "waymoney",
-    "wayory",
-    "waypath",
-    "wayperformance",
-    "wayprogram",
-    "wayreport",
-    "wayresult",
-    "wayservice",
-    "waysystem",
-    "waywise",
-    "wear",
-    "wearal",
-    "wearer",
-    "wearial",
-    "wearment",
-    "wearteen",
-    "wearth",
-    "website",
-    "websiteapplication",
-    "websiteattribute",
-    "websiteent",
-    "websitefold",
-    "websitefrequency",
-    "websitefy",
-    "websitegraphic",
-    "websiteible",
-    "websiteive",
-    "websitejob",
-    "websitelike",
-    "websitely",
-    "websitemethod",
-    "websiteness",
-    "websiteoffice",
-    "websiteplatform",
-    "websiteprogram",
-    "websitesion",
-    "websitesupport",
-    "websitetion",
-    "websitetool",
-    "websitety",
-    "websiteward",
-    "week",
-    "weekbusiness",
-    "weekconnector",
-    "weekcourse",
-    "weekdom",
-    "weeken",
-    "weekent",
-    "weekful",
-    "weekhood",
-    "weekhouse",
-    "weekible",
-    "weekinfrastructure",
-    "weekinstrument",
-    "weekite",
-    "weekive",
-    "weekjob",
-    "weekmember",
-    "weekproperty",
-    "weekscreen",
-    "weeksion",
-    "weeksome",
-    "weekspace",
-    "weekteen",
-    "weekty",
-    "weekuniversity",
-    "weekure",
-    "weekvariable",
-    "weekwise",
-    "what",
-    "whatage",
-    "whatic",
-    "whating",
-    "whatist",
-    "whatment",
-    "whatory",
-    "whatward",
-    "when",
-    "whenage",
-    "whenary",
-    "whendom",
-    "whenen",
-    "whenful",
-    "whenness",
-    "whenwise",
-    "where",
-    "whereary",
-    "whereest",
-    "wheretion",
-    "wherewise",
-    "which",
-    "whichable",
-    "whichary",
-    "whicher",
-    "whichest",
-    "whichible",
-    "whichism",
-    "whichless",
-    "win",
-    "winal",
-    "winist",
-    "wise",
-    "wiseable",
-    "wiseant",
-    "wiseer",
-    "wisety",
-    "woman",
-    "womanattribute",
-    "womancolor",
-    "womandevelopment",
-    "womandom",
-    "womaned",
-    "womanen",
-    "womanent",
-    "womanfeature",
-    "womanfold",
-    "womanfolder",
-    "womanful",
-    "womanmodel",
-    "womanness",
-    "womanperson",
-    "womanpublic",
-    "womanresult",
-    "womansensor",
-    "womanstandard",
-    "womanstudent",
-    "womanure",
-    "womanvoltage",
-    "word",
-    "wordactivity",
-    "wordant",
-    "wordcomponent",
-    "worddevice",
-    "worddocumentation",
-    "wordeducation",
-    "wordefficiency",
-    "worder",
-    "wordful",
-    "wordial",
-    "wordist",
-    "wordmobile",
-    "wordous",
-    "wordparty",
-    "wordproductivity",
-    "wordproject",
-    "wordship",
-    "wordsome",
-    "wordspace",
-    "wordtool",
-    "wordty",
-    "wordwork",
-    "wordyear",
-    "work",
-    "workal",
-    "workcar",
-    "workcircuit",
-    "workcompany",
-    "workcontact",
-    "workdevice",
-    "workent",
-    "worker",
-    "workexample",
-    "workible",
-    "workic",
-    "workise",
-    "workist",
-    "workless",
-    "worklike",
-    "workorganization",
-    "workous",
-    "workprotocol",
-    "workscanner",
-    "worksome",
-    "workstate",
-    "workstudy",
-    "worktext",
-    "workth",
-    "worktool",
-    "worktrain",
-    "workty",
-    "workwise",
-    "world",
-    "worldage",
-    "worldant",
-    "worldconcept",
-    "worlddesign",
-    "worlddom",
-    "worldfile",
-    "worldful",
-    "worldfy",
-    "worldgovernment",
-    "worldgrowth",
-    "worldic",
-    "worldimage",
-    "worlding",
-    "worldmoney",
-    "worldname",
-    "worldory",
-    "worldous",
-    "worldproject",
-    "worldroom",
-    "worldstudent",
-    "worldterm",
-    "worldtion",
-    "worldty",
-    "worldward",
-    "write",
-    "writeer",
-    "writefold",
-    "writeful",
-    "writeory",
-    "writeship",
-    "writesome",
-    "year",
-    "yearage",
-    "yeardesign",
-    "yeardocument",
-    "yearelectricity",
-    "yearer",
-    "yearest",
-    "yearful",
-    "yearfy",
-    "yearless",
-    "yearlife",
-    "yearlike",
-    "yearment",
-    "yearmobile",
-    "yearness",
-    "yearposition",
-    "yearproperty",
-    "yearsociety",
-    "yearsome",
-    "yearwar",
-    "yearward",
-    "yearwebsite",
-    "young",
-    "youngant",
-    "youngaudio",
-    "youngboat",
-    "youngcharger",
-    "youngcourse",
-    "youngen",
-    "youngest",
-    "youngfact",
-    "youngfuel",
-    "youngful",
-    "youngfy",
-    "youngible",
-    "youngism",
-    "youngist",
-    "youngless",
-    "younglife",
-    "younglike",
-    "youngmanagement",
-    "youngnation",
-    "youngness",
-    "youngoptimization",
-    "youngory",
-    "youngpattern",
-    "youngpublic",
-    "youngroom",
-    "youngsome",
-    "youngsystem",
-    "youngteen",
-    "youngtext",
-    "youngth",
-    "youngty",
-    "youngward",
-    "youngwave",
-    "youngweek",
-    "youngwise"
+#include <stdint.h>
+
+// Generated by generate_dictionary.py
+#define DICTIONARY_WORD_COUNT 10000
+
+// Every word followed by a NUL, back to back
+const char DICTIONARY_BLOB[119053] =
+    "able\0"
+    "ablecraft\0"
+    "ableial\0"
+    "ablely\0"
+    "action\0"
+    "actionable\0"
+    "actionactivity\0"
+    "actionanalysis\0"
+    "actionbattery\0"
+    "actionconstant\0"
+    "actioncraft\0"
+    "actioncurrent\0"
+    "actionenergy\0"
+    "actionexperience\0"
+    "actionfuel\0"
+    "actionful\0"
+    "actionist\0"
+    "actionite\0"
+    "actionive\0"
+    "actionlike\0"
+    "actionness\0"
+    "actionous\0"
+    "actionproject\0"
+    "actionprotocol\0"
+    "actionschool\0"
+    "actionstudent\0"
+    "actionty\0"
+    "actionvoltage\0"
+    "actionweek\0"
+    "actionwise\0"
+    "activity\0"
+    "activityapplication\0"
+    "activitycraft\0"
+    "activityfold\0"
+    "activityfoundation\0"
+    "activitygroup\0"
+    "activityhand\0"
+    "activityheadphone\0"
+    "activityimage\0"
+    "activitying\0"
+    "activityize\0"
+    "activitykeyboard\0"
+    "activityly\0"
+    "activitymachine\0"
+    "activitymobile\0"
+    "activityoperation\0"
+    "activitypicture\0"
+    "activityship\0"
+    "activitysignal\0"
+    "adapter\0"
+    "adapteral\0"
+    "adaptercharger\0"
+    "adaptereducation\0"
+    "adapterelectricity\0"
+    "adapteren\0"
+    "adapterexample\0"
+    "adapterful\0"
+    "adapterible\0"
+    "adapterite\0"
+    "adapterlight\0"
+    "adaptermaterial\0"
+    "adapterpath\0"
+    "adapterpeople\0"
+    "adapterplan\0"
+    "adapterproject\0"
+    "adapterquestion\0"
+    "adaptership\0"
+    "adaptersignal\0"
+    "adapterstructure\0"
+    "adaptertraining\0"
+    "adapterty\0"
+    "adapterure\0"
+    "adaptervideo\0"
+    "add\0"
+    "added\0"
+    "adder\0"
+    "addless\0"
+    "address\0"
+    "addressable\0"
+    "addressage\0"
+    "addressanalysis\0"
+    "addresscase\0"
+    "addresscharger\0"
+    "addressdirectory\0"
+    "addressdom\0"
+    "addressfact\0"
+    "addressfy\0"
+    "addresshood\0"
+    "addressial\0"
+    "addressible\0"
+    "addressise\0"
+    "addressize\0"
+    "addressly\0"
+    "addressorder\0"
+    "addressprocedure\0"
+    "addressproject\0"
+    "addressteen\0"
+    "addressth\0"
+    "addressty\0"
+    "addresswebsite\0"
+    "addth\0"
+    "addty\0"
+    "algorithm\0"
+    "algorithmbasis\0"
+    "algorithmcraft\0"
+    "algorithmed\0"
+    "algorithment\0"
+    "algorithmfy\0"
+    "algorithmic\0"
+    "algorithminternet\0"
+    "algorithmmanagement\0"
+    "algorithmmaterial\0"
+    "algorithmous\0"
+    "algorithmpattern\0"
+    "algorithmpower\0"
+    "algorithmprinter\0"
+    "algorithmsound\0"
+    "algorithmth\0"
+    "algorithmtraining\0"
+    "algorithmty\0"
+    "algorithmure\0"
+    "algorithmwar\0"
+    "algorithmwise\0"
+    "allow\0"
+    "allowdom\0"
+    "allowful\0"
+    "allowist\0"
+    "allowteen\0"
+    "allowty\0"
+    "analysis\0"
+    "analysisable\0"
+    "analysisant\0"
+    "analysised\0"
+    "analysisemail\0"
+    "analysisfy\0"
+    "analysishood\0"
+    "analysising\0"
+    "analysismechanism\0"
+    "analysismember\0"
+    "analysisness\0"
+    "analysisory\0"
+    "analysisous\0"
+    "analysisphone\0"
+    "analysisprocedure\0"
+    "analysission\0"
+    "analysissociety\0"
+    "analysistext\0"
+    "antiable\0"
+    "antiableing\0"
+    "antiaction\0"
+    "antiactivity\0"
+    "antiadddom\0"
+    "antialgorithm\0"
+    "antiallowent\0"
+    "antiallowward\0"
+    "antianalysis\0"
+    "antiarchitecture\0"
+    "antiaudio\0"
+    "antibattery\0"
+    "antibook\0"
+    "antibuyive\0"
+    "anticolor\0"
+    "anticome\0"
+    "anticomponent\0"
+    "anticomputer\0"
+    "anticonstant\0"
+    "anticontinueship\0"
+    "antidatabase\0"
+    "antiday\0"
+    "antidesign\0"
+    "antidevelopment\0"
+    "antidevice\0"
+    "antidisplay\0"
+    "antidocument\0"
+    "antielectricity\0"
+    "antiemail\0"
+    "antiend\0"
+    "antienergy\0"
+    "antiengine\0"
+    "antiequipment\0"
+    "antiexample\0"
+    "antifact\0"
+    "antifile\0"
+    "antifrequency\0"
+    "antigraphic\0"
+    "antigroup\0"
+    "antigrowth\0"
+    "antihappen\0"
+    "antihealth\0"
+    "antihistoricalary\0"
+    "antihouse\0"
+    "antiibleic\0"
+    "antiimplementation\0"
+    "antiinfrastructure\0"
+    "antiinstrument\0"
+    "antiintegration\0"
+    "antikeyboard\0"
+    "antilife\0"
+    "antilight\0"
+    "antilive\0"
+    "antilocation\0"
+    "antimaintenance\0"
+    "antimember\0"
+    "antiment\0"
+    "antimessage\0"
+    "antiorder\0"
+    "antipart\0"
+    "antipassary\0"
+    "antipattern\0"
+    "antipay\0"
+    "antiperformance\0"
+    "antipickful\0"
+    "antiplace\0"
+    "antiplatform\0"
+    "antiplay\0"
+    "antipoint\0"
+    "antipower\0"
+    "antiprinter\0"
+    "antiprofessional\0"
+    "antiprogramward\0"
+    "antiproject\0"
+    "antiproperty\0"
+    "antiprovideth\0"
+    "antiquality\0"
+    "antirememberive\0"
+    "antirequireial\0"
+    "antiscreen\0"
+    "antisell\0"
+    "antision\0"
+    "antisoftware\0"
+    "antisolution\0"
+    "antispeaker\0"
+    "antispecial\0"
+    "antistop\0"
+    "antistorage\0"
+    "antistructure\0"
+    "antisupport\0"
+    "antisystemer\0"
+    "antisystemty\0"
+    "antitechnique\0"
+    "antitechnology\0"
+    "antitell\0"
+    "antitellise\0"
+    "antiterm\0"
+    "antithing\0"
+    "antitime\0"
+    "antitionless\0"
+    "antitrain\0"
+    "antitraining\0"
+    "antitreatment\0"
+    "antitruck\0"
+    "antiuniversity\0"
+    "antiuse\0"
+    "antivehicle\0"
+    "antivoltage\0"
+    "antiwaitless\0"
+    "antiwaitship\0"
+    "antiwant\0"
+    "antiwater\0"
+    "antiway\0"
+    "antiwin\0"
+    "antiwise\0"
+    "antiwiseial\0"
+    "antiwoman\0"
+    "antiword\0"
+    "antiwork\0"
+    "apparatus\0"
+    "apparatusapplication\0"
+    "apparatusapproach\0"
+    "apparatusary\0"
+    "apparatusconnector\0"
+    "apparatuscraft\0"
+    "apparatusen\0"
+    "apparatusfrequency\0"
+    "apparatusgovernment\0"
+    "apparatusible\0"
+    "apparatusic\0"
+    "apparatuslevel\0"
+    "apparatuslike\0"
+    "apparatusly\0"
+    "apparatusous\0"
+    "apparatuspart\0"
+    "apparatussecurity\0"
+    "apparatussome\0"
+    "apparatusspeaker\0"
+    "apparatusty\0"
+    "apparatusvariable\0"
+    "apparatusward\0"
+    "apparatusway\0"
+    "apparatusweek\0"
+    "apparatuswise\0"
+    "appear\0"
+    "appearent\0"
+    "appearise\0"
+    "appearist\0"
+    "appearous\0"
+    "appearty\0"
+    "application\0"
+    "applicationable\0"
+    "applicationant\0"
+    "applicationary\0"
+    "applicationcraft\0"
+    "applicationdom\0"
+    "applicationen\0"
+    "applicationest\0"
+    "applicationfy\0"
+    "applicationise\0"
+    "applicationism\0"
+    "applicationite\0"
+    "applicationmemory\0"
+    "applicationment\0"
+    "applicationmodel\0"
+    "applicationness\0"
+    "applicationory\0"
+    "applicationproperty\0"
+    "applicationspace\0"
+    "applicationure\0"
+    "applicationward\0"
+    "applicationwise\0"
+    "approach\0"
+    "approachable\0"
+    "approachaction\0"
+    "approachal\0"
+    "approachapproach\0"
+    "approacharea\0"
+    "approachcomponent\0"
+    "approachcontroller\0"
+    "approachcraft\0"
+    "approachdesign\0"
+    "approachdocument\0"
+    "approachdom\0"
+    "approacher\0"
+    "approachfold\0"
+    "approachful\0"
+    "approachgrowth\0"
+    "approachheadphone\0"
+    "approachhood\0"
+    "approachible\0"
+    "approachimage\0"
+    "approachive\0"
+    "approachmouse\0"
+    "approachness\0"
+    "approachperformance\0"
+    "approachpublic\0"
+    "approachteen\0"
+    "approachterm\0"
+    "approachtion\0"
+    "approachvoltage\0"
+    "architecture\0"
+    "architecturecourse\0"
+    "architecturedom\0"
+    "architectureenergy\0"
+    "architectureer\0"
+    "architectureful\0"
+    "architectureing\0"
+    "architectureinterest\0"
+    "architecturelike\0"
+    "architecturement\0"
+    "architectureous\0"
+    "architecturepicture\0"
+    "architecturequestion\0"
+    "architectureship\0"
+    "architecturething\0"
+    "architecturetion\0"
+    "area\0"
+    "areabattery\0"
+    "areacar\0"
+    "areacase\0"
+    "areacountry\0"
+    "areaed\0"
+    "areaen\0"
+    "areaer\0"
+    "areaing\0"
+    "areaise\0"
+    "areament\0"
+    "areamicrophone\0"
+    "areaness\0"
+    "areaory\0"
+    "areaous\0"
+    "areapattern\0"
+    "areapower\0"
+    "areaquality\0"
+    "areaship\0"
+    "areaside\0"
+    "areation\0"
+    "areauniversity\0"
+    "areaword\0"
+    "ask\0"
+    "askal\0"
+    "askial\0"
+    "askic\0"
+    "askless\0"
+    "askly\0"
+    "attribute\0"
+    "attributeal\0"
+    "attributecable\0"
+    "attributedom\0"
+    "attributeent\0"
+    "attributeframework\0"
+    "attributeless\0"
+    "attributement\0"
+    "attributepolicy\0"
+    "attributeprocedure\0"
+    "attributeresistance\0"
+    "attributesion\0"
+    "attributetion\0"
+    "attributety\0"
+    "attributewise\0"
+    "audio\0"
+    "audiochild\0"
+    "audioconnector\0"
+    "audioed\0"
+    "audioent\0"
+    "audioexample\0"
+    "audioite\0"
+    "audioive\0"
+    "audioize\0"
+    "audiomusic\0"
+    "audioperson\0"
+    "audiophoto\0"
+    "audiopublic\0"
+    "audiosignal\0"
+    "audiosoftware\0"
+    "audiosome\0"
+    "audiostudy\0"
+    "audioth\0"
+    "audioty\0"
+    "autoadapter\0"
+    "autoaddress\0"
+    "autoapparatus\0"
+    "autoasked\0"
+    "autoaudio\0"
+    "autobasis\0"
+    "autobattery\0"
+    "autobicycle\0"
+    "autoboat\0"
+    "autobook\0"
+    "autobus\0"
+    "autobusiness\0"
+    "autocallent\0"
+    "autocamera\0"
+    "autocar\0"
+    "autochild\0"
+    "autocolor\0"
+    "autodelivery\0"
+    "autodesign\0"
+    "autodocumentation\0"
+    "autoeconomic\0"
+    "autoefficiency\0"
+    "autoelectricity\0"
+    "autoemail\0"
+    "autoend\0"
+    "autofallhood\0"
+    "autofamily\0"
+    "autofeelous\0"
+    "autofinancial\0"
+    "autofolder\0"
+    "autofollow\0"
+    "autofrequency\0"
+    "autofuel\0"
+    "autofull\0"
+    "autofunction\0"
+    "autogovernment\0"
+    "autohealth\0"
+    "autohistorical\0"
+    "autohistory\0"
+    "autoimage\0"
+    "autoimplementation\0"
+    "autoincludement\0"
+    "autoinformation\0"
+    "autoinnovation\0"
+    "autointegration\0"
+    "autointerest\0"
+    "autoleave\0"
+    "autoless\0"
+    "autoletter\0"
+    "autolevel\0"
+    "autoloseed\0"
+    "automarket\0"
+    "automechanism\0"
+    "automember\0"
+    "automemory\0"
+    "automessage\0"
+    "automicrophone\0"
+    "automoney\0"
+    "automost\0"
+    "automotor\0"
+    "automotorcycle\0"
+    "automouse\0"
+    "autonatural\0"
+    "autonaturalary\0"
+    "autoness\0"
+    "autonessise\0"
+    "autonews\0"
+    "autonumber\0"
+    "autoopen\0"
+    "autoorganization\0"
+    "autoparameter\0"
+    "autopath\0"
+    "autopay\0"
+    "autopeople\0"
+    "autoperformance\0"
+    "autoperson\0"
+    "autophone\0"
+    "autopick\0"
+    "autopickise\0"
+    "autoplane\0"
+    "autoprice\0"
+    "autoprinciple\0"
+    "autoprocess\0"
+    "autoprogram\0"
+    "autoproject\0"
+    "autopullite\0"
+    "autoquestionteen\0"
+    "autoraise\0"
+    "autoreach\0"
+    "autoremember\0"
+    "autoreportteen\0"
+    "autoroom\0"
+    "autoscience\0"
+    "autoscientific\0"
+    "autosend\0"
+    "autosendful\0"
+    "autoserve\0"
+    "autoset\0"
+    "autoship\0"
+    "autoshipping\0"
+    "autoside\0"
+    "autosithood\0"
+    "autositing\0"
+    "autosolution\0"
+    "autosomething\0"
+    "autosound\0"
+    "autospecial\0"
+    "autospend\0"
+    "autostandard\0"
+    "autostate\0"
+    "autostay\0"
+    "autostoption\0"
+    "autostrategy\0"
+    "autosuggest\0"
+    "autotake\0"
+    "autotakeite\0"
+    "autotechnicalize\0"
+    "autotechnique\0"
+    "autotechnology\0"
+    "autotext\0"
+    "autotool\0"
+    "autotrain\0"
+    "autotraining\0"
+    "autotravel\0"
+    "autotruck\0"
+    "autounderstandlike\0"
+    "autovalue\0"
+    "autovariable\0"
+    "autowantory\0"
+    "autoway\0"
+    "autowear\0"
+    "autoweek\0"
+    "autowhich\0"
+    "autowinest\0"
+    "autoword\0"
+    "autowork\0"
+    "basis\0"
+    "basisary\0"
+    "basisconstant\0"
+    "basiscontact\0"
+    "basisdom\0"
+    "basisengine\0"
+    "basisexample\0"
+    "basisframework\0"
+    "basisfuel\0"
+    "basishood\0"
+    "basisite\0"
+    "basisless\0"
+    "basismarket\0"
+    "basisoffice\0"
+    "basisory\0"
+    "basisous\0"
+    "basisproject\0"
+    "basisresistance\0"
+    "basission\0"
+    "basistool\0"
+    "basistravel\0"
+    "basisure\0"
+    "battery\0"
+    "batteryaudio\0"
+    "batterycraft\0"
+    "batteryed\0"
+    "batteryequipment\0"
+    "batteryexperience\0"
+    "batteryfamily\0"
+    "batteryful\0"
+    "batteryhome\0"
+    "batteryinstrument\0"
+    "batteryinterface\0"
+    "batteryive\0"
+    "batteryless\0"
+    "batterymoney\0"
+    "batteryous\0"
+    "batteryprice\0"
+    "batteryservice\0"
+    "batterysome\0"
+    "batterysomething\0"
+    "batteryspecial\0"
+    "batterytrain\0"
+    "believe\0"
+    "believeible\0"
+    "bicycle\0"
+    "bicycleaddress\0"
+    "bicycleal\0"
+    "bicyclecamera\0"
+    "bicycledevelopment\0"
+    "bicycledevice\0"
+    "bicycleen\0"
+    "bicyclehealth\0"
+    "bicyclehood\0"
+    "bicycleial\0"
+    "bicyclelife\0"
+    "bicycleness\0"
+    "bicycleparty\0"
+    "bicyclephone\0"
+    "bicycleposition\0"
+    "bicycleprinciple\0"
+    "bicycleprocedure\0"
+    "bicyclesion\0"
+    "bicyclesystem\0"
+    "bicycletool\0"
+    "bicycletreatment\0"
+    "bicycleure\0"
+    "bicyclewise\0"
+    "boat\0"
+    "boatage\0"
+    "boatbusiness\0"
+    "boatcharacteristic\0"
+    "boatcharger\0"
+    "boatest\0"
+    "boatfold\0"
+    "boatite\0"
+    "boative\0"
+    "boatlike\0"
+    "boatmarket\0"
+    "boatpart\0"
+    "boatparty\0"
+    "boatplace\0"
+    "boatprogram\0"
+    "boatsion\0"
+    "boatsupport\0"
+    "boatworld\0"
+    "book\0"
+    "bookal\0"
+    "bookant\0"
+    "bookboat\0"
+    "bookfamily\0"
+    "bookhand\0"
+    "bookhood\0"
+    "bookinterest\0"
+    "bookist\0"
+    "bookjob\0"
+    "bookment\0"
+    "booknation\0"
+    "bookplan\0"
+    "bookpower\0"
+    "bookprocedure\0"
+    "bookproperty\0"
+    "bookresource\0"
+    "booksion\0"
+    "booksome\0"
+    "bookspace\0"
+    "booktion\0"
+    "bookvoltage\0"
+    "bookweek\0"
+    "break\0"
+    "breakary\0"
+    "breakive\0"
+    "breaklike\0"
+    "breakship\0"
+    "breakwise\0"
+    "bring\0"
+    "bringable\0"
+    "bringant\0"
+    "bringfold\0"
+    "bringise\0"
+    "bringist\0"
+    "bringize\0"
+    "bringlike\0"
+    "bringteen\0"
+    "bringth\0"
+    "bringward\0"
+    "build\0"
+    "buildal\0"
+    "builddom\0"
+    "buildest\0"
+    "buildfold\0"
+    "buildory\0"
+    "buildtion\0"
+    "bus\0"
+    "busable\0"
+    "busal\0"
+    "busary\0"
+    "buscraft\0"
+    "bused\0"
+    "busent\0"
+    "buser\0"
+    "busfold\0"
+    "busible\0"
+    "busimplementation\0"
+    "business\0"
+    "businessant\0"
+    "businessdom\0"
+    "businessed\0"
+    "businessen\0"
+    "businessent\0"
+    "businessest\0"
+    "businessfile\0"
+    "businessfrequency\0"
+    "businessing\0"
+    "businessize\0"
+    "businessless\0"
+    "businessly\0"
+    "businessmonitor\0"
+    "businessmouse\0"
+    "businessoperation\0"
+    "businessperson\0"
+    "businessplan\0"
+    "businessplane\0"
+    "businessprocess\0"
+    "businessty\0"
+    "businessuniversity\0"
+    "businessure\0"
+    "busise\0"
+    "busless\0"
+    "busmotorcycle\0"
+    "buspackage\0"
+    "buspart\0"
+    "busposition\0"
+    "busproject\0"
+    "busreason\0"
+    "bussome\0"
+    "busstory\0"
+    "buy\0"
+    "buyic\0"
+    "buyism\0"
+    "buyward\0"
+    "cable\0"
+    "cableary\0"
+    "cablecharacteristic\0"
+    "cablecharger\0"
+    "cablecraft\0"
+    "cableday\0"
+    "cabledelivery\0"
+    "cableer\0"
+    "cablegroup\0"
+    "cablehood\0"
+    "cableial\0"
+    "cableise\0"
+    "cableist\0"
+    "cableite\0"
+    "cableive\0"
+    "cableless\0"
+    "cablelevel\0"
+    "cablelike\0"
+    "cablemouse\0"
+    "cablenetwork\0"
+    "cableous\0"
+    "cablephone\0"
+    "cableteen\0"
+    "cableterm\0"
+    "cabletion\0"
+    "cablevehicle\0"
+    "cablewoman\0"
+    "call\0"
+    "callant\0"
+    "calldom\0"
+    "caller\0"
+    "callly\0"
+    "camera\0"
+    "cameraaction\0"
+    "cameracase\0"
+    "cameracomponent\0"
+    "cameraent\0"
+    "camerahood\0"
+    "cameraial\0"
+    "cameraise\0"
+    "cameraite\0"
+    "cameraive\0"
+    "cameraize\0"
+    "cameralife\0"
+    "camerament\0"
+    "cameraness\0"
+    "cameranetwork\0"
+    "cameraory\0"
+    "cameraprogram\0"
+    "cameraquality\0"
+    "camerasome\0"
+    "camerastory\0"
+    "camerastrategy\0"
+    "camerateen\0"
+    "cameratool\0"
+    "camerawise\0"
+    "car\0"
+    "carable\0"
+    "carcraft\0"
+    "carelectricity\0"
+    "carent\0"
+    "carest\0"
+    "carfuel\0"
+    "cargovernment\0"
+    "carhood\0"
+    "carise\0"
+    "carly\0"
+    "carmaterial\0"
+    "carphone\0"
+    "carplane\0"
+    "carteen\0"
+    "case\0"
+    "caseant\0"
+    "casecharger\0"
+    "casecontroller\0"
+    "casefoundation\0"
+    "casefy\0"
+    "casehood\0"
+    "caseible\0"
+    "caseinnovation\0"
+    "caseism\0"
+    "caseless\0"
+    "casemessage\0"
+    "caseposition\0"
+    "casereport\0"
+    "caseth\0"
+    "casetion\0"
+    "caseword\0"
+    "change\0"
+    "changeable\0"
+    "changeary\0"
+    "changeism\0"
+    "changeous\0"
+    "characteristic\0"
+    "characteristicage\0"
+    "characteristicaudio\0"
+    "characteristicen\0"
+    "characteristicfy\0"
+    "characteristichouse\0"
+    "characteristicial\0"
+    "characteristicism\0"
+    "characteristicize\0"
+    "characteristiclike\0"
+    "characteristicly\0"
+    "characteristicname\0"
+    "characteristicplan\0"
+    "characteristicsion\0"
+    "characteristicsome\0"
+    "characteristicwoman\0"
+    "characteristicyear\0"
+    "charger\0"
+    "chargerable\0"
+    "chargerant\0"
+    "chargerchild\0"
+    "chargerconnector\0"
+    "chargercraft\0"
+    "chargercurrent\0"
+    "chargered\0"
+    "chargerer\0"
+    "chargerfy\0"
+    "chargergovernment\0"
+    "chargerible\0"
+    "chargerize\0"
+    "chargerly\0"
+    "chargerresearch\0"
+    "chargerright\0"
+    "chargersociety\0"
+    "chargerspace\0"
+    "chargertion\0"
+    "chargerty\0"
+    "chargerure\0"
+    "chargerwar\0"
+    "child\0"
+    "childage\0"
+    "childant\0"
+    "childbicycle\0"
+    "childdesign\0"
+    "childdirectory\0"
+    "childelement\0"
+    "childen\0"
+    "childer\0"
+    "childexperience\0"
+    "childhistory\0"
+    "childhood\0"
+    "childinterest\0"
+    "childise\0"
+    "childive\0"
+    "childless\0"
+    "childmobile\0"
+    "childnetwork\0"
+    "childorganization\0"
+    "childory\0"
+    "childous\0"
+    "childschool\0"
+    "childspecial\0"
+    "childstudent\0"
+    "childtransport\0"
+    "circuit\0"
+    "circuitable\0"
+    "circuitadapter\0"
+    "circuitconcept\0"
+    "circuitdirectory\0"
+    "circuitful\0"
+    "circuitgovernment\0"
+    "circuithistory\0"
+    "circuitise\0"
+    "circuitless\0"
+    "circuitment\0"
+    "circuitory\0"
+    "circuitous\0"
+    "circuitpicture\0"
+    "circuitsome\0"
+    "circuitstate\0"
+    "circuitteen\0"
+    "circuittruck\0"
+    "circuiture\0"
+    "coableize\0"
+    "coaction\0"
+    "coalgorithm\0"
+    "coallowary\0"
+    "coaskwise\0"
+    "coaudio\0"
+    "cobasis\0"
+    "coboat\0"
+    "cobring\0"
+    "cobusiness\0"
+    "cocall\0"
+    "cocamera\0"
+    "cocar\0"
+    "cocolor\0"
+    "cocommunication\0"
+    "cocomponent\0"
+    "coconsider\0"
+    "cocountry\0"
+    "coday\0"
+    "codelivery\0"
+    "codesign\0"
+    "codie\0"
+    "codisplay\0"
+    "codocumentation\0"
+    "coeducation\0"
+    "coelectricity\0"
+    "coelement\0"
+    "coeverfy\0"
+    "coeverwise\0"
+    "coexample\0"
+    "coexpect\0"
+    "cofact\0"
+    "cofinancial\0"
+    "cofind\0"
+    "cofolder\0"
+    "cofoundation\0"
+    "cofuel\0"
+    "cogroup\0"
+    "cogrow\0"
+    "cohand\0"
+    "cohood\0"
+    "cohouse\0"
+    "coibleible\0"
+    "cointerface\0"
+    "cointernational\0"
+    "cointernet\0"
+    "cokill\0"
+    "coknow\0"
+    "coknowsome\0"
+    "color\0"
+    "colorage\0"
+    "coloral\0"
+    "colordevelopment\0"
+    "colordom\0"
+    "colored\0"
+    "coloren\0"
+    "colorent\0"
+    "colorgroup\0"
+    "colorial\0"
+    "colorise\0"
+    "colorism\0"
+    "colorize\0"
+    "colorless\0"
+    "colorletter\0"
+    "colorlike\0"
+    "colorline\0"
+    "colormechanism\0"
+    "colormicrophone\0"
+    "colornation\0"
+    "colorous\0"
+    "colorprice\0"
+    "colorquality\0"
+    "colorsome\0"
+    "colorure\0"
+    "colorwater\0"
+    "colorwave\0"
+    "colorwebsite\0"
+    "colorweek\0"
+    "colorwise\0"
+    "comarket\0"
+    "come\0"
+    "comeable\0"
+    "comechanism\0"
+    "comeic\0"
+    "comeing\0"
+    "comeise\0"
+    "comeite\0"
+    "comeive\0"
+    "comelike\0"
+    "comement\0"
+    "comemory\0"
+    "cometeen\0"
+    "cometion\0"
+    "comeure\0"
+    "communication\0"
+    "communicationaddress\0"
+    "communicationcompany\0"
+    "communicationen\0"
+    "communicationer\0"
+    "communicationful\0"
+    "communicationist\0"
+    "communicationize\0"
+    "communicationlike\0"
+    "communicationline\0"
+    "communicationnetwork\0"
+    "communicationorder\0"
+    "communicationory\0"
+    "communicationous\0"
+    "communicationship\0"
+    "communicationwave\0"
+    "comost\0"
+    "company\0"
+    "companycable\0"
+    "companycraft\0"
+    "companycurrent\0"
+    "companydom\0"
+    "companyed\0"
+    "companyeducation\0"
+    "companyer\0"
+    "companyful\0"
+    "companyhealth\0"
+    "companyial\0"
+    "companying\0"
+    "companyise\0"
+    "companyism\0"
+    "companyist\0"
+    "companyive\0"
+    "companyless\0"
+    "companylight\0"
+    "companyorganization\0"
+    "companyparameter\0"
+    "companyplane\0"
+    "companyposition\0"
+    "companypower\0"
+    "companyprinciple\0"
+    "companyquality\0"
+    "companyresistance\0"
+    "companyschool\0"
+    "companysion\0"
+    "companysome\0"
+    "companytechnology\0"
+    "companyteen\0"
+    "companytreatment\0"
+    "component\0"
+    "componentapplication\0"
+    "componentary\0"
+    "componentcircuit\0"
+    "componentcontroller\0"
+    "componentcourse\0"
+    "componentcraft\0"
+    "componentdisplay\0"
+    "componentdom\0"
+    "componentfact\0"
+    "componentfy\0"
+    "componential\0"
+    "componentic\0"
+    "componentinstrument\0"
+    "componentive\0"
+    "componently\0"
+    "componentoperation\0"
+    "componentous\0"
+    "componentposition\0"
+    "componentreason\0"
+    "componentright\0"
+    "componentstructure\0"
+    "componenttool\0"
+    "componentyear\0"
+    "computer\0"
+    "computeradapter\0"
+    "computerary\0"
+    "computerbook\0"
+    "computercraft\0"
+    "computerent\0"
+    "computerful\0"
+    "computering\0"
+    "computerinstrument\0"
+    "computerise\0"
+    "computerist\0"
+    "computerite\0"
+    "computerpicture\0"
+    "computerplane\0"
+    "computerplatform\0"
+    "computersound\0"
+    "computerstandard\0"
+    "computertion\0"
+    "computerty\0"
+    "computerwave\0"
+    "conation\0"
+    "concept\0"
+    "conceptaddress\0"
+    "conceptage\0"
+    "conceptaudio\0"
+    "conceptcontact\0"
+    "conceptday\0"
+    "concepted\0"
+    "conceptenergy\0"
+    "concepter\0"
+    "conceptfold\0"
+    "conceptful\0"
+    "conceptfy\0"
+    "concepthistory\0"
+    "concepthood\0"
+    "conceptible\0"
+    "conceptic\0"
+    "concepting\0"
+    "conceptinnovation\0"
+    "conceptism\0"
+    "conceptize\0"
+    "conceptless\0"
+    "conceptmarket\0"
+    "conceptmobile\0"
+    "conceptnews\0"
+    "conceptroom\0"
+    "conceptsensor\0"
+    "conceptshipping\0"
+    "conceptstudy\0"
+    "conceptterm\0"
+    "concepture\0"
+    "connector\0"
+    "connectoral\0"
+    "connectorapparatus\0"
+    "connectoraudio\0"
+    "connectorbicycle\0"
+    "connectordom\0"
+    "connectoren\0"
+    "connectorent\0"
+    "connectorequipment\0"
+    "connectorfunction\0"
+    "connectorhood\0"
+    "connectorial\0"
+    "connectoric\0"
+    "connectorive\0"
+    "connectorletter\0"
+    "connectorlike\0"
+    "connectorly\0"
+    "connectormusic\0"
+    "connectorness\0"
+    "connectorory\0"
+    "connectorperformance\0"
+    "connectorsion\0"
+    "connectorstorage\0"
+    "connectorthing\0"
+    "connectortion\0"
+    "connectorty\0"
+    "connectorure\0"
+    "connectoryoung\0"
+    "consider\0"
+    "considered\0"
+    "considerent\0"
+    "considerible\0"
+    "considerly\0"
+    "constant\0"
+    "constantable\0"
+    "constanted\0"
+    "constanten\0"
+    "constantexperience\0"
+    "constantframework\0"
+    "constantful\0"
+    "constanting\0"
+    "constantintegration\0"
+    "constantlike\0"
+    "constantmechanism\0"
+    "constantprinciple\0"
+    "constantprinter\0"
+    "constantprocess\0"
+    "constantsecurity\0"
+    "constantsolution\0"
+    "constantspeaker\0"
+    "constantspecial\0"
+    "constantstory\0"
+    "constantthing\0"
+    "constantwater\0"
+    "contact\0"
+    "contactal\0"
+    "contactant\0"
+    "contactboat\0"
+    "contactcompany\0"
+    "contactdevelopment\0"
+    "contacted\0"
+    "contacten\0"
+    "contactest\0"
+    "contactfact\0"
+    "contactfold\0"
+    "contactfy\0"
+    "contacthand\0"
+    "contacthouse\0"
+    "contactinterest\0"
+    "contactist\0"
+    "contactite\0"
+    "contactmechanism\0"
+    "contactment\0"
+    "contactness\0"
+    "contactory\0"
+    "contactpackage\0"
+    "contactsecurity\0"
+    "contactside\0"
+    "contactstudy\0"
+    "contacttechnique\0"
+    "contactth\0"
+    "contacttime\0"
+    "contacttraining\0"
+    "contacture\0"
+    "contactwise\0"
+    "contactyear\0"
+    "continue\0"
+    "continueant\0"
+    "continuefold\0"
+    "continuefy\0"
+    "continuety\0"
+    "continueward\0"
+    "controller\0"
+    "controllerdom\0"
+    "controlleren\0"
+    "controllerest\0"
+    "controllerfold\0"
+    "controllerfuel\0"
+    "controllergovernment\0"
+    "controllerible\0"
+    "controllerise\0"
+    "controllerism\0"
+    "controllerize\0"
+    "controllerjob\0"
+    "controllermechanism\0"
+    "controllerness\0"
+    "controllerory\0"
+    "controllersupport\0"
+    "controllerth\0"
+    "controllerure\0"
+    "controllervideo\0"
+    "controllerward\0"
+    "cooffice\0"
+    "coorder\0"
+    "copackage\0"
+    "copaperic\0"
+    "coparty\0"
+    "copass\0"
+    "copath\0"
+    "copay\0"
+    "copayable\0"
+    "cophone\0"
+    "cophoto\0"
+    "copicture\0"
+    "coplan\0"
+    "coplane\0"
+    "coplatform\0"
+    "coprocess\0"
+    "coproperty\0"
+    "coprovide\0"
+    "coprovidefy\0"
+    "coquality\0"
+    "coradiation\0"
+    "corememberward\0"
+    "coreporttion\0"
+    "coresource\0"
+    "coschool\0"
+    "coscience\0"
+    "coscreen\0"
+    "cosecurity\0"
+    "coseem\0"
+    "coseemive\0"
+    "coshipping\0"
+    "cosociety\0"
+    "cospeakfy\0"
+    "cosystem\0"
+    "cosystemary\0"
+    "cotakefold\0"
+    "cotakeist\0"
+    "cotakeite\0"
+    "cotechnicaled\0"
+    "cotechnique\0"
+    "cotechnology\0"
+    "coterm\0"
+    "cotime\0"
+    "cotool\0"
+    "cotransport\0"
+    "cotruck\0"
+    "counderstand\0"
+    "couniversity\0"
+    "counteradapter\0"
+    "counteradd\0"
+    "counterappearhood\0"
+    "counterapplication\0"
+    "counterask\0"
+    "counteraudio\0"
+    "counterbook\0"
+    "counterbus\0"
+    "counterbusiness\0"
+    "countercase\0"
+    "counterchild\0"
+    "countercolor\0"
+    "countercommunication\0"
+    "countercompany\0"
+    "counterconcept\0"
+    "counterconstant\0"
+    "countercourse\0"
+    "countercutfy\0"
+    "counterday\0"
+    "counterdelivery\0"
+    "counterdevice\0"
+    "counterdisplay\0"
+    "counterdocument\0"
+    "counterelectricity\0"
+    "countereverite\0"
+    "counterexpectteen\0"
+    "counterfallable\0"
+    "counterfamily\0"
+    "counterfeature\0"
+    "counterfinancialtion\0"
+    "counterfolder\0"
+    "counterfoundation\0"
+    "counterfunction\0"
+    "countergrow\0"
+    "countergrowth\0"
+    "counterhand\0"
+    "counterhouse\0"
+    "counterible\0"
+    "counterinclude\0"
+    "counterinformation\0"
+    "counterinnovation\0"
+    "counterjob\0"
+    "counterless\0"
+    "counterlivesion\0"
+    "countermaintenance\0"
+    "countermember\0"
+    "counterment\0"
+    "countermessage\0"
+    "countermobile\0"
+    "countermodel\0"
+    "countermoney\0"
+    "countername\0"
+    "counternatural\0"
+    "counternaturally\0"
+    "counternature\0"
+    "counternumber\0"
+    "counteroffer\0"
+    "counteroffice\0"
+    "counteropen\0"
+    "counteroperation\0"
+    "counterorder\0"
+    "counterpaper\0"
+    "counterparameter\0"
+    "counterpass\0"
+    "counterpattern\0"
+    "counterpeople\0"
+    "counterpersonal\0"
+    "counterpick\0"
+    "counterpickth\0"
+    "counterplane\0"
+    "counterplay\0"
+    "counterpolitical\0"
+    "counterpower\0"
+    "counterprinciple\0"
+    "counterprinter\0"
+    "counterprocedure\0"
+    "counterprogram\0"
+    "counterproject\0"
+    "counterpullary\0"
+    "counterquality\0"
+    "counterquestion\0"
+    "counterreport\0"
+    "counterrequire\0"
+    "counterresearch\0"
+    "counterresult\0"
+    "counterroom\0"
+    "counterscanner\0"
+    "counterscreen\0"
+    "countersell\0"
+    "countersend\0"
+    "countersensor\0"
+    "countershipping\0"
+    "countersocial\0"
+    "countersocialism\0"
+    "countersound\0"
+    "counterspeakent\0"
+    "counterstorage\0"
+    "counterstory\0"
+    "counterstructure\0"
+    "counterstudy\0"
+    "countersupport\0"
+    "countersystem\0"
+    "countersystemal\0"
+    "countertechnology\0"
+    "counterterm\0"
+    "counterthink\0"
+    "countertool\0"
+    "countertravel\0"
+    "counteruniversity\0"
+    "countervoltage\0"
+    "counterwantsion\0"
+    "counterwave\0"
+    "counterweek\0"
+    "counterwhat\0"
+    "counterwhenship\0"
+    "counterwork\0"
+    "counterworkible\0"
+    "counteryoung\0"
+    "country\0"
+    "countryage\0"
+    "countryboat\0"
+    "countrycharger\0"
+    "countrycomponent\0"
+    "countrydevice\0"
+    "countryed\0"
+    "countryefficiency\0"
+    "countryer\0"
+    "countryfold\0"
+    "countryfuel\0"
+    "countryful\0"
+    "countrygraphic\0"
+    "countryial\0"
+    "countryible\0"
+    "countryic\0"
+    "countryise\0"
+    "countryism\0"
+    "countrylike\0"
+    "countrymachine\0"
+    "countrymarket\0"
+    "countrynumber\0"
+    "countryperformance\0"
+    "countryplatform\0"
+    "countryscreen\0"
+    "countrysion\0"
+    "countrystudent\0"
+    "countrytime\0"
+    "countryty\0"
+    "course\0"
+    "courseal\0"
+    "courseant\0"
+    "courseboat\0"
+    "courseed\0"
+    "courseen\0"
+    "courseenergy\0"
+    "courseest\0"
+    "coursefold\0"
+    "courseful\0"
+    "courseial\0"
+    "courseinstrument\0"
+    "courseive\0"
+    "courseize\0"
+    "coursement\0"
+    "coursenature\0"
+    "courseness\0"
+    "coursepoint\0"
+    "coursepolicy\0"
+    "courseship\0"
+    "coursesion\0"
+    "coursesome\0"
+    "coursetool\0"
+    "courseure\0"
+    "courseward\0"
+    "covalue\0"
+    "covariable\0"
+    "covideo\0"
+    "cowalk\0"
+    "cowalkly\0"
+    "cowar\0"
+    "coway\0"
+    "cowhat\0"
+    "create\0"
+    "createfy\0"
+    "createing\0"
+    "createive\0"
+    "createness\0"
+    "createship\0"
+    "createsome\0"
+    "cultural\0"
+    "culturalal\0"
+    "culturalant\0"
+    "culturaler\0"
+    "current\0"
+    "currentable\0"
+    "currentary\0"
+    "currentdom\0"
+    "currenthood\0"
+    "currential\0"
+    "currenting\0"
+    "currentise\0"
+    "currentmaintenance\0"
+    "currentmaterial\0"
+    "currentmonitor\0"
+    "currentmusic\0"
+    "currentnetwork\0"
+    "currentoptimization\0"
+    "currentpattern\0"
+    "currentphone\0"
+    "currentprogram\0"
+    "currentroom\0"
+    "currentship\0"
+    "currentsome\0"
+    "currentteen\0"
+    "currenttion\0"
+    "currenttraining\0"
+    "currentty\0"
+    "currenture\0"
+    "currentward\0"
+    "currentyear\0"
+    "cut\0"
+    "cuter\0"
+    "cutful\0"
+    "cutial\0"
+    "cuting\0"
+    "cutize\0"
+    "cutlike\0"
+    "cutship\0"
+    "cuture\0"
+    "database\0"
+    "databaseary\0"
+    "databaseconnector\0"
+    "databaseer\0"
+    "databaseest\0"
+    "databaseexample\0"
+    "databasefold\0"
+    "databaseheadphone\0"
+    "databasehealth\0"
+    "databasehood\0"
+    "databasehouse\0"
+    "databaseic\0"
+    "databaseintegration\0"
+    "databasejob\0"
+    "databaselike\0"
+    "databasely\0"
+    "databasement\0"
+    "databasemoney\0"
+    "databasenumber\0"
+    "databaseoperation\0"
+    "databaseoptimization\0"
+    "databaseous\0"
+    "databaseproject\0"
+    "databaseship\0"
+    "databaseside\0"
+    "databasetransport\0"
+    "databasety\0"
+    "databaseure\0"
+    "databasework\0"
+    "day\0"
+    "dayboat\0"
+    "daycommunication\0"
+    "daycraft\0"
+    "dayday\0"
+    "dayed\0"
+    "dayent\0"
+    "dayfolder\0"
+    "dayfy\0"
+    "dayhood\0"
+    "dayite\0"
+    "dayize\0"
+    "dayless\0"
+    "daymouse\0"
+    "dayness\0"
+    "dayparty\0"
+    "dayplace\0"
+    "dayplatform\0"
+    "dayth\0"
+    "deadapter\0"
+    "deaddress\0"
+    "deanalysis\0"
+    "debook\0"
+    "debuilding\0"
+    "decase\0"
+    "decharger\0"
+    "decide\0"
+    "decidecraft\0"
+    "decideial\0"
+    "decideing\0"
+    "decidely\0"
+    "decideness\0"
+    "decideory\0"
+    "decideward\0"
+    "decidewise\0"
+    "deconnector\0"
+    "decreate\0"
+    "deculturalial\0"
+    "decutteen\0"
+    "dedesign\0"
+    "dedevelopment\0"
+    "dedocument\0"
+    "deeconomicen\0"
+    "deend\0"
+    "deequipment\0"
+    "deever\0"
+    "deexample\0"
+    "deexperience\0"
+    "defallal\0"
+    "defeel\0"
+    "defind\0"
+    "degiveable\0"
+    "deglobal\0"
+    "degraphic\0"
+    "deheadphone\0"
+    "dehistory\0"
+    "deiblelike\0"
+    "deimage\0"
+    "deimplementation\0"
+    "deinnovation\0"
+    "deinstrument\0"
+    "deintegration\0"
+    "deinterface\0"
+    "dekill\0"
+    "deknowless\0"
+    "deknowory\0"
+    "deleave\0"
+    "deliveen\0"
+    "delivery\0"
+    "deliveryage\0"
+    "deliveryalgorithm\0"
+    "deliverycomputer\0"
+    "deliverycourse\0"
+    "deliverydom\0"
+    "deliveryest\0"
+    "deliveryful\0"
+    "deliveryial\0"
+    "deliveryible\0"
+    "deliveryism\0"
+    "deliverylight\0"
+    "deliverymotorcycle\0"
+    "deliveryous\0"
+    "deliverypoint\0"
+    "deliveryquestion\0"
+    "deliveryresult\0"
+    "deliverystory\0"
+    "deliverytreatment\0"
+    "deliveryvideo\0"
+    "deliveryvoltage\0"
+    "deliveryweek\0"
+    "deliverywoman\0"
+    "deloveal\0"
+    "demethod\0"
+    "demodel\0"
+    "demonitor\0"
+    "demotor\0"
+    "demotorcycle\0"
+    "demove\0"
+    "demusic\0"
+    "dename\0"
+    "denational\0"
+    "denatural\0"
+    "denaturallike\0"
+    "denews\0"
+    "deofferly\0"
+    "deoffice\0"
+    "deorganization\0"
+    "depackage\0"
+    "depart\0"
+    "depass\0"
+    "deperformance\0"
+    "deperson\0"
+    "dephoto\0"
+    "depick\0"
+    "depicture\0"
+    "deplace\0"
+    "deplane\0"
+    "deplayial\0"
+    "depoint\0"
+    "depoliticalal\0"
+    "deprinciple\0"
+    "deprogram\0"
+    "deproject\0"
+    "deproperty\0"
+    "depublic\0"
+    "dequestion\0"
+    "dereachen\0"
+    "dereport\0"
+    "dereportive\0"
+    "deresistance\0"
+    "deright\0"
+    "deroom\0"
+    "descanner\0"
+    "deschool\0"
+    "desensor\0"
+    "deset\0"
+    "deship\0"
+    "design\0"
+    "designcommunication\0"
+    "designen\0"
+    "designenergy\0"
+    "designest\0"
+    "designfeature\0"
+    "designise\0"
+    "designlike\0"
+    "designly\0"
+    "designmanagement\0"
+    "designment\0"
+    "designmicrophone\0"
+    "designory\0"
+    "designpicture\0"
+    "designplace\0"
+    "designpoint\0"
+    "designprice\0"
+    "designreason\0"
+    "designship\0"
+    "designure\0"
+    "desionest\0"
+    "desolution\0"
+    "despend\0"
+    "destayible\0"
+    "destrategy\0"
+    "desystem\0"
+    "dething\0"
+    "detrade\0"
+    "detrain\0"
+    "detravel\0"
+    "detruck\0"
+    "detryite\0"
+    "deunderstand\0"
+    "deunderstandship\0"
+    "devehicle\0"
+    "development\0"
+    "developmental\0"
+    "developmentalgorithm\0"
+    "developmentent\0"
+    "developmentequipment\0"
+    "developmentfold\0"
+    "developmentful\0"
+    "developmentfunction\0"
+    "developmentgrowth\0"
+    "developmentinternet\0"
+    "developmentless\0"
+    "developmentplatform\0"
+    "developmentstate\0"
+    "developmenttion\0"
+    "developmenttraining\0"
+    "device\0"
+    "deviceable\0"
+    "deviceage\0"
+    "deviceal\0"
+    "deviceant\0"
+    "deviceary\0"
+    "devicecontact\0"
+    "devicecraft\0"
+    "deviceen\0"
+    "deviceengine\0"
+    "deviceest\0"
+    "devicefy\0"
+    "devicegovernment\0"
+    "devicehood\0"
+    "deviceial\0"
+    "deviceive\0"
+    "deviceize\0"
+    "devicejob\0"
+    "deviceless\0"
+    "devicely\0"
+    "devicematerial\0"
+    "devicement\0"
+    "devicemobile\0"
+    "deviceness\0"
+    "deviceproblem\0"
+    "devicescanner\0"
+    "deviceship\0"
+    "devicespace\0"
+    "devicespeaker\0"
+    "devicetime\0"
+    "devicetion\0"
+    "devicetransport\0"
+    "deviceure\0"
+    "deviceweek\0"
+    "deviceworld\0"
+    "devideo\0"
+    "devoltage\0"
+    "dewar\0"
+    "dewatchen\0"
+    "deway\0"
+    "dewear\0"
+    "deworld\0"
+    "deyear\0"
+    "deyoung\0"
+    "die\0"
+    "dieant\0"
+    "dieer\0"
+    "diement\0"
+    "dieness\0"
+    "diewise\0"
+    "digital\0"
+    "digitalant\0"
+    "digitalic\0"
+    "digitalness\0"
+    "digitalory\0"
+    "digitalsion\0"
+    "directory\0"
+    "directorycase\0"
+    "directorycomponent\0"
+    "directorycomputer\0"
+    "directorydom\0"
+    "directoryinformation\0"
+    "directoryise\0"
+    "directoryism\0"
+    "directoryist\0"
+    "directoryize\0"
+    "directoryless\0"
+    "directoryly\0"
+    "directorymaintenance\0"
+    "directoryment\0"
+    "directoryness\0"
+    "directorypart\0"
+    "directorypoint\0"
+    "directoryradiation\0"
+    "directorystructure\0"
+    "directoryteen\0"
+    "directorytreatment\0"
+    "directoryure\0"
+    "directorywise\0"
+    "disaction\0"
+    "disallowsome\0"
+    "disanalysis\0"
+    "disappear\0"
+    "disappearteen\0"
+    "disapplication\0"
+    "disarchitecture\0"
+    "disattribute\0"
+    "disaudio\0"
+    "disboat\0"
+    "disbring\0"
+    "disbuy\0"
+    "discallty\0"
+    "discar\0"
+    "discharacteristic\0"
+    "dischild\0"
+    "discircuit\0"
+    "discomeive\0"
+    "discommunication\0"
+    "disconstant\0"
+    "discreate\0"
+    "discreateen\0"
+    "discurrent\0"
+    "disday\0"
+    "disdevelopment\0"
+    "disdevice\0"
+    "disdigitalive\0"
+    "disdirectory\0"
+    "disdocument\0"
+    "disefficiency\0"
+    "disemail\0"
+    "disengine\0"
+    "disexample\0"
+    "disfact\0"
+    "disfinancialwise\0"
+    "disfind\0"
+    "disframework\0"
+    "disfull\0"
+    "disglobal\0"
+    "disgovernment\0"
+    "disgraphic\0"
+    "dishood\0"
+    "disiblelike\0"
+    "disimage\0"
+    "disincludeent\0"
+    "disinformation\0"
+    "disinterface\0"
+    "disinternet\0"
+    "diskeyboard\0"
+    "dislesssome\0"
+    "dislevel\0"
+    "dislikeable\0"
+    "dislikeism\0"
+    "disline\0"
+    "dislivefold\0"
+    "dislocal\0"
+    "dislook\0"
+    "dislove\0"
+    "dismember\0"
+    "dismessage\0"
+    "dismethod\0"
+    "dismoney\0"
+    "dismonitor\0"
+    "dismostage\0"
+    "dismotor\0"
+    "dismotorcycle\0"
+    "dismouse\0"
+    "dismusic\0"
+    "disnational\0"
+    "disnationalist\0"
+    "disnaturalous\0"
+    "disness\0"
+    "disnumber\0"
+    "disoffer\0"
+    "disofferal\0"
+    "disparameter\0"
+    "dispattern\0"
+    "dispayfy\0"
+    "dispayward\0"
+    "dispeople\0"
+    "disperformance\0"
+    "disperson\0"
+    "display\0"
+    "displayary\0"
+    "displayboat\0"
+    "displayent\0"
+    "displayequipment\0"
+    "displayest\0"
+    "displayfold\0"
+    "displayhood\0"
+    "displayinternet\0"
+    "displayise\0"
+    "displayite\0"
+    "displayive\0"
+    "displayless\0"
+    "displayly\0"
+    "displaymachine\0"
+    "displayness\0"
+    "displayoperation\0"
+    "displayory\0"
+    "displayreport\0"
+    "displayschool\0"
+    "displayship\0"
+    "displaysome\0"
+    "displayterm\0"
+    "displayty\0"
+    "displayvalue\0"
+    "displayvehicle\0"
+    "displaywebsite\0"
+    "dispoint\0"
+    "dispower\0"
+    "disprinciple\0"
+    "disprinter\0"
+    "disproblem\0"
+    "disprocedure\0"
+    "disprocess\0"
+    "disprocessor\0"
+    "disproductivity\0"
+    "disprogramship\0"
+    "disraisewise\0"
+    "disreport\0"
+    "disreportth\0"
+    "disright\0"
+    "disscience\0"
+    "disscreen\0"
+    "dissecurity\0"
+    "disservice\0"
+    "disshipping\0"
+    "dission\0"
+    "dissocialsion\0"
+    "dissolution\0"
+    "dissome\0"
+    "dissound\0"
+    "disspeak\0"
+    "disspeaker\0"
+    "disspecial\0"
+    "disstandment\0"
+    "disstopsion\0"
+    "disstorage\0"
+    "disstory\0"
+    "disstrategy\0"
+    "disstudy\0"
+    "distechnique\0"
+    "distheory\0"
+    "distime\0"
+    "distruck\0"
+    "disvariable\0"
+    "disvehicle\0"
+    "diswardwise\0"
+    "diswin\0"
+    "disword\0"
+    "diswork\0"
+    "disyoung\0"
+    "document\0"
+    "documentation\0"
+    "documentationconcept\0"
+    "documentationdom\0"
+    "documentationhood\0"
+    "documentationible\0"
+    "documentationing\0"
+    "documentationist\0"
+    "documentationite\0"
+    "documentationize\0"
+    "documentationless\0"
+    "documentationness\0"
+    "documentationprogram\0"
+    "documentationsound\0"
+    "documentationure\0"
+    "documentationward\0"
+    "documentcable\0"
+    "documentcomputer\0"
+    "documentent\0"
+    "documentfamily\0"
+    "documentfold\0"
+    "documenting\0"
+    "documentinterest\0"
+    "documently\0"
+    "documentmoney\0"
+    "documentorganization\0"
+    "documentous\0"
+    "documentplace\0"
+    "documentposition\0"
+    "documentprice\0"
+    "documentship\0"
+    "documentspecial\0"
+    "documenttime\0"
+    "documentword\0"
+    "economic\0"
+    "economicage\0"
+    "economical\0"
+    "economicteen\0"
+    "economicwise\0"
+    "education\0"
+    "educationaddress\0"
+    "educational\0"
+    "educationaled\0"
+    "educationalist\0"
+    "educationalless\0"
+    "educationalment\0"
+    "educationalness\0"
+    "educationalous\0"
+    "educationalsome\0"
+    "educationalth\0"
+    "educationattribute\0"
+    "educationcamera\0"
+    "educationconstant\0"
+    "educationdocument\0"
+    "educationelement\0"
+    "educationer\0"
+    "educationfact\0"
+    "educationfolder\0"
+    "educationly\0"
+    "educationous\0"
+    "educationphoto\0"
+    "educationpoint\0"
+    "educationquality\0"
+    "educationradiation\0"
+    "educationtravel\0"
+    "educationty\0"
+    "educationway\0"
+    "educationwebsite\0"
+    "efficiency\0"
+    "efficiencyable\0"
+    "efficiencyage\0"
+    "efficiencyal\0"
+    "efficiencycable\0"
+    "efficiencyed\0"
+    "efficiencyer\0"
+    "efficiencyfamily\0"
+    "efficiencyfold\0"
+    "efficiencyive\0"
+    "efficiencynature\0"
+    "efficiencyphone\0"
+    "efficiencyproject\0"
+    "efficiencyscreen\0"
+    "efficiencyth\0"
+    "efficiencyvehicle\0"
+    "efficiencywise\0"
+    "efficiencywork\0"
+    "electricity\0"
+    "electricityconcept\0"
+    "electricityday\0"
+    "electricityen\0"
+    "electricityfold\0"
+    "electricityful\0"
+    "electricityial\0"
+    "electricityinterest\0"
+    "electricityinternet\0"
+    "electricityize\0"
+    "electricityless\0"
+    "electricityly\0"
+    "electricitymobile\0"
+    "electricityness\0"
+    "electricityparty\0"
+    "electricitysecurity\0"
+    "electricityship\0"
+    "electricitytreatment\0"
+    "electricityure\0"
+    "element\0"
+    "elementable\0"
+    "elementdocument\0"
+    "elementend\0"
+    "elementest\0"
+    "elementfold\0"
+    "elemential\0"
+    "elementing\0"
+    "elementmemory\0"
+    "elementoptimization\0"
+    "elementsion\0"
+    "elementsomething\0"
+    "elementsound\0"
+    "elementtion\0"
+    "elementure\0"
+    "elementyoung\0"
+    "email\0"
+    "emailarchitecture\0"
+    "emaildocument\0"
+    "emailest\0"
+    "emailfy\0"
+    "emailize\0"
+    "emailmarket\0"
+    "emailment\0"
+    "emailmodel\0"
+    "emailness\0"
+    "emailoffice\0"
+    "emailpath\0"
+    "emailpoint\0"
+    "emailpower\0"
+    "emailprocessor\0"
+    "emailresearch\0"
+    "emailship\0"
+    "emailshipping\0"
+    "emailsoftware\0"
+    "emailth\0"
+    "emailtrain\0"
+    "emailvalue\0"
+    "emailworld\0"
+    "enableory\0"
+    "enadapter\0"
+    "enadder\0"
+    "enaddress\0"
+    "enapplication\0"
+    "enarchitecture\0"
+    "enask\0"
+    "enattribute\0"
+    "enbook\0"
+    "enbringible\0"
+    "enbringite\0"
+    "encable\0"
+    "encase\0"
+    "encharacteristic\0"
+    "encharger\0"
+    "enchild\0"
+    "encome\0"
+    "encomputer\0"
+    "enconsiderent\0"
+    "enculturaldom\0"
+    "encurrent\0"
+    "encut\0"
+    "end\0"
+    "enday\0"
+    "endcompany\0"
+    "enddevelopment\0"
+    "endevelopment\0"
+    "endevice\0"
+    "endframework\0"
+    "endfrequency\0"
+    "endfuel\0"
+    "endfy\0"
+    "endic\0"
+    "endize\0"
+    "endless\0"
+    "endmanagement\0"
+    "endnature\0"
+    "endocumentation\0"
+    "endous\0"
+    "endperformance\0"
+    "endprinciple\0"
+    "endsignal\0"
+    "endtion\0"
+    "eneconomic\0"
+    "eneducation\0"
+    "enelectricity\0"
+    "enengine\0"
+    "enequipment\0"
+    "energy\0"
+    "energyaction\0"
+    "energyaddress\0"
+    "energyal\0"
+    "energyarea\0"
+    "energycomputer\0"
+    "energyelement\0"
+    "energyemail\0"
+    "energyen\0"
+    "energyend\0"
+    "energyer\0"
+    "energyfile\0"
+    "energyframework\0"
+    "energyhome\0"
+    "energyhouse\0"
+    "energyible\0"
+    "energyite\0"
+    "energyless\0"
+    "energymoney\0"
+    "energyory\0"
+    "energyproductivity\0"
+    "energysignal\0"
+    "energystructure\0"
+    "energystudent\0"
+    "energytion\0"
+    "energyward\0"
+    "energywise\0"
+    "enfact\0"
+    "enfamily\0"
+    "enfullen\0"
+    "engine\0"
+    "enginealgorithm\0"
+    "enginebicycle\0"
+    "engineen\0"
+    "engineest\0"
+    "enginehome\0"
+    "engineive\0"
+    "enginemaintenance\0"
+    "enginement\0"
+    "enginemoney\0"
+    "enginemonitor\0"
+    "enginenature\0"
+    "engineoptimization\0"
+    "engineous\0"
+    "engineright\0"
+    "enginesome\0"
+    "enginetheory\0"
+    "enginevideo\0"
+    "engineward\0"
+    "engraphic\0"
+    "engroup\0"
+    "enhand\0"
+    "enheadphone\0"
+    "enhealth\0"
+    "enhoodty\0"
+    "enhouse\0"
+    "enibleing\0"
+    "enintegration\0"
+    "eninterface\0"
+    "eninternational\0"
+    "enjob\0"
+    "enkeyboard\0"
+    "enkillsion\0"
+    "enleadous\0"
+    "enlearn\0"
+    "enleavesome\0"
+    "enlessive\0"
+    "enletter\0"
+    "enlevel\0"
+    "enlook\0"
+    "enlooker\0"
+    "enloveing\0"
+    "enmachine\0"
+    "enmedicalable\0"
+    "enmeet\0"
+    "enment\0"
+    "enmessage\0"
+    "enmonitor\0"
+    "enmotor\0"
+    "enmouse\0"
+    "ennation\0"
+    "ennatural\0"
+    "enness\0"
+    "ennetwork\0"
+    "enoffer\0"
+    "enofferward\0"
+    "enopen\0"
+    "enoperation\0"
+    "enpart\0"
+    "enpay\0"
+    "enperson\0"
+    "enphone\0"
+    "enphoto\0"
+    "enpick\0"
+    "enpicture\0"
+    "enplace\0"
+    "enplane\0"
+    "enproblem\0"
+    "enproductivity\0"
+    "enpublic\0"
+    "enreachite\0"
+    "enread\0"
+    "enreadage\0"
+    "enremainial\0"
+    "enrememberwise\0"
+    "enrequireary\0"
+    "enresearch\0"
+    "enscanner\0"
+    "ensendcraft\0"
+    "enservice\0"
+    "enset\0"
+    "enshipping\0"
+    "ensit\0"
+    "ensolution\0"
+    "ensomething\0"
+    "ensound\0"
+    "enspace\0"
+    "enspeaker\0"
+    "enstandard\0"
+    "enstructure\0"
+    "enstudent\0"
+    "ensuggest\0"
+    "ensystem\0"
+    "ensystemism\0"
+    "entechnical\0"
+    "entechnology\0"
+    "entime\0"
+    "entrain\0"
+    "entruck\0"
+    "entry\0"
+    "enunderstand\0"
+    "enunderstandism\0"
+    "enuniversity\0"
+    "envariable\0"
+    "enwait\0"
+    "enwalk\0"
+    "enwalksome\0"
+    "enwater\0"
+    "enwave\0"
+    "enway\0"
+    "enwear\0"
+    "enweek\0"
+    "enwhere\0"
+    "enwhich\0"
+    "enwiner\0"
+    "enwinure\0"
+    "enwiseed\0"
+    "enyoung\0"
+    "equipment\0"
+    "equipmentant\0"
+    "equipmentapplication\0"
+    "equipmentary\0"
+    "equipmentcable\0"
+    "equipmentcomputer\0"
+    "equipmentcraft\0"
+    "equipmentcurrent\0"
+    "equipmentfold\0"
+    "equipmentfuel\0"
+    "equipmentfy\0"
+    "equipmenthood\0"
+    "equipmentist\0"
+    "equipmentite\0"
+    "equipmentless\0"
+    "equipmentmicrophone\0"
+    "equipmentname\0"
+    "equipmentness\0"
+    "equipmentous\0"
+    "equipmentpackage\0"
+    "equipmentproject\0"
+    "equipmentpublic\0"
+    "equipmentradiation\0"
+    "equipmentroom\0"
+    "equipmentsion\0"
+    "equipmentstudent\0"
+    "equipmenttool\0"
+    "equipmenture\0"
+    "equipmentwar\0"
+    "equipmentward\0"
+    "ever\0"
+    "everage\0"
+    "everary\0"
+    "everdom\0"
+    "everfy\0"
+    "example\0"
+    "exampleary\0"
+    "examplecamera\0"
+    "examplecharger\0"
+    "examplecontact\0"
+    "exampleen\0"
+    "exampleent\0"
+    "exampleequipment\0"
+    "exampleest\0"
+    "examplefy\0"
+    "exampleing\0"
+    "exampleinterest\0"
+    "examplely\0"
+    "examplemarket\0"
+    "examplemethod\0"
+    "exampleness\0"
+    "exampleprinter\0"
+    "exampleth\0"
+    "exampletion\0"
+    "exampleworld\0"
+    "exampleyoung\0"
+    "expect\0"
+    "expectary\0"
+    "expecter\0"
+    "expectize\0"
+    "experience\0"
+    "experienceant\0"
+    "experiencecomputer\0"
+    "experienceed\0"
+    "experienceemail\0"
+    "experienceend\0"
+    "experienceent\0"
+    "experienceer\0"
+    "experienceible\0"
+    "experienceism\0"
+    "experienceless\0"
+    "experiencely\0"
+    "experiencemachine\0"
+    "experiencemethod\0"
+    "experienceory\0"
+    "experiencepattern\0"
+    "experiencesupport\0"
+    "experienceteen\0"
+    "experiencewise\0"
+    "extraable\0"
+    "extraactivity\0"
+    "extraaddism\0"
+    "extraaddress\0"
+    "extraanalysis\0"
+    "extraapplication\0"
+    "extrabasis\0"
+    "extrabicycle\0"
+    "extrabuild\0"
+    "extrabus\0"
+    "extracable\0"
+    "extracamera\0"
+    "extracar\0"
+    "extracontact\0"
+    "extracontroller\0"
+    "extracreate\0"
+    "extraculturalable\0"
+    "extradesign\0"
+    "extradisplay\0"
+    "extradocumentation\0"
+    "extraeducation\0"
+    "extraeducational\0"
+    "extraemail\0"
+    "extraend\0"
+    "extraengine\0"
+    "extrafall\0"
+    "extrafamily\0"
+    "extrafile\0"
+    "extraframework\0"
+    "extragiveise\0"
+    "extragively\0"
+    "extragraphic\0"
+    "extragroup\0"
+    "extragrow\0"
+    "extraheadphone\0"
+    "extrahistorical\0"
+    "extraholdite\0"
+    "extraholdive\0"
+    "extrahoodteen\0"
+    "extraincludecraft\0"
+    "extrainformation\0"
+    "extrainstrument\0"
+    "extraintegration\0"
+    "extrainterest\0"
+    "extrajob\0"
+    "extralessary\0"
+    "extraletter\0"
+    "extralife\0"
+    "extralike\0"
+    "extraliketh\0"
+    "extraline\0"
+    "extralive\0"
+    "extralook\0"
+    "extralookize\0"
+    "extramanagement\0"
+    "extrament\0"
+    "extramodel\0"
+    "extramoney\0"
+    "extramotor\0"
+    "extramotorcycle\0"
+    "extranews\0"
+    "extranumber\0"
+    "extraparty\0"
+    "extrapattern\0"
+    "extrapaylike\0"
+    "extraphoto\0"
+    "extrapicture\0"
+    "extraplayth\0"
+    "extrapoint\0"
+    "extraposition\0"
+    "extraprice\0"
+    "extraprofessionaler\0"
+    "extraproperty\0"
+    "extrapullment\0"
+    "extraquestionic\0"
+    "extraquestiontion\0"
+    "extrareadary\0"
+    "extraresistance\0"
+    "extraresult\0"
+    "extraschool\0"
+    "extrascientific\0"
+    "extrasellism\0"
+    "extrasensor\0"
+    "extrasetward\0"
+    "extrashipping\0"
+    "extrasignal\0"
+    "extrasocial\0"
+    "extrasociallike\0"
+    "extrasolution\0"
+    "extrasomeise\0"
+    "extraspace\0"
+    "extraspeaker\0"
+    "extraspendant\0"
+    "extrastand\0"
+    "extrastandtion\0"
+    "extrastate\0"
+    "extrastopward\0"
+    "extrastrategy\0"
+    "extrastudy\0"
+    "extrasuggest\0"
+    "extrasystem\0"
+    "extratechnology\0"
+    "extrathink\0"
+    "extratime\0"
+    "extratrade\0"
+    "extratrain\0"
+    "extratraining\0"
+    "extratransport\0"
+    "extratravel\0"
+    "extratreatment\0"
+    "extratruck\0"
+    "extravalue\0"
+    "extravehicle\0"
+    "extraway\0"
+    "extrawearty\0"
+    "extrawebsite\0"
+    "extrawhenic\0"
+    "extrawhereure\0"
+    "extraword\0"
+    "extrawrite\0"
+    "extrawritetion\0"
+    "fact\0"
+    "factelement\0"
+    "factent\0"
+    "factise\0"
+    "factless\0"
+    "factresource\0"
+    "factship\0"
+    "factstory\0"
+    "facttion\0"
+    "facttruck\0"
+    "factty\0"
+    "facture\0"
+    "factward\0"
+    "fall\0"
+    "falldom\0"
+    "fallen\0"
+    "fallent\0"
+    "fallize\0"
+    "fallteen\0"
+    "fallward\0"
+    "family\0"
+    "familyable\0"
+    "familyage\0"
+    "familycraft\0"
+    "familyen\0"
+    "familyent\0"
+    "familyer\0"
+    "familyest\0"
+    "familyful\0"
+    "familygovernment\0"
+    "familygrowth\0"
+    "familyise\0"
+    "familyism\0"
+    "familylike\0"
+    "familyline\0"
+    "familyment\0"
+    "familymonitor\0"
+    "familymotor\0"
+    "familyprinter\0"
+    "familyproductivity\0"
+    "familyschool\0"
+    "familystate\0"
+    "familystructure\0"
+    "familyteen\0"
+    "familytheory\0"
+    "familywise\0"
+    "familywork\0"
+    "feature\0"
+    "featureadapter\0"
+    "featureanalysis\0"
+    "featureconnector\0"
+    "featurecraft\0"
+    "featuredocumentation\0"
+    "featureeducation\0"
+    "featureer\0"
+    "featureest\0"
+    "featurefold\0"
+    "featureful\0"
+    "featuregraphic\0"
+    "featureise\0"
+    "featureize\0"
+    "featureless\0"
+    "featureness\0"
+    "featureory\0"
+    "featureteen\0"
+    "featureterm\0"
+    "featureth\0"
+    "featuretravel\0"
+    "featuretruck\0"
+    "featurety\0"
+    "featurework\0"
+    "feel\0"
+    "feelable\0"
+    "feelal\0"
+    "feelent\0"
+    "feelful\0"
+    "feelive\0"
+    "feellike\0"
+    "feelure\0"
+    "file\0"
+    "fileaction\0"
+    "fileant\0"
+    "fileary\0"
+    "filecharacteristic\0"
+    "filecraft\0"
+    "filedesign\0"
+    "filedevice\0"
+    "filedirectory\0"
+    "filefoundation\0"
+    "filefy\0"
+    "filehome\0"
+    "fileible\0"
+    "fileing\0"
+    "fileise\0"
+    "fileism\0"
+    "fileive\0"
+    "fileless\0"
+    "filelight\0"
+    "filelike\0"
+    "filelocation\0"
+    "filemechanism\0"
+    "filement\0"
+    "fileory\0"
+    "fileprogram\0"
+    "filesion\0"
+    "fileteen\0"
+    "filetheory\0"
+    "fileward\0"
+    "financial\0"
+    "financialable\0"
+    "financialest\0"
+    "financialial\0"
+    "financialism\0"
+    "financialize\0"
+    "financialory\0"
+    "financialteen\0"
+    "find\0"
+    "finding\0"
+    "findism\0"
+    "findive\0"
+    "findsome\0"
+    "findteen\0"
+    "findure\0"
+    "folder\0"
+    "folderant\0"
+    "folderbook\0"
+    "foldered\0"
+    "folderengine\0"
+    "folderinformation\0"
+    "folderise\0"
+    "folderive\0"
+    "folderize\0"
+    "foldermicrophone\0"
+    "folderous\0"
+    "folderresult\0"
+    "foldersome\0"
+    "folderuniversity\0"
+    "folderway\0"
+    "folderwebsite\0"
+    "follow\0"
+    "followable\0"
+    "followfold\0"
+    "followible\0"
+    "followise\0"
+    "followless\0"
+    "followtion\0"
+    "followure\0"
+    "followwise\0"
+    "foreadapter\0"
+    "foreapparatus\0"
+    "foreappeared\0"
+    "foreapproach\0"
+    "forearchitecture\0"
+    "forearea\0"
+    "foreaudio\0"
+    "forebasis\0"
+    "forebattery\0"
+    "forebook\0"
+    "forebring\0"
+    "forebusiness\0"
+    "forecable\0"
+    "forecharger\0"
+    "forecometeen\0"
+    "forecommunication\0"
+    "forecomponent\0"
+    "forecomputer\0"
+    "forecourse\0"
+    "forecreate\0"
+    "foreday\0"
+    "foredelivery\0"
+    "foredesign\0"
+    "foredevice\0"
+    "foredocument\0"
+    "foreengine\0"
+    "foreequipment\0"
+    "forefeelous\0"
+    "forefinancial\0"
+    "forefinancialcraft\0"
+    "forefolder\0"
+    "forefoundation\0"
+    "foreframework\0"
+    "forefunction\0"
+    "foregraphic\0"
+    "foregrowed\0"
+    "foregrowent\0"
+    "forehealth\0"
+    "forehistorical\0"
+    "forehood\0"
+    "foreinfrastructure\0"
+    "foreinterface\0"
+    "forekillward\0"
+    "forelearnous\0"
+    "forelife\0"
+    "forelikeful\0"
+    "forelocation\0"
+    "foremake\0"
+    "foremeet\0"
+    "foremeethood\0"
+    "foremethod\0"
+    "foremoney\0"
+    "foremouse\0"
+    "forenatural\0"
+    "forenews\0"
+    "foreopen\0"
+    "foreorganization\0"
+    "forepattern\0"
+    "foreperformance\0"
+    "forepick\0"
+    "foreplane\0"
+    "forepoint\0"
+    "forepolicy\0"
+    "forepower\0"
+    "foreprinciple\0"
+    "foreprinter\0"
+    "foreprocess\0"
+    "foreprofessionalth\0"
+    "foreprogram\0"
+    "foreprogramage\0"
+    "foreproperty\0"
+    "forepublic\0"
+    "forepull\0"
+    "forepullfold\0"
+    "forequestion\0"
+    "foreread\0"
+    "foreremember\0"
+    "foreresearch\0"
+    "foreresistance\0"
+    "foreresource\0"
+    "foreresult\0"
+    "foreroom\0"
+    "foreschool\0"
+    "forescience\0"
+    "forescientific\0"
+    "forescreen\0"
+    "foreseemtion\0"
+    "foresend\0"
+    "foreservice\0"
+    "foreset\0"
+    "foreside\0"
+    "foresoftware\0"
+    "foresolution\0"
+    "foresome\0"
+    "forespace\0"
+    "forespeak\0"
+    "forespecial\0"
+    "forespendable\0"
+    "forestop\0"
+    "forestrategy\0"
+    "forestudent\0"
+    "foresuggest\0"
+    "foresuggestous\0"
+    "foresystem\0"
+    "foretechnique\0"
+    "foretheory\0"
+    "forething\0"
+    "foretime\0"
+    "foretion\0"
+    "foretransport\0"
+    "forevalue\0"
+    "forewalk\0"
+    "forewantive\0"
+    "forewebsite\0"
+    "forewhere\0"
+    "forewhereible\0"
+    "forewoman\0"
+    "forewriteal\0"
+    "foreyear\0"
+    "foreyoung\0"
+    "foundation\0"
+    "foundationaudio\0"
+    "foundationboat\0"
+    "foundationer\0"
+    "foundationest\0"
+    "foundationful\0"
+    "foundationic\0"
+    "foundationing\0"
+    "foundationinnovation\0"
+    "foundationism\0"
+    "foundationize\0"
+    "foundationlike\0"
+    "foundationment\0"
+    "foundationname\0"
+    "foundationorder\0"
+    "foundationtion\0"
+    "foundationyear\0"
+    "framework\0"
+    "frameworkable\0"
+    "frameworkage\0"
+    "frameworkcomputer\0"
+    "frameworkcontact\0"
+    "frameworked\0"
+    "frameworkhealth\0"
+    "frameworkhood\0"
+    "frameworkial\0"
+    "frameworking\0"
+    "frameworkise\0"
+    "frameworkism\0"
+    "frameworkist\0"
+    "frameworkmemory\0"
+    "frameworkment\0"
+    "frameworkproblem\0"
+    "frameworkprocessor\0"
+    "frameworkproperty\0"
+    "frameworkright\0"
+    "frameworksensor\0"
+    "frameworksome\0"
+    "frameworktheory\0"
+    "frameworktreatment\0"
+    "frameworkward\0"
+    "frameworkwave\0"
+    "frameworkwise\0"
+    "frequency\0"
+    "frequencyapparatus\0"
+    "frequencyary\0"
+    "frequencycompany\0"
+    "frequencycraft\0"
+    "frequencycurrent\0"
+    "frequencydatabase\0"
+    "frequencyent\0"
+    "frequencyequipment\0"
+    "frequencyfold\0"
+    "frequencyhome\0"
+    "frequencyial\0"
+    "frequencying\0"
+    "frequencyize\0"
+    "frequencylike\0"
+    "frequencymobile\0"
+    "frequencyphone\0"
+    "frequencyplane\0"
+    "frequencyprocess\0"
+    "frequencysion\0"
+    "frequencywater\0"
+    "fuel\0"
+    "fuelage\0"
+    "fuelary\0"
+    "fuelent\0"
+    "fuelest\0"
+    "fuelfold\0"
+    "fuelful\0"
+    "fuelhealth\0"
+    "fuelinfrastructure\0"
+    "fuelist\0"
+    "fuelmaintenance\0"
+    "fuelment\0"
+    "fuelness\0"
+    "fuelpath\0"
+    "fuelpeople\0"
+    "fuelplatform\0"
+    "fuelproblem\0"
+    "fuelsion\0"
+    "fuelsound\0"
+    "fuelspeaker\0"
+    "fueltime\0"
+    "fueltion\0"
+    "fuelty\0"
+    "fuelwise\0"
+    "full\0"
+    "fullable\0"
+    "fulled\0"
+    "fullfy\0"
+    "fulling\0"
+    "fullite\0"
+    "fullous\0"
+    "fullsome\0"
+    "fullure\0"
+    "fullward\0"
+    "function\0"
+    "functionant\0"
+    "functionary\0"
+    "functioncharger\0"
+    "functioncourse\0"
+    "functiondom\0"
+    "functionen\0"
+    "functionent\0"
+    "functionful\0"
+    "functiongovernment\0"
+    "functionhood\0"
+    "functionial\0"
+    "functioninstrument\0"
+    "functioninterface\0"
+    "functionise\0"
+    "functionlife\0"
+    "functionlike\0"
+    "functionly\0"
+    "functionmachine\0"
+    "functionment\0"
+    "functionradiation\0"
+    "functionright\0"
+    "functionschool\0"
+    "functionsome\0"
+    "functionstory\0"
+    "functionteen\0"
+    "functiontion\0"
+    "functionure\0"
+    "functionward\0"
+    "functionyoung\0"
+    "give\0"
+    "giveal\0"
+    "giveent\0"
+    "giveful\0"
+    "giveing\0"
+    "giveite\0"
+    "giveless\0"
+    "global\0"
+    "globalent\0"
+    "globalial\0"
+    "globalism\0"
+    "globalist\0"
+    "government\0"
+    "governmentage\0"
+    "governmentant\0"
+    "governmentaudio\0"
+    "governmentbus\0"
+    "governmented\0"
+    "governmentefficiency\0"
+    "governmenten\0"
+    "governmentent\0"
+    "governmentfamily\0"
+    "governmentfold\0"
+    "governmentgrowth\0"
+    "governmentory\0"
+    "governmentpart\0"
+    "governmentpattern\0"
+    "governmentpublic\0"
+    "governmentreport\0"
+    "governmentship\0"
+    "governmentshipping\0"
+    "governmentsion\0"
+    "governmenture\0"
+    "graphic\0"
+    "graphicage\0"
+    "graphicbasis\0"
+    "graphiccable\0"
+    "graphiccraft\0"
+    "graphiced\0"
+    "graphicest\0"
+    "graphicfeature\0"
+    "graphichood\0"
+    "graphicly\0"
+    "graphicmachine\0"
+    "graphicmarket\0"
+    "graphicmoney\0"
+    "graphicorganization\0"
+    "graphicory\0"
+    "graphicous\0"
+    "graphicpattern\0"
+    "graphicship\0"
+    "graphicsound\0"
+    "graphicteen\0"
+    "graphicty\0"
+    "graphicuniversity\0"
+    "graphicvariable\0"
+    "graphicvideo\0"
+    "graphicwebsite\0"
+    "group\0"
+    "groupant\0"
+    "groupapparatus\0"
+    "groupary\0"
+    "groupbook\0"
+    "groupcurrent\0"
+    "groupdocumentation\0"
+    "grouped\0"
+    "groupent\0"
+    "grouper\0"
+    "groupfold\0"
+    "groupful\0"
+    "groupial\0"
+    "groupimage\0"
+    "groupinstrument\0"
+    "groupise\0"
+    "groupive\0"
+    "groupness\0"
+    "groupous\0"
+    "groupphone\0"
+    "groupproperty\0"
+    "groupreport\0"
+    "groupright\0"
+    "groupsolution\0"
+    "groupsome\0"
+    "groupteen\0"
+    "groupward\0"
+    "groupway\0"
+    "grow\0"
+    "growable\0"
+    "growant\0"
+    "growary\0"
+    "growful\0"
+    "growism\0"
+    "growship\0"
+    "growteen\0"
+    "growth\0"
+    "growthable\0"
+    "growthaddress\0"
+    "growthal\0"
+    "growthend\0"
+    "growthequipment\0"
+    "growthexample\0"
+    "growthfold\0"
+    "growthfy\0"
+    "growthhood\0"
+    "growthial\0"
+    "growthimage\0"
+    "growthinterface\0"
+    "growthise\0"
+    "growthist\0"
+    "growthmobile\0"
+    "growthname\0"
+    "growthness\0"
+    "growthpoint\0"
+    "growthproperty\0"
+    "growthsome\0"
+    "growthth\0"
+    "growthtime\0"
+    "growthure\0"
+    "growthwise\0"
+    "growthword\0"
+    "growthyoung\0"
+    "hand\0"
+    "handcable\0"
+    "handcraft\0"
+    "handdom\0"
+    "handful\0"
+    "handgovernment\0"
+    "handgraphic\0"
+    "handible\0"
+    "handinternet\0"
+    "handism\0"
+    "handoperation\0"
+    "handorder\0"
+    "handphoto\0"
+    "handpublic\0"
+    "handship\0"
+    "handsion\0"
+    "handsociety\0"
+    "handspace\0"
+    "handtion\0"
+    "handtransport\0"
+    "handure\0"
+    "handward\0"
+    "handway\0"
+    "handword\0"
+    "happen\0"
+    "happenen\0"
+    "happenize\0"
+    "happenship\0"
+    "happenty\0"
+    "headphone\0"
+    "headphoneage\0"
+    "headphoneal\0"
+    "headphoneant\0"
+    "headphoneequipment\0"
+    "headphoneer\0"
+    "headphonefuel\0"
+    "headphoneful\0"
+    "headphonehood\0"
+    "headphoneial\0"
+    "headphoneible\0"
+    "headphoneise\0"
+    "headphoneite\0"
+    "headphoneive\0"
+    "headphoneless\0"
+    "headphonely\0"
+    "headphonemember\0"
+    "headphonemessage\0"
+    "headphoneness\0"
+    "headphoneperson\0"
+    "headphoneplatform\0"
+    "headphoneprinciple\0"
+    "headphonestrategy\0"
+    "headphonetheory\0"
+    "headphonetraining\0"
+    "health\0"
+    "healthant\0"
+    "healthboat\0"
+    "healthcommunication\0"
+    "healthcontroller\0"
+    "healthdesign\0"
+    "healthdevice\0"
+    "healthdom\0"
+    "healthent\0"
+    "healthest\0"
+    "healthexperience\0"
+    "healthfold\0"
+    "healthfrequency\0"
+    "healthfuel\0"
+    "healthism\0"
+    "healthize\0"
+    "healthmaintenance\0"
+    "healthmanagement\0"
+    "healthory\0"
+    "healthright\0"
+    "healthshipping\0"
+    "healthweek\0"
+    "historical\0"
+    "historicalible\0"
+    "historicalment\0"
+    "historicalure\0"
+    "history\0"
+    "historyant\0"
+    "historyary\0"
+    "historybicycle\0"
+    "historyconnector\0"
+    "historyconstant\0"
+    "historydesign\0"
+    "historyen\0"
+    "historyfile\0"
+    "historyfy\0"
+    "historyial\0"
+    "historyise\0"
+    "historyite\0"
+    "historylike\0"
+    "historyline\0"
+    "historyment\0"
+    "historyous\0"
+    "historyparameter\0"
+    "historyresistance\0"
+    "historysion\0"
+    "historysome\0"
+    "historystudent\0"
+    "historyth\0"
+    "historytime\0"
+    "historytravel\0"
+    "historyvalue\0"
+    "historyward\0"
+    "hold\0"
+    "holdable\0"
+    "holdial\0"
+    "holdous\0"
+    "home\0"
+    "homecircuit\0"
+    "homeed\0"
+    "homeen\0"
+    "homeer\0"
+    "homefrequency\0"
+    "homeial\0"
+    "homeic\0"
+    "homeite\0"
+    "homenature\0"
+    "homepower\0"
+    "homeprocedure\0"
+    "homereason\0"
+    "homesion\0"
+    "homesystem\0"
+    "homething\0"
+    "hometreatment\0"
+    "homety\0"
+    "homewise\0"
+    "hood\0"
+    "hoodcraft\0"
+    "hoodest\0"
+    "hoodful\0"
+    "hoodite\0"
+    "hoodment\0"
+    "house\0"
+    "housebicycle\0"
+    "housecraft\0"
+    "houseengine\0"
+    "houseest\0"
+    "houseexperience\0"
+    "houseinfrastructure\0"
+    "houseinterface\0"
+    "housement\0"
+    "housemotorcycle\0"
+    "houseprinciple\0"
+    "houseproperty\0"
+    "housereason\0"
+    "houseship\0"
+    "housetransport\0"
+    "ible\0"
+    "ibleal\0"
+    "ibleing\0"
+    "iblelike\0"
+    "image\0"
+    "imageactivity\0"
+    "imageconcept\0"
+    "imagecraft\0"
+    "imagedatabase\0"
+    "imagedocumentation\0"
+    "imagefuel\0"
+    "imageful\0"
+    "imagehood\0"
+    "imageial\0"
+    "imageist\0"
+    "imageite\0"
+    "imagely\0"
+    "imagement\0"
+    "imageous\0"
+    "imagephoto\0"
+    "imagepower\0"
+    "imagereason\0"
+    "imageteen\0"
+    "imageth\0"
+    "implementation\0"
+    "implementationdesign\0"
+    "implementationdom\0"
+    "implementationend\0"
+    "implementationfile\0"
+    "implementationful\0"
+    "implementationhood\0"
+    "implementationhouse\0"
+    "implementationly\0"
+    "implementationmarket\0"
+    "implementationmethod\0"
+    "implementationparty\0"
+    "implementationsensor\0"
+    "implementationwise\0"
+    "implementationworld\0"
+    "inable\0"
+    "inadapter\0"
+    "inaddress\0"
+    "inapparatus\0"
+    "inaskism\0"
+    "inattribute\0"
+    "inaudio\0"
+    "inbicycle\0"
+    "inbook\0"
+    "inbring\0"
+    "inbuild\0"
+    "incar\0"
+    "incase\0"
+    "incharacteristic\0"
+    "incharger\0"
+    "incircuit\0"
+    "include\0"
+    "incolor\0"
+    "income\0"
+    "incompany\0"
+    "incomputer\0"
+    "inconcept\0"
+    "inconstant\0"
+    "increateary\0"
+    "indatabase\0"
+    "inday\0"
+    "indelivery\0"
+    "indesign\0"
+    "indie\0"
+    "indisplay\0"
+    "indocumentation\0"
+    "ineconomichood\0"
+    "ineducationaling\0"
+    "inelectricity\0"
+    "inelement\0"
+    "inemail\0"
+    "inexpect\0"
+    "infallant\0"
+    "infamily\0"
+    "infeel\0"
+    "infindfy\0"
+    "infollowful\0"
+    "information\0"
+    "informationable\0"
+    "informational\0"
+    "informationary\0"
+    "informationent\0"
+    "informationexample\0"
+    "informationfile\0"
+    "informationhouse\0"
+    "informationible\0"
+    "informationless\0"
+    "informationlike\0"
+    "informationmarket\0"
+    "informationproblem\0"
+    "informationstrategy\0"
+    "informationstudy\0"
+    "informationsupport\0"
+    "informationtechnique\0"
+    "informationward\0"
+    "inframework\0"
+    "infrastructure\0"
+    "infrastructureable\0"
+    "infrastructureage\0"
+    "infrastructurebook\0"
+    "infrastructurecolor\0"
+    "infrastructureed\0"
+    "infrastructureer\0"
+    "infrastructureest\0"
+    "infrastructuregroup\0"
+    "infrastructureic\0"
+    "infrastructureing\0"
+    "infrastructureise\0"
+    "infrastructureive\0"
+    "infrastructurelight\0"
+    "infrastructurenation\0"
+    "infrastructurepeople\0"
+    "infrastructuresignal\0"
+    "infrastructurewave\0"
+    "infrastructurewise\0"
+    "infunction\0"
+    "inglobaler\0"
+    "ingrowth\0"
+    "inhealth\0"
+    "inhistorical\0"
+    "inhome\0"
+    "inhoodism\0"
+    "inintegration\0"
+    "inkillsome\0"
+    "inlead\0"
+    "inlearndom\0"
+    "inleave\0"
+    "inlesscraft\0"
+    "inletter\0"
+    "inlevel\0"
+    "inlike\0"
+    "inmachine\0"
+    "inmaintenance\0"
+    "inmake\0"
+    "inmanagement\0"
+    "inmember\0"
+    "inmemory\0"
+    "inmethod\0"
+    "inmost\0"
+    "inmostism\0"
+    "inmouse\0"
+    "inmove\0"
+    "innaturalous\0"
+    "innovation\0"
+    "innovationant\0"
+    "innovationcable\0"
+    "innovationcamera\0"
+    "innovationer\0"
+    "innovationfamily\0"
+    "innovationfold\0"
+    "innovationfunction\0"
+    "innovationhouse\0"
+    "innovationial\0"
+    "innovationism\0"
+    "innovationist\0"
+    "innovationjob\0"
+    "innovationmechanism\0"
+    "innovationment\0"
+    "innovationparty\0"
+    "innovationphone\0"
+    "innovationplatform\0"
+    "innovationradiation\0"
+    "innovationship\0"
+    "innovationtrain\0"
+    "innumber\0"
+    "inpattern\0"
+    "inpay\0"
+    "inpayive\0"
+    "inpeople\0"
+    "inphoto\0"
+    "inpick\0"
+    "inpicture\0"
+    "inplan\0"
+    "inplatform\0"
+    "inposition\0"
+    "inprice\0"
+    "inproblem\0"
+    "inproperty\0"
+    "inprotocol\0"
+    "inradiation\0"
+    "inreach\0"
+    "inremember\0"
+    "inreport\0"
+    "inresearch\0"
+    "inresult\0"
+    "inschool\0"
+    "inscientificwise\0"
+    "insecurity\0"
+    "inserve\0"
+    "inship\0"
+    "inshipping\0"
+    "insocialable\0"
+    "insolution\0"
+    "insomething\0"
+    "insound\0"
+    "inspace\0"
+    "inspendize\0"
+    "instate\0"
+    "instayise\0"
+    "instaysion\0"
+    "instop\0"
+    "instopory\0"
+    "instrategy\0"
+    "instructure\0"
+    "instrument\0"
+    "instrumentable\0"
+    "instrumentarea\0"
+    "instrumented\0"
+    "instrumentgroup\0"
+    "instrumential\0"
+    "instrumentic\0"
+    "instrumentinterface\0"
+    "instrumentist\0"
+    "instrumentive\0"
+    "instrumentmethod\0"
+    "instrumentous\0"
+    "instrumentpart\0"
+    "instrumentreport\0"
+    "instrumentresource\0"
+    "instrumentscience\0"
+    "instrumentship\0"
+    "instrumentside\0"
+    "instrumentsome\0"
+    "instrumentteen\0"
+    "instrumentth\0"
+    "instrumentthing\0"
+    "instrumenttrain\0"
+    "instrumenttruck\0"
+    "instudent\0"
+    "insuggestest\0"
+    "insupport\0"
+    "insystem\0"
+    "integration\0"
+    "integrationage\0"
+    "integrationant\0"
+    "integrationdocument\0"
+    "integrationdom\0"
+    "integrationed\0"
+    "integrationen\0"
+    "integrationest\0"
+    "integrationfamily\0"
+    "integrationgrowth\0"
+    "integrationible\0"
+    "integrationite\0"
+    "integrationize\0"
+    "integrationkeyboard\0"
+    "integrationous\0"
+    "integrationprinciple\0"
+    "integrationproperty\0"
+    "integrationquestion\0"
+    "integrationreport\0"
+    "integrationstandard\0"
+    "integrationtechnique\0"
+    "integrationtion\0"
+    "integrationvideo\0"
+    "integrationwork\0"
+    "intell\0"
+    "interactivity\0"
+    "interadd\0"
+    "interallow\0"
+    "interapparatus\0"
+    "interappear\0"
+    "interattribute\0"
+    "interaudio\0"
+    "interboat\0"
+    "intercable\0"
+    "intercamera\0"
+    "intercar\0"
+    "intercharacteristic\0"
+    "intercharger\0"
+    "intercompany\0"
+    "interconcept\0"
+    "intercountry\0"
+    "intercreateen\0"
+    "intercut\0"
+    "interdevice\0"
+    "interdieable\0"
+    "interdisplay\0"
+    "interdocumentation\0"
+    "intereconomic\0"
+    "intereducationaldom\0"
+    "interenergy\0"
+    "interequipment\0"
+    "interest\0"
+    "interestage\0"
+    "interestal\0"
+    "interestary\0"
+    "interestattribute\0"
+    "interestcontroller\0"
+    "interestcraft\0"
+    "interested\0"
+    "interesten\0"
+    "interestment\0"
+    "interestnetwork\0"
+    "interestparty\0"
+    "interestperformance\0"
+    "interestperson\0"
+    "interesture\0"
+    "interestward\0"
+    "interestwise\0"
+    "interexpect\0"
+    "interface\0"
+    "interfaceant\0"
+    "interfaceary\0"
+    "interfacecar\0"
+    "interfacedom\0"
+    "interfaceent\0"
+    "interfacefy\0"
+    "interfacegraphic\0"
+    "interfaceible\0"
+    "interfaceinformation\0"
+    "interfaceinterface\0"
+    "interfaceise\0"
+    "interfaceist\0"
+    "interfaceive\0"
+    "interfaceletter\0"
+    "interfacely\0"
+    "interfaceness\0"
+    "interfaceoperation\0"
+    "interfaceous\0"
+    "interfaceparty\0"
+    "interfacestate\0"
+    "interfacetool\0"
+    "interfaceure\0"
+    "interfinancialent\0"
+    "interfollowent\0"
+    "interfollowial\0"
+    "interframework\0"
+    "interfull\0"
+    "interfunction\0"
+    "intergive\0"
+    "intergrowous\0"
+    "interhappening\0"
+    "interheadphone\0"
+    "interhoodous\0"
+    "interhouse\0"
+    "interimage\0"
+    "interimplementation\0"
+    "interinformation\0"
+    "interintegration\0"
+    "interinterface\0"
+    "interjob\0"
+    "interlead\0"
+    "interless\0"
+    "interletter\0"
+    "interlife\0"
+    "interlocation\0"
+    "interloseward\0"
+    "intermakeous\0"
+    "intermanagement\0"
+    "intermarket\0"
+    "intermedicalal\0"
+    "intermember\0"
+    "intermemory\0"
+    "intermessage\0"
+    "intermethod\0"
+    "intermobile\0"
+    "intermotor\0"
+    "intermotorcycle\0"
+    "intermouse\0"
+    "internation\0"
+    "international\0"
+    "internationalable\0"
+    "internationalary\0"
+    "internationaldom\0"
+    "internationaled\0"
+    "internationalful\0"
+    "internationalial\0"
+    "internationalness\0"
+    "internationalory\0"
+    "internationalship\0"
+    "internationalth\0"
+    "internaturalary\0"
+    "internet\0"
+    "internetbook\0"
+    "internetbusiness\0"
+    "internetcase\0"
+    "internetcircuit\0"
+    "internetdirectory\0"
+    "internetdisplay\0"
+    "internetexample\0"
+    "internetfold\0"
+    "internetframework\0"
+    "internetintegration\0"
+    "internetinterest\0"
+    "internetist\0"
+    "internetive\0"
+    "internetnews\0"
+    "internetorganization\0"
+    "internetproperty\0"
+    "internetresistance\0"
+    "internetroom\0"
+    "internetsoftware\0"
+    "internetth\0"
+    "internetwork\0"
+    "interoffer\0"
+    "interopen\0"
+    "interpath\0"
+    "interpeople\0"
+    "interpicture\0"
+    "interposition\0"
+    "interpower\0"
+    "interprice\0"
+    "interprinciple\0"
+    "interproject\0"
+    "interprovide\0"
+    "interprovideize\0"
+    "interquality\0"
+    "interquestion\0"
+    "interreason\0"
+    "interremainent\0"
+    "interremember\0"
+    "interrememberwise\0"
+    "interreport\0"
+    "interresource\0"
+    "interscience\0"
+    "interscreen\0"
+    "intersell\0"
+    "interseture\0"
+    "intershipping\0"
+    "intersion\0"
+    "intersocial\0"
+    "intersoftware\0"
+    "interspeaker\0"
+    "interstructure\0"
+    "interterm\0"
+    "interthinkous\0"
+    "intertion\0"
+    "intertool\0"
+    "intertrain\0"
+    "intertravel\0"
+    "intertreatment\0"
+    "intertry\0"
+    "intertryism\0"
+    "interuniversity\0"
+    "interuse\0"
+    "intervalue\0"
+    "intervariable\0"
+    "intervideo\0"
+    "interway\0"
+    "interwebsite\0"
+    "interwhere\0"
+    "interwhich\0"
+    "interwin\0"
+    "interwiseal\0"
+    "interwork\0"
+    "interyear\0"
+    "interyoung\0"
+    "intext\0"
+    "intheory\0"
+    "intrain\0"
+    "intraining\0"
+    "inuse\0"
+    "invariable\0"
+    "involtage\0"
+    "inwave\0"
+    "inwebsite\0"
+    "inwheresion\0"
+    "inwhichite\0"
+    "inwise\0"
+    "inwiseist\0"
+    "inwiseteen\0"
+    "inwork\0"
+    "job\0"
+    "jobal\0"
+    "jobary\0"
+    "jobconstant\0"
+    "jobed\0"
+    "joben\0"
+    "jobequipment\0"
+    "jobful\0"
+    "jobfy\0"
+    "jobgroup\0"
+    "jobly\0"
+    "jobment\0"
+    "jobprocess\0"
+    "jobroom\0"
+    "jobscanner\0"
+    "jobsoftware\0"
+    "jobth\0"
+    "jobtruck\0"
+    "jobure\0"
+    "jobword\0"
+    "keyboard\0"
+    "keyboardary\0"
+    "keyboardaudio\0"
+    "keyboardent\0"
+    "keyboardfold\0"
+    "keyboardism\0"
+    "keyboardlight\0"
+    "keyboardlike\0"
+    "keyboardment\0"
+    "keyboardmicrophone\0"
+    "keyboardness\0"
+    "keyboardpackage\0"
+    "keyboardphoto\0"
+    "keyboardsion\0"
+    "keyboardteen\0"
+    "keyboardth\0"
+    "keyboardwebsite\0"
+    "keyboardwise\0"
+    "kill\0"
+    "killant\0"
+    "killest\0"
+    "killhood\0"
+    "killize\0"
+    "killness\0"
+    "killory\0"
+    "killsome\0"
+    "killure\0"
+    "killward\0"
+    "killwise\0"
+    "know\0"
+    "knowed\0"
+    "knowful\0"
+    "lead\0"
+    "leaddom\0"
+    "leader\0"
+    "leadest\0"
+    "leading\0"
+    "leadous\0"
+    "leadsion\0"
+    "leadteen\0"
+    "leadth\0"
+    "leadure\0"
+    "leadward\0"
+    "learn\0"
+    "learnent\0"
+    "learnfold\0"
+    "leave\0"
+    "leavefy\0"
+    "leaveism\0"
+    "leaveive\0"
+    "leaveory\0"
+    "less\0"
+    "lesshood\0"
+    "lessness\0"
+    "lessth\0"
+    "lessure\0"
+    "lessward\0"
+    "letter\0"
+    "letteral\0"
+    "letterant\0"
+    "letterbus\0"
+    "lettercircuit\0"
+    "letterest\0"
+    "letterhealth\0"
+    "letterimplementation\0"
+    "letterite\0"
+    "letterize\0"
+    "letterkeyboard\0"
+    "letterless\0"
+    "letterorder\0"
+    "letterory\0"
+    "letterous\0"
+    "letterprinciple\0"
+    "letterprinter\0"
+    "letterth\0"
+    "letterure\0"
+    "lettervariable\0"
+    "letteryear\0"
+    "level\0"
+    "levelapproach\0"
+    "levelcharacteristic\0"
+    "levelcurrent\0"
+    "leveldom\0"
+    "leveled\0"
+    "leveler\0"
+    "levelfile\0"
+    "levelial\0"
+    "levelible\0"
+    "leveling\0"
+    "levelism\0"
+    "levelmethod\0"
+    "levelmodel\0"
+    "levelmonitor\0"
+    "levelmouse\0"
+    "levelnetwork\0"
+    "levelous\0"
+    "levelparameter\0"
+    "levelperson\0"
+    "levelsome\0"
+    "levelspeaker\0"
+    "leveltion\0"
+    "levelvehicle\0"
+    "life\0"
+    "lifeactivity\0"
+    "lifeage\0"
+    "lifecable\0"
+    "lifeconstant\0"
+    "lifeefficiency\0"
+    "lifeen\0"
+    "lifeest\0"
+    "lifefold\0"
+    "lifefuel\0"
+    "lifegovernment\0"
+    "lifeinfrastructure\0"
+    "lifeism\0"
+    "lifeive\0"
+    "lifeize\0"
+    "lifelife\0"
+    "lifemoney\0"
+    "lifemonitor\0"
+    "lifeoffice\0"
+    "lifeory\0"
+    "lifeplace\0"
+    "lifeproductivity\0"
+    "lifequality\0"
+    "liferesistance\0"
+    "lifeside\0"
+    "lifesound\0"
+    "lifetion\0"
+    "lifeuniversity\0"
+    "light\0"
+    "lightadapter\0"
+    "lightal\0"
+    "lightanalysis\0"
+    "lightary\0"
+    "lightbook\0"
+    "lightbusiness\0"
+    "lightcraft\0"
+    "lightdelivery\0"
+    "lightdocumentation\0"
+    "lighted\0"
+    "lighten\0"
+    "lightent\0"
+    "lightest\0"
+    "lightfy\0"
+    "lighthood\0"
+    "lightinnovation\0"
+    "lightive\0"
+    "lightmaintenance\0"
+    "lightmethod\0"
+    "lightory\0"
+    "lightphone\0"
+    "lightship\0"
+    "lightthing\0"
+    "lightty\0"
+    "lightwebsite\0"
+    "like\0"
+    "likeary\0"
+    "likeest\0"
+    "likeless\0"
+    "likely\0"
+    "likeory\0"
+    "likeship\0"
+    "likesion\0"
+    "liketeen\0"
+    "line\0"
+    "lineal\0"
+    "lineary\0"
+    "linebicycle\0"
+    "linecontroller\0"
+    "linecraft\0"
+    "linedevice\0"
+    "linedom\0"
+    "lineed\0"
+    "lineible\0"
+    "lineing\0"
+    "lineinterface\0"
+    "lineise\0"
+    "lineism\0"
+    "lineive\0"
+    "lineize\0"
+    "linekeyboard\0"
+    "lineless\0"
+    "linement\0"
+    "lineness\0"
+    "lineorder\0"
+    "lineory\0"
+    "linepublic\0"
+    "linesion\0"
+    "linesolution\0"
+    "linesome\0"
+    "lineteen\0"
+    "linety\0"
+    "live\0"
+    "liveible\0"
+    "liveic\0"
+    "liveite\0"
+    "livesome\0"
+    "local\0"
+    "localfold\0"
+    "localism\0"
+    "locally\0"
+    "localship\0"
+    "localtion\0"
+    "location\0"
+    "locationant\0"
+    "locationdatabase\0"
+    "locationdevice\0"
+    "locationdom\0"
+    "locationed\0"
+    "locationeducation\0"
+    "locationer\0"
+    "locationfold\0"
+    "locationfy\0"
+    "locationhood\0"
+    "locationing\0"
+    "locationinterest\0"
+    "locationist\0"
+    "locationless\0"
+    "locationmethod\0"
+    "locationness\0"
+    "locationory\0"
+    "locationous\0"
+    "locationplane\0"
+    "locationschool\0"
+    "locationth\0"
+    "locationure\0"
+    "locationway\0"
+    "locationworld\0"
+    "look\0"
+    "lookest\0"
+    "lookly\0"
+    "looksion\0"
+    "lookty\0"
+    "lose\0"
+    "loseing\0"
+    "loseive\0"
+    "loseless\0"
+    "loselike\0"
+    "loseness\0"
+    "love\0"
+    "loveage\0"
+    "loveal\0"
+    "loveant\0"
+    "loveise\0"
+    "loveite\0"
+    "loveory\0"
+    "loveous\0"
+    "loveship\0"
+    "machine\0"
+    "machineable\0"
+    "machineal\0"
+    "machinebicycle\0"
+    "machinecamera\0"
+    "machineest\0"
+    "machinefold\0"
+    "machinefolder\0"
+    "machineism\0"
+    "machinelike\0"
+    "machinely\0"
+    "machinemachine\0"
+    "machinemotor\0"
+    "machineness\0"
+    "machineprocedure\0"
+    "machineprocess\0"
+    "machineteen\0"
+    "machineure\0"
+    "machinewar\0"
+    "machinewise\0"
+    "maintenance\0"
+    "maintenanceable\0"
+    "maintenancecharger\0"
+    "maintenancechild\0"
+    "maintenancecraft\0"
+    "maintenanceest\0"
+    "maintenancefold\0"
+    "maintenanceful\0"
+    "maintenancehood\0"
+    "maintenanceing\0"
+    "maintenanceline\0"
+    "maintenancemechanism\0"
+    "maintenanceoffice\0"
+    "maintenancepart\0"
+    "maintenanceprinter\0"
+    "maintenanceschool\0"
+    "maintenancescreen\0"
+    "maintenanceship\0"
+    "maintenancespace\0"
+    "make\0"
+    "makeable\0"
+    "makeant\0"
+    "makeness\0"
+    "makeward\0"
+    "management\0"
+    "managemental\0"
+    "managementbattery\0"
+    "managementcamera\0"
+    "managementcomputer\0"
+    "managementcraft\0"
+    "managementfact\0"
+    "managementheadphone\0"
+    "managementise\0"
+    "managementist\0"
+    "managementive\0"
+    "managementmemory\0"
+    "managementment\0"
+    "managementmouse\0"
+    "managementmusic\0"
+    "managementnetwork\0"
+    "managementprice\0"
+    "managementservice\0"
+    "managementstudent\0"
+    "managementsystem\0"
+    "managementwise\0"
+    "market\0"
+    "marketenergy\0"
+    "marketism\0"
+    "marketlike\0"
+    "marketmanagement\0"
+    "marketment\0"
+    "marketmobile\0"
+    "marketnature\0"
+    "marketproperty\0"
+    "marketresearch\0"
+    "marketship\0"
+    "marketteen\0"
+    "marketth\0"
+    "marketthing\0"
+    "markettion\0"
+    "marketty\0"
+    "marketwater\0"
+    "material\0"
+    "materialage\0"
+    "materialant\0"
+    "materialcamera\0"
+    "materialen\0"
+    "materialer\0"
+    "materialfamily\0"
+    "materialful\0"
+    "materialhood\0"
+    "materialinnovation\0"
+    "materialism\0"
+    "materialize\0"
+    "materialless\0"
+    "materiallife\0"
+    "materially\0"
+    "materialory\0"
+    "materialprinciple\0"
+    "materialsion\0"
+    "materialsociety\0"
+    "materialstudent\0"
+    "materialteen\0"
+    "mechanism\0"
+    "mechanismarea\0"
+    "mechanismcompany\0"
+    "mechanismconcept\0"
+    "mechanismdevice\0"
+    "mechanismend\0"
+    "mechanismest\0"
+    "mechanismexample\0"
+    "mechanismframework\0"
+    "mechanismhood\0"
+    "mechanismible\0"
+    "mechanisming\0"
+    "mechanismism\0"
+    "mechanismive\0"
+    "mechanismly\0"
+    "mechanismmotorcycle\0"
+    "mechanismoffice\0"
+    "mechanismparty\0"
+    "mechanismperson\0"
+    "mechanismprocessor\0"
+    "mechanismradiation\0"
+    "mechanismreason\0"
+    "mechanismresistance\0"
+    "mechanismsolution\0"
+    "mechanismsome\0"
+    "mechanismuniversity\0"
+    "medical\0"
+    "medicalment\0"
+    "medicalsome\0"
+    "medicalty\0"
+    "meet\0"
+    "meetal\0"
+    "meetible\0"
+    "meetist\0"
+    "meetous\0"
+    "meetteen\0"
+    "member\0"
+    "memberage\0"
+    "memberarea\0"
+    "memberbicycle\0"
+    "membercamera\0"
+    "membercomputer\0"
+    "membered\0"
+    "memberent\0"
+    "memberfuel\0"
+    "membergraphic\0"
+    "memberhealth\0"
+    "memberhood\0"
+    "memberial\0"
+    "membering\0"
+    "memberinterest\0"
+    "memberinterface\0"
+    "memberism\0"
+    "memberjob\0"
+    "membermaintenance\0"
+    "membermessage\0"
+    "membermonitor\0"
+    "membermotor\0"
+    "memberness\0"
+    "memberoptimization\0"
+    "memberory\0"
+    "memberstory\0"
+    "memberstudent\0"
+    "memberth\0"
+    "memberty\0"
+    "memberweek\0"
+    "memberwork\0"
+    "memory\0"
+    "memoryable\0"
+    "memoryarchitecture\0"
+    "memorybasis\0"
+    "memorycontroller\0"
+    "memorydocument\0"
+    "memorydom\0"
+    "memoryist\0"
+    "memorylife\0"
+    "memorylike\0"
+    "memorymicrophone\0"
+    "memoryprice\0"
+    "memorypublic\0"
+    "memorysion\0"
+    "memoryspecial\0"
+    "memorystandard\0"
+    "memorystrategy\0"
+    "memorytrain\0"
+    "memoryward\0"
+    "ment\0"
+    "mentant\0"
+    "mential\0"
+    "mently\0"
+    "mentth\0"
+    "message\0"
+    "messageable\0"
+    "messageant\0"
+    "messagecase\0"
+    "messageconcept\0"
+    "messageconnector\0"
+    "messageest\0"
+    "messageful\0"
+    "messagegrowth\0"
+    "messagehood\0"
+    "messageible\0"
+    "messageic\0"
+    "messageing\0"
+    "messageintegration\0"
+    "messageinterest\0"
+    "messageist\0"
+    "messagemachine\0"
+    "messagemaintenance\0"
+    "messagemember\0"
+    "messagemotorcycle\0"
+    "messageous\0"
+    "messageposition\0"
+    "messagevoltage\0"
+    "messageward\0"
+    "messagewise\0"
+    "metaadddom\0"
+    "metaallowward\0"
+    "metaanalysis\0"
+    "metaappear\0"
+    "metaapproach\0"
+    "metaaskent\0"
+    "metaattribute\0"
+    "metaaudio\0"
+    "metabasis\0"
+    "metabook\0"
+    "metabreaklike\0"
+    "metabringer\0"
+    "metabringic\0"
+    "metabringment\0"
+    "metabus\0"
+    "metacamera\0"
+    "metachange\0"
+    "metacommunication\0"
+    "metacomputer\0"
+    "metaconsiderdom\0"
+    "metacontinue\0"
+    "metacontroller\0"
+    "metacountry\0"
+    "metacreateant\0"
+    "metacut\0"
+    "metadatabase\0"
+    "metadecidely\0"
+    "metadesign\0"
+    "metadevelopment\0"
+    "metadie\0"
+    "metadieible\0"
+    "metadisplay\0"
+    "metadocument\0"
+    "metadocumentation\0"
+    "metaeducation\0"
+    "metaeducational\0"
+    "metaefficiency\0"
+    "metaelement\0"
+    "metaemail\0"
+    "metaexample\0"
+    "metafamily\0"
+    "metafeel\0"
+    "metafile\0"
+    "metafollow\0"
+    "metafoundation\0"
+    "metafull\0"
+    "metagraphic\0"
+    "metagrow\0"
+    "metahappenth\0"
+    "metaheadphone\0"
+    "metahold\0"
+    "metainterface\0"
+    "metainternational\0"
+    "metainternet\0"
+    "metaknow\0"
+    "metalessage\0"
+    "metaletter\0"
+    "metalike\0"
+    "metalikeic\0"
+    "metaliketh\0"
+    "metalocation\0"
+    "metamaintenance\0"
+    "metameetship\0"
+    "metamessage\0"
+    "metamethod\0"
+    "metamobile\0"
+    "metamonitor\0"
+    "metamostsome\0"
+    "metamotor\0"
+    "metamovesome\0"
+    "metamusic\0"
+    "metanation\0"
+    "metanaturalsome\0"
+    "metanetwork\0"
+    "metanews\0"
+    "metaoperation\0"
+    "metaorder\0"
+    "metapackage\0"
+    "metaparty\0"
+    "metapassive\0"
+    "metaperson\0"
+    "metaplan\0"
+    "metaplatform\0"
+    "metaplay\0"
+    "metapoint\0"
+    "metapolitical\0"
+    "metapower\0"
+    "metaproblem\0"
+    "metaprocessor\0"
+    "metaprofessional\0"
+    "metaprogramfy\0"
+    "metaproperty\0"
+    "metapublic\0"
+    "metaquestionship\0"
+    "metaradiation\0"
+    "metaraisewise\0"
+    "metareach\0"
+    "metareport\0"
+    "metareportous\0"
+    "metaresearch\0"
+    "metaright\0"
+    "metaroom\0"
+    "metasecurity\0"
+    "metasell\0"
+    "metasend\0"
+    "metasensor\0"
+    "metaset\0"
+    "metasocialwise\0"
+    "metasoftware\0"
+    "metaspecial\0"
+    "metaspend\0"
+    "metastandard\0"
+    "metastrategy\0"
+    "metasystem\0"
+    "metasystemal\0"
+    "metatechnicalful\0"
+    "metatechnique\0"
+    "metatext\0"
+    "metatheory\0"
+    "metathinktion\0"
+    "metatime\0"
+    "metauniversity\0"
+    "metauseed\0"
+    "metavalue\0"
+    "metavideo\0"
+    "metawear\0"
+    "metaweek\0"
+    "metawhichism\0"
+    "metaword\0"
+    "metawork\0"
+    "metayear\0"
+    "method\0"
+    "methodant\0"
+    "methodapparatus\0"
+    "methodbook\0"
+    "methodcircuit\0"
+    "methoded\0"
+    "methodful\0"
+    "methodial\0"
+    "methodible\0"
+    "methodinformation\0"
+    "methodism\0"
+    "methodite\0"
+    "methodive\0"
+    "methodlight\0"
+    "methodline\0"
+    "methodnature\0"
+    "methodness\0"
+    "methodorder\0"
+    "methodpower\0"
+    "methodradiation\0"
+    "methodsolution\0"
+    "methodsome\0"
+    "methodty\0"
+    "methodvehicle\0"
+    "microaction\0"
+    "microactivity\0"
+    "microanalysis\0"
+    "microapparatus\0"
+    "microappearic\0"
+    "microapplication\0"
+    "microarchitecture\0"
+    "microbattery\0"
+    "microboat\0"
+    "microbook\0"
+    "microbreak\0"
+    "microcall\0"
+    "microcharger\0"
+    "microchild\0"
+    "microcolor\0"
+    "microcompany\0"
+    "microconcept\0"
+    "microcontinueible\0"
+    "microcontroller\0"
+    "microcreateary\0"
+    "microcreateward\0"
+    "microdelivery\0"
+    "microdevice\0"
+    "microdigital\0"
+    "microdisplay\0"
+    "microelectricity\0"
+    "microelement\0"
+    "microemail\0"
+    "microequipment\0"
+    "microeverory\0"
+    "microexpect\0"
+    "microfact\0"
+    "microfamily\0"
+    "microfeel\0"
+    "microfinancial\0"
+    "microfollow\0"
+    "microfoundation\0"
+    "microfrequency\0"
+    "microgloballike\0"
+    "microgovernment\0"
+    "microhealth\0"
+    "microimage\0"
+    "microimplementation\0"
+    "microinclude\0"
+    "microinterest\0"
+    "microinterface\0"
+    "microinternational\0"
+    "microlead\0"
+    "microletter\0"
+    "microlife\0"
+    "microlocal\0"
+    "microloseite\0"
+    "microloseship\0"
+    "micromeet\0"
+    "micromember\0"
+    "micromessage\0"
+    "micromoney\0"
+    "micromotorcycle\0"
+    "micronation\0"
+    "micronews\0"
+    "microorder\0"
+    "micropackage\0"
+    "micropart\0"
+    "microparty\0"
+    "micropeople\0"
+    "microperformance\0"
+    "microphone\0"
+    "microphoneant\0"
+    "microphonecase\0"
+    "microphonecraft\0"
+    "microphoneelement\0"
+    "microphonefact\0"
+    "microphonehood\0"
+    "microphoneinterface\0"
+    "microphoneism\0"
+    "microphoneorder\0"
+    "microphonepicture\0"
+    "microphoneplace\0"
+    "microphoneright\0"
+    "microphonesignal\0"
+    "microphonesome\0"
+    "microphoneure\0"
+    "microphonevoltage\0"
+    "microphoneward\0"
+    "microphoneworld\0"
+    "microphoto\0"
+    "microplatform\0"
+    "micropoint\0"
+    "microprinciple\0"
+    "microproblem\0"
+    "microproductivity\0"
+    "microprogramous\0"
+    "microprovideen\0"
+    "microquestion\0"
+    "microquestionship\0"
+    "microraiseed\0"
+    "microreach\0"
+    "microreachage\0"
+    "microreason\0"
+    "microreport\0"
+    "microreportsome\0"
+    "microresistance\0"
+    "microright\0"
+    "microschool\0"
+    "microscreen\0"
+    "microseem\0"
+    "microserve\0"
+    "microservice\0"
+    "microship\0"
+    "micrositwise\0"
+    "microsocial\0"
+    "microsociety\0"
+    "microsome\0"
+    "microsomefold\0"
+    "microspeaker\0"
+    "microstandard\0"
+    "microstandible\0"
+    "microstate\0"
+    "microstay\0"
+    "microstory\0"
+    "microsuggest\0"
+    "microsystem\0"
+    "microtechnical\0"
+    "microtechnology\0"
+    "microterm\0"
+    "microthing\0"
+    "microtionous\0"
+    "microtool\0"
+    "microtravel\0"
+    "microtryist\0"
+    "microvariable\0"
+    "microwater\0"
+    "microwebsite\0"
+    "microwhichure\0"
+    "microwork\0"
+    "minialgorithm\0"
+    "minianalysis\0"
+    "miniapproach\0"
+    "miniaskth\0"
+    "minibelieve\0"
+    "minibuildsion\0"
+    "minibuildth\0"
+    "minibus\0"
+    "minicable\0"
+    "minicharacteristic\0"
+    "minicircuit\0"
+    "minicolor\0"
+    "minicommunication\0"
+    "minicompany\0"
+    "miniconcept\0"
+    "miniconnector\0"
+    "minicutment\0"
+    "miniday\0"
+    "minidigitalen\0"
+    "minidirectory\0"
+    "minidisplay\0"
+    "minidocument\0"
+    "minieconomic\0"
+    "miniefficiency\0"
+    "miniend\0"
+    "miniever\0"
+    "miniexpect\0"
+    "minifeel\0"
+    "minifindsion\0"
+    "minifuel\0"
+    "minifunction\0"
+    "minigraphic\0"
+    "minigrowtion\0"
+    "minihappen\0"
+    "minihouse\0"
+    "miniimage\0"
+    "miniinstrument\0"
+    "miniintegration\0"
+    "miniinterest\0"
+    "minileadteen\0"
+    "minilearnant\0"
+    "minileave\0"
+    "minileaveory\0"
+    "miniletter\0"
+    "minilife\0"
+    "minimake\0"
+    "minimechanism\0"
+    "minimentfold\0"
+    "minimessage\0"
+    "minimethod\0"
+    "minimoney\0"
+    "minimostth\0"
+    "minimoveite\0"
+    "mininame\0"
+    "mininaturalhood\0"
+    "mininumber\0"
+    "minioffice\0"
+    "miniorganization\0"
+    "minipackage\0"
+    "miniparameter\0"
+    "minipart\0"
+    "minipath\0"
+    "minipayfold\0"
+    "minipicture\0"
+    "miniplace\0"
+    "minipoliticalest\0"
+    "minipower\0"
+    "miniprinter\0"
+    "miniproblem\0"
+    "miniproject\0"
+    "miniraise\0"
+    "minireach\0"
+    "miniread\0"
+    "minireason\0"
+    "miniremainer\0"
+    "minireport\0"
+    "miniresistance\0"
+    "miniscanner\0"
+    "minischool\0"
+    "miniscience\0"
+    "minisecurity\0"
+    "minisell\0"
+    "minisensor\0"
+    "miniserveest\0"
+    "miniservice\0"
+    "minishiphood\0"
+    "minisit\0"
+    "ministory\0"
+    "minisuggest\0"
+    "minisystem\0"
+    "minisystemible\0"
+    "minitechnology\0"
+    "miniterm\0"
+    "minithing\0"
+    "minitime\0"
+    "minition\0"
+    "minitrain\0"
+    "minitravel\0"
+    "miniuniversity\0"
+    "minivoltage\0"
+    "miniwaitly\0"
+    "miniwar\0"
+    "miniward\0"
+    "miniwardsion\0"
+    "miniwear\0"
+    "miniwhatible\0"
+    "miniwinty\0"
+    "miniwork\0"
+    "miniyoung\0"
+    "misaddive\0"
+    "misalgorithm\0"
+    "misallowdom\0"
+    "misanalysis\0"
+    "misapparatus\0"
+    "misappear\0"
+    "misapproach\0"
+    "misarea\0"
+    "misaudio\0"
+    "miscamera\0"
+    "mischaracteristic\0"
+    "mischarger\0"
+    "mischild\0"
+    "miscircuit\0"
+    "miscolor\0"
+    "miscome\0"
+    "miscommunication\0"
+    "miscomputer\0"
+    "misconcept\0"
+    "miscountry\0"
+    "miscourse\0"
+    "miscreatefy\0"
+    "miscuten\0"
+    "misdatabase\0"
+    "misdelivery\0"
+    "misdevice\0"
+    "misdocument\0"
+    "miseducation\0"
+    "miselectricity\0"
+    "misemail\0"
+    "misenergy\0"
+    "misexample\0"
+    "misexperience\0"
+    "misfeature\0"
+    "misfile\0"
+    "misfinancialary\0"
+    "misfunction\0"
+    "misgrowth\0"
+    "mishappen\0"
+    "misiblefy\0"
+    "misinterface\0"
+    "misinternet\0"
+    "misjob\0"
+    "misleave\0"
+    "mislevel\0"
+    "mislife\0"
+    "mismachine\0"
+    "mismicrophone\0"
+    "mismobile\0"
+    "mismonitor\0"
+    "mismusic\0"
+    "misname\0"
+    "misnation\0"
+    "misoffer\0"
+    "misofferible\0"
+    "misoperation\0"
+    "mispass\0"
+    "mispattern\0"
+    "mispay\0"
+    "mispayhood\0"
+    "mispersonalory\0"
+    "mispersonalsome\0"
+    "misphone\0"
+    "mispick\0"
+    "misplatform\0"
+    "mispower\0"
+    "misprinter\0"
+    "misprotocol\0"
+    "misprovideant\0"
+    "mispublic\0"
+    "misquestion\0"
+    "misraise\0"
+    "misremember\0"
+    "misrequire\0"
+    "misresistance\0"
+    "misscience\0"
+    "misselling\0"
+    "misserve\0"
+    "misservice\0"
+    "missignal\0"
+    "misspeak\0"
+    "misspeaker\0"
+    "misspeakise\0"
+    "misspecial\0"
+    "misspend\0"
+    "misspendable\0"
+    "misspendly\0"
+    "misstand\0"
+    "misstandard\0"
+    "misstorage\0"
+    "misstudent\0"
+    "missystement\0"
+    "missystemness\0"
+    "missystemth\0"
+    "mistake\0"
+    "mistellment\0"
+    "mistion\0"
+    "mistiondom\0"
+    "mistool\0"
+    "mistrade\0"
+    "misuse\0"
+    "misvehicle\0"
+    "miswantsome\0"
+    "miswar\0"
+    "miswater\0"
+    "misway\0"
+    "miswhichlike\0"
+    "miswise\0"
+    "miswiseful\0"
+    "misworkest\0"
+    "misyoung\0"
+    "mobile\0"
+    "mobilealgorithm\0"
+    "mobileant\0"
+    "mobileapproach\0"
+    "mobilecomponent\0"
+    "mobilecraft\0"
+    "mobileelectricity\0"
+    "mobileent\0"
+    "mobileimage\0"
+    "mobileite\0"
+    "mobilemarket\0"
+    "mobilemicrophone\0"
+    "mobileness\0"
+    "mobileproductivity\0"
+    "mobileside\0"
+    "mobilestudy\0"
+    "mobileth\0"
+    "mobiletool\0"
+    "mobileure\0"
+    "model\0"
+    "modelable\0"
+    "modelant\0"
+    "modelapparatus\0"
+    "modelarchitecture\0"
+    "modelbus\0"
+    "modelconnector\0"
+    "modelial\0"
+    "modelic\0"
+    "modelimplementation\0"
+    "modelinstrument\0"
+    "modelive\0"
+    "modelletter\0"
+    "modelline\0"
+    "modelorder\0"
+    "modelreason\0"
+    "modelsion\0"
+    "modelsomething\0"
+    "modelty\0"
+    "modelvideo\0"
+    "modelward\0"
+    "modelword\0"
+    "modelyear\0"
+    "money\0"
+    "moneyable\0"
+    "moneyarea\0"
+    "moneycase\0"
+    "moneycontact\0"
+    "moneydesign\0"
+    "moneydevice\0"
+    "moneyen\0"
+    "moneyent\0"
+    "moneyer\0"
+    "moneyfold\0"
+    "moneying\0"
+    "moneyist\0"
+    "moneyive\0"
+    "moneymicrophone\0"
+    "moneypicture\0"
+    "moneyprinciple\0"
+    "moneyresearch\0"
+    "moneyscreen\0"
+    "moneyshipping\0"
+    "moneysion\0"
+    "moneysound\0"
+    "moneystrategy\0"
+    "moneyth\0"
+    "moneyty\0"
+    "moneyvalue\0"
+    "moneyvariable\0"
+    "monitor\0"
+    "monitorary\0"
+    "monitordisplay\0"
+    "monitordocumentation\0"
+    "monitorfy\0"
+    "monitorhood\0"
+    "monitorism\0"
+    "monitorless\0"
+    "monitorlike\0"
+    "monitorline\0"
+    "monitorous\0"
+    "monitorpart\0"
+    "monitorperson\0"
+    "monitorproblem\0"
+    "monitorship\0"
+    "monitorsome\0"
+    "monitorsupport\0"
+    "monitorure\0"
+    "monitorwise\0"
+    "most\0"
+    "mostant\0"
+    "mostary\0"
+    "mostible\0"
+    "mosting\0"
+    "mostise\0"
+    "mostive\0"
+    "mostwise\0"
+    "motor\0"
+    "motorable\0"
+    "motorary\0"
+    "motorchild\0"
+    "motorcycle\0"
+    "motorcycleable\0"
+    "motorcycleant\0"
+    "motorcycleary\0"
+    "motorcyclecable\0"
+    "motorcyclecase\0"
+    "motorcycleed\0"
+    "motorcycleism\0"
+    "motorcyclemotorcycle\0"
+    "motorcycleparameter\0"
+    "motorcyclereport\0"
+    "motorcycleship\0"
+    "motorcycleside\0"
+    "motorcyclesome\0"
+    "motorcyclestory\0"
+    "motorcycleth\0"
+    "motorenergy\0"
+    "motorist\0"
+    "motorless\0"
+    "motoroptimization\0"
+    "motorous\0"
+    "motorperson\0"
+    "motortime\0"
+    "motorward\0"
+    "mouse\0"
+    "mouseable\0"
+    "mousealgorithm\0"
+    "mouseant\0"
+    "mousedom\0"
+    "mouseed\0"
+    "mouseeducation\0"
+    "mouseelectricity\0"
+    "mousegraphic\0"
+    "mousehood\0"
+    "mouseic\0"
+    "mouseinformation\0"
+    "mouseise\0"
+    "mouseism\0"
+    "mousely\0"
+    "mousement\0"
+    "mousemobile\0"
+    "mousemouse\0"
+    "mouseory\0"
+    "mousepolicy\0"
+    "mousesion\0"
+    "mousesolution\0"
+    "mousesome\0"
+    "mousestate\0"
+    "mousestudy\0"
+    "mouseteen\0"
+    "mousety\0"
+    "move\0"
+    "moveen\0"
+    "moveite\0"
+    "moveteen\0"
+    "movewise\0"
+    "multiable\0"
+    "multialgorithm\0"
+    "multiallow\0"
+    "multianalysis\0"
+    "multiapplication\0"
+    "multiarchitecture\0"
+    "multiarea\0"
+    "multiask\0"
+    "multibicycle\0"
+    "multiboat\0"
+    "multibreak\0"
+    "multibusiness\0"
+    "multicar\0"
+    "multichange\0"
+    "multicompany\0"
+    "multicomputer\0"
+    "multiconcept\0"
+    "multicreate\0"
+    "multicultural\0"
+    "multiday\0"
+    "multidecideent\0"
+    "multidelivery\0"
+    "multidevice\0"
+    "multidisplay\0"
+    "multieducation\0"
+    "multiemail\0"
+    "multiequipment\0"
+    "multiexample\0"
+    "multiexpectism\0"
+    "multifamily\0"
+    "multifeature\0"
+    "multifeelfy\0"
+    "multifeelic\0"
+    "multifinancialed\0"
+    "multifoundation\0"
+    "multiframework\0"
+    "multigiveory\0"
+    "multigovernment\0"
+    "multigrow\0"
+    "multigrowth\0"
+    "multihistorical\0"
+    "multihouse\0"
+    "multiible\0"
+    "multiibleible\0"
+    "multiinclude\0"
+    "multiinformation\0"
+    "multiinternational\0"
+    "multiinternet\0"
+    "multileading\0"
+    "multileaveite\0"
+    "multilevel\0"
+    "multimaintenance\0"
+    "multimarket\0"
+    "multimechanism\0"
+    "multimember\0"
+    "multimentage\0"
+    "multimicrophone\0"
+    "multimodel\0"
+    "multimostship\0"
+    "multimotor\0"
+    "multinetwork\0"
+    "multioffice\0"
+    "multiphone\0"
+    "multipickism\0"
+    "multipicture\0"
+    "multiplace\0"
+    "multipolicy\0"
+    "multipower\0"
+    "multiprice\0"
+    "multiprocedure\0"
+    "multiprocess\0"
+    "multiprocessor\0"
+    "multiprofessional\0"
+    "multiprogram\0"
+    "multiproject\0"
+    "multiproperty\0"
+    "multiprovide\0"
+    "multiprovideent\0"
+    "multipublic\0"
+    "multiquestion\0"
+    "multireason\0"
+    "multireport\0"
+    "multirequireable\0"
+    "multirequirefy\0"
+    "multiresource\0"
+    "multiresult\0"
+    "multiscience\0"
+    "multiship\0"
+    "multisignal\0"
+    "multisocial\0"
+    "multisoftware\0"
+    "multisolution\0"
+    "multisomething\0"
+    "multispeak\0"
+    "multispecial\0"
+    "multistorage\0"
+    "multistudy\0"
+    "multitechnicalfy\0"
+    "multitechnique\0"
+    "multitheory\0"
+    "multitool\0"
+    "multitraining\0"
+    "multitransport\0"
+    "multitravel\0"
+    "multitruck\0"
+    "multivalue\0"
+    "multivideo\0"
+    "multiwalk\0"
+    "multiwardent\0"
+    "multiwatchness\0"
+    "multiway\0"
+    "multiwear\0"
+    "multiwhen\0"
+    "multiwhere\0"
+    "multiwhereous\0"
+    "multiwinism\0"
+    "multiwinsome\0"
+    "multiwisewise\0"
+    "multiworker\0"
+    "multiwrite\0"
+    "multiyear\0"
+    "music\0"
+    "musicable\0"
+    "musicen\0"
+    "musicfy\0"
+    "musichood\0"
+    "musicise\0"
+    "musicless\0"
+    "musicmotorcycle\0"
+    "musicory\0"
+    "musicpublic\0"
+    "musicsensor\0"
+    "musicstate\0"
+    "musicstrategy\0"
+    "musicth\0"
+    "musictheory\0"
+    "musiction\0"
+    "musictrain\0"
+    "musicure\0"
+    "musicward\0"
+    "name\0"
+    "nameapparatus\0"
+    "nameary\0"
+    "namedesign\0"
+    "nameed\0"
+    "nameexperience\0"
+    "namefold\0"
+    "namehealth\0"
+    "namehouse\0"
+    "nameial\0"
+    "nameism\0"
+    "nameist\0"
+    "nameite\0"
+    "nameive\0"
+    "nameize\0"
+    "nameless\0"
+    "namemicrophone\0"
+    "nameous\0"
+    "nameresource\0"
+    "nameroom\0"
+    "namesupport\0"
+    "nameteen\0"
+    "nation\0"
+    "national\0"
+    "nationalage\0"
+    "nationalcraft\0"
+    "nationaldom\0"
+    "nationaled\0"
+    "nationalfy\0"
+    "nationalous\0"
+    "nationalwise\0"
+    "nationary\0"
+    "nationbook\0"
+    "nationcraft\0"
+    "nationdisplay\0"
+    "nationdocumentation\0"
+    "nationdom\0"
+    "nationen\0"
+    "nationer\0"
+    "nationful\0"
+    "nationgraphic\0"
+    "nationial\0"
+    "nationise\0"
+    "nationist\0"
+    "nationite\0"
+    "nationize\0"
+    "nationlight\0"
+    "nationoffice\0"
+    "nationoperation\0"
+    "nationparameter\0"
+    "nationproperty\0"
+    "nationresearch\0"
+    "nationsion\0"
+    "nationtion\0"
+    "nationvehicle\0"
+    "nationwoman\0"
+    "nationyear\0"
+    "natural\0"
+    "naturalant\0"
+    "naturalful\0"
+    "naturalhood\0"
+    "naturalism\0"
+    "naturalive\0"
+    "naturalty\0"
+    "nature\0"
+    "natureable\0"
+    "naturearchitecture\0"
+    "naturecompany\0"
+    "naturecraft\0"
+    "natureen\0"
+    "natureer\0"
+    "naturefold\0"
+    "natureful\0"
+    "natureible\0"
+    "natureic\0"
+    "natureing\0"
+    "natureinternet\0"
+    "natureist\0"
+    "natureless\0"
+    "natureline\0"
+    "naturelocation\0"
+    "naturely\0"
+    "naturemodel\0"
+    "naturemonitor\0"
+    "naturename\0"
+    "natureory\0"
+    "natureplace\0"
+    "natureprinter\0"
+    "natureship\0"
+    "naturespeaker\0"
+    "naturevoltage\0"
+    "natureweek\0"
+    "naturewise\0"
+    "ness\0"
+    "nesscraft\0"
+    "nessdom\0"
+    "nesser\0"
+    "nessial\0"
+    "nessism\0"
+    "nessly\0"
+    "nessship\0"
+    "nessure\0"
+    "network\0"
+    "networkattribute\0"
+    "networkaudio\0"
+    "networkcolor\0"
+    "networkcontact\0"
+    "networkent\0"
+    "networkfold\0"
+    "networkhood\0"
+    "networkise\0"
+    "networkive\0"
+    "networkless\0"
+    "networkmobile\0"
+    "networkproblem\0"
+    "networkship\0"
+    "networksomething\0"
+    "networkstudent\0"
+    "networkstudy\0"
+    "networkth\0"
+    "news\0"
+    "newsadapter\0"
+    "newsage\0"
+    "newsapplication\0"
+    "newsarea\0"
+    "newscraft\0"
+    "newsenergy\0"
+    "newsent\0"
+    "newsful\0"
+    "newsic\0"
+    "newsinternet\0"
+    "newsise\0"
+    "newsist\0"
+    "newsite\0"
+    "newslight\0"
+    "newsnation\0"
+    "newsness\0"
+    "newsnews\0"
+    "newsous\0"
+    "newspicture\0"
+    "newssecurity\0"
+    "newsstandard\0"
+    "newsth\0"
+    "newsure\0"
+    "newsward\0"
+    "newswave\0"
+    "newsweek\0"
+    "nonable\0"
+    "nonableed\0"
+    "nonactivity\0"
+    "nonadapter\0"
+    "nonadd\0"
+    "nonaddic\0"
+    "nonaddite\0"
+    "nonalgorithm\0"
+    "nonanalysis\0"
+    "nonapparatus\0"
+    "nonappearure\0"
+    "nonaskly\0"
+    "nonaudio\0"
+    "nonbasis\0"
+    "nonbicycle\0"
+    "nonboat\0"
+    "nonbuild\0"
+    "noncase\0"
+    "noncircuit\0"
+    "noncomeism\0"
+    "noncommunication\0"
+    "noncomponent\0"
+    "nonconcept\0"
+    "noncontinueic\0"
+    "noncountry\0"
+    "noncultural\0"
+    "nondelivery\0"
+    "nondesign\0"
+    "nondie\0"
+    "nondirectory\0"
+    "nonelement\0"
+    "nonenergy\0"
+    "nonequipment\0"
+    "nonfact\0"
+    "nonfalldom\0"
+    "nonfallfold\0"
+    "nonfile\0"
+    "nonfolder\0"
+    "nonfuel\0"
+    "nonfullen\0"
+    "nongraphic\0"
+    "nongroup\0"
+    "nonheadphone\0"
+    "nonhistorical\0"
+    "nonhistoricalial\0"
+    "nonhistory\0"
+    "nonhouse\0"
+    "nonimage\0"
+    "noninstrument\0"
+    "noninterest\0"
+    "noninternational\0"
+    "nonknow\0"
+    "nonlearn\0"
+    "nonlearnly\0"
+    "nonlife\0"
+    "nonlight\0"
+    "nonline\0"
+    "nonlocalent\0"
+    "nonlocation\0"
+    "nonlook\0"
+    "nonlosesome\0"
+    "nonlovewise\0"
+    "nonmachine\0"
+    "nonmaintenance\0"
+    "nonmanagement\0"
+    "nonmoney\0"
+    "nonmost\0"
+    "nonmotorcycle\0"
+    "nonmoveest\0"
+    "nonmusic\0"
+    "nonnature\0"
+    "nonnumber\0"
+    "nonoffice\0"
+    "nonopenfy\0"
+    "nonorder\0"
+    "nonpaper\0"
+    "nonpass\0"
+    "nonpassage\0"
+    "nonphoto\0"
+    "nonpoint\0"
+    "nonpolicy\0"
+    "nonposition\0"
+    "nonpower\0"
+    "nonprocessor\0"
+    "nonprofessional\0"
+    "nonproject\0"
+    "nonproperty\0"
+    "nonprotocol\0"
+    "nonpublic\0"
+    "nonpullteen\0"
+    "nonquestion\0"
+    "nonradiation\0"
+    "nonraise\0"
+    "nonremainsome\0"
+    "nonremainure\0"
+    "nonreport\0"
+    "nonresearch\0"
+    "nonroom\0"
+    "nonseemfy\0"
+    "nonserveent\0"
+    "nonship\0"
+    "nonshipping\0"
+    "nonside\0"
+    "nonsionure\0"
+    "nonsit\0"
+    "nonspace\0"
+    "nonspeaker\0"
+    "nonstandard\0"
+    "nonstandous\0"
+    "nonstrategy\0"
+    "nonstructure\0"
+    "nontechnique\0"
+    "nontext\0"
+    "nontheory\0"
+    "nontime\0"
+    "nontrain\0"
+    "nontraining\0"
+    "nontravel\0"
+    "nontryhood\0"
+    "nontrying\0"
+    "nonunderstandory\0"
+    "nonuniversity\0"
+    "nonvalue\0"
+    "nonvariable\0"
+    "nonwantize\0"
+    "nonwebsite\0"
+    "nonweek\0"
+    "nonwhat\0"
+    "nonwhen\0"
+    "nonwhere\0"
+    "nonworkous\0"
+    "nonwrite\0"
+    "number\0"
+    "numberant\0"
+    "numbercable\0"
+    "numbercar\0"
+    "numberconcept\0"
+    "numberdevice\0"
+    "numberdocumentation\0"
+    "numberen\0"
+    "numberenergy\0"
+    "numberer\0"
+    "numberfy\0"
+    "numberhood\0"
+    "numberial\0"
+    "numbering\0"
+    "numberive\0"
+    "numberlife\0"
+    "numbermarket\0"
+    "numbermonitor\0"
+    "numberparameter\0"
+    "numberreport\0"
+    "numberresult\0"
+    "numberroom\0"
+    "numbersolution\0"
+    "numberspecial\0"
+    "numbertechnique\0"
+    "numbertransport\0"
+    "numbervideo\0"
+    "offer\0"
+    "offerable\0"
+    "offerant\0"
+    "offerfold\0"
+    "offeric\0"
+    "offersion\0"
+    "offerward\0"
+    "office\0"
+    "officealgorithm\0"
+    "officeary\0"
+    "officebattery\0"
+    "officeboat\0"
+    "officebus\0"
+    "officecolor\0"
+    "officeed\0"
+    "officeen\0"
+    "officefy\0"
+    "officeive\0"
+    "officelight\0"
+    "officelike\0"
+    "officelocation\0"
+    "officemodel\0"
+    "officeprocedure\0"
+    "officespeaker\0"
+    "officeure\0"
+    "open\0"
+    "openary\0"
+    "openful\0"
+    "openial\0"
+    "openous\0"
+    "openship\0"
+    "opention\0"
+    "openwise\0"
+    "operation\0"
+    "operational\0"
+    "operationdesign\0"
+    "operationdevice\0"
+    "operationed\0"
+    "operationent\0"
+    "operationframework\0"
+    "operationhood\0"
+    "operationive\0"
+    "operationmaterial\0"
+    "operationmethod\0"
+    "operationnation\0"
+    "operationory\0"
+    "operationous\0"
+    "operationstate\0"
+    "operationterm\0"
+    "operationward\0"
+    "operationwebsite\0"
+    "optimization\0"
+    "optimizationable\0"
+    "optimizationage\0"
+    "optimizationary\0"
+    "optimizationelement\0"
+    "optimizationemail\0"
+    "optimizationful\0"
+    "optimizationgroup\0"
+    "optimizationible\0"
+    "optimizationic\0"
+    "optimizationism\0"
+    "optimizationite\0"
+    "optimizationly\0"
+    "optimizationmachine\0"
+    "optimizationname\0"
+    "optimizationside\0"
+    "optimizationterm\0"
+    "optimizationth\0"
+    "optimizationwise\0"
+    "order\0"
+    "orderable\0"
+    "orderaction\0"
+    "orderboat\0"
+    "ordercraft\0"
+    "orderdisplay\0"
+    "ordered\0"
+    "orderefficiency\0"
+    "orderfile\0"
+    "orderfold\0"
+    "orderial\0"
+    "orderise\0"
+    "orderist\0"
+    "orderite\0"
+    "orderive\0"
+    "orderize\0"
+    "orderly\0"
+    "ordermicrophone\0"
+    "orderory\0"
+    "ordersion\0"
+    "ordersolution\0"
+    "ordersome\0"
+    "orderspace\0"
+    "ordersystem\0"
+    "ordervehicle\0"
+    "ordervideo\0"
+    "orderworld\0"
+    "organization\0"
+    "organizationbusiness\0"
+    "organizationcamera\0"
+    "organizationdocument\0"
+    "organizationdom\0"
+    "organizationemail\0"
+    "organizationer\0"
+    "organizationfeature\0"
+    "organizationfy\0"
+    "organizationic\0"
+    "organizationive\0"
+    "organizationize\0"
+    "organizationlike\0"
+    "organizationory\0"
+    "organizationous\0"
+    "organizationpart\0"
+    "organizationteen\0"
+    "outadd\0"
+    "outaddress\0"
+    "outalgorithm\0"
+    "outanalysis\0"
+    "outarchitecture\0"
+    "outbicycle\0"
+    "outboat\0"
+    "outbook\0"
+    "outbusiness\0"
+    "outcar\0"
+    "outchangeible\0"
+    "outchild\0"
+    "outcircuit\0"
+    "outcolor\0"
+    "outcommunication\0"
+    "outcomponent\0"
+    "outcomputer\0"
+    "outconcept\0"
+    "outcontinuement\0"
+    "outcountry\0"
+    "outcourse\0"
+    "outcreateism\0"
+    "outdecide\0"
+    "outdevelopment\0"
+    "outdevice\0"
+    "outdiewise\0"
+    "outdocument\0"
+    "outeducational\0"
+    "outelectricity\0"
+    "outexample\0"
+    "outexpectable\0"
+    "outexperience\0"
+    "outfact\0"
+    "outfoundation\0"
+    "outfullory\0"
+    "outglobalteen\0"
+    "outgroup\0"
+    "outhealth\0"
+    "outhistory\0"
+    "outhooding\0"
+    "outibleure\0"
+    "outimage\0"
+    "outinterest\0"
+    "outinternet\0"
+    "outkeyboard\0"
+    "outlead\0"
+    "outlearn\0"
+    "outlessen\0"
+    "outlevel\0"
+    "outlike\0"
+    "outlive\0"
+    "outmake\0"
+    "outmakeant\0"
+    "outmechanism\0"
+    "outmember\0"
+    "outment\0"
+    "outmicrophone\0"
+    "outmobile\0"
+    "outmoney\0"
+    "outmost\0"
+    "outmouse\0"
+    "outnation\0"
+    "outnationalen\0"
+    "outnaturalable\0"
+    "outnumber\0"
+    "outoperation\0"
+    "outorder\0"
+    "outorganization\0"
+    "outpaperer\0"
+    "outpart\0"
+    "outpath\0"
+    "outperson\0"
+    "outpersonalize\0"
+    "outplane\0"
+    "outplatform\0"
+    "outplay\0"
+    "outposition\0"
+    "outpower\0"
+    "outprinciple\0"
+    "outproblem\0"
+    "outprogram\0"
+    "outproject\0"
+    "outproperty\0"
+    "outprovideant\0"
+    "outroom\0"
+    "outscanner\0"
+    "outscience\0"
+    "outsensor\0"
+    "outservice\0"
+    "outsetcraft\0"
+    "outship\0"
+    "outsitible\0"
+    "outsitlike\0"
+    "outspecial\0"
+    "outstory\0"
+    "outstudent\0"
+    "outstudy\0"
+    "outsuggest\0"
+    "outtechnicalcraft\0"
+    "outtechnology\0"
+    "outtime\0"
+    "outtion\0"
+    "outtraining\0"
+    "outtransport\0"
+    "outtravel\0"
+    "outtreatment\0"
+    "outtruck\0"
+    "outusedom\0"
+    "outvalue\0"
+    "outwalk\0"
+    "outwatchth\0"
+    "outwater\0"
+    "outwear\0"
+    "outwebsite\0"
+    "outwhat\0"
+    "outwhereure\0"
+    "outwhichdom\0"
+    "outwoman\0"
+    "outwork\0"
+    "outworked\0"
+    "outworkment\0"
+    "outyear\0"
+    "overadapter\0"
+    "overalgorithm\0"
+    "overanalysis\0"
+    "overarchitecture\0"
+    "overask\0"
+    "overattribute\0"
+    "overaudio\0"
+    "overbattery\0"
+    "overbicycle\0"
+    "overboat\0"
+    "overbook\0"
+    "overbuild\0"
+    "overbusiness\0"
+    "overbuy\0"
+    "overcall\0"
+    "overcallen\0"
+    "overcamera\0"
+    "overcase\0"
+    "overcolor\0"
+    "overcomeent\0"
+    "overcompany\0"
+    "overcourse\0"
+    "overcreatecraft\0"
+    "overdieless\0"
+    "overdigital\0"
+    "overdocument\0"
+    "overeducationalty\0"
+    "overelement\0"
+    "overend\0"
+    "overengine\0"
+    "overequipment\0"
+    "overexpectment\0"
+    "overfollow\0"
+    "overglobalous\0"
+    "overgovernment\0"
+    "overgraphic\0"
+    "overhealth\0"
+    "overhistorical\0"
+    "overhistory\0"
+    "overhood\0"
+    "overimage\0"
+    "overinclude\0"
+    "overinstrument\0"
+    "overinternationaling\0"
+    "overjob\0"
+    "overknow\0"
+    "overlead\0"
+    "overlearn\0"
+    "overleave\0"
+    "overlight\0"
+    "overlocation\0"
+    "overmaintenance\0"
+    "overmanagement\0"
+    "overmaterial\0"
+    "overmeet\0"
+    "overmemory\0"
+    "overmethod\0"
+    "overmobile\0"
+    "overmoney\0"
+    "overmonitor\0"
+    "overmostic\0"
+    "overmouse\0"
+    "overmove\0"
+    "overname\0"
+    "overnation\0"
+    "overnational\0"
+    "overnaturalant\0"
+    "overnumber\0"
+    "overorder\0"
+    "overpackage\0"
+    "overpapersion\0"
+    "overperformance\0"
+    "overpick\0"
+    "overpickory\0"
+    "overplan\0"
+    "overplane\0"
+    "overpolicy\0"
+    "overpower\0"
+    "overprice\0"
+    "overprinciple\0"
+    "overprocess\0"
+    "overprogram\0"
+    "overproperty\0"
+    "overpull\0"
+    "overraiseful\0"
+    "overremember\0"
+    "overreport\0"
+    "overreportteen\0"
+    "overrequire\0"
+    "overresistance\0"
+    "overright\0"
+    "overscanner\0"
+    "overschool\0"
+    "overscience\0"
+    "overscreen\0"
+    "overseemhood\0"
+    "overservice\0"
+    "overside\0"
+    "oversionism\0"
+    "oversitous\0"
+    "oversocial\0"
+    "oversoftware\0"
+    "overspeakise\0"
+    "overspendsion\0"
+    "overstand\0"
+    "overstaysome\0"
+    "overstorage\0"
+    "overstructure\0"
+    "overtakedom\0"
+    "overtechnique\0"
+    "overtechnology\0"
+    "overtheory\0"
+    "overthing\0"
+    "overthink\0"
+    "overtime\0"
+    "overtionful\0"
+    "overtool\0"
+    "overtryous\0"
+    "overvariable\0"
+    "overvehicle\0"
+    "overvideo\0"
+    "overwalkdom\0"
+    "overwar\0"
+    "overwebsite\0"
+    "overweek\0"
+    "overwhere\0"
+    "overwin\0"
+    "overwoman\0"
+    "overwork\0"
+    "overyear\0"
+    "package\0"
+    "packageable\0"
+    "packagebattery\0"
+    "packagecraft\0"
+    "packagedevice\0"
+    "packagedom\0"
+    "packageest\0"
+    "packagefoundation\0"
+    "packagefy\0"
+    "packagegraphic\0"
+    "packagehood\0"
+    "packageible\0"
+    "packageic\0"
+    "packageive\0"
+    "packagely\0"
+    "packageory\0"
+    "packageprinter\0"
+    "packagereason\0"
+    "packagereport\0"
+    "packageship\0"
+    "packageshipping\0"
+    "packagesome\0"
+    "packagesupport\0"
+    "packagetheory\0"
+    "packagetion\0"
+    "packagety\0"
+    "paper\0"
+    "papered\0"
+    "paperen\0"
+    "paperest\0"
+    "paperful\0"
+    "paperhood\0"
+    "paperial\0"
+    "paperize\0"
+    "parameter\0"
+    "parameterage\0"
+    "parameterbasis\0"
+    "parameterdom\0"
+    "parametered\0"
+    "parameterelement\0"
+    "parameterer\0"
+    "parameterful\0"
+    "parameterimage\0"
+    "parameterinnovation\0"
+    "parameterinstrument\0"
+    "parameterism\0"
+    "parameterive\0"
+    "parameterjob\0"
+    "parameterless\0"
+    "parameterlike\0"
+    "parametermonitor\0"
+    "parameterory\0"
+    "parameterpath\0"
+    "parameterpoint\0"
+    "parameterprocedure\0"
+    "parameterprocess\0"
+    "parametersion\0"
+    "parameterspecial\0"
+    "parametertext\0"
+    "parametertravel\0"
+    "parameterure\0"
+    "parametervideo\0"
+    "parameterwise\0"
+    "part\0"
+    "partarchitecture\0"
+    "partbasis\0"
+    "partcar\0"
+    "parted\0"
+    "partelectricity\0"
+    "parter\0"
+    "partfy\0"
+    "parthand\0"
+    "parthome\0"
+    "partial\0"
+    "partible\0"
+    "partize\0"
+    "partless\0"
+    "partmobile\0"
+    "partmotor\0"
+    "partprice\0"
+    "partright\0"
+    "partsome\0"
+    "partstudent\0"
+    "parttravel\0"
+    "parttruck\0"
+    "parture\0"
+    "party\0"
+    "partyaddress\0"
+    "partyage\0"
+    "partyal\0"
+    "partyary\0"
+    "partyaudio\0"
+    "partycable\0"
+    "partycharger\0"
+    "partyed\0"
+    "partyelectricity\0"
+    "partyen\0"
+    "partyent\0"
+    "partyest\0"
+    "partyfold\0"
+    "partyfy\0"
+    "partyial\0"
+    "partyise\0"
+    "partyive\0"
+    "partyly\0"
+    "partymodel\0"
+    "partyory\0"
+    "partypublic\0"
+    "partyschool\0"
+    "partysolution\0"
+    "partyspace\0"
+    "partytransport\0"
+    "partyuniversity\0"
+    "partyure\0"
+    "partyvalue\0"
+    "partywise\0"
+    "pass\0"
+    "passory\0"
+    "path\0"
+    "pathal\0"
+    "pathapparatus\0"
+    "pathcharger\0"
+    "pathcolor\0"
+    "pathcurrent\0"
+    "pathdisplay\0"
+    "pathend\0"
+    "pathexperience\0"
+    "pathfeature\0"
+    "pathfuel\0"
+    "pathful\0"
+    "pathhood\0"
+    "pathise\0"
+    "pathite\0"
+    "pathkeyboard\0"
+    "pathmember\0"
+    "pathment\0"
+    "pathness\0"
+    "pathproperty\0"
+    "pathsome\0"
+    "pathstory\0"
+    "pathtransport\0"
+    "pathty\0"
+    "pathvehicle\0"
+    "pathwise\0"
+    "pattern\0"
+    "patternage\0"
+    "patternal\0"
+    "patterncircuit\0"
+    "patternent\0"
+    "patternexperience\0"
+    "patternhood\0"
+    "patterning\0"
+    "patternise\0"
+    "patternive\0"
+    "patternless\0"
+    "patternletter\0"
+    "patternlike\0"
+    "patternment\0"
+    "patternmouse\0"
+    "patternpeople\0"
+    "patternreport\0"
+    "patternscanner\0"
+    "patternship\0"
+    "patternspace\0"
+    "patternth\0"
+    "patterntion\0"
+    "patternward\0"
+    "patternwave\0"
+    "pay\0"
+    "paylike\0"
+    "payteen\0"
+    "people\0"
+    "peopleable\0"
+    "peopleant\0"
+    "peoplearchitecture\0"
+    "peoplebus\0"
+    "peopleconstant\0"
+    "peopleemail\0"
+    "peoplehood\0"
+    "peopleic\0"
+    "peopleinterest\0"
+    "peopleinterface\0"
+    "peopleise\0"
+    "peopleive\0"
+    "peoplemessage\0"
+    "peopleness\0"
+    "peopleous\0"
+    "peoplephone\0"
+    "peoplescience\0"
+    "peopleship\0"
+    "peoplestandard\0"
+    "peoplesystem\0"
+    "peopletechnique\0"
+    "peopletransport\0"
+    "peoplewave\0"
+    "performance\0"
+    "performanceable\0"
+    "performancearea\0"
+    "performanceday\0"
+    "performanceeducation\0"
+    "performanceen\0"
+    "performancefold\0"
+    "performancefy\0"
+    "performanceial\0"
+    "performanceism\0"
+    "performanceite\0"
+    "performanceive\0"
+    "performanceless\0"
+    "performancely\0"
+    "performancemember\0"
+    "performancement\0"
+    "performanceory\0"
+    "performanceperson\0"
+    "performanceresult\0"
+    "performanceship\0"
+    "performancesion\0"
+    "performancesoftware\0"
+    "performancetext\0"
+    "performancevoltage\0"
+    "performancewise\0"
+    "person\0"
+    "personal\0"
+    "personalable\0"
+    "personalage\0"
+    "personalite\0"
+    "personalth\0"
+    "personalty\0"
+    "personalwise\0"
+    "personary\0"
+    "personboat\0"
+    "personcraft\0"
+    "persondelivery\0"
+    "persondom\0"
+    "personengine\0"
+    "personest\0"
+    "personexperience\0"
+    "personfy\0"
+    "personhood\0"
+    "personial\0"
+    "personible\0"
+    "personinterface\0"
+    "personise\0"
+    "personism\0"
+    "personist\0"
+    "personline\0"
+    "personly\0"
+    "personmachine\0"
+    "personmaterial\0"
+    "personmechanism\0"
+    "personmember\0"
+    "personmicrophone\0"
+    "personness\0"
+    "personory\0"
+    "personplan\0"
+    "personside\0"
+    "personsion\0"
+    "personsociety\0"
+    "persontion\0"
+    "persontool\0"
+    "persontrade\0"
+    "persontravel\0"
+    "personward\0"
+    "phone\0"
+    "phoneable\0"
+    "phoneary\0"
+    "phonebook\0"
+    "phonecolor\0"
+    "phonedatabase\0"
+    "phoneer\0"
+    "phonefact\0"
+    "phonegovernment\0"
+    "phoneible\0"
+    "phoneic\0"
+    "phoneorder\0"
+    "phonepoint\0"
+    "phoneprinter\0"
+    "phoneproductivity\0"
+    "phoneresearch\0"
+    "phoneschool\0"
+    "phoneship\0"
+    "phonestate\0"
+    "phonestorage\0"
+    "phonety\0"
+    "phoneway\0"
+    "photo\0"
+    "photoal\0"
+    "photocraft\0"
+    "photodirectory\0"
+    "photoent\0"
+    "photoer\0"
+    "photofold\0"
+    "photofunction\0"
+    "photofy\0"
+    "photogroup\0"
+    "photoible\0"
+    "photoic\0"
+    "photoing\0"
+    "photoise\0"
+    "photoism\0"
+    "photoist\0"
+    "photojob\0"
+    "photoletter\0"
+    "photolevel\0"
+    "photomaterial\0"
+    "photomechanism\0"
+    "photomobile\0"
+    "photomotorcycle\0"
+    "photonation\0"
+    "photoory\0"
+    "photoroom\0"
+    "photoservice\0"
+    "photosome\0"
+    "photostory\0"
+    "phototeen\0"
+    "phototion\0"
+    "phototy\0"
+    "photowise\0"
+    "photoworld\0"
+    "pick\0"
+    "pickal\0"
+    "picked\0"
+    "pickhood\0"
+    "pickless\0"
+    "pickty\0"
+    "picture\0"
+    "pictureage\0"
+    "pictureal\0"
+    "pictureant\0"
+    "pictureapparatus\0"
+    "picturecomponent\0"
+    "pictureed\0"
+    "pictureen\0"
+    "pictureer\0"
+    "pictureest\0"
+    "picturefrequency\0"
+    "pictureful\0"
+    "picturegraphic\0"
+    "pictureial\0"
+    "pictureible\0"
+    "pictureinnovation\0"
+    "pictureise\0"
+    "pictureism\0"
+    "pictureive\0"
+    "pictureless\0"
+    "picturelocation\0"
+    "picturely\0"
+    "picturemusic\0"
+    "pictureness\0"
+    "pictureposition\0"
+    "picturepower\0"
+    "picturequality\0"
+    "pictureradiation\0"
+    "pictureresult\0"
+    "picturesome\0"
+    "pictureteen\0"
+    "picturetheory\0"
+    "picturewise\0"
+    "place\0"
+    "placeactivity\0"
+    "placeary\0"
+    "placeaudio\0"
+    "placeboat\0"
+    "placecharacteristic\0"
+    "placecharger\0"
+    "placecomputer\0"
+    "placecraft\0"
+    "placedom\0"
+    "placeequipment\0"
+    "placeest\0"
+    "placefy\0"
+    "placeial\0"
+    "placeic\0"
+    "placeinterface\0"
+    "placeism\0"
+    "placelike\0"
+    "placemotor\0"
+    "placeous\0"
+    "placeprocedure\0"
+    "placeright\0"
+    "placeth\0"
+    "placety\0"
+    "placeure\0"
+    "placeweek\0"
+    "plan\0"
+    "plancharger\0"
+    "plandocumentation\0"
+    "plane\0"
+    "planeage\0"
+    "planeapparatus\0"
+    "planechild\0"
+    "planed\0"
+    "planedevelopment\0"
+    "planeen\0"
+    "planeexample\0"
+    "planefold\0"
+    "planegovernment\0"
+    "planeheadphone\0"
+    "planehood\0"
+    "planeimplementation\0"
+    "planeise\0"
+    "planeist\0"
+    "planelevel\0"
+    "planemechanism\0"
+    "planement\0"
+    "planen\0"
+    "planeparameter\0"
+    "planeposition\0"
+    "planeprocess\0"
+    "planeproject\0"
+    "planer\0"
+    "planesome\0"
+    "planest\0"
+    "planeward\0"
+    "planewise\0"
+    "planhood\0"
+    "planial\0"
+    "planist\0"
+    "planize\0"
+    "planory\0"
+    "planous\0"
+    "planradiation\0"
+    "planresistance\0"
+    "planship\0"
+    "plansion\0"
+    "plansome\0"
+    "planspace\0"
+    "planspeaker\0"
+    "planteen\0"
+    "planth\0"
+    "plantruck\0"
+    "planvoltage\0"
+    "planwork\0"
+    "platform\0"
+    "platformal\0"
+    "platformant\0"
+    "platformarchitecture\0"
+    "platformbattery\0"
+    "platformcar\0"
+    "platformcomponent\0"
+    "platformdesign\0"
+    "platformdom\0"
+    "platformed\0"
+    "platformend\0"
+    "platformer\0"
+    "platformest\0"
+    "platformfoundation\0"
+    "platformfuel\0"
+    "platformhistory\0"
+    "platforminformation\0"
+    "platformize\0"
+    "platformmodel\0"
+    "platformness\0"
+    "platformous\0"
+    "platformpath\0"
+    "platformperformance\0"
+    "platformpoint\0"
+    "platformship\0"
+    "platformteen\0"
+    "play\0"
+    "playable\0"
+    "played\0"
+    "playic\0"
+    "playlike\0"
+    "playship\0"
+    "point\0"
+    "pointable\0"
+    "pointage\0"
+    "pointant\0"
+    "pointapplication\0"
+    "pointcase\0"
+    "pointcountry\0"
+    "pointdom\0"
+    "pointed\0"
+    "pointen\0"
+    "pointenergy\0"
+    "pointent\0"
+    "pointest\0"
+    "pointfold\0"
+    "pointfolder\0"
+    "pointgovernment\0"
+    "pointhood\0"
+    "pointic\0"
+    "pointinternet\0"
+    "pointive\0"
+    "pointize\0"
+    "pointlife\0"
+    "pointposition\0"
+    "pointpublic\0"
+    "pointship\0"
+    "pointsignal\0"
+    "pointsion\0"
+    "pointsomething\0"
+    "pointterm\0"
+    "pointtion\0"
+    "pointtravel\0"
+    "pointward\0"
+    "pointwebsite\0"
+    "policy\0"
+    "policycourse\0"
+    "policyen\0"
+    "policyest\0"
+    "policyfile\0"
+    "policyfrequency\0"
+    "policygrowth\0"
+    "policyhistory\0"
+    "policyhood\0"
+    "policyial\0"
+    "policyic\0"
+    "policying\0"
+    "policyjob\0"
+    "policymethod\0"
+    "policyory\0"
+    "policysome\0"
+    "policystorage\0"
+    "policytion\0"
+    "policytreatment\0"
+    "political\0"
+    "politicalable\0"
+    "politicalcraft\0"
+    "politicalible\0"
+    "politicaling\0"
+    "politicalory\0"
+    "politicalous\0"
+    "politicalship\0"
+    "politicalth\0"
+    "politicaltion\0"
+    "politicalwise\0"
+    "position\0"
+    "positionalgorithm\0"
+    "positionbattery\0"
+    "positionbook\0"
+    "positionbusiness\0"
+    "positionconnector\0"
+    "positionframework\0"
+    "positiongraphic\0"
+    "positionise\0"
+    "positionism\0"
+    "positionist\0"
+    "positionive\0"
+    "positionly\0"
+    "positionpeople\0"
+    "positionphone\0"
+    "positionproblem\0"
+    "positionproject\0"
+    "positionsignal\0"
+    "positionsome\0"
+    "power\0"
+    "poweraction\0"
+    "poweradapter\0"
+    "powerage\0"
+    "powerapproach\0"
+    "powerary\0"
+    "poweraudio\0"
+    "powerbus\0"
+    "powerbusiness\0"
+    "powercharger\0"
+    "powercolor\0"
+    "powercountry\0"
+    "powercourse\0"
+    "powerdesign\0"
+    "powered\0"
+    "powereducation\0"
+    "powerfold\0"
+    "powerfolder\0"
+    "powerfunction\0"
+    "powerfy\0"
+    "powerhand\0"
+    "powerhood\0"
+    "powerible\0"
+    "powerimage\0"
+    "powerise\0"
+    "powerize\0"
+    "powerlife\0"
+    "powerlight\0"
+    "powerlike\0"
+    "powermember\0"
+    "powernation\0"
+    "powerness\0"
+    "powerory\0"
+    "powerpath\0"
+    "powerproductivity\0"
+    "powerproject\0"
+    "powerreport\0"
+    "powerschool\0"
+    "powership\0"
+    "powerside\0"
+    "powerspeaker\0"
+    "powerstudy\0"
+    "powertheory\0"
+    "powertime\0"
+    "powertool\0"
+    "powerty\0"
+    "powerure\0"
+    "powerwar\0"
+    "powerward\0"
+    "powerwise\0"
+    "powerword\0"
+    "preaction\0"
+    "prealgorithm\0"
+    "preallowible\0"
+    "prearea\0"
+    "prebattery\0"
+    "prebreak\0"
+    "prebreakty\0"
+    "prebuildless\0"
+    "prebusiness\0"
+    "precamera\0"
+    "prechangeive\0"
+    "prechild\0"
+    "precompany\0"
+    "preconnector\0"
+    "preconstant\0"
+    "precreate\0"
+    "preculturalful\0"
+    "predevelopment\0"
+    "predigitaldom\0"
+    "preeducation\0"
+    "preefficiency\0"
+    "preelectricity\0"
+    "preengine\0"
+    "preequipment\0"
+    "preexample\0"
+    "preexperience\0"
+    "prefact\0"
+    "prefeeler\0"
+    "prefindsome\0"
+    "preframework\0"
+    "prehome\0"
+    "preimplementation\0"
+    "preinstrument\0"
+    "preinterest\0"
+    "preinterface\0"
+    "prelearn\0"
+    "preleave\0"
+    "prelevel\0"
+    "preliveful\0"
+    "preliveize\0"
+    "prelocalable\0"
+    "prelocalward\0"
+    "prelose\0"
+    "preloseive\0"
+    "preloveal\0"
+    "premaintenance\0"
+    "premechanism\0"
+    "premost\0"
+    "premouse\0"
+    "premove\0"
+    "prenationalen\0"
+    "prenetwork\0"
+    "prenumber\0"
+    "preoperation\0"
+    "prepart\0"
+    "prepath\0"
+    "prepayless\0"
+    "prepeople\0"
+    "preplace\0"
+    "preplatform\0"
+    "prepower\0"
+    "preprice\0"
+    "preproblem\0"
+    "preprocedure\0"
+    "preproductivity\0"
+    "preprofessional\0"
+    "preprovide\0"
+    "preprovidely\0"
+    "prepublic\0"
+    "prequality\0"
+    "preread\0"
+    "preremainhood\0"
+    "prereportness\0"
+    "preright\0"
+    "prescientific\0"
+    "presecurity\0"
+    "preseem\0"
+    "presell\0"
+    "presendial\0"
+    "presendly\0"
+    "preservice\0"
+    "preset\0"
+    "presetful\0"
+    "preshipping\0"
+    "presitist\0"
+    "presocial\0"
+    "presolution\0"
+    "presomething\0"
+    "presound\0"
+    "prespeak\0"
+    "prespeakless\0"
+    "prespecial\0"
+    "prestopness\0"
+    "prestopty\0"
+    "prestory\0"
+    "prestructure\0"
+    "prestudent\0"
+    "presystem\0"
+    "pretell\0"
+    "preterm\0"
+    "pretime\0"
+    "pretrade\0"
+    "pretrain\0"
+    "pretravel\0"
+    "pretreatment\0"
+    "pretruck\0"
+    "prevideo\0"
+    "prevoltage\0"
+    "prewalkship\0"
+    "prewar\0"
+    "prewatch\0"
+    "prewave\0"
+    "prewear\0"
+    "prewhen\0"
+    "prewhereial\0"
+    "prewhich\0"
+    "prework\0"
+    "price\0"
+    "pricebus\0"
+    "pricecolor\0"
+    "pricedom\0"
+    "pricefold\0"
+    "priceframework\0"
+    "priceheadphone\0"
+    "priceise\0"
+    "pricemanagement\0"
+    "pricemobile\0"
+    "priceory\0"
+    "priceous\0"
+    "pricepeople\0"
+    "priceship\0"
+    "pricesome\0"
+    "priceteen\0"
+    "priceth\0"
+    "pricety\0"
+    "pricevoltage\0"
+    "principle\0"
+    "principleant\0"
+    "principleaudio\0"
+    "principlebattery\0"
+    "principlebook\0"
+    "principlecraft\0"
+    "principleed\0"
+    "principleequipment\0"
+    "principleest\0"
+    "principlehood\0"
+    "principleing\0"
+    "principleite\0"
+    "principleive\0"
+    "principleize\0"
+    "principlekeyboard\0"
+    "principlelight\0"
+    "principlelocation\0"
+    "principleparty\0"
+    "principleprocedure\0"
+    "principlequality\0"
+    "principleterm\0"
+    "principletion\0"
+    "principletreatment\0"
+    "principlety\0"
+    "printer\0"
+    "printerage\0"
+    "printeral\0"
+    "printerapparatus\0"
+    "printercolor\0"
+    "printercompany\0"
+    "printercraft\0"
+    "printerdom\0"
+    "printergovernment\0"
+    "printerible\0"
+    "printeric\0"
+    "printerise\0"
+    "printerite\0"
+    "printerize\0"
+    "printerkeyboard\0"
+    "printerless\0"
+    "printerlike\0"
+    "printerpath\0"
+    "printerproject\0"
+    "printerproperty\0"
+    "printerscreen\0"
+    "printersensor\0"
+    "printertechnique\0"
+    "printerteen\0"
+    "printervoltage\0"
+    "printerwise\0"
+    "problem\0"
+    "problemant\0"
+    "problemary\0"
+    "problemcable\0"
+    "problemcar\0"
+    "problemed\0"
+    "problemen\0"
+    "problemenergy\0"
+    "problemgraphic\0"
+    "problemhand\0"
+    "problemial\0"
+    "problemic\0"
+    "probleminformation\0"
+    "probleming\0"
+    "problemjob\0"
+    "problemname\0"
+    "problemness\0"
+    "problemory\0"
+    "problemprinter\0"
+    "problemresearch\0"
+    "problemschool\0"
+    "problemsociety\0"
+    "problemsoftware\0"
+    "problemteen\0"
+    "problemthing\0"
+    "problemuniversity\0"
+    "problemure\0"
+    "procedure\0"
+    "procedureage\0"
+    "procedureconnector\0"
+    "proceduredom\0"
+    "procedureest\0"
+    "procedurefeature\0"
+    "procedurefold\0"
+    "procedureful\0"
+    "procedurehood\0"
+    "procedureial\0"
+    "procedureinstrument\0"
+    "procedurelike\0"
+    "proceduremouse\0"
+    "procedurepower\0"
+    "procedureship\0"
+    "proceduresion\0"
+    "proceduresupport\0"
+    "procedureteen\0"
+    "procedureth\0"
+    "proceduretion\0"
+    "proceduretool\0"
+    "proceduretransport\0"
+    "procedureure\0"
+    "procedurewise\0"
+    "process\0"
+    "processage\0"
+    "processant\0"
+    "processchild\0"
+    "processen\0"
+    "processfy\0"
+    "processinterest\0"
+    "processist\0"
+    "processly\0"
+    "processmarket\0"
+    "processmessage\0"
+    "processor\0"
+    "processoradapter\0"
+    "processorbicycle\0"
+    "processorder\0"
+    "processordom\0"
+    "processored\0"
+    "processorent\0"
+    "processorer\0"
+    "processorfy\0"
+    "processorible\0"
+    "processorite\0"
+    "processorlevel\0"
+    "processorlike\0"
+    "processororder\0"
+    "processorpublic\0"
+    "processorscience\0"
+    "processorsensor\0"
+    "processorsociety\0"
+    "processorterm\0"
+    "processorth\0"
+    "processortool\0"
+    "processorty\0"
+    "processorvoltage\0"
+    "processorwise\0"
+    "processoryoung\0"
+    "processplane\0"
+    "processprinter\0"
+    "processresearch\0"
+    "processsome\0"
+    "processtion\0"
+    "processty\0"
+    "processward\0"
+    "processwise\0"
+    "productivity\0"
+    "productivitydelivery\0"
+    "productivityer\0"
+    "productivityful\0"
+    "productivityise\0"
+    "productivityite\0"
+    "productivityize\0"
+    "productivityly\0"
+    "productivitypicture\0"
+    "productivitypolicy\0"
+    "productivitysion\0"
+    "productivitysystem\0"
+    "productivityth\0"
+    "productivitything\0"
+    "productivitywise\0"
+    "professional\0"
+    "professionaler\0"
+    "professionalial\0"
+    "professionalize\0"
+    "professionalous\0"
+    "professionalth\0"
+    "program\0"
+    "programage\0"
+    "programal\0"
+    "programary\0"
+    "programbus\0"
+    "programcraft\0"
+    "programdocumentation\0"
+    "programdom\0"
+    "programen\0"
+    "programer\0"
+    "programfamily\0"
+    "programhistory\0"
+    "programial\0"
+    "programite\0"
+    "programless\0"
+    "programlevel\0"
+    "programmessage\0"
+    "programmusic\0"
+    "programness\0"
+    "programory\0"
+    "programous\0"
+    "programresearch\0"
+    "programscreen\0"
+    "programship\0"
+    "programsociety\0"
+    "programstory\0"
+    "programteen\0"
+    "programty\0"
+    "programway\0"
+    "programwise\0"
+    "project\0"
+    "projectary\0"
+    "projectbasis\0"
+    "projectbus\0"
+    "projectefficiency\0"
+    "projectelement\0"
+    "projectent\0"
+    "projecter\0"
+    "projecthood\0"
+    "projectize\0"
+    "projectmaintenance\0"
+    "projectment\0"
+    "projectmotor\0"
+    "projectness\0"
+    "projectside\0"
+    "projectsystem\0"
+    "projectteen\0"
+    "projecttion\0"
+    "property\0"
+    "propertyaddress\0"
+    "propertyboat\0"
+    "propertycamera\0"
+    "propertydatabase\0"
+    "propertydom\0"
+    "propertyelement\0"
+    "propertyequipment\0"
+    "propertyfeature\0"
+    "propertyfold\0"
+    "propertyfy\0"
+    "propertyhood\0"
+    "propertyic\0"
+    "propertying\0"
+    "propertyinnovation\0"
+    "propertyintegration\0"
+    "propertyise\0"
+    "propertyite\0"
+    "propertyive\0"
+    "propertyless\0"
+    "propertylike\0"
+    "propertyness\0"
+    "propertyory\0"
+    "propertyparameter\0"
+    "propertypath\0"
+    "propertypeople\0"
+    "propertyscience\0"
+    "propertysecurity\0"
+    "propertysion\0"
+    "propertystudy\0"
+    "propertytext\0"
+    "propertything\0"
+    "propertytion\0"
+    "propertyward\0"
+    "propertywise\0"
+    "protoaddress\0"
+    "protoaddty\0"
+    "protoapparatus\0"
+    "protoapplication\0"
+    "protobus\0"
+    "protobusiness\0"
+    "protocallite\0"
+    "protocharger\0"
+    "protochild\0"
+    "protocol\0"
+    "protocolage\0"
+    "protocolconnector\0"
+    "protocolcraft\0"
+    "protocolent\0"
+    "protocolest\0"
+    "protocolfold\0"
+    "protocolic\0"
+    "protocoling\0"
+    "protocolise\0"
+    "protocolive\0"
+    "protocolly\0"
+    "protocolmoney\0"
+    "protocolnature\0"
+    "protocolperson\0"
+    "protocolpoint\0"
+    "protocolsomething\0"
+    "protocolstructure\0"
+    "protocolth\0"
+    "protocoltion\0"
+    "protocolwise\0"
+    "protocomponent\0"
+    "protoconnector\0"
+    "protocontact\0"
+    "protocourse\0"
+    "protocreate\0"
+    "protocurrent\0"
+    "protodatabase\0"
+    "protodigital\0"
+    "protodirectory\0"
+    "protodisplay\0"
+    "protoeducation\0"
+    "protoefficiency\0"
+    "protoend\0"
+    "protoequipment\0"
+    "protoever\0"
+    "protofallwise\0"
+    "protofeel\0"
+    "protofinancial\0"
+    "protofinancialdom\0"
+    "protofollower\0"
+    "protofoundation\0"
+    "protogive\0"
+    "protogivehood\0"
+    "protoglobal\0"
+    "protographic\0"
+    "protogroup\0"
+    "protohand\0"
+    "protoheadphone\0"
+    "protointerface\0"
+    "protojob\0"
+    "protokeyboard\0"
+    "protolead\0"
+    "protoleave\0"
+    "protoleaveteen\0"
+    "protolevel\0"
+    "protoline\0"
+    "protolocation\0"
+    "protolook\0"
+    "protolose\0"
+    "protomake\0"
+    "protomeet\0"
+    "protomemory\0"
+    "protomentcraft\0"
+    "protomethod\0"
+    "protomicrophone\0"
+    "protomobile\0"
+    "protomotor\0"
+    "protomove\0"
+    "protomusic\0"
+    "protonation\0"
+    "protoness\0"
+    "protonetwork\0"
+    "protonews\0"
+    "protooffice\0"
+    "protooperation\0"
+    "protoorder\0"
+    "protoorganization\0"
+    "protoparameter\0"
+    "protoparty\0"
+    "protopeople\0"
+    "protoperson\0"
+    "protoplay\0"
+    "protopoliticalty\0"
+    "protoprocess\0"
+    "protoprocessor\0"
+    "protoprotocol\0"
+    "protopublic\0"
+    "protoreason\0"
+    "protoresult\0"
+    "protoscience\0"
+    "protoscientificdom\0"
+    "protoscientificward\0"
+    "protoseem\0"
+    "protosellly\0"
+    "protoshipping\0"
+    "protosignal\0"
+    "protosome\0"
+    "protosound\0"
+    "protospace\0"
+    "protospeaker\0"
+    "protostand\0"
+    "protostopcraft\0"
+    "protostory\0"
+    "protostrategy\0"
+    "protostructure\0"
+    "prototerm\0"
+    "protothink\0"
+    "protothinkfy\0"
+    "prototime\0"
+    "prototrade\0"
+    "prototreatment\0"
+    "protovoltage\0"
+    "protowant\0"
+    "protowatch\0"
+    "protowater\0"
+    "protowave\0"
+    "protoway\0"
+    "protowear\0"
+    "protowebsite\0"
+    "protowhatteen\0"
+    "protowork\0"
+    "protowrite\0"
+    "protoyoung\0"
+    "provide\0"
+    "provideal\0"
+    "providedom\0"
+    "provideed\0"
+    "provideible\0"
+    "provideize\0"
+    "provideward\0"
+    "pseudoallower\0"
+    "pseudoapparatus\0"
+    "pseudoapplication\0"
+    "pseudoask\0"
+    "pseudoattribute\0"
+    "pseudoaudio\0"
+    "pseudobasis\0"
+    "pseudobicycle\0"
+    "pseudobuildic\0"
+    "pseudobus\0"
+    "pseudocamera\0"
+    "pseudocar\0"
+    "pseudocase\0"
+    "pseudochange\0"
+    "pseudocharger\0"
+    "pseudocolor\0"
+    "pseudocommunication\0"
+    "pseudoconcept\0"
+    "pseudoconnector\0"
+    "pseudoconstant\0"
+    "pseudocountry\0"
+    "pseudocourse\0"
+    "pseudocurrent\0"
+    "pseudodatabase\0"
+    "pseudodelivery\0"
+    "pseudodesign\0"
+    "pseudodie\0"
+    "pseudodocument\0"
+    "pseudoeducation\0"
+    "pseudoend\0"
+    "pseudoeverment\0"
+    "pseudoexample\0"
+    "pseudoexperience\0"
+    "pseudofact\0"
+    "pseudofeature\0"
+    "pseudofile\0"
+    "pseudofinancial\0"
+    "pseudofolder\0"
+    "pseudofoundation\0"
+    "pseudofunction\0"
+    "pseudogive\0"
+    "pseudographic\0"
+    "pseudogroup\0"
+    "pseudogrowen\0"
+    "pseudohappen\0"
+    "pseudohealth\0"
+    "pseudohistorical\0"
+    "pseudohistory\0"
+    "pseudohome\0"
+    "pseudoible\0"
+    "pseudoimage\0"
+    "pseudoimplementation\0"
+    "pseudoinclude\0"
+    "pseudoinformation\0"
+    "pseudoinnovation\0"
+    "pseudoinstrument\0"
+    "pseudointegration\0"
+    "pseudointernet\0"
+    "pseudoknowest\0"
+    "pseudolearn\0"
+    "pseudolikeize\0"
+    "pseudolocalant\0"
+    "pseudolosehood\0"
+    "pseudomaintenance\0"
+    "pseudomake\0"
+    "pseudomanagement\0"
+    "pseudomarket\0"
+    "pseudomechanism\0"
+    "pseudomember\0"
+    "pseudomessage\0"
+    "pseudomicrophone\0"
+    "pseudomoney\0"
+    "pseudomost\0"
+    "pseudoname\0"
+    "pseudonature\0"
+    "pseudonews\0"
+    "pseudooffice\0"
+    "pseudoopen\0"
+    "pseudooptimization\0"
+    "pseudoorder\0"
+    "pseudoorganization\0"
+    "pseudopass\0"
+    "pseudoperformance\0"
+    "pseudopersonal\0"
+    "pseudophone\0"
+    "pseudophoto\0"
+    "pseudopickite\0"
+    "pseudopicture\0"
+    "pseudoplan\0"
+    "pseudoplane\0"
+    "pseudoplay\0"
+    "pseudoplaysion\0"
+    "pseudopoint\0"
+    "pseudopolicy\0"
+    "pseudopolitical\0"
+    "pseudoposition\0"
+    "pseudoprice\0"
+    "pseudoprinciple\0"
+    "pseudoprocessor\0"
+    "pseudoproductivity\0"
+    "pseudoprogram\0"
+    "pseudoquality\0"
+    "pseudoradiation\0"
+    "pseudoraise\0"
+    "pseudoreach\0"
+    "pseudoreason\0"
+    "pseudoreport\0"
+    "pseudoresearch\0"
+    "pseudoresistance\0"
+    "pseudoright\0"
+    "pseudoscience\0"
+    "pseudoscreen\0"
+    "pseudosecurity\0"
+    "pseudoseemible\0"
+    "pseudosender\0"
+    "pseudoside\0"
+    "pseudosociety\0"
+    "pseudosoftware\0"
+    "pseudosome\0"
+    "pseudosometeen\0"
+    "pseudosomety\0"
+    "pseudosound\0"
+    "pseudospeak\0"
+    "pseudospecial\0"
+    "pseudospendible\0"
+    "pseudostorage\0"
+    "pseudostory\0"
+    "pseudosupport\0"
+    "pseudotakement\0"
+    "pseudotechnical\0"
+    "pseudotechnique\0"
+    "pseudoterm\0"
+    "pseudotheory\0"
+    "pseudotime\0"
+    "pseudotionise\0"
+    "pseudotool\0"
+    "pseudotransport\0"
+    "pseudotruck\0"
+    "pseudouniversity\0"
+    "pseudouse\0"
+    "pseudovalue\0"
+    "pseudovehicle\0"
+    "pseudowant\0"
+    "pseudoway\0"
+    "pseudoweek\0"
+    "pseudowhich\0"
+    "pseudowin\0"
+    "pseudoword\0"
+    "pseudowriteteen\0"
+    "pseudowritewise\0"
+    "pseudoyear\0"
+    "public\0"
+    "publicary\0"
+    "publicconcept\0"
+    "publicdom\0"
+    "publiced\0"
+    "publiceducation\0"
+    "publicen\0"
+    "publicent\0"
+    "publicfold\0"
+    "publichood\0"
+    "publicic\0"
+    "publicing\0"
+    "publicist\0"
+    "publicless\0"
+    "publicmarket\0"
+    "publicment\0"
+    "publicnation\0"
+    "publicous\0"
+    "publicsupport\0"
+    "publicteen\0"
+    "publicthing\0"
+    "publicty\0"
+    "publicweek\0"
+    "pull\0"
+    "pullage\0"
+    "pullest\0"
+    "pullist\0"
+    "pullous\0"
+    "pullth\0"
+    "pulltion\0"
+    "pullward\0"
+    "quality\0"
+    "qualitycraft\0"
+    "qualitydevice\0"
+    "qualitydom\0"
+    "qualityed\0"
+    "qualityent\0"
+    "qualityfold\0"
+    "qualityible\0"
+    "qualityist\0"
+    "qualityive\0"
+    "qualityless\0"
+    "qualityline\0"
+    "qualitymotor\0"
+    "qualitynation\0"
+    "qualityness\0"
+    "qualitynews\0"
+    "qualityplan\0"
+    "qualityship\0"
+    "qualitysome\0"
+    "qualityteen\0"
+    "qualityth\0"
+    "question\0"
+    "questionable\0"
+    "questional\0"
+    "questionant\0"
+    "questionary\0"
+    "questionattribute\0"
+    "questionconnector\0"
+    "questioncontact\0"
+    "questionen\0"
+    "questionfile\0"
+    "questionfold\0"
+    "questionfy\0"
+    "questionheadphone\0"
+    "questioninnovation\0"
+    "questionise\0"
+    "questionize\0"
+    "questionless\0"
+    "questionnature\0"
+    "questionorganization\0"
+    "questionpattern\0"
+    "questionperson\0"
+    "questionprogram\0"
+    "questionservice\0"
+    "questionship\0"
+    "questionshipping\0"
+    "questionsoftware\0"
+    "questionspecial\0"
+    "questionteen\0"
+    "questionth\0"
+    "questiontion\0"
+    "questiontrain\0"
+    "questiontraining\0"
+    "questiontravel\0"
+    "questionure\0"
+    "questionwise\0"
+    "radiation\0"
+    "radiationanalysis\0"
+    "radiationdocument\0"
+    "radiationent\0"
+    "radiationest\0"
+    "radiationhand\0"
+    "radiationinterface\0"
+    "radiationinternet\0"
+    "radiationlike\0"
+    "radiationmobile\0"
+    "radiationmoney\0"
+    "radiationnews\0"
+    "radiationpicture\0"
+    "radiationright\0"
+    "radiationship\0"
+    "radiationsignal\0"
+    "radiationstructure\0"
+    "radiationure\0"
+    "radiationward\0"
+    "radiationway\0"
+    "radiationwise\0"
+    "raise\0"
+    "raiseable\0"
+    "raiseest\0"
+    "raisefy\0"
+    "raiseous\0"
+    "reable\0"
+    "reach\0"
+    "reachal\0"
+    "reachfold\0"
+    "reachize\0"
+    "reachlike\0"
+    "reachwise\0"
+    "reaction\0"
+    "read\0"
+    "readable\0"
+    "readapter\0"
+    "readfold\0"
+    "readial\0"
+    "readth\0"
+    "readwise\0"
+    "realgorithm\0"
+    "reapplication\0"
+    "rearchitecture\0"
+    "reason\0"
+    "reasoncircuit\0"
+    "reasonen\0"
+    "reasonful\0"
+    "reasonfy\0"
+    "reasongrowth\0"
+    "reasoning\0"
+    "reasoninterface\0"
+    "reasonism\0"
+    "reasonize\0"
+    "reasonlight\0"
+    "reasonment\0"
+    "reasonside\0"
+    "reasonsion\0"
+    "reasonteen\0"
+    "reasontext\0"
+    "reasontime\0"
+    "reasonure\0"
+    "reasonyoung\0"
+    "rebasis\0"
+    "rebattery\0"
+    "rebook\0"
+    "rebreak\0"
+    "rebus\0"
+    "recar\0"
+    "recircuit\0"
+    "recolor\0"
+    "reconsider\0"
+    "recontact\0"
+    "recontroller\0"
+    "recourse\0"
+    "recreate\0"
+    "reculturalage\0"
+    "recurrent\0"
+    "redecide\0"
+    "redelivery\0"
+    "redocument\0"
+    "reeconomic\0"
+    "reeconomicen\0"
+    "reeducational\0"
+    "reelement\0"
+    "reengine\0"
+    "reequipment\0"
+    "reever\0"
+    "reexpect\0"
+    "reexperience\0"
+    "refeature\0"
+    "refoundation\0"
+    "regiveth\0"
+    "regrowsome\0"
+    "rehand\0"
+    "rehappen\0"
+    "rehealth\0"
+    "rehistory\0"
+    "rehouse\0"
+    "reibleteen\0"
+    "reimage\0"
+    "reinternet\0"
+    "rejob\0"
+    "rekilled\0"
+    "releadwise\0"
+    "releave\0"
+    "relife\0"
+    "relight\0"
+    "relocalcraft\0"
+    "remain\0"
+    "remaindom\0"
+    "remainial\0"
+    "remainise\0"
+    "remainism\0"
+    "remanagement\0"
+    "remechanism\0"
+    "remedicalfold\0"
+    "remember\0"
+    "rememberdom\0"
+    "rememberise\0"
+    "rememberist\0"
+    "rememberite\0"
+    "remembersion\0"
+    "rementing\0"
+    "remessage\0"
+    "remethod\0"
+    "remobile\0"
+    "remodel\0"
+    "remotor\0"
+    "remusic\0"
+    "renews\0"
+    "renumber\0"
+    "reopenless\0"
+    "repath\0"
+    "repeople\0"
+    "rephoto\0"
+    "replatform\0"
+    "replaysion\0"
+    "replayteen\0"
+    "repoint\0"
+    "repolicy\0"
+    "report\0"
+    "reportable\0"
+    "reportage\0"
+    "reportant\0"
+    "reportbus\0"
+    "reportcraft\0"
+    "reporten\0"
+    "reporter\0"
+    "reportfact\0"
+    "reportfeature\0"
+    "reportful\0"
+    "reportist\0"
+    "reportite\0"
+    "reportize\0"
+    "reportmanagement\0"
+    "reportment\0"
+    "reportmodel\0"
+    "reportness\0"
+    "reportory\0"
+    "reportpeople\0"
+    "reportresistance\0"
+    "reportship\0"
+    "reportteen\0"
+    "reportthing\0"
+    "reportty\0"
+    "reportwise\0"
+    "reposition\0"
+    "repower\0"
+    "reprice\0"
+    "reprinciple\0"
+    "reproblem\0"
+    "reprocess\0"
+    "reprogram\0"
+    "reprovide\0"
+    "reprovideant\0"
+    "republic\0"
+    "repull\0"
+    "requestion\0"
+    "require\0"
+    "requiredom\0"
+    "requireful\0"
+    "requireial\0"
+    "requireless\0"
+    "requirely\0"
+    "requireous\0"
+    "requiretion\0"
+    "requireward\0"
+    "reradiation\0"
+    "rereport\0"
+    "rerequire\0"
+    "reresearch\0"
+    "reresource\0"
+    "rescanner\0"
+    "rescience\0"
+    "research\0"
+    "researchage\0"
+    "researchapplication\0"
+    "researchcraft\0"
+    "researchelement\0"
+    "researchent\0"
+    "researcher\0"
+    "researchfoundation\0"
+    "researchhome\0"
+    "researchhood\0"
+    "researchial\0"
+    "researchic\0"
+    "researchite\0"
+    "researchly\0"
+    "researchmotorcycle\0"
+    "researchory\0"
+    "researchparty\0"
+    "researchstructure\0"
+    "researchteen\0"
+    "researchtransport\0"
+    "researchvehicle\0"
+    "researchward\0"
+    "researchwave\0"
+    "resecurity\0"
+    "resell\0"
+    "resendary\0"
+    "reserveous\0"
+    "reship\0"
+    "reside\0"
+    "resistance\0"
+    "resistancealgorithm\0"
+    "resistanceen\0"
+    "resistanceer\0"
+    "resistanceest\0"
+    "resistancefeature\0"
+    "resistanceible\0"
+    "resistanceism\0"
+    "resistanceous\0"
+    "resistancepart\0"
+    "resistancesignal\0"
+    "resistanceteen\0"
+    "resistancetion\0"
+    "resistancetrade\0"
+    "resistancety\0"
+    "resocialtion\0"
+    "resociety\0"
+    "resolution\0"
+    "resource\0"
+    "resourcebusiness\0"
+    "resourceen\0"
+    "resourceend\0"
+    "resourceent\0"
+    "resourceer\0"
+    "resourceful\0"
+    "resourcegraphic\0"
+    "resourceheadphone\0"
+    "resourceible\0"
+    "resourceive\0"
+    "resourcenature\0"
+    "resourcestate\0"
+    "resourceth\0"
+    "resourcetruck\0"
+    "resourcety\0"
+    "respace\0"
+    "respeak\0"
+    "respecial\0"
+    "restrategy\0"
+    "restructure\0"
+    "restudent\0"
+    "result\0"
+    "resultcase\0"
+    "resultdelivery\0"
+    "resultdesign\0"
+    "resultdisplay\0"
+    "resulted\0"
+    "resulten\0"
+    "resultfolder\0"
+    "resultful\0"
+    "resulthistory\0"
+    "resultism\0"
+    "resultist\0"
+    "resultite\0"
+    "resultive\0"
+    "resultize\0"
+    "resultless\0"
+    "resultlevel\0"
+    "resultous\0"
+    "resultpattern\0"
+    "resultperson\0"
+    "resultphoto\0"
+    "resultproblem\0"
+    "resultprocessor\0"
+    "resultpublic\0"
+    "resultresult\0"
+    "resultschool\0"
+    "resultstorage\0"
+    "resultsupport\0"
+    "resultth\0"
+    "resulture\0"
+    "resultyoung\0"
+    "resystem\0"
+    "reterm\0"
+    "rething\0"
+    "retion\0"
+    "retool\0"
+    "retrain\0"
+    "retraining\0"
+    "retreatment\0"
+    "reunderstand\0"
+    "reuniversity\0"
+    "reusewise\0"
+    "rewait\0"
+    "rewalkship\0"
+    "rewar\0"
+    "rewave\0"
+    "rewear\0"
+    "rewhich\0"
+    "rewise\0"
+    "reword\0"
+    "reyear\0"
+    "reyoung\0"
+    "right\0"
+    "rightable\0"
+    "rightbook\0"
+    "rightcraft\0"
+    "rightdom\0"
+    "rightgrowth\0"
+    "rightism\0"
+    "rightive\0"
+    "rightkeyboard\0"
+    "rightletter\0"
+    "rightlike\0"
+    "rightlocation\0"
+    "rightmachine\0"
+    "rightment\0"
+    "rightnation\0"
+    "rightorganization\0"
+    "rightory\0"
+    "rightpicture\0"
+    "rightplane\0"
+    "rightprogram\0"
+    "rightship\0"
+    "rightsion\0"
+    "rightsystem\0"
+    "rightteen\0"
+    "rightweek\0"
+    "room\0"
+    "roomal\0"
+    "roomed\0"
+    "roomfact\0"
+    "roomfy\0"
+    "roomial\0"
+    "rooming\0"
+    "roomism\0"
+    "roomive\0"
+    "roomlife\0"
+    "roomlocation\0"
+    "roomly\0"
+    "roomment\0"
+    "roommonitor\0"
+    "roomparty\0"
+    "roomprogram\0"
+    "roomreport\0"
+    "roomsion\0"
+    "roomsolution\0"
+    "roomsupport\0"
+    "roomterm\0"
+    "scanner\0"
+    "scannerage\0"
+    "scanneralgorithm\0"
+    "scannerapproach\0"
+    "scannerary\0"
+    "scannereducation\0"
+    "scanneren\0"
+    "scannerer\0"
+    "scannerfold\0"
+    "scannerfrequency\0"
+    "scanneric\0"
+    "scannerite\0"
+    "scannerless\0"
+    "scannerment\0"
+    "scannerquestion\0"
+    "scannerradiation\0"
+    "scannerroom\0"
+    "scannersociety\0"
+    "scannersome\0"
+    "scannerspeaker\0"
+    "scannerstrategy\0"
+    "scannerth\0"
+    "scannertion\0"
+    "scannerty\0"
+    "scannerure\0"
+    "scannervariable\0"
+    "scannerwise\0"
+    "scannerword\0"
+    "school\0"
+    "schoolable\0"
+    "schoolal\0"
+    "schoolalgorithm\0"
+    "schooldirectory\0"
+    "schoolial\0"
+    "schoolinternet\0"
+    "schoolist\0"
+    "schoolite\0"
+    "schoollike\0"
+    "schoolmobile\0"
+    "schoolnetwork\0"
+    "schoolnumber\0"
+    "schoolprocedure\0"
+    "schoolreport\0"
+    "schoolservice\0"
+    "schoolteen\0"
+    "schoolward\0"
+    "science\0"
+    "scienceary\0"
+    "sciencedirectory\0"
+    "scienceelectricity\0"
+    "scienceen\0"
+    "sciencefold\0"
+    "sciencefuel\0"
+    "scienceful\0"
+    "sciencefunction\0"
+    "sciencegovernment\0"
+    "sciencehood\0"
+    "scienceial\0"
+    "scienceic\0"
+    "scienceing\0"
+    "scienceintegration\0"
+    "scienceism\0"
+    "sciencemachine\0"
+    "sciencemonitor\0"
+    "scienceous\0"
+    "sciencestate\0"
+    "sciencestudy\0"
+    "scienceth\0"
+    "scienceyear\0"
+    "scientific\0"
+    "scientificfold\0"
+    "scientificism\0"
+    "scientificlike\0"
+    "scientificment\0"
+    "screen\0"
+    "screenaddress\0"
+    "screenary\0"
+    "screenbasis\0"
+    "screencamera\0"
+    "screencharger\0"
+    "screenconcept\0"
+    "screencraft\0"
+    "screenday\0"
+    "screenframework\0"
+    "screenful\0"
+    "screenible\0"
+    "screenism\0"
+    "screenite\0"
+    "screenness\0"
+    "screenory\0"
+    "screentext\0"
+    "screentheory\0"
+    "screentraining\0"
+    "security\0"
+    "securityary\0"
+    "securityed\0"
+    "securityfy\0"
+    "securitygroup\0"
+    "securityible\0"
+    "securityinformation\0"
+    "securitying\0"
+    "securitylight\0"
+    "securitymanagement\0"
+    "securityness\0"
+    "securitypoint\0"
+    "securityprocess\0"
+    "securitysion\0"
+    "securitysociety\0"
+    "securityspace\0"
+    "securityteen\0"
+    "securityty\0"
+    "seem\0"
+    "seemant\0"
+    "seemed\0"
+    "seemer\0"
+    "seemful\0"
+    "seemfy\0"
+    "seemise\0"
+    "seemness\0"
+    "seemory\0"
+    "seemure\0"
+    "sell\0"
+    "sellal\0"
+    "sellful\0"
+    "semiable\0"
+    "semiadapter\0"
+    "semiaddress\0"
+    "semiapplication\0"
+    "semiarea\0"
+    "semibasis\0"
+    "semibicycle\0"
+    "semibook\0"
+    "semibusiness\0"
+    "semibuy\0"
+    "semicable\0"
+    "semichangewise\0"
+    "semicolor\0"
+    "semicommunication\0"
+    "semicomputer\0"
+    "semiconcept\0"
+    "semicontact\0"
+    "semicontinue\0"
+    "semicontinuetion\0"
+    "semicourse\0"
+    "semidatabase\0"
+    "semidelivery\0"
+    "semidesign\0"
+    "semiefficiency\0"
+    "semielement\0"
+    "semienergy\0"
+    "semieveren\0"
+    "semiexample\0"
+    "semiexpect\0"
+    "semifile\0"
+    "semifind\0"
+    "semifolder\0"
+    "semiframework\0"
+    "semifullful\0"
+    "semigiveant\0"
+    "semigrowth\0"
+    "semihand\0"
+    "semiheadphone\0"
+    "semihistory\0"
+    "semiimage\0"
+    "semiimplementation\0"
+    "semiinstrument\0"
+    "semiinterest\0"
+    "semiinternet\0"
+    "semikeyboard\0"
+    "semileave\0"
+    "semilevel\0"
+    "semilookless\0"
+    "semimaintenance\0"
+    "semimechanism\0"
+    "semimedicalest\0"
+    "semimemory\0"
+    "semimicrophone\0"
+    "semimonitor\0"
+    "semimouse\0"
+    "semioptimization\0"
+    "semiorganization\0"
+    "semiparty\0"
+    "semipass\0"
+    "semipath\0"
+    "semipeople\0"
+    "semipick\0"
+    "semipicture\0"
+    "semiplace\0"
+    "semiplatform\0"
+    "semipower\0"
+    "semiprocedure\0"
+    "semiproductivity\0"
+    "semiprogram\0"
+    "semiproject\0"
+    "semiquality\0"
+    "semireason\0"
+    "semireport\0"
+    "semiresistance\0"
+    "semiresource\0"
+    "semiright\0"
+    "semiroom\0"
+    "semisetage\0"
+    "semiship\0"
+    "semishipest\0"
+    "semisignal\0"
+    "semisociety\0"
+    "semisoftware\0"
+    "semisome\0"
+    "semisomething\0"
+    "semispace\0"
+    "semispeaker\0"
+    "semispend\0"
+    "semistate\0"
+    "semistorage\0"
+    "semistudy\0"
+    "semisupport\0"
+    "semiterm\0"
+    "semithing\0"
+    "semitrain\0"
+    "semitravel\0"
+    "semitruck\0"
+    "semitry\0"
+    "semiuniversity\0"
+    "semivalue\0"
+    "semivariable\0"
+    "semivehicle\0"
+    "semivoltage\0"
+    "semiwaittion\0"
+    "semiwantlike\0"
+    "semiwatch\0"
+    "semiwatching\0"
+    "semiwearible\0"
+    "semiwhatent\0"
+    "semiworld\0"
+    "send\0"
+    "senden\0"
+    "sendlike\0"
+    "sendly\0"
+    "sendwise\0"
+    "sensor\0"
+    "sensorcraft\0"
+    "sensorelement\0"
+    "sensorexperience\0"
+    "sensorfold\0"
+    "sensorial\0"
+    "sensorible\0"
+    "sensorinformation\0"
+    "sensorkeyboard\0"
+    "sensorlocation\0"
+    "sensormaintenance\0"
+    "sensormoney\0"
+    "sensornation\0"
+    "sensorperson\0"
+    "sensorpicture\0"
+    "sensorprocedure\0"
+    "sensorresource\0"
+    "sensorsecurity\0"
+    "sensortechnique\0"
+    "sensortheory\0"
+    "sensorvehicle\0"
+    "serve\0"
+    "serveal\0"
+    "serveise\0"
+    "serveism\0"
+    "serveless\0"
+    "servement\0"
+    "serveory\0"
+    "service\0"
+    "servicearea\0"
+    "servicecable\0"
+    "servicecomputer\0"
+    "servicedocumentation\0"
+    "servicedom\0"
+    "serviceent\0"
+    "serviceest\0"
+    "serviceheadphone\0"
+    "serviceible\0"
+    "serviceism\0"
+    "servicelike\0"
+    "serviceprice\0"
+    "serviceprinciple\0"
+    "serviceschool\0"
+    "serviceship\0"
+    "servicespace\0"
+    "servicestudent\0"
+    "servicetion\0"
+    "serviceway\0"
+    "serviceword\0"
+    "set\0"
+    "seten\0"
+    "setlike\0"
+    "setness\0"
+    "ship\0"
+    "shipal\0"
+    "shipary\0"
+    "shipcomponent\0"
+    "shipcountry\0"
+    "shiped\0"
+    "shipent\0"
+    "shiper\0"
+    "shipfolder\0"
+    "shipfuel\0"
+    "shipful\0"
+    "shipheadphone\0"
+    "shipial\0"
+    "shipic\0"
+    "shipinformation\0"
+    "shiping\0"
+    "shipive\0"
+    "shipize\0"
+    "shiplike\0"
+    "shiply\0"
+    "shipnation\0"
+    "shipnature\0"
+    "shipness\0"
+    "shipping\0"
+    "shippingable\0"
+    "shippingcircuit\0"
+    "shippingcurrent\0"
+    "shippinged\0"
+    "shippingest\0"
+    "shippinggrowth\0"
+    "shippingist\0"
+    "shippingive\0"
+    "shippingless\0"
+    "shippingly\0"
+    "shippingpackage\0"
+    "shippingparty\0"
+    "shippingpattern\0"
+    "shippingphone\0"
+    "shippingquality\0"
+    "shippingresource\0"
+    "shippingscreen\0"
+    "shippingsensor\0"
+    "shippingsystem\0"
+    "shippingtion\0"
+    "shippingwar\0"
+    "shippingward\0"
+    "shippingwater\0"
+    "shippingwise\0"
+    "shipprocess\0"
+    "shipreport\0"
+    "shipship\0"
+    "shiptheory\0"
+    "shiptravel\0"
+    "shipwoman\0"
+    "side\0"
+    "sideage\0"
+    "sideal\0"
+    "sidearchitecture\0"
+    "sideattribute\0"
+    "sidecraft\0"
+    "sidedom\0"
+    "sidefoundation\0"
+    "sidefy\0"
+    "sidegrowth\0"
+    "sidehood\0"
+    "sideive\0"
+    "sideize\0"
+    "sidemaintenance\0"
+    "sideness\0"
+    "sideory\0"
+    "sideplan\0"
+    "sideproblem\0"
+    "sidereason\0"
+    "sidesolution\0"
+    "sidespeaker\0"
+    "sideth\0"
+    "sidety\0"
+    "sidevalue\0"
+    "sidewebsite\0"
+    "signal\0"
+    "signalal\0"
+    "signalapplication\0"
+    "signalarchitecture\0"
+    "signalcamera\0"
+    "signalent\0"
+    "signalful\0"
+    "signalgraphic\0"
+    "signalheadphone\0"
+    "signalic\0"
+    "signalise\0"
+    "signalism\0"
+    "signalive\0"
+    "signalmemory\0"
+    "signalous\0"
+    "signalpoint\0"
+    "signalresearch\0"
+    "signalroom\0"
+    "signalspecial\0"
+    "signalwater\0"
+    "sion\0"
+    "sionfy\0"
+    "sionhood\0"
+    "sionize\0"
+    "sionly\0"
+    "sionwise\0"
+    "sit\0"
+    "sitable\0"
+    "siten\0"
+    "sitic\0"
+    "sitise\0"
+    "sitist\0"
+    "sitite\0"
+    "sitment\0"
+    "social\0"
+    "socialfy\0"
+    "socialism\0"
+    "socialive\0"
+    "socialless\0"
+    "socially\0"
+    "socialment\0"
+    "society\0"
+    "societyal\0"
+    "societyarea\0"
+    "societycomputer\0"
+    "societyed\0"
+    "societyent\0"
+    "societyfold\0"
+    "societyful\0"
+    "societyhood\0"
+    "societyial\0"
+    "societyible\0"
+    "societyinternet\0"
+    "societyist\0"
+    "societyjob\0"
+    "societyless\0"
+    "societyory\0"
+    "societyous\0"
+    "societyplace\0"
+    "societyquestion\0"
+    "societyresource\0"
+    "societyschool\0"
+    "societyservice\0"
+    "societyship\0"
+    "societytechnique\0"
+    "societytheory\0"
+    "societytion\0"
+    "societyure\0"
+    "software\0"
+    "softwareary\0"
+    "softwareconstant\0"
+    "softwarecontroller\0"
+    "softwareed\0"
+    "softwareen\0"
+    "softwareent\0"
+    "softwareer\0"
+    "softwareexperience\0"
+    "softwarehome\0"
+    "softwareial\0"
+    "softwareible\0"
+    "softwareise\0"
+    "softwareite\0"
+    "softwarement\0"
+    "softwareness\0"
+    "softwareoffice\0"
+    "softwarepicture\0"
+    "softwareroom\0"
+    "softwareship\0"
+    "softwaresound\0"
+    "softwarestandard\0"
+    "softwareteen\0"
+    "softwaretransport\0"
+    "solution\0"
+    "solutionant\0"
+    "solutionbattery\0"
+    "solutioncomputer\0"
+    "solutionfile\0"
+    "solutionful\0"
+    "solutionfy\0"
+    "solutionhome\0"
+    "solutionible\0"
+    "solutionic\0"
+    "solutionist\0"
+    "solutionive\0"
+    "solutionment\0"
+    "solutionoffice\0"
+    "solutionperson\0"
+    "solutionsensor\0"
+    "solutionservice\0"
+    "solutionsion\0"
+    "solutionteen\0"
+    "solutionterm\0"
+    "solutiontraining\0"
+    "solutionty\0"
+    "some\0"
+    "someant\0"
+    "someed\0"
+    "someent\0"
+    "something\0"
+    "somethingcomputer\0"
+    "somethingconcept\0"
+    "somethingcourse\0"
+    "somethingdelivery\0"
+    "somethingeducation\0"
+    "somethinger\0"
+    "somethingest\0"
+    "somethingframework\0"
+    "somethingfy\0"
+    "somethinggovernment\0"
+    "somethingic\0"
+    "somethingmaterial\0"
+    "somethingory\0"
+    "somethingparty\0"
+    "somethingpath\0"
+    "somethingpower\0"
+    "somethingpublic\0"
+    "somethingschool\0"
+    "somethingstorage\0"
+    "sometion\0"
+    "sound\0"
+    "soundapplication\0"
+    "soundapproach\0"
+    "soundary\0"
+    "soundbicycle\0"
+    "soundcraft\0"
+    "sounded\0"
+    "sounden\0"
+    "soundequipment\0"
+    "soundest\0"
+    "soundfold\0"
+    "soundfoundation\0"
+    "soundgrowth\0"
+    "soundhand\0"
+    "soundible\0"
+    "soundinnovation\0"
+    "soundise\0"
+    "soundite\0"
+    "soundive\0"
+    "soundize\0"
+    "soundmaintenance\0"
+    "soundmechanism\0"
+    "soundnetwork\0"
+    "soundory\0"
+    "soundous\0"
+    "soundprinter\0"
+    "soundresistance\0"
+    "soundsion\0"
+    "soundstandard\0"
+    "soundtechnology\0"
+    "soundth\0"
+    "soundtion\0"
+    "soundtrade\0"
+    "space\0"
+    "spaceage\0"
+    "spaceal\0"
+    "spacecamera\0"
+    "spacecar\0"
+    "spacefile\0"
+    "spacefolder\0"
+    "spaceful\0"
+    "spacefy\0"
+    "spacehistory\0"
+    "spaceimage\0"
+    "spaceinterface\0"
+    "spaceise\0"
+    "spaceism\0"
+    "spaceletter\0"
+    "spacemouse\0"
+    "spaceprogram\0"
+    "spacesion\0"
+    "spacetheory\0"
+    "speak\0"
+    "speaker\0"
+    "speakercamera\0"
+    "speakercircuit\0"
+    "speakercountry\0"
+    "speakerday\0"
+    "speakerdocument\0"
+    "speakerdom\0"
+    "speakerent\0"
+    "speakerest\0"
+    "speakerfold\0"
+    "speakerfy\0"
+    "speakerhood\0"
+    "speakerletter\0"
+    "speakerlike\0"
+    "speakerpackage\0"
+    "speakerprocedure\0"
+    "speakerschool\0"
+    "speakersignal\0"
+    "speakersome\0"
+    "speakerspecial\0"
+    "speakertechnique\0"
+    "speakerweek\0"
+    "speakerwise\0"
+    "speakite\0"
+    "speakness\0"
+    "speaksome\0"
+    "speakty\0"
+    "special\0"
+    "specialactivity\0"
+    "specialapparatus\0"
+    "specialary\0"
+    "specialconnector\0"
+    "specialday\0"
+    "specialemail\0"
+    "specialfy\0"
+    "specialible\0"
+    "specialinternet\0"
+    "specialist\0"
+    "specialize\0"
+    "speciallevel\0"
+    "specialness\0"
+    "specialoptimization\0"
+    "specialspeaker\0"
+    "specialspecial\0"
+    "specialty\0"
+    "specialvariable\0"
+    "specialward\0"
+    "spend\0"
+    "spendfy\0"
+    "spendise\0"
+    "spendly\0"
+    "spendment\0"
+    "spendsion\0"
+    "spendward\0"
+    "stand\0"
+    "standard\0"
+    "standardal\0"
+    "standardant\0"
+    "standardbook\0"
+    "standardcompany\0"
+    "standardcraft\0"
+    "standardend\0"
+    "standardest\0"
+    "standardfolder\0"
+    "standardhand\0"
+    "standardial\0"
+    "standardible\0"
+    "standardise\0"
+    "standardist\0"
+    "standardjob\0"
+    "standardlight\0"
+    "standardmachine\0"
+    "standardment\0"
+    "standardnation\0"
+    "standardory\0"
+    "standardous\0"
+    "standardpower\0"
+    "standardresearch\0"
+    "standardservice\0"
+    "standardth\0"
+    "standardtheory\0"
+    "standardtion\0"
+    "standardure\0"
+    "standardyoung\0"
+    "standdom\0"
+    "standed\0"
+    "standhood\0"
+    "standic\0"
+    "standly\0"
+    "standteen\0"
+    "state\0"
+    "stateant\0"
+    "stateful\0"
+    "statehand\0"
+    "stateic\0"
+    "stateinterface\0"
+    "stateist\0"
+    "stateite\0"
+    "stateive\0"
+    "statemechanism\0"
+    "statement\0"
+    "statenation\0"
+    "stateperformance\0"
+    "stateproperty\0"
+    "stateradiation\0"
+    "stateroom\0"
+    "statescience\0"
+    "stateship\0"
+    "statething\0"
+    "statewise\0"
+    "stay\0"
+    "stayable\0"
+    "stayed\0"
+    "stayic\0"
+    "stayise\0"
+    "stayize\0"
+    "stayness\0"
+    "staytion\0"
+    "stayward\0"
+    "stop\0"
+    "stopcraft\0"
+    "stopfy\0"
+    "stopial\0"
+    "stopize\0"
+    "stopship\0"
+    "storage\0"
+    "storagecontroller\0"
+    "storagedevice\0"
+    "storageed\0"
+    "storageent\0"
+    "storagefold\0"
+    "storagehand\0"
+    "storageible\0"
+    "storageless\0"
+    "storagely\0"
+    "storageperson\0"
+    "storageprinciple\0"
+    "storageroom\0"
+    "storageservice\0"
+    "storageship\0"
+    "storageside\0"
+    "storagestudy\0"
+    "storagetechnology\0"
+    "storagevoltage\0"
+    "storageward\0"
+    "storagewater\0"
+    "story\0"
+    "storyaddress\0"
+    "storyage\0"
+    "storyant\0"
+    "storycircuit\0"
+    "storycommunication\0"
+    "storyed\0"
+    "storyer\0"
+    "storyfact\0"
+    "storyism\0"
+    "storyless\0"
+    "storylevel\0"
+    "storymarket\0"
+    "storyment\0"
+    "storyname\0"
+    "storyness\0"
+    "storyous\0"
+    "storypeople\0"
+    "storyprice\0"
+    "storypublic\0"
+    "storyroom\0"
+    "storytechnique\0"
+    "storytion\0"
+    "storyty\0"
+    "storyure\0"
+    "storyweek\0"
+    "strategy\0"
+    "strategyable\0"
+    "strategyaction\0"
+    "strategyant\0"
+    "strategyarchitecture\0"
+    "strategyaudio\0"
+    "strategygrowth\0"
+    "strategying\0"
+    "strategyism\0"
+    "strategyist\0"
+    "strategyite\0"
+    "strategyless\0"
+    "strategylike\0"
+    "strategyly\0"
+    "strategyness\0"
+    "strategyous\0"
+    "strategyprogram\0"
+    "strategyproject\0"
+    "strategyproperty\0"
+    "strategyresearch\0"
+    "strategyresource\0"
+    "strategyresult\0"
+    "strategytechnology\0"
+    "strategyterm\0"
+    "strategyth\0"
+    "strategytion\0"
+    "strategytruck\0"
+    "strategyweek\0"
+    "strategywise\0"
+    "structure\0"
+    "structurearea\0"
+    "structureconnector\0"
+    "structuredelivery\0"
+    "structuredesign\0"
+    "structureen\0"
+    "structureent\0"
+    "structureest\0"
+    "structurefact\0"
+    "structurefunction\0"
+    "structureist\0"
+    "structuremachine\0"
+    "structurematerial\0"
+    "structuremodel\0"
+    "structurename\0"
+    "structurepart\0"
+    "structurepolicy\0"
+    "structureradiation\0"
+    "structureship\0"
+    "structuresome\0"
+    "structureteen\0"
+    "structurething\0"
+    "structuretion\0"
+    "structurety\0"
+    "student\0"
+    "studentable\0"
+    "studentant\0"
+    "studentapparatus\0"
+    "studentary\0"
+    "studentcamera\0"
+    "studentcourse\0"
+    "studentcraft\0"
+    "studented\0"
+    "studentemail\0"
+    "studenten\0"
+    "studentengine\0"
+    "studenthood\0"
+    "studentic\0"
+    "studentinformation\0"
+    "studenting\0"
+    "studentise\0"
+    "studentism\0"
+    "studentist\0"
+    "studentorder\0"
+    "studentsoftware\0"
+    "studentsolution\0"
+    "studentsome\0"
+    "studentstory\0"
+    "studentterm\0"
+    "studentth\0"
+    "studenttruck\0"
+    "studentwise\0"
+    "study\0"
+    "studyage\0"
+    "studyant\0"
+    "studybasis\0"
+    "studybusiness\0"
+    "studycontroller\0"
+    "studydocument\0"
+    "studydom\0"
+    "studyed\0"
+    "studyeducation\0"
+    "studyelement\0"
+    "studyent\0"
+    "studyfeature\0"
+    "studyfy\0"
+    "studyheadphone\0"
+    "studyial\0"
+    "studylevel\0"
+    "studymanagement\0"
+    "studymaterial\0"
+    "studymessage\0"
+    "studymoney\0"
+    "studypackage\0"
+    "studyquality\0"
+    "studyschool\0"
+    "studysion\0"
+    "studyyear\0"
+    "subalgorithm\0"
+    "subanalysis\0"
+    "subappear\0"
+    "subapplication\0"
+    "subarchitecture\0"
+    "subattribute\0"
+    "subaudio\0"
+    "subbattery\0"
+    "subbicycle\0"
+    "subboat\0"
+    "subbook\0"
+    "subbuildward\0"
+    "subbus\0"
+    "subcable\0"
+    "subcamera\0"
+    "subcase\0"
+    "subcircuit\0"
+    "subcolor\0"
+    "subcommunication\0"
+    "subcompany\0"
+    "subcomputer\0"
+    "subconstant\0"
+    "subculturalic\0"
+    "subdatabase\0"
+    "subday\0"
+    "subdecide\0"
+    "subdelivery\0"
+    "subdevelopment\0"
+    "subdigitalous\0"
+    "subeconomic\0"
+    "subeducational\0"
+    "subemail\0"
+    "subenergy\0"
+    "subengine\0"
+    "subexpecter\0"
+    "subfeelite\0"
+    "subfolder\0"
+    "subfrequency\0"
+    "subfuel\0"
+    "subglobal\0"
+    "subgovernment\0"
+    "subgrowth\0"
+    "subhistory\0"
+    "subhold\0"
+    "subhood\0"
+    "subibleic\0"
+    "subinterface\0"
+    "subknow\0"
+    "sublearnth\0"
+    "sublevel\0"
+    "sublivehood\0"
+    "subloveure\0"
+    "submaintenance\0"
+    "submakeest\0"
+    "submanagement\0"
+    "submedical\0"
+    "submemory\0"
+    "submessage\0"
+    "submethod\0"
+    "submobile\0"
+    "submodel\0"
+    "subnature\0"
+    "subnessant\0"
+    "suboffice\0"
+    "suboperation\0"
+    "suborder\0"
+    "subpaper\0"
+    "subpart\0"
+    "subpass\0"
+    "subpattern\0"
+    "subperformance\0"
+    "subperson\0"
+    "subphone\0"
+    "subplay\0"
+    "subpolitical\0"
+    "subposition\0"
+    "subpower\0"
+    "subprinciple\0"
+    "subprinter\0"
+    "subprocedure\0"
+    "subprocess\0"
+    "subprocessor\0"
+    "subprofessional\0"
+    "subprogram\0"
+    "subprogramdom\0"
+    "subprogramhood\0"
+    "subprogramsion\0"
+    "subproperty\0"
+    "subprovide\0"
+    "subpublic\0"
+    "subreachship\0"
+    "subreadise\0"
+    "subreadous\0"
+    "subreason\0"
+    "subrememberteen\0"
+    "subroom\0"
+    "subschool\0"
+    "subshipping\0"
+    "subside\0"
+    "subsion\0"
+    "subsoftware\0"
+    "subspendite\0"
+    "substudent\0"
+    "subsystem\0"
+    "subtake\0"
+    "subtakeen\0"
+    "subtool\0"
+    "subtrain\0"
+    "subtravel\0"
+    "subuniversity\0"
+    "subwalk\0"
+    "subwar\0"
+    "subwatchlike\0"
+    "subweek\0"
+    "subwoman\0"
+    "subword\0"
+    "subwork\0"
+    "subworld\0"
+    "subwrite\0"
+    "subyear\0"
+    "suggest\0"
+    "suggestful\0"
+    "suggestic\0"
+    "suggestth\0"
+    "suggesttion\0"
+    "suggestward\0"
+    "suggestwise\0"
+    "superable\0"
+    "superactivity\0"
+    "superaddress\0"
+    "superanalysis\0"
+    "superappear\0"
+    "superarchitecture\0"
+    "superarea\0"
+    "superattribute\0"
+    "superaudio\0"
+    "superbattery\0"
+    "superboat\0"
+    "superbringing\0"
+    "superbus\0"
+    "superbusiness\0"
+    "superbuy\0"
+    "supercable\0"
+    "supercharacteristic\0"
+    "supercommunication\0"
+    "supercomponent\0"
+    "superconcept\0"
+    "superconnector\0"
+    "superconstant\0"
+    "supercontinue\0"
+    "supercontroller\0"
+    "supercreatefy\0"
+    "superdevice\0"
+    "superdiehood\0"
+    "superdigital\0"
+    "superdigitalfy\0"
+    "superdocument\0"
+    "supereducation\0"
+    "supereducational\0"
+    "superelement\0"
+    "superemail\0"
+    "superenergy\0"
+    "superequipment\0"
+    "superever\0"
+    "superexpect\0"
+    "superexperience\0"
+    "superfact\0"
+    "superfeature\0"
+    "superfinancialfold\0"
+    "superfrequency\0"
+    "superfull\0"
+    "supergroup\0"
+    "supergrowth\0"
+    "superhappen\0"
+    "superheadphone\0"
+    "superhealth\0"
+    "superhistorical\0"
+    "superhistory\0"
+    "superholdal\0"
+    "superholdtion\0"
+    "superibleteen\0"
+    "superinformation\0"
+    "superinstrument\0"
+    "superintegration\0"
+    "superinterest\0"
+    "superinternational\0"
+    "superinternet\0"
+    "superknowic\0"
+    "superless\0"
+    "superlive\0"
+    "superliveure\0"
+    "superlocation\0"
+    "superlook\0"
+    "superlose\0"
+    "superloveary\0"
+    "supermedical\0"
+    "supermemory\0"
+    "supermoney\0"
+    "supermonitor\0"
+    "supermotor\0"
+    "supermotorcycle\0"
+    "supermove\0"
+    "supermusic\0"
+    "supername\0"
+    "supernation\0"
+    "supernationalise\0"
+    "supernaturaler\0"
+    "supernature\0"
+    "superoffice\0"
+    "superorganization\0"
+    "superpackage\0"
+    "superpart\0"
+    "superpass\0"
+    "superpath\0"
+    "superpeople\0"
+    "superperformance\0"
+    "superphone\0"
+    "superpick\0"
+    "superpickcraft\0"
+    "superplace\0"
+    "superplayize\0"
+    "superpolicy\0"
+    "superpolitical\0"
+    "superpoliticaldom\0"
+    "superpower\0"
+    "superproblem\0"
+    "superprocedure\0"
+    "superprocess\0"
+    "superprogram\0"
+    "superproperty\0"
+    "superpublic\0"
+    "superpull\0"
+    "superquestion\0"
+    "superradiation\0"
+    "superraise\0"
+    "superreason\0"
+    "superresource\0"
+    "superroom\0"
+    "superschool\0"
+    "supersecurity\0"
+    "supersell\0"
+    "supersensor\0"
+    "supership\0"
+    "supersolution\0"
+    "superstop\0"
+    "supersystemal\0"
+    "supertechnicalal\0"
+    "supertechnicaled\0"
+    "supertechnicalhood\0"
+    "supertell\0"
+    "superterm\0"
+    "supertool\0"
+    "supertrade\0"
+    "supertravel\0"
+    "supertruck\0"
+    "superuniversity\0"
+    "superuseic\0"
+    "supervalue\0"
+    "supervariable\0"
+    "supervideo\0"
+    "supervoltage\0"
+    "superwaitable\0"
+    "superwaitory\0"
+    "superwant\0"
+    "superwantfold\0"
+    "superwater\0"
+    "superwebsite\0"
+    "superwhatial\0"
+    "superwoman\0"
+    "superwrite\0"
+    "support\0"
+    "supportable\0"
+    "supportcar\0"
+    "supported\0"
+    "supportexperience\0"
+    "supportfile\0"
+    "supportfold\0"
+    "supportfy\0"
+    "supportgroup\0"
+    "supporthood\0"
+    "supportimage\0"
+    "supportintegration\0"
+    "supportism\0"
+    "supportive\0"
+    "supportless\0"
+    "supportly\0"
+    "supportmachine\0"
+    "supportness\0"
+    "supportnetwork\0"
+    "supportous\0"
+    "supportpath\0"
+    "supportscreen\0"
+    "supportship\0"
+    "supportsion\0"
+    "supportstandard\0"
+    "supportth\0"
+    "supportweek\0"
+    "system\0"
+    "systemage\0"
+    "systembicycle\0"
+    "systemboat\0"
+    "systemconnector\0"
+    "systemcraft\0"
+    "systemdom\0"
+    "systemfold\0"
+    "systemial\0"
+    "systemible\0"
+    "systemic\0"
+    "systeminnovation\0"
+    "systemise\0"
+    "systemly\0"
+    "systemment\0"
+    "systemmoney\0"
+    "systemory\0"
+    "systemous\0"
+    "systemplane\0"
+    "systemreport\0"
+    "systemsome\0"
+    "systemtechnique\0"
+    "systemteen\0"
+    "systemthing\0"
+    "systemure\0"
+    "systemward\0"
+    "systemwise\0"
+    "take\0"
+    "takeant\0"
+    "takehood\0"
+    "technical\0"
+    "technicalable\0"
+    "technicalary\0"
+    "technicalcraft\0"
+    "technicalen\0"
+    "technicalible\0"
+    "technicalic\0"
+    "technicalism\0"
+    "technicalment\0"
+    "technique\0"
+    "techniquecase\0"
+    "techniquechild\0"
+    "techniqueed\0"
+    "techniqueelectricity\0"
+    "techniqueexperience\0"
+    "techniquehood\0"
+    "techniqueible\0"
+    "techniqueise\0"
+    "techniqueite\0"
+    "techniqueive\0"
+    "techniqueize\0"
+    "techniquelike\0"
+    "techniquely\0"
+    "techniquemaintenance\0"
+    "techniqueprinciple\0"
+    "techniquereason\0"
+    "techniqueresult\0"
+    "techniquesecurity\0"
+    "techniquesomething\0"
+    "techniqueure\0"
+    "techniquevalue\0"
+    "techniquevariable\0"
+    "techniquewise\0"
+    "techniquework\0"
+    "technology\0"
+    "technologyage\0"
+    "technologyant\0"
+    "technologyary\0"
+    "technologycraft\0"
+    "technologydesign\0"
+    "technologydom\0"
+    "technologyent\0"
+    "technologyequipment\0"
+    "technologyfact\0"
+    "technologygrowth\0"
+    "technologyhood\0"
+    "technologyible\0"
+    "technologyinterest\0"
+    "technologyism\0"
+    "technologyive\0"
+    "technologyize\0"
+    "technologylike\0"
+    "technologymarket\0"
+    "technologymaterial\0"
+    "technologyness\0"
+    "technologyory\0"
+    "technologyous\0"
+    "technologyprocess\0"
+    "technologytime\0"
+    "technologyure\0"
+    "tell\0"
+    "tellen\0"
+    "tellless\0"
+    "tellteen\0"
+    "term\0"
+    "termactivity\0"
+    "termalgorithm\0"
+    "termary\0"
+    "termboat\0"
+    "termbusiness\0"
+    "termcar\0"
+    "termcomponent\0"
+    "termed\0"
+    "terment\0"
+    "termfolder\0"
+    "termframework\0"
+    "termhand\0"
+    "termlevel\0"
+    "termlight\0"
+    "termlike\0"
+    "termmemory\0"
+    "termsensor\0"
+    "termsion\0"
+    "termsound\0"
+    "termwave\0"
+    "termwise\0"
+    "text\0"
+    "textcable\0"
+    "textcomponent\0"
+    "textdelivery\0"
+    "textdom\0"
+    "textent\0"
+    "textest\0"
+    "textfold\0"
+    "textful\0"
+    "textintegration\0"
+    "textize\0"
+    "textlike\0"
+    "textmodel\0"
+    "textmoney\0"
+    "textness\0"
+    "textprogram\0"
+    "texttechnique\0"
+    "texture\0"
+    "theory\0"
+    "theoryable\0"
+    "theoryaudio\0"
+    "theorybusiness\0"
+    "theorycircuit\0"
+    "theorycountry\0"
+    "theorydom\0"
+    "theoryed\0"
+    "theoryelectricity\0"
+    "theoryen\0"
+    "theoryible\0"
+    "theoryimage\0"
+    "theoryinformation\0"
+    "theoryize\0"
+    "theoryjob\0"
+    "theoryletter\0"
+    "theorylike\0"
+    "theorymethod\0"
+    "theoryory\0"
+    "theorypath\0"
+    "theoryscreen\0"
+    "theorysecurity\0"
+    "theorysignal\0"
+    "theorytion\0"
+    "theorytravel\0"
+    "theoryway\0"
+    "thing\0"
+    "thingant\0"
+    "thingattribute\0"
+    "thingboat\0"
+    "thingcharacteristic\0"
+    "thingconcept\0"
+    "thingcraft\0"
+    "thingfold\0"
+    "thingful\0"
+    "thinghood\0"
+    "thinginfrastructure\0"
+    "thingless\0"
+    "thingname\0"
+    "thingpoint\0"
+    "thingship\0"
+    "thingsome\0"
+    "thingspeaker\0"
+    "thingtime\0"
+    "thingtion\0"
+    "thingure\0"
+    "thingwebsite\0"
+    "thingwise\0"
+    "think\0"
+    "thinkhood\0"
+    "thinking\0"
+    "thinkise\0"
+    "thinkless\0"
+    "thinkness\0"
+    "thinktion\0"
+    "time\0"
+    "timeary\0"
+    "timecharger\0"
+    "timeest\0"
+    "timefolder\0"
+    "timekeyboard\0"
+    "timelike\0"
+    "timemodel\0"
+    "timeory\0"
+    "timeous\0"
+    "timeplan\0"
+    "timeproperty\0"
+    "timespecial\0"
+    "timetechnology\0"
+    "timetheory\0"
+    "timething\0"
+    "timetraining\0"
+    "timeward\0"
+    "timewise\0"
+    "timeworld\0"
+    "tion\0"
+    "tionage\0"
+    "tionen\0"
+    "tionent\0"
+    "tool\0"
+    "tooladapter\0"
+    "toolage\0"
+    "toolalgorithm\0"
+    "tooldirectory\0"
+    "toolfold\0"
+    "toolhistory\0"
+    "toolhood\0"
+    "toolic\0"
+    "toolletter\0"
+    "toolline\0"
+    "toolmarket\0"
+    "toolory\0"
+    "toolpicture\0"
+    "toolprotocol\0"
+    "toolship\0"
+    "toolsoftware\0"
+    "toolstudy\0"
+    "toolth\0"
+    "toolty\0"
+    "toolure\0"
+    "toolward\0"
+    "toolwater\0"
+    "trade\0"
+    "tradeal\0"
+    "tradearchitecture\0"
+    "tradeary\0"
+    "tradeed\0"
+    "tradeelement\0"
+    "tradeer\0"
+    "tradefold\0"
+    "tradegovernment\0"
+    "tradehand\0"
+    "tradeial\0"
+    "tradeible\0"
+    "tradeic\0"
+    "tradeimage\0"
+    "tradeimplementation\0"
+    "tradeing\0"
+    "tradeite\0"
+    "tradejob\0"
+    "tradement\0"
+    "tradeparty\0"
+    "traderight\0"
+    "tradeth\0"
+    "tradeuniversity\0"
+    "train\0"
+    "trainaddress\0"
+    "trainage\0"
+    "trainalgorithm\0"
+    "trainapplication\0"
+    "traincraft\0"
+    "traindesign\0"
+    "traindisplay\0"
+    "trained\0"
+    "trainen\0"
+    "trainenergy\0"
+    "trainent\0"
+    "trainfold\0"
+    "training\0"
+    "trainingage\0"
+    "trainingary\0"
+    "trainingbattery\0"
+    "trainingboat\0"
+    "trainingcamera\0"
+    "trainingdesign\0"
+    "traininged\0"
+    "trainingfold\0"
+    "traininghood\0"
+    "trainingial\0"
+    "trainingic\0"
+    "traininginformation\0"
+    "trainingise\0"
+    "trainingism\0"
+    "trainingize\0"
+    "trainingless\0"
+    "trainingpower\0"
+    "trainingship\0"
+    "trainingsoftware\0"
+    "trainingtion\0"
+    "traininguniversity\0"
+    "trainingvehicle\0"
+    "trainingvoltage\0"
+    "trainingway\0"
+    "trainingwise\0"
+    "trainism\0"
+    "trainist\0"
+    "trainite\0"
+    "trainly\0"
+    "trainmarket\0"
+    "trainnation\0"
+    "trainoptimization\0"
+    "trainpackage\0"
+    "trainparameter\0"
+    "trainprocess\0"
+    "trainquestion\0"
+    "trainresult\0"
+    "trainsion\0"
+    "trainth\0"
+    "traintion\0"
+    "traintraining\0"
+    "transanalysis\0"
+    "transapplication\0"
+    "transaskful\0"
+    "transaudio\0"
+    "transcall\0"
+    "transcallsome\0"
+    "transcar\0"
+    "transcharacteristic\0"
+    "transcommunication\0"
+    "transcompany\0"
+    "transcourse\0"
+    "transcreateable\0"
+    "transcurrent\0"
+    "transcut\0"
+    "transdelivery\0"
+    "transdevelopment\0"
+    "transeducational\0"
+    "transequipment\0"
+    "transexpect\0"
+    "transfallfy\0"
+    "transfeature\0"
+    "transfeel\0"
+    "transhealth\0"
+    "transhistory\0"
+    "transhold\0"
+    "transhood\0"
+    "transhouse\0"
+    "transimage\0"
+    "transinstrument\0"
+    "transinterest\0"
+    "transknow\0"
+    "transknowant\0"
+    "translevel\0"
+    "translife\0"
+    "translike\0"
+    "translose\0"
+    "translosewise\0"
+    "transmarket\0"
+    "transmedical\0"
+    "transmedicalward\0"
+    "transmeet\0"
+    "transmentless\0"
+    "transmenttion\0"
+    "transmicrophone\0"
+    "transmodel\0"
+    "transnation\0"
+    "transnatural\0"
+    "transness\0"
+    "transopen\0"
+    "transopenless\0"
+    "transoperation\0"
+    "transorganization\0"
+    "transpaper\0"
+    "transparty\0"
+    "transpass\0"
+    "transpattern\0"
+    "transpay\0"
+    "transphoto\0"
+    "transpicture\0"
+    "transpoint\0"
+    "transpolicy\0"
+    "transpolitical\0"
+    "transport\0"
+    "transportable\0"
+    "transportcraft\0"
+    "transportdom\0"
+    "transported\0"
+    "transportelectricity\0"
+    "transporter\0"
+    "transportest\0"
+    "transportexperience\0"
+    "transportfold\0"
+    "transportful\0"
+    "transportfy\0"
+    "transporthand\0"
+    "transportial\0"
+    "transportmarket\0"
+    "transportment\0"
+    "transportness\0"
+    "transportphoto\0"
+    "transportship\0"
+    "transportsion\0"
+    "transportstrategy\0"
+    "transportstudent\0"
+    "transportth\0"
+    "transporttion\0"
+    "transporttruck\0"
+    "transpower\0"
+    "transprinciple\0"
+    "transprocedure\0"
+    "transprocess\0"
+    "transprofessional\0"
+    "transprogram\0"
+    "transproperty\0"
+    "transprovide\0"
+    "transpublic\0"
+    "transquestion\0"
+    "transquestioned\0"
+    "transraiseer\0"
+    "transraisefold\0"
+    "transreason\0"
+    "transresult\0"
+    "transscanner\0"
+    "transscreen\0"
+    "transsecurity\0"
+    "transseem\0"
+    "transsensor\0"
+    "transset\0"
+    "transside\0"
+    "transsignal\0"
+    "transsioner\0"
+    "transsit\0"
+    "transsociety\0"
+    "transspeaker\0"
+    "transstay\0"
+    "transstop\0"
+    "transstorage\0"
+    "transstrategy\0"
+    "transstructure\0"
+    "transsupport\0"
+    "transthing\0"
+    "transtime\0"
+    "transtion\0"
+    "transtool\0"
+    "transtrade\0"
+    "transuse\0"
+    "transusesome\0"
+    "transvehicle\0"
+    "transwalk\0"
+    "transwar\0"
+    "transwatchful\0"
+    "transway\0"
+    "transwear\0"
+    "transwhere\0"
+    "transwhereous\0"
+    "transwhich\0"
+    "travel\0"
+    "travelable\0"
+    "travelarchitecture\0"
+    "travelary\0"
+    "travelchild\0"
+    "travelequipment\0"
+    "travelfeature\0"
+    "travelfold\0"
+    "travelful\0"
+    "travelgroup\0"
+    "travelial\0"
+    "traveling\0"
+    "travelist\0"
+    "travelkeyboard\0"
+    "travelment\0"
+    "travelness\0"
+    "travelorder\0"
+    "travelphone\0"
+    "travelpolicy\0"
+    "travelprotocol\0"
+    "travelquality\0"
+    "travelscience\0"
+    "travelteen\0"
+    "travelth\0"
+    "traveltravel\0"
+    "travelward\0"
+    "travelway\0"
+    "travelword\0"
+    "treatment\0"
+    "treatmentary\0"
+    "treatmentcase\0"
+    "treatmentconnector\0"
+    "treatmentcourse\0"
+    "treatmentdelivery\0"
+    "treatmentdisplay\0"
+    "treatmentequipment\0"
+    "treatmenter\0"
+    "treatmentfeature\0"
+    "treatmentfold\0"
+    "treatmentful\0"
+    "treatmentfy\0"
+    "treatmentist\0"
+    "treatmentize\0"
+    "treatmentlike\0"
+    "treatmentmouse\0"
+    "treatmentory\0"
+    "treatmentous\0"
+    "treatmentpublic\0"
+    "treatmentsome\0"
+    "treatmenttext\0"
+    "treatmenttion\0"
+    "treatmentward\0"
+    "treatmentwork\0"
+    "truck\0"
+    "truckary\0"
+    "truckcharger\0"
+    "trucked\0"
+    "truckest\0"
+    "truckfact\0"
+    "truckframework\0"
+    "truckise\0"
+    "truckite\0"
+    "truckize\0"
+    "truckname\0"
+    "truckoperation\0"
+    "truckpoint\0"
+    "truckprocedure\0"
+    "truckquestion\0"
+    "truckspeaker\0"
+    "truckteen\0"
+    "trucktrade\0"
+    "truckure\0"
+    "truckwar\0"
+    "try\0"
+    "tryal\0"
+    "tryer\0"
+    "tryfold\0"
+    "ultraableial\0"
+    "ultraaction\0"
+    "ultraactivity\0"
+    "ultraadd\0"
+    "ultraalgorithm\0"
+    "ultraanalysis\0"
+    "ultraapparatus\0"
+    "ultraapplication\0"
+    "ultraapproach\0"
+    "ultraarea\0"
+    "ultraaskfold\0"
+    "ultraattribute\0"
+    "ultrabelieve\0"
+    "ultrabook\0"
+    "ultrabuild\0"
+    "ultracall\0"
+    "ultrachangely\0"
+    "ultracharacteristic\0"
+    "ultracircuit\0"
+    "ultracolor\0"
+    "ultracomehood\0"
+    "ultracommunication\0"
+    "ultraconcept\0"
+    "ultraconnector\0"
+    "ultracontact\0"
+    "ultracontinueive\0"
+    "ultracontroller\0"
+    "ultracountry\0"
+    "ultracurrent\0"
+    "ultraday\0"
+    "ultradelivery\0"
+    "ultradevelopment\0"
+    "ultradevice\0"
+    "ultradisplay\0"
+    "ultradocument\0"
+    "ultradocumentation\0"
+    "ultraeducation\0"
+    "ultraemail\0"
+    "ultraexample\0"
+    "ultrafallize\0"
+    "ultrafeature\0"
+    "ultrafolder\0"
+    "ultraframework\0"
+    "ultrafuel\0"
+    "ultrafullal\0"
+    "ultraglobal\0"
+    "ultrahand\0"
+    "ultrahappenage\0"
+    "ultrahappened\0"
+    "ultrahood\0"
+    "ultrahouse\0"
+    "ultraimage\0"
+    "ultrainfrastructure\0"
+    "ultrainterest\0"
+    "ultrainterface\0"
+    "ultrajob\0"
+    "ultrakeyboard\0"
+    "ultraknow\0"
+    "ultraletter\0"
+    "ultralevel\0"
+    "ultralife\0"
+    "ultralight\0"
+    "ultralike\0"
+    "ultralikewise\0"
+    "ultraline\0"
+    "ultraloveial\0"
+    "ultramaintenance\0"
+    "ultramakeous\0"
+    "ultramaterial\0"
+    "ultramember\0"
+    "ultramentlike\0"
+    "ultramessage\0"
+    "ultramodel\0"
+    "ultramoney\0"
+    "ultramost\0"
+    "ultramotorcycle\0"
+    "ultramouse\0"
+    "ultramove\0"
+    "ultraness\0"
+    "ultraoperation\0"
+    "ultrapaper\0"
+    "ultrapaperlike\0"
+    "ultraparameter\0"
+    "ultrapath\0"
+    "ultrapersonalship\0"
+    "ultraplan\0"
+    "ultraposition\0"
+    "ultraprinciple\0"
+    "ultraprogram\0"
+    "ultraproject\0"
+    "ultraprotocol\0"
+    "ultrapullial\0"
+    "ultraquestionist\0"
+    "ultrareach\0"
+    "ultrareadary\0"
+    "ultrareason\0"
+    "ultraremain\0"
+    "ultrareport\0"
+    "ultraresearch\0"
+    "ultraresource\0"
+    "ultraresult\0"
+    "ultrascanner\0"
+    "ultraschool\0"
+    "ultrascience\0"
+    "ultrascreen\0"
+    "ultrasecurity\0"
+    "ultraship\0"
+    "ultraside\0"
+    "ultrasionlike\0"
+    "ultrasitly\0"
+    "ultrasociety\0"
+    "ultrasomething\0"
+    "ultrasound\0"
+    "ultrastand\0"
+    "ultrastay\0"
+    "ultrasystem\0"
+    "ultrasystemible\0"
+    "ultratechnology\0"
+    "ultrathing\0"
+    "ultrathinkize\0"
+    "ultratime\0"
+    "ultratraining\0"
+    "ultratransport\0"
+    "ultratravel\0"
+    "ultratruck\0"
+    "ultrawant\0"
+    "ultrawatch\0"
+    "ultrawave\0"
+    "ultrawebsite\0"
+    "ultraweek\0"
+    "ultrawhere\0"
+    "ultrawinure\0"
+    "ultraworld\0"
+    "ultrayear\0"
+    "unaction\0"
+    "unactivity\0"
+    "unadapter\0"
+    "unallowsome\0"
+    "unanalysis\0"
+    "unappear\0"
+    "unapproach\0"
+    "unaskly\0"
+    "unbasis\0"
+    "unboat\0"
+    "unbuild\0"
+    "unbuildous\0"
+    "unbus\0"
+    "uncamera\0"
+    "uncase\0"
+    "uncommunication\0"
+    "unconstant\0"
+    "uncontact\0"
+    "uncontroller\0"
+    "uncreateness\0"
+    "undelivery\0"
+    "underactivity\0"
+    "underalgorithm\0"
+    "underallow\0"
+    "underbasis\0"
+    "underbelievedom\0"
+    "underbringness\0"
+    "underbuild\0"
+    "undercallwise\0"
+    "undercharger\0"
+    "undercompany\0"
+    "underconcept\0"
+    "underconnector\0"
+    "undercontact\0"
+    "undercontinue\0"
+    "undercontroller\0"
+    "undercountry\0"
+    "undercourse\0"
+    "undercultural\0"
+    "underdevice\0"
+    "underdie\0"
+    "undereconomicsome\0"
+    "underend\0"
+    "underenergy\0"
+    "underexample\0"
+    "underexpect\0"
+    "underexperience\0"
+    "underfact\0"
+    "underfall\0"
+    "underfeelless\0"
+    "underfile\0"
+    "underfindible\0"
+    "underfrequency\0"
+    "undergovernment\0"
+    "undergroup\0"
+    "underhooder\0"
+    "underhouse\0"
+    "underimplementation\0"
+    "underinformation\0"
+    "underinfrastructure\0"
+    "underinnovation\0"
+    "underlead\0"
+    "underlearnment\0"
+    "underlearntion\0"
+    "underleaveive\0"
+    "underlessary\0"
+    "underlevel\0"
+    "underlight\0"
+    "underlook\0"
+    "undermanagement\0"
+    "undermemory\0"
+    "undermethod\0"
+    "undermicrophone\0"
+    "undermost\0"
+    "undermotor\0"
+    "undermotorcycle\0"
+    "undermouse\0"
+    "undernationalfold\0"
+    "undernessable\0"
+    "undernetwork\0"
+    "underofferer\0"
+    "underoffice\0"
+    "underorganization\0"
+    "underparty\0"
+    "underpass\0"
+    "underpattern\0"
+    "underpersonal\0"
+    "underplane\0"
+    "underprice\0"
+    "underproblem\0"
+    "underprogram\0"
+    "underproperty\0"
+    "underraise\0"
+    "underremember\0"
+    "underroom\0"
+    "underserve\0"
+    "underset\0"
+    "underside\0"
+    "undersignal\0"
+    "underspace\0"
+    "understand\0"
+    "understandard\0"
+    "understandfold\0"
+    "understandhood\0"
+    "understandite\0"
+    "understandness\0"
+    "understop\0"
+    "understudent\0"
+    "undersystem\0"
+    "undertechnique\0"
+    "underterm\0"
+    "undertext\0"
+    "undertheory\0"
+    "underthinkous\0"
+    "underthinksome\0"
+    "undertool\0"
+    "undertrade\0"
+    "undertraining\0"
+    "undertransport\0"
+    "undertravel\0"
+    "undertreatment\0"
+    "undertruck\0"
+    "underunderstander\0"
+    "undervalue\0"
+    "undervoltage\0"
+    "underwait\0"
+    "underwater\0"
+    "underwebsite\0"
+    "underwhereen\0"
+    "underword\0"
+    "underyoung\0"
+    "undigitalen\0"
+    "undocument\0"
+    "unelectricity\0"
+    "unequipment\0"
+    "unexample\0"
+    "unexperience\0"
+    "unfeelsome\0"
+    "ungiveward\0"
+    "ungraphic\0"
+    "ungrowth\0"
+    "unhealth\0"
+    "unimage\0"
+    "uninfrastructure\0"
+    "uninterface\0"
+    "university\0"
+    "universityable\0"
+    "universityboat\0"
+    "universitycraft\0"
+    "universityfold\0"
+    "universityfolder\0"
+    "universitying\0"
+    "universityist\0"
+    "universityive\0"
+    "universitymessage\0"
+    "universityquality\0"
+    "universityresource\0"
+    "universitystorage\0"
+    "universitytext\0"
+    "universitything\0"
+    "universityure\0"
+    "universityway\0"
+    "universitywise\0"
+    "unlead\0"
+    "unlike\0"
+    "unlookage\0"
+    "unlooktion\0"
+    "unlose\0"
+    "unlosecraft\0"
+    "unloseible\0"
+    "unmake\0"
+    "unmarket\0"
+    "unmaterial\0"
+    "unmented\0"
+    "unmessage\0"
+    "unmethod\0"
+    "unmodel\0"
+    "unnation\0"
+    "unnationalial\0"
+    "unnatural\0"
+    "unness\0"
+    "unnumber\0"
+    "unopenise\0"
+    "unoptimization\0"
+    "unpattern\0"
+    "unpayary\0"
+    "unpeople\0"
+    "unpersonal\0"
+    "unphone\0"
+    "unpicture\0"
+    "unplane\0"
+    "unplaywise\0"
+    "unpower\0"
+    "unprinter\0"
+    "unproblem\0"
+    "unprocess\0"
+    "unproductivity\0"
+    "unproject\0"
+    "unquality\0"
+    "unradiation\0"
+    "unraise\0"
+    "unraiseen\0"
+    "unreason\0"
+    "unremainite\0"
+    "unreport\0"
+    "unright\0"
+    "unschool\0"
+    "unseemist\0"
+    "unsended\0"
+    "unservice\0"
+    "unsignal\0"
+    "unsociety\0"
+    "unsolution\0"
+    "unsound\0"
+    "unspeaker\0"
+    "unstandard\0"
+    "unstate\0"
+    "unstudy\0"
+    "unsystem\0"
+    "untechnology\0"
+    "untell\0"
+    "unterm\0"
+    "untheory\0"
+    "untool\0"
+    "untravel\0"
+    "ununiversity\0"
+    "unuse\0"
+    "unvehicle\0"
+    "unwatch\0"
+    "unway\0"
+    "unwhat\0"
+    "unwhatcraft\0"
+    "unwin\0"
+    "unwork\0"
+    "unyoung\0"
+    "upablecraft\0"
+    "upablesion\0"
+    "upaction\0"
+    "upadapter\0"
+    "upapparatus\0"
+    "upapproach\0"
+    "upaudio\0"
+    "upbattery\0"
+    "upbook\0"
+    "upbreak\0"
+    "upbring\0"
+    "upbringant\0"
+    "upbusiness\0"
+    "upcall\0"
+    "upcamera\0"
+    "upcase\0"
+    "upcharger\0"
+    "upcircuit\0"
+    "upcolor\0"
+    "upcometh\0"
+    "upcomponent\0"
+    "upconnector\0"
+    "upcontact\0"
+    "upcontroller\0"
+    "upcourse\0"
+    "upcreate\0"
+    "upcultural\0"
+    "upcut\0"
+    "updocument\0"
+    "updocumentation\0"
+    "upelement\0"
+    "upemail\0"
+    "upenergy\0"
+    "upexample\0"
+    "upexpect\0"
+    "upfeeled\0"
+    "upfollow\0"
+    "upframework\0"
+    "upfullcraft\0"
+    "upfullive\0"
+    "upfunction\0"
+    "upglobal\0"
+    "upgraphic\0"
+    "upgroup\0"
+    "upgrowize\0"
+    "upheadphone\0"
+    "uphold\0"
+    "uphood\0"
+    "upible\0"
+    "upinternationaldom\0"
+    "upjob\0"
+    "upless\0"
+    "uplessward\0"
+    "upliveful\0"
+    "uplocalsome\0"
+    "uplocation\0"
+    "uploveness\0"
+    "uploveward\0"
+    "upmachine\0"
+    "upmakeal\0"
+    "upmanagement\0"
+    "upmarket\0"
+    "upmechanism\0"
+    "upmeet\0"
+    "upmeeting\0"
+    "upmemory\0"
+    "upmodel\0"
+    "upname\0"
+    "upnature\0"
+    "upnetwork\0"
+    "upnews\0"
+    "upopenen\0"
+    "upoperation\0"
+    "uporder\0"
+    "uppayen\0"
+    "uppayhood\0"
+    "upperformance\0"
+    "uppersonal\0"
+    "upphone\0"
+    "upphoto\0"
+    "upplane\0"
+    "upplay\0"
+    "uppoint\0"
+    "upposition\0"
+    "upprice\0"
+    "upprinciple\0"
+    "upproblem\0"
+    "upprofessional\0"
+    "upprofessionalness\0"
+    "upquestion\0"
+    "upquestionial\0"
+    "upraise\0"
+    "upraiseable\0"
+    "upraiseist\0"
+    "upreachous\0"
+    "upreason\0"
+    "upresource\0"
+    "upright\0"
+    "upscanner\0"
+    "upscience\0"
+    "upsendary\0"
+    "upserve\0"
+    "upshipping\0"
+    "upsionest\0"
+    "upsocialite\0"
+    "upsocialwise\0"
+    "upsoftware\0"
+    "upsolution\0"
+    "upsome\0"
+    "upsomething\0"
+    "upstandard\0"
+    "upstudent\0"
+    "upsuggest\0"
+    "uptechnicalory\0"
+    "uptechnicalure\0"
+    "uptellic\0"
+    "uptellory\0"
+    "uptheory\0"
+    "upthing\0"
+    "uptime\0"
+    "uption\0"
+    "uptool\0"
+    "uptravel\0"
+    "upvalue\0"
+    "upvehicle\0"
+    "upwaitdom\0"
+    "upwantable\0"
+    "upwater\0"
+    "upway\0"
+    "upwear\0"
+    "upweek\0"
+    "upwhich\0"
+    "upworksome\0"
+    "upworkure\0"
+    "upworld\0"
+    "upwriteist\0"
+    "use\0"
+    "useer\0"
+    "useest\0"
+    "usefold\0"
+    "useial\0"
+    "value\0"
+    "valueage\0"
+    "valuebus\0"
+    "valuecontact\0"
+    "valueed\0"
+    "valueent\0"
+    "valueest\0"
+    "valueful\0"
+    "valuefunction\0"
+    "valuegraphic\0"
+    "valueic\0"
+    "valueise\0"
+    "valueism\0"
+    "valuelevel\0"
+    "valuelike\0"
+    "valuely\0"
+    "valueoperation\0"
+    "valueory\0"
+    "valueparty\0"
+    "valuepublic\0"
+    "valuescreen\0"
+    "valueteen\0"
+    "valuetraining\0"
+    "valueyoung\0"
+    "variable\0"
+    "variableapplication\0"
+    "variablecomputer\0"
+    "variableconnector\0"
+    "variablecontact\0"
+    "variabledatabase\0"
+    "variableent\0"
+    "variablefrequency\0"
+    "variablefy\0"
+    "variablehood\0"
+    "variableic\0"
+    "variableist\0"
+    "variablelike\0"
+    "variablemonitor\0"
+    "variablenetwork\0"
+    "variableory\0"
+    "variablesion\0"
+    "vehicle\0"
+    "vehicleal\0"
+    "vehiclecontact\0"
+    "vehicledisplay\0"
+    "vehicleen\0"
+    "vehiclefold\0"
+    "vehicleful\0"
+    "vehicleic\0"
+    "vehicleise\0"
+    "vehicleism\0"
+    "vehicleness\0"
+    "vehicleplatform\0"
+    "vehicleproject\0"
+    "vehiclequestion\0"
+    "vehicleservice\0"
+    "vehicletheory\0"
+    "video\0"
+    "videoable\0"
+    "videocraft\0"
+    "videodelivery\0"
+    "videoelectricity\0"
+    "videoent\0"
+    "videoism\0"
+    "videoive\0"
+    "videolike\0"
+    "videomoney\0"
+    "videoname\0"
+    "videoness\0"
+    "videooperation\0"
+    "videoous\0"
+    "videoresearch\0"
+    "videosion\0"
+    "videosome\0"
+    "videostate\0"
+    "videostudent\0"
+    "videowave\0"
+    "videoway\0"
+    "videowise\0"
+    "voltage\0"
+    "voltageable\0"
+    "voltagecraft\0"
+    "voltageent\0"
+    "voltageest\0"
+    "voltagefy\0"
+    "voltagehand\0"
+    "voltageial\0"
+    "voltageic\0"
+    "voltageite\0"
+    "voltageive\0"
+    "voltageize\0"
+    "voltagemethod\0"
+    "voltagename\0"
+    "voltageoperation\0"
+    "voltageous\0"
+    "voltageperformance\0"
+    "voltageproductivity\0"
+    "voltagequestion\0"
+    "voltagescreen\0"
+    "voltagesound\0"
+    "voltagestrategy\0"
+    "voltageth\0"
+    "voltagetrain\0"
+    "wait\0"
+    "waitic\0"
+    "waitsome\0"
+    "walk\0"
+    "walkdom\0"
+    "walked\0"
+    "walkism\0"
+    "walkite\0"
+    "walksome\0"
+    "walktion\0"
+    "want\0"
+    "wantful\0"
+    "wantist\0"
+    "wantize\0"
+    "wantship\0"
+    "wantteen\0"
+    "wanttion\0"
+    "war\0"
+    "warable\0"
+    "warant\0"
+    "warbattery\0"
+    "warcase\0"
+    "warcircuit\0"
+    "ward\0"
+    "warder\0"
+    "wardic\0"
+    "wardwise\0"
+    "waremail\0"
+    "waren\0"
+    "warequipment\0"
+    "warer\0"
+    "warful\0"
+    "wargroup\0"
+    "warhood\0"
+    "warize\0"
+    "warmouse\0"
+    "warness\0"
+    "warphoto\0"
+    "warproperty\0"
+    "warscience\0"
+    "warteen\0"
+    "warward\0"
+    "watch\0"
+    "watchage\0"
+    "watchen\0"
+    "watcher\0"
+    "watchfy\0"
+    "watchsion\0"
+    "water\0"
+    "watercurrent\0"
+    "watered\0"
+    "wateremail\0"
+    "wateren\0"
+    "waterfold\0"
+    "waterfuel\0"
+    "waterimage\0"
+    "waterinfrastructure\0"
+    "waterinterest\0"
+    "waterite\0"
+    "waterlocation\0"
+    "watermoney\0"
+    "waterplace\0"
+    "waterpoint\0"
+    "waterprotocol\0"
+    "waterquality\0"
+    "waterradiation\0"
+    "watersion\0"
+    "watertreatment\0"
+    "waterure\0"
+    "wave\0"
+    "waveable\0"
+    "waveage\0"
+    "waveanalysis\0"
+    "waveant\0"
+    "wavecharacteristic\0"
+    "wavecraft\0"
+    "wavedesign\0"
+    "wavedocument\0"
+    "waveed\0"
+    "wavefact\0"
+    "wavegrowth\0"
+    "waveic\0"
+    "waveinterest\0"
+    "waveise\0"
+    "waveist\0"
+    "waveless\0"
+    "wavelike\0"
+    "wavenation\0"
+    "waveory\0"
+    "waveprotocol\0"
+    "waveschool\0"
+    "waveship\0"
+    "wavesion\0"
+    "wavestrategy\0"
+    "waveteen\0"
+    "waveth\0"
+    "wavetion\0"
+    "waveure\0"
+    "waveword\0"
+    "way\0"
+    "wayal\0"
+    "waycable\0"
+    "waycase\0"
+    "wayed\0"
+    "wayfoundation\0"
+    "wayful\0"
+    "wayfy\0"
+    "wayic\0"
+    "wayism\0"
+    "wayist\0"
+    "waylocation\0"
+    "wayly\0"
+    "waymaintenance\0"
+    "waymaterial\0"
+    "waymoney\0"
+    "wayory\0"
+    "waypath\0"
+    "wayperformance\0"
+    "wayprogram\0"
+    "wayreport\0"
+    "wayresult\0"
+    "wayservice\0"
+    "waysystem\0"
+    "waywise\0"
+    "wear\0"
+    "wearal\0"
+    "wearer\0"
+    "wearial\0"
+    "wearment\0"
+    "wearteen\0"
+    "wearth\0"
+    "website\0"
+    "websiteapplication\0"
+    "websiteattribute\0"
+    "websiteent\0"
+    "websitefold\0"
+    "websitefrequency\0"
+    "websitefy\0"
+    "websitegraphic\0"
+    "websiteible\0"
+    "websiteive\0"
+    "websitejob\0"
+    "websitelike\0"
+    "websitely\0"
+    "websitemethod\0"
+    "websiteness\0"
+    "websiteoffice\0"
+    "websiteplatform\0"
+    "websiteprogram\0"
+    "websitesion\0"
+    "websitesupport\0"
+    "websitetion\0"
+    "websitetool\0"
+    "websitety\0"
+    "websiteward\0"
+    "week\0"
+    "weekbusiness\0"
+    "weekconnector\0"
+    "weekcourse\0"
+    "weekdom\0"
+    "weeken\0"
+    "weekent\0"
+    "weekful\0"
+    "weekhood\0"
+    "weekhouse\0"
+    "weekible\0"
+    "weekinfrastructure\0"
+    "weekinstrument\0"
+    "weekite\0"
+    "weekive\0"
+    "weekjob\0"
+    "weekmember\0"
+    "weekproperty\0"
+    "weekscreen\0"
+    "weeksion\0"
+    "weeksome\0"
+    "weekspace\0"
+    "weekteen\0"
+    "weekty\0"
+    "weekuniversity\0"
+    "weekure\0"
+    "weekvariable\0"
+    "weekwise\0"
+    "what\0"
+    "whatage\0"
+    "whatic\0"
+    "whating\0"
+    "whatist\0"
+    "whatment\0"
+    "whatory\0"
+    "whatward\0"
+    "when\0"
+    "whenage\0"
+    "whenary\0"
+    "whendom\0"
+    "whenen\0"
+    "whenful\0"
+    "whenness\0"
+    "whenwise\0"
+    "where\0"
+    "whereary\0"
+    "whereest\0"
+    "wheretion\0"
+    "wherewise\0"
+    "which\0"
+    "whichable\0"
+    "whichary\0"
+    "whicher\0"
+    "whichest\0"
+    "whichible\0"
+    "whichism\0"
+    "whichless\0"
+    "win\0"
+    "winal\0"
+    "winist\0"
+    "wise\0"
+    "wiseable\0"
+    "wiseant\0"
+    "wiseer\0"
+    "wisety\0"
+    "woman\0"
+    "womanattribute\0"
+    "womancolor\0"
+    "womandevelopment\0"
+    "womandom\0"
+    "womaned\0"
+    "womanen\0"
+    "womanent\0"
+    "womanfeature\0"
+    "womanfold\0"
+    "womanfolder\0"
+    "womanful\0"
+    "womanmodel\0"
+    "womanness\0"
+    "womanperson\0"
+    "womanpublic\0"
+    "womanresult\0"
+    "womansensor\0"
+    "womanstandard\0"
+    "womanstudent\0"
+    "womanure\0"
+    "womanvoltage\0"
+    "word\0"
+    "wordactivity\0"
+    "wordant\0"
+    "wordcomponent\0"
+    "worddevice\0"
+    "worddocumentation\0"
+    "wordeducation\0"
+    "wordefficiency\0"
+    "worder\0"
+    "wordful\0"
+    "wordial\0"
+    "wordist\0"
+    "wordmobile\0"
+    "wordous\0"
+    "wordparty\0"
+    "wordproductivity\0"
+    "wordproject\0"
+    "wordship\0"
+    "wordsome\0"
+    "wordspace\0"
+    "wordtool\0"
+    "wordty\0"
+    "wordwork\0"
+    "wordyear\0"
+    "work\0"
+    "workal\0"
+    "workcar\0"
+    "workcircuit\0"
+    "workcompany\0"
+    "workcontact\0"
+    "workdevice\0"
+    "workent\0"
+    "worker\0"
+    "workexample\0"
+    "workible\0"
+    "workic\0"
+    "workise\0"
+    "workist\0"
+    "workless\0"
+    "worklike\0"
+    "workorganization\0"
+    "workous\0"
+    "workprotocol\0"
+    "workscanner\0"
+    "worksome\0"
+    "workstate\0"
+    "workstudy\0"
+    "worktext\0"
+    "workth\0"
+    "worktool\0"
+    "worktrain\0"
+    "workty\0"
+    "workwise\0"
+    "world\0"
+    "worldage\0"
+    "worldant\0"
+    "worldconcept\0"
+    "worlddesign\0"
+    "worlddom\0"
+    "worldfile\0"
+    "worldful\0"
+    "worldfy\0"
+    "worldgovernment\0"
+    "worldgrowth\0"
+    "worldic\0"
+    "worldimage\0"
+    "worlding\0"
+    "worldmoney\0"
+    "worldname\0"
+    "worldory\0"
+    "worldous\0"
+    "worldproject\0"
+    "worldroom\0"
+    "worldstudent\0"
+    "worldterm\0"
+    "worldtion\0"
+    "worldty\0"
+    "worldward\0"
+    "write\0"
+    "writeer\0"
+    "writefold\0"
+    "writeful\0"
+    "writeory\0"
+    "writeship\0"
+    "writesome\0"
+    "year\0"
+    "yearage\0"
+    "yeardesign\0"
+    "yeardocument\0"
+    "yearelectricity\0"
+    "yearer\0"
+    "yearest\0"
+    "yearful\0"
+    "yearfy\0"
+    "yearless\0"
+    "yearlife\0"
+    "yearlike\0"
+    "yearment\0"
+    "yearmobile\0"
+    "yearness\0"
+    "yearposition\0"
+    "yearproperty\0"
+    "yearsociety\0"
+    "yearsome\0"
+    "yearwar\0"
+    "yearward\0"
+    "yearwebsite\0"
+    "young\0"
+    "youngant\0"
+    "youngaudio\0"
+    "youngboat\0"
+    "youngcharger\0"
+    "youngcourse\0"
+    "youngen\0"
+    "youngest\0"
+    "youngfact\0"
+    "youngfuel\0"
+    "youngful\0"
+    "youngfy\0"
+    "youngible\0"
+    "youngism\0"
+    "youngist\0"
+    "youngless\0"
+    "younglife\0"
+    "younglike\0"
+    "youngmanagement\0"
+    "youngnation\0"
+    "youngness\0"
+    "youngoptimization\0"
+    "youngory\0"
+    "youngpattern\0"
+    "youngpublic\0"
+    "youngroom\0"
+    "youngsome\0"
+    "youngsystem\0"
+    "youngteen\0"
+    "youngtext\0"
+    "youngth\0"
+    "youngty\0"
+    "youngward\0"
+    "youngwave\0"
+    "youngweek\0"
+    "youngwise\0";
+
+// Start of each word in DICTIONARY_BLOB
+const uint32_t DICTIONARY_OFFSETS[10000] = {
+    0, 5, 15, 23, 30, 37, 48, 63, 78, 92,
+    107, 119, 133, 146, 163, 174, 184, 194, 204, 214,
+    225, 236, 246, 260, 275, 288, 302, 311, 325, 336,
+    347, 356, 376, 390, 403, 422, 436, 449, 467, 481,
+    493, 505, 522, 533, 549, 564, 582, 598, 611, 626,
+    634, 644, 659, 676, 695, 705, 720, 731, 743, 754,
+    767, 783, 795, 809, 821, 836, 852, 864, 878, 895,
+    911, 921, 932, 945, 949, 955, 961, 969, 977, 989,
+    1000, 1016, 1028, 1043, 1060, 1071, 1083, 1093, 1105, 1116,
+    1128, 1139, 1150, 1160, 1173, 1190, 1205, 1217, 1227, 1237,
+    1252, 1258, 1264, 1274, 1289, 1304, 1316, 1329, 1341, 1353,
+    1371, 1391, 1409, 1422, 1439, 1454, 1471, 1486, 1498, 1516,
+    1528, 1541, 1554, 1568, 1574, 1583, 1592, 1601, 1611, 1619,
+    1628, 1641, 1653, 1664, 1678, 1689, 1702, 1714, 1732, 1747,
+    1760, 1772, 1784, 1798, 1816, 1829, 1845, 1858, 1867, 1879,
+    1890, 1903, 1914, 1928, 1941, 1955, 1968, 1985, 1995, 2007,
+    2016, 2027, 2037, 2046, 2060, 2073, 2086, 2103, 2116, 2124,
+    2135, 2151, 2162, 2174, 2187, 2203, 2213, 2221, 2232, 2243,
+    2257, 2269, 2278, 2287, 2301, 2313, 2323, 2334, 2345, 2356,
+    2374, 2384, 2395, 2414, 2433, 2448, 2464, 2477, 2486, 2496,
+    2505, 2518, 2534, 2545, 2554, 2566, 2576, 2585, 2597, 2609,
+    2617, 2633, 2645, 2655, 2668, 2677, 2687, 2697, 2709, 2726,
+    2742, 2754, 2767, 2781, 2793, 2809, 2824, 2835, 2844, 2853,
+    2866, 2879, 2891, 2903, 2912, 2924, 2938, 2950, 2963, 2976,
+    2990, 3005, 3014, 3026, 3035, 3045, 3054, 3067, 3077, 3090,
+    3104, 3114, 3129, 3137, 3149, 3161, 3174, 3187, 3196, 3206,
+    3214, 3222, 3231, 3243, 3253, 3262, 3271, 3281, 3302, 3320,
+    3333, 3352, 3367, 3379, 3398, 3418, 3432, 3444, 3459, 3473,
+    3485, 3498, 3512, 3530, 3544, 3561, 3573, 3591, 3605, 3618,
+    3632, 3646, 3653, 3663, 3673, 3683, 3693, 3702, 3714, 3730,
+    3745, 3760, 3777, 3792, 3806, 3821, 3835, 3850, 3865, 3880,
+    3898, 3914, 3931, 3947, 3962, 3982, 3999, 4014, 4030, 4046,
+    4055, 4068, 4083, 4094, 4111, 4124, 4142, 4161, 4175, 4190,
+    4207, 4219, 4230, 4243, 4255, 4270, 4288, 4301, 4314, 4328,
+    4340, 4354, 4367, 4387, 4402, 4415, 4428, 4441, 4457, 4470,
+    4489, 4505, 4524, 4539, 4555, 4571, 4592, 4609, 4626, 4642,
+    4662, 4683, 4700, 4718, 4735, 4740, 4752, 4760, 4769, 4781,
+    4788, 4795, 4802, 4810, 4818, 4827, 4842, 4851, 4859, 4867,
+    4879, 4889, 4901, 4910, 4919, 4928, 4943, 4952, 4956, 4962,
+    4969, 4975, 4983, 4989, 4999, 5011, 5026, 5039, 5052, 5071,
+    5085, 5099, 5115, 5134, 5154, 5168, 5182, 5194, 5208, 5214,
+    5225, 5240, 5248, 5257, 5270, 5279, 5288, 5297, 5308, 5320,
+    5331, 5343, 5355, 5369, 5379, 5390, 5398, 5406, 5418, 5430,
+    5444, 5454, 5464, 5474, 5486, 5498, 5507, 5516, 5524, 5537,
+    5549, 5560, 5568, 5578, 5588, 5601, 5612, 5630, 5643, 5658,
+    5674, 5684, 5692, 5705, 5716, 5728, 5742, 5753, 5764, 5778,
+    5787, 5796, 5809, 5824, 5835, 5850, 5862, 5872, 5891, 5907,
+    5923, 5938, 5954, 5967, 5977, 5986, 5997, 6007, 6018, 6029,
+    6043, 6054, 6065, 6077, 6092, 6102, 6111, 6121, 6136, 6146,
+    6158, 6173, 6182, 6194, 6203, 6214, 6223, 6240, 6254, 6263,
+    6271, 6282, 6298, 6309, 6319, 6328, 6340, 6350, 6360, 6374,
+    6386, 6398, 6410, 6422, 6439, 6449, 6459, 6472, 6487, 6496,
+    6508, 6523, 6532, 6544, 6554, 6562, 6571, 6584, 6593, 6605,
+    6616, 6629, 6643, 6653, 6665, 6675, 6688, 6698, 6707, 6720,
+    6733, 6745, 6754, 6766, 6783, 6797, 6812, 6821, 6830, 6840,
+    6853, 6864, 6874, 6893, 6903, 6916, 6928, 6936, 6945, 6954,
+    6964, 6975, 6984, 6993, 6999, 7008, 7022, 7035, 7044, 7056,
+    7069, 7084, 7094, 7104, 7113, 7123, 7135, 7147, 7156, 7165,
+    7178, 7194, 7204, 7214, 7226, 7235, 7243, 7256, 7269, 7279,
+    7296, 7314, 7328, 7339, 7351, 7369, 7386, 7397, 7409, 7422,
+    7433, 7446, 7461, 7473, 7490, 7505, 7518, 7526, 7538, 7546,
+    7561, 7571, 7585, 7604, 7618, 7628, 7642, 7654, 7665, 7677,
+    7689, 7702, 7715, 7731, 7748, 7765, 7777, 7791, 7803, 7820,
+    7831, 7843, 7848, 7856, 7869, 7888, 7900, 7908, 7917, 7925,
+    7933, 7942, 7953, 7962, 7972, 7982, 7994, 8003, 8015, 8025,
+    8030, 8037, 8045, 8054, 8065, 8074, 8083, 8096, 8104, 8112,
+    8121, 8132, 8141, 8151, 8165, 8178, 8191, 8200, 8209, 8219,
+    8228, 8240, 8249, 8255, 8264, 8273, 8283, 8293, 8303, 8309,
+    8319, 8328, 8338, 8347, 8356, 8365, 8375, 8385, 8393, 8403,
+    8409, 8417, 8426, 8435, 8445, 8454, 8464, 8468, 8476, 8482,
+    8489, 8498, 8504, 8511, 8517, 8525, 8533, 8551, 8560, 8572,
+    8584, 8595, 8606, 8618, 8630, 8643, 8661, 8673, 8685, 8698,
+    8709, 8725, 8739, 8757, 8772, 8785, 8799, 8815, 8826, 8845,
+    8857, 8864, 8872, 8886, 8897, 8905, 8917, 8928, 8938, 8946,
+    8955, 8959, 8965, 8972, 8980, 8986, 8995, 9015, 9028, 9039,
+    9048, 9062, 9070, 9081, 9091, 9100, 9109, 9118, 9127, 9136,
+    9146, 9157, 9167, 9178, 9191, 9200, 9211, 9221, 9231, 9241,
+    9254, 9265, 9270, 9278, 9286, 9293, 9300, 9307, 9320, 9331,
+    9347, 9357, 9368, 9378, 9388, 9398, 9408, 9418, 9429, 9440,
+    9451, 9465, 9475, 9489, 9503, 9514, 9526, 9541, 9552, 9563,
+    9574, 9578, 9586, 9595, 9610, 9617, 9624, 9632, 9646, 9654,
+    9661, 9667, 9679, 9688, 9697, 9705, 9710, 9718, 9730, 9745,
+    9760, 9767, 9776, 9785, 9800, 9808, 9817, 9829, 9842, 9853,
+    9860, 9869, 9878, 9885, 9896, 9906, 9916, 9926, 9941, 9959,
+    9979, 9996, 10013, 10033, 10051, 10069, 10087, 10106, 10123, 10142,
+    10161, 10180, 10199, 10219, 10238, 10246, 10258, 10269, 10282, 10299,
+    10312, 10327, 10337, 10347, 10357, 10375, 10387, 10398, 10408, 10424,
+    10437, 10452, 10465, 10477, 10487, 10498, 10509, 10515, 10524, 10533,
+    10546, 10558, 10573, 10586, 10594, 10602, 10618, 10631, 10641, 10655,
+    10664, 10673, 10683, 10695, 10708, 10726, 10735, 10744, 10756, 10769,
+    10782, 10797, 10805, 10817, 10832, 10847, 10864, 10875, 10893, 10908,
+    10919, 10931, 10943, 10954, 10965, 10980, 10992, 11005, 11017, 11030,
+    11041, 11051, 11060, 11072, 11083, 11093, 11101, 11109, 11116, 11124,
+    11135, 11142, 11151, 11157, 11165, 11181, 11193, 11204, 11214, 11220,
+    11231, 11240, 11246, 11256, 11272, 11284, 11298, 11308, 11317, 11328,
+    11338, 11347, 11354, 11366, 11373, 11382, 11395, 11402, 11410, 11417,
+    11424, 11431, 11439, 11450, 11462, 11478, 11489, 11496, 11503, 11514,
+    11520, 11529, 11537, 11554, 11563, 11571, 11579, 11588, 11599, 11608,
+    11617, 11626, 11635, 11645, 11657, 11667, 11677, 11692, 11708, 11720,
+    11729, 11740, 11753, 11763, 11772, 11783, 11793, 11806, 11816, 11826,
+    11835, 11840, 11849, 11861, 11868, 11876, 11884, 11892, 11900, 11909,
+    11918, 11927, 11936, 11945, 11953, 11967, 11988, 12009, 12025, 12041,
+    12058, 12075, 12092, 12110, 12128, 12149, 12168, 12185, 12202, 12220,
+    12238, 12245, 12253, 12266, 12279, 12294, 12305, 12315, 12332, 12342,
+    12353, 12367, 12378, 12389, 12400, 12411, 12422, 12433, 12445, 12458,
+    12478, 12495, 12508, 12524, 12537, 12554, 12569, 12587, 12601, 12613,
+    12625, 12643, 12655, 12672, 12682, 12703, 12716, 12733, 12753, 12769,
+    12784, 12801, 12814, 12828, 12840, 12853, 12865, 12885, 12898, 12910,
+    12929, 12942, 12960, 12976, 12991, 13010, 13024, 13038, 13047, 13063,
+    13075, 13088, 13102, 13114, 13126, 13138, 13157, 13169, 13181, 13193,
+    13209, 13223, 13240, 13254, 13271, 13284, 13295, 13308, 13317, 13325,
+    13340, 13351, 13364, 13379, 13390, 13400, 13414, 13424, 13436, 13447,
+    13457, 13472, 13484, 13496, 13506, 13517, 13535, 13546, 13557, 13569,
+    13583, 13597, 13609, 13621, 13635, 13651, 13664, 13676, 13687, 13697,
+    13709, 13728, 13743, 13760, 13773, 13785, 13798, 13817, 13835, 13849,
+    13862, 13874, 13887, 13903, 13917, 13929, 13944, 13958, 13971, 13992,
+    14006, 14023, 14038, 14052, 14064, 14077, 14092, 14101, 14112, 14124,
+    14137, 14148, 14157, 14170, 14181, 14192, 14211, 14229, 14241, 14253,
+    14273, 14286, 14304, 14322, 14338, 14354, 14371, 14388, 14404, 14420,
+    14434, 14448, 14462, 14470, 14480, 14491, 14503, 14518, 14537, 14547,
+    14557, 14568, 14580, 14592, 14602, 14614, 14627, 14643, 14654, 14665,
+    14682, 14694, 14706, 14717, 14732, 14748, 14760, 14773, 14790, 14800,
+    14812, 14828, 14839, 14851, 14863, 14872, 14884, 14897, 14908, 14919,
+    14932, 14943, 14957, 14970, 14984, 14999, 15014, 15035, 15050, 15064,
+    15078, 15092, 15106, 15126, 15141, 15155, 15173, 15186, 15200, 15216,
+    15231, 15240, 15248, 15258, 15268, 15276, 15283, 15290, 15296, 15306,
+    15314, 15322, 15332, 15339, 15347, 15358, 15368, 15379, 15389, 15401,
+    15411, 15423, 15438, 15451, 15462, 15471, 15481, 15490, 15501, 15508,
+    15518, 15529, 15539, 15549, 15558, 15570, 15581, 15591, 15601, 15615,
+    15627, 15640, 15647, 15654, 15661, 15673, 15681, 15694, 15707, 15722,
+    15733, 15751, 15770, 15781, 15794, 15806, 15817, 15833, 15845, 15858,
+    15871, 15892, 15907, 15922, 15938, 15952, 15965, 15976, 15992, 16006,
+    16021, 16037, 16056, 16071, 16089, 16105, 16119, 16134, 16155, 16169,
+    16187, 16203, 16215, 16229, 16241, 16254, 16266, 16281, 16300, 16318,
+    16329, 16341, 16357, 16376, 16390, 16402, 16417, 16431, 16444, 16457,
+    16469, 16484, 16501, 16515, 16529, 16542, 16556, 16568, 16585, 16598,
+    16611, 16628, 16640, 16655, 16669, 16685, 16697, 16711, 16724, 16736,
+    16753, 16766, 16783, 16798, 16815, 16830, 16845, 16860, 16875, 16891,
+    16905, 16920, 16936, 16950, 16962, 16977, 16991, 17003, 17015, 17029,
+    17045, 17059, 17076, 17089, 17105, 17120, 17133, 17150, 17163, 17178,
+    17192, 17208, 17226, 17238, 17251, 17263, 17277, 17295, 17310, 17326,
+    17338, 17350, 17362, 17378, 17390, 17406, 17419, 17427, 17438, 17450,
+    17465, 17482, 17496, 17506, 17524, 17534, 17546, 17558, 17569, 17584,
+    17595, 17607, 17617, 17628, 17639, 17651, 17666, 17680, 17694, 17713,
+    17729, 17743, 17755, 17770, 17782, 17792, 17799, 17808, 17818, 17829,
+    17838, 17847, 17860, 17870, 17881, 17891, 17901, 17918, 17928, 17938,
+    17949, 17962, 17973, 17985, 17998, 18009, 18020, 18031, 18042, 18052,
+    18063, 18071, 18082, 18090, 18097, 18106, 18112, 18118, 18125, 18132,
+    18141, 18151, 18161, 18172, 18183, 18194, 18203, 18214, 18226, 18237,
+    18245, 18257, 18268, 18279, 18291, 18302, 18313, 18324, 18343, 18359,
+    18374, 18387, 18402, 18422, 18437, 18450, 18465, 18477, 18489, 18501,
+    18513, 18525, 18541, 18551, 18562, 18574, 18586, 18590, 18596, 18603,
+    18610, 18617, 18624, 18632, 18640, 18647, 18656, 18668, 18686, 18697,
+    18709, 18725, 18738, 18756, 18771, 18784, 18798, 18809, 18829, 18841,
+    18854, 18865, 18878, 18892, 18907, 18925, 18946, 18958, 18974, 18987,
+    19000, 19018, 19029, 19041, 19054, 19058, 19066, 19083, 19092, 19099,
+    19105, 19112, 19122, 19128, 19136, 19143, 19150, 19158, 19167, 19175,
+    19184, 19193, 19205, 19211, 19221, 19231, 19242, 19249, 19260, 19267,
+    19277, 19284, 19296, 19306, 19316, 19325, 19336, 19346, 19357, 19368,
+    19380, 19389, 19403, 19413, 19422, 19436, 19447, 19460, 19466, 19478,
+    19485, 19495, 19508, 19517, 19524, 19531, 19542, 19551, 19561, 19573,
+    19583, 19594, 19602, 19619, 19632, 19645, 19659, 19671, 19678, 19689,
+    19699, 19707, 19716, 19725, 19737, 19755, 19772, 19787, 19799, 19811,
+    19823, 19835, 19848, 19860, 19874, 19893, 19905, 19919, 19936, 19951,
+    19965, 19983, 19997, 20013, 20026, 20040, 20049, 20058, 20066, 20076,
+    20084, 20097, 20104, 20112, 20119, 20130, 20140, 20154, 20161, 20171,
+    20180, 20195, 20205, 20212, 20219, 20233, 20242, 20250, 20257, 20267,
+    20275, 20283, 20293, 20301, 20315, 20327, 20337, 20347, 20358, 20367,
+    20378, 20388, 20397, 20409, 20422, 20430, 20437, 20447, 20456, 20465,
+    20471, 20478, 20485, 20505, 20514, 20527, 20537, 20551, 20561, 20572,
+    20581, 20598, 20609, 20626, 20636, 20650, 20662, 20674, 20686, 20699,
+    20710, 20720, 20730, 20741, 20749, 20760, 20771, 20780, 20788, 20796,
+    20804, 20813, 20821, 20830, 20843, 20860, 20870, 20882, 20896, 20917,
+    20932, 20953, 20969, 20984, 21004, 21022, 21042, 21058, 21078, 21095,
+    21111, 21131, 21138, 21149, 21159, 21168, 21178, 21188, 21202, 21214,
+    21223, 21236, 21246, 21255, 21272, 21283, 21293, 21303, 21313, 21323,
+    21334, 21343, 21358, 21369, 21382, 21393, 21407, 21421, 21432, 21444,
+    21458, 21469, 21480, 21496, 21506, 21517, 21529, 21537, 21547, 21553,
+    21563, 21569, 21576, 21584, 21591, 21599, 21603, 21610, 21616, 21624,
+    21632, 21640, 21648, 21659, 21669, 21681, 21692, 21704, 21714, 21728,
+    21747, 21765, 21778, 21799, 21812, 21825, 21838, 21851, 21865, 21877,
+    21898, 21912, 21926, 21940, 21955, 21974, 21993, 22007, 22026, 22039,
+    22053, 22063, 22076, 22088, 22098, 22112, 22127, 22143, 22156, 22165,
+    22173, 22182, 22189, 22199, 22206, 22224, 22233, 22244, 22255, 22272,
+    22284, 22294, 22306, 22317, 22324, 22339, 22349, 22363, 22376, 22388,
+    22402, 22411, 22421, 22432, 22440, 22457, 22465, 22478, 22486, 22496,
+    22510, 22521, 22529, 22541, 22550, 22564, 22579, 22592, 22604, 22616,
+    22628, 22637, 22649, 22660, 22668, 22680, 22689, 22697, 22705, 22715,
+    22726, 22736, 22745, 22756, 22767, 22776, 22790, 22799, 22808, 22820,
+    22835, 22849, 22857, 22867, 22876, 22887, 22900, 22911, 22920, 22931,
+    22941, 22956, 22966, 22974, 22985, 22997, 23008, 23025, 23036, 23048,
+    23060, 23076, 23087, 23098, 23109, 23121, 23131, 23146, 23158, 23175,
+    23186, 23200, 23214, 23226, 23238, 23250, 23260, 23273, 23288, 23303,
+    23312, 23321, 23334, 23345, 23356, 23369, 23380, 23393, 23409, 23424,
+    23437, 23447, 23459, 23468, 23479, 23489, 23501, 23512, 23524, 23532,
+    23546, 23558, 23566, 23575, 23584, 23595, 23606, 23619, 23631, 23642,
+    23651, 23663, 23672, 23685, 23695, 23703, 23712, 23724, 23735, 23747,
+    23754, 23762, 23770, 23779, 23788, 23802, 23823, 23840, 23858, 23876,
+    23893, 23910, 23927, 23944, 23962, 23980, 24001, 24020, 24037, 24055,
+    24069, 24086, 24098, 24113, 24126, 24138, 24155, 24166, 24180, 24201,
+    24213, 24227, 24244, 24258, 24271, 24287, 24300, 24313, 24322, 24334,
+    24345, 24358, 24371, 24381, 24398, 24410, 24424, 24439, 24455, 24471,
+    24487, 24502, 24518, 24532, 24551, 24567, 24585, 24603, 24620, 24632,
+    24646, 24662, 24674, 24687, 24702, 24717, 24734, 24753, 24769, 24781,
+    24794, 24811, 24822, 24837, 24851, 24864, 24880, 24893, 24906, 24923,
+    24938, 24952, 24969, 24985, 25003, 25020, 25033, 25051, 25066, 25081,
+    25093, 25112, 25127, 25141, 25157, 25172, 25187, 25207, 25227, 25242,
+    25258, 25272, 25290, 25306, 25323, 25343, 25359, 25380, 25395, 25403,
+    25415, 25431, 25442, 25453, 25465, 25476, 25487, 25501, 25521, 25533,
+    25550, 25563, 25575, 25586, 25599, 25605, 25623, 25637, 25646, 25654,
+    25663, 25675, 25685, 25696, 25706, 25718, 25728, 25739, 25750, 25765,
+    25779, 25789, 25803, 25817, 25825, 25836, 25847, 25858, 25868, 25878,
+    25886, 25896, 25910, 25925, 25931, 25943, 25950, 25962, 25973, 25981,
+    25988, 26005, 26015, 26023, 26030, 26041, 26055, 26069, 26079, 26085,
+    26089, 26095, 26106, 26121, 26135, 26144, 26157, 26170, 26178, 26184,
+    26190, 26197, 26205, 26219, 26229, 26245, 26252, 26267, 26280, 26290,
+    26298, 26309, 26321, 26335, 26344, 26356, 26363, 26376, 26390, 26399,
+    26410, 26425, 26439, 26451, 26460, 26470, 26479, 26490, 26506, 26517,
+    26529, 26540, 26550, 26561, 26573, 26583, 26602, 26615, 26631, 26645,
+    26656, 26667, 26678, 26685, 26694, 26703, 26710, 26726, 26740, 26749,
+    26759, 26770, 26780, 26798, 26809, 26821, 26835, 26848, 26867, 26877,
+    26889, 26900, 26913, 26925, 26936, 26946, 26954, 26961, 26973, 26982,
+    26991, 26999, 27009, 27023, 27035, 27051, 27057, 27068, 27079, 27089,
+    27097, 27109, 27119, 27128, 27136, 27143, 27152, 27162, 27172, 27186,
+    27193, 27200, 27210, 27220, 27228, 27236, 27245, 27255, 27262, 27272,
+    27280, 27292, 27299, 27311, 27318, 27324, 27333, 27341, 27349, 27356,
+    27366, 27374, 27382, 27392, 27407, 27416, 27427, 27434, 27444, 27456,
+    27471, 27484, 27495, 27505, 27517, 27527, 27533, 27544, 27550, 27561,
+    27573, 27581, 27589, 27599, 27610, 27622, 27632, 27642, 27651, 27663,
+    27675, 27688, 27695, 27703, 27711, 27717, 27730, 27746, 27759, 27770,
+    27777, 27784, 27795, 27803, 27810, 27816, 27823, 27830, 27838, 27846,
+    27854, 27863, 27872, 27880, 27890, 27903, 27924, 27937, 27952, 27970,
+    27985, 28002, 28016, 28030, 28042, 28056, 28069, 28082, 28096, 28116,
+    28130, 28144, 28157, 28174, 28191, 28207, 28226, 28240, 28254, 28271,
+    28285, 28298, 28311, 28325, 28330, 28338, 28346, 28354, 28361, 28369,
+    28380, 28394, 28409, 28424, 28434, 28445, 28462, 28473, 28483, 28494,
+    28510, 28520, 28534, 28548, 28560, 28575, 28585, 28597, 28610, 28623,
+    28630, 28640, 28649, 28659, 28670, 28684, 28703, 28716, 28732, 28746,
+    28760, 28773, 28788, 28802, 28817, 28830, 28848, 28865, 28879, 28897,
+    28915, 28930, 28945, 28955, 28969, 28981, 28994, 29008, 29025, 29036,
+    29049, 29060, 29069, 29080, 29092, 29101, 29114, 29130, 29142, 29160,
+    29172, 29185, 29204, 29219, 29236, 29247, 29256, 29268, 29278, 29290,
+    29300, 29315, 29328, 29340, 29353, 29364, 29374, 29389, 29405, 29418,
+    29431, 29445, 29463, 29480, 29496, 29513, 29527, 29536, 29549, 29561,
+    29571, 29581, 29593, 29603, 29613, 29623, 29636, 29652, 29662, 29673,
+    29684, 29695, 29711, 29721, 29733, 29744, 29757, 29770, 29781, 29794,
+    29806, 29817, 29831, 29842, 29862, 29876, 29890, 29906, 29924, 29937,
+    29953, 29965, 29977, 29993, 30006, 30018, 30031, 30045, 30057, 30069,
+    30085, 30099, 30112, 30123, 30136, 30150, 30161, 30176, 30187, 30201,
+    30215, 30226, 30239, 30251, 30267, 30278, 30288, 30299, 30310, 30324,
+    30339, 30351, 30366, 30377, 30388, 30401, 30410, 30422, 30435, 30447,
+    30461, 30471, 30482, 30497, 30502, 30514, 30522, 30530, 30539, 30552,
+    30561, 30571, 30580, 30590, 30597, 30605, 30614, 30619, 30627, 30634,
+    30642, 30650, 30659, 30668, 30675, 30686, 30696, 30708, 30717, 30727,
+    30736, 30746, 30756, 30773, 30786, 30796, 30806, 30817, 30828, 30839,
+    30853, 30865, 30879, 30898, 30911, 30923, 30939, 30950, 30963, 30974,
+    30985, 30993, 31008, 31024, 31041, 31054, 31075, 31092, 31102, 31113,
+    31125, 31136, 31151, 31162, 31173, 31185, 31197, 31208, 31220, 31232,
+    31242, 31256, 31269, 31279, 31291, 31296, 31305, 31312, 31320, 31328,
+    31336, 31345, 31353, 31358, 31369, 31377, 31385, 31404, 31414, 31425,
+    31436, 31450, 31465, 31472, 31481, 31490, 31498, 31506, 31514, 31522,
+    31531, 31541, 31550, 31563, 31577, 31586, 31594, 31606, 31615, 31624,
+    31635, 31644, 31654, 31668, 31681, 31694, 31707, 31720, 31733, 31747,
+    31752, 31760, 31768, 31776, 31785, 31794, 31802, 31809, 31819, 31830,
+    31839, 31852, 31870, 31880, 31890, 31900, 31917, 31927, 31940, 31951,
+    31968, 31978, 31992, 31999, 32010, 32021, 32032, 32042, 32053, 32064,
+    32074, 32085, 32097, 32111, 32124, 32137, 32154, 32163, 32173, 32183,
+    32195, 32204, 32214, 32227, 32237, 32249, 32262, 32280, 32294, 32307,
+    32318, 32329, 32337, 32350, 32361, 32372, 32385, 32396, 32410, 32422,
+    32436, 32455, 32466, 32481, 32495, 32508, 32520, 32531, 32543, 32554,
+    32569, 32578, 32597, 32611, 32624, 32637, 32646, 32658, 32671, 32680,
+    32689, 32702, 32713, 32723, 32733, 32745, 32754, 32763, 32780, 32792,
+    32808, 32817, 32827, 32837, 32848, 32858, 32872, 32884, 32896, 32915,
+    32927, 32942, 32955, 32966, 32975, 32988, 33001, 33010, 33023, 33036,
+    33051, 33064, 33075, 33084, 33095, 33107, 33122, 33133, 33146, 33155,
+    33167, 33175, 33184, 33197, 33210, 33219, 33229, 33239, 33251, 33265,
+    33274, 33287, 33299, 33311, 33326, 33337, 33351, 33362, 33372, 33381,
+    33390, 33404, 33414, 33423, 33435, 33447, 33457, 33471, 33481, 33493,
+    33502, 33512, 33523, 33539, 33554, 33567, 33581, 33595, 33608, 33622,
+    33643, 33657, 33671, 33686, 33701, 33716, 33732, 33747, 33762, 33772,
+    33786, 33799, 33817, 33834, 33846, 33862, 33876, 33889, 33902, 33915,
+    33928, 33941, 33957, 33971, 33988, 34007, 34025, 34040, 34056, 34070,
+    34086, 34105, 34119, 34133, 34147, 34157, 34176, 34189, 34206, 34221,
+    34238, 34256, 34269, 34288, 34302, 34316, 34329, 34342, 34355, 34369,
+    34385, 34400, 34415, 34432, 34446, 34461, 34466, 34474, 34482, 34490,
+    34498, 34507, 34515, 34526, 34545, 34553, 34569, 34578, 34587, 34596,
+    34607, 34620, 34632, 34641, 34651, 34663, 34672, 34681, 34688, 34697,
+    34702, 34711, 34718, 34725, 34733, 34741, 34749, 34758, 34766, 34775,
+    34784, 34796, 34808, 34824, 34839, 34851, 34862, 34874, 34886, 34905,
+    34918, 34930, 34949, 34967, 34979, 34992, 35005, 35016, 35032, 35045,
+    35063, 35077, 35092, 35105, 35119, 35132, 35145, 35157, 35170, 35184,
+    35189, 35196, 35204, 35212, 35220, 35228, 35237, 35244, 35254, 35264,
+    35274, 35284, 35295, 35309, 35323, 35339, 35353, 35366, 35387, 35400,
+    35414, 35431, 35446, 35463, 35477, 35492, 35510, 35527, 35544, 35559,
+    35578, 35593, 35607, 35615, 35626, 35639, 35652, 35665, 35675, 35686,
+    35701, 35713, 35723, 35738, 35752, 35765, 35785, 35796, 35807, 35822,
+    35834, 35847, 35859, 35869, 35887, 35903, 35916, 35931, 35937, 35946,
+    35961, 35970, 35980, 35993, 36012, 36020, 36029, 36037, 36047, 36056,
+    36065, 36076, 36092, 36101, 36110, 36120, 36129, 36140, 36154, 36166,
+    36177, 36191, 36201, 36211, 36221, 36230, 36235, 36244, 36252, 36260,
+    36268, 36276, 36285, 36294, 36301, 36312, 36326, 36335, 36345, 36361,
+    36375, 36386, 36395, 36406, 36416, 36428, 36444, 36454, 36464, 36477,
+    36488, 36499, 36511, 36526, 36537, 36546, 36557, 36567, 36578, 36589,
+    36601, 36606, 36616, 36626, 36634, 36642, 36657, 36669, 36678, 36691,
+    36699, 36713, 36723, 36733, 36744, 36753, 36762, 36774, 36784, 36793,
+    36807, 36815, 36824, 36832, 36841, 36848, 36857, 36867, 36878, 36887,
+    36897, 36910, 36922, 36935, 36954, 36966, 36980, 36993, 37007, 37020,
+    37034, 37047, 37060, 37073, 37087, 37099, 37115, 37132, 37146, 37162,
+    37180, 37199, 37217, 37233, 37251, 37258, 37268, 37279, 37299, 37316,
+    37329, 37342, 37352, 37362, 37372, 37389, 37400, 37416, 37427, 37437,
+    37447, 37465, 37482, 37492, 37504, 37519, 37530, 37541, 37556, 37571,
+    37585, 37593, 37604, 37615, 37630, 37647, 37663, 37677, 37687, 37699,
+    37709, 37720, 37731, 37742, 37754, 37766, 37778, 37789, 37806, 37824,
+    37836, 37848, 37863, 37873, 37885, 37899, 37912, 37924, 37929, 37938,
+    37946, 37954, 37959, 37971, 37978, 37985, 37992, 38006, 38014, 38021,
+    38029, 38040, 38050, 38064, 38075, 38084, 38095, 38105, 38119, 38126,
+    38135, 38140, 38150, 38158, 38166, 38174, 38183, 38189, 38202, 38213,
+    38225, 38234, 38250, 38270, 38285, 38295, 38311, 38326, 38340, 38352,
+    38362, 38377, 38382, 38389, 38397, 38406, 38412, 38426, 38439, 38450,
+    38464, 38483, 38493, 38502, 38512, 38521, 38530, 38539, 38547, 38557,
+    38566, 38577, 38588, 38600, 38610, 38618, 38633, 38654, 38672, 38690,
+    38709, 38727, 38746, 38766, 38783, 38804, 38825, 38845, 38866, 38885,
+    38905, 38912, 38922, 38932, 38944, 38953, 38965, 38973, 38983, 38990,
+    38998, 39006, 39012, 39019, 39036, 39046, 39056, 39064, 39072, 39079,
+    39089, 39100, 39110, 39121, 39133, 39144, 39150, 39161, 39170, 39176,
+    39186, 39202, 39217, 39234, 39248, 39258, 39266, 39275, 39285, 39294,
+    39301, 39310, 39322, 39334, 39350, 39364, 39379, 39394, 39413, 39429,
+    39446, 39462, 39478, 39494, 39512, 39531, 39551, 39568, 39587, 39608,
+    39624, 39636, 39651, 39670, 39688, 39707, 39727, 39744, 39761, 39779,
+    39799, 39816, 39834, 39852, 39870, 39890, 39911, 39932, 39953, 39972,
+    39991, 40002, 40013, 40022, 40031, 40044, 40051, 40061, 40075, 40086,
+    40093, 40104, 40112, 40124, 40133, 40141, 40148, 40158, 40172, 40179,
+    40192, 40201, 40210, 40219, 40226, 40236, 40244, 40251, 40264, 40275,
+    40289, 40305, 40322, 40335, 40352, 40367, 40386, 40402, 40416, 40430,
+    40444, 40458, 40478, 40493, 40509, 40525, 40544, 40564, 40579, 40595,
+    40604, 40614, 40620, 40629, 40638, 40646, 40653, 40663, 40670, 40681,
+    40692, 40700, 40710, 40721, 40732, 40744, 40752, 40763, 40772, 40783,
+    40792, 40801, 40818, 40829, 40837, 40844, 40855, 40868, 40879, 40891,
+    40899, 40907, 40918, 40926, 40936, 40947, 40954, 40964, 40975, 40987,
+    40998, 41013, 41028, 41041, 41057, 41071, 41084, 41104, 41118, 41132,
+    41149, 41163, 41178, 41195, 41214, 41232, 41247, 41262, 41277, 41292,
+    41305, 41321, 41337, 41353, 41363, 41376, 41386, 41395, 41407, 41422,
+    41437, 41457, 41472, 41486, 41500, 41515, 41533, 41551, 41567, 41582,
+    41597, 41617, 41632, 41653, 41673, 41693, 41711, 41731, 41752, 41768,
+    41785, 41801, 41808, 41822, 41831, 41842, 41857, 41869, 41884, 41895,
+    41905, 41916, 41928, 41937, 41957, 41970, 41983, 41996, 42009, 42023,
+    42032, 42044, 42057, 42070, 42089, 42103, 42123, 42135, 42150, 42159,
+    42171, 42182, 42194, 42212, 42231, 42245, 42256, 42267, 42280, 42296,
+    42310, 42330, 42345, 42357, 42370, 42383, 42395, 42405, 42418, 42431,
+    42444, 42457, 42470, 42482, 42499, 42513, 42534, 42553, 42566, 42579,
+    42592, 42608, 42620, 42634, 42653, 42666, 42681, 42696, 42710, 42723,
+    42741, 42756, 42771, 42786, 42796, 42810, 42820, 42833, 42848, 42863,
+    42876, 42887, 42898, 42918, 42935, 42952, 42967, 42976, 42986, 42996,
+    43008, 43018, 43032, 43046, 43059, 43075, 43087, 43102, 43114, 43126,
+    43139, 43151, 43163, 43174, 43190, 43201, 43213, 43227, 43245, 43262,
+    43279, 43295, 43312, 43329, 43347, 43364, 43382, 43398, 43414, 43423,
+    43436, 43453, 43466, 43482, 43500, 43516, 43532, 43545, 43563, 43583,
+    43600, 43612, 43624, 43637, 43658, 43675, 43694, 43707, 43724, 43735,
+    43748, 43759, 43769, 43779, 43791, 43804, 43818, 43829, 43840, 43855,
+    43868, 43881, 43897, 43910, 43924, 43936, 43951, 43965, 43983, 43995,
+    44009, 44022, 44034, 44044, 44056, 44070, 44080, 44092, 44106, 44119,
+    44134, 44144, 44158, 44168, 44178, 44189, 44201, 44216, 44225, 44237,
+    44253, 44262, 44273, 44287, 44298, 44307, 44320, 44331, 44342, 44351,
+    44363, 44373, 44383, 44394, 44401, 44410, 44418, 44429, 44435, 44446,
+    44456, 44463, 44473, 44485, 44496, 44503, 44513, 44524, 44531, 44535,
+    44541, 44548, 44560, 44566, 44572, 44585, 44592, 44598, 44607, 44613,
+    44621, 44632, 44640, 44651, 44663, 44669, 44678, 44685, 44693, 44702,
+    44714, 44728, 44740, 44753, 44765, 44779, 44792, 44805, 44824, 44837,
+    44853, 44867, 44880, 44893, 44904, 44920, 44933, 44938, 44946, 44954,
+    44963, 44971, 44980, 44988, 44997, 45005, 45014, 45023, 45028, 45035,
+    45043, 45048, 45056, 45063, 45071, 45079, 45087, 45096, 45105, 45112,
+    45120, 45129, 45135, 45144, 45154, 45160, 45168, 45177, 45186, 45195,
+    45200, 45209, 45218, 45225, 45233, 45242, 45249, 45258, 45268, 45278,
+    45292, 45302, 45315, 45336, 45346, 45356, 45371, 45382, 45394, 45404,
+    45414, 45430, 45444, 45453, 45463, 45478, 45489, 45495, 45509, 45529,
+    45542, 45551, 45559, 45567, 45577, 45586, 45596, 45605, 45614, 45626,
+    45637, 45650, 45661, 45674, 45683, 45698, 45710, 45720, 45733, 45743,
+    45756, 45761, 45774, 45782, 45792, 45805, 45820, 45827, 45835, 45844,
+    45853, 45868, 45887, 45895, 45903, 45911, 45920, 45930, 45942, 45953,
+    45961, 45971, 45988, 46000, 46015, 46024, 46034, 46043, 46058, 46064,
+    46077, 46085, 46099, 46108, 46118, 46132, 46143, 46157, 46176, 46184,
+    46192, 46201, 46210, 46218, 46228, 46244, 46253, 46270, 46282, 46291,
+    46302, 46312, 46323, 46331, 46344, 46349, 46357, 46365, 46374, 46381,
+    46389, 46398, 46407, 46416, 46421, 46428, 46436, 46448, 46463, 46473,
+    46484, 46492, 46499, 46508, 46516, 46530, 46538, 46546, 46554, 46562,
+    46575, 46584, 46593, 46602, 46612, 46620, 46631, 46640, 46653, 46662,
+    46671, 46678, 46683, 46692, 46699, 46707, 46716, 46722, 46732, 46741,
+    46749, 46759, 46769, 46778, 46790, 46807, 46822, 46834, 46845, 46863,
+    46874, 46887, 46898, 46911, 46923, 46940, 46952, 46965, 46980, 46993,
+    47005, 47017, 47031, 47046, 47057, 47069, 47081, 47095, 47100, 47108,
+    47115, 47124, 47131, 47136, 47144, 47152, 47161, 47170, 47179, 47184,
+    47192, 47199, 47207, 47215, 47223, 47231, 47239, 47248, 47256, 47268,
+    47278, 47293, 47307, 47318, 47330, 47344, 47355, 47367, 47377, 47392,
+    47405, 47417, 47434, 47449, 47461, 47472, 47483, 47495, 47507, 47523,
+    47542, 47559, 47576, 47591, 47607, 47622, 47638, 47653, 47669, 47690,
+    47708, 47724, 47743, 47761, 47779, 47795, 47812, 47817, 47826, 47834,
+    47843, 47852, 47863, 47876, 47894, 47911, 47930, 47946, 47961, 47981,
+    47995, 48009, 48023, 48040, 48055, 48071, 48087, 48105, 48121, 48139,
+    48157, 48174, 48189, 48196, 48209, 48219, 48230, 48247, 48258, 48271,
+    48284, 48299, 48314, 48325, 48336, 48345, 48357, 48368, 48377, 48389,
+    48398, 48410, 48422, 48437, 48448, 48459, 48474, 48486, 48499, 48518,
+    48530, 48542, 48555, 48568, 48579, 48591, 48609, 48622, 48638, 48654,
+    48667, 48677, 48691, 48708, 48725, 48741, 48754, 48767, 48784, 48803,
+    48817, 48831, 48844, 48857, 48870, 48882, 48902, 48918, 48933, 48949,
+    48968, 48987, 49003, 49023, 49041, 49055, 49075, 49083, 49095, 49107,
+    49117, 49122, 49129, 49138, 49146, 49154, 49163, 49170, 49180, 49191,
+    49205, 49218, 49233, 49242, 49252, 49263, 49277, 49290, 49301, 49311,
+    49321, 49336, 49352, 49362, 49372, 49390, 49404, 49418, 49430, 49441,
+    49460, 49470, 49482, 49496, 49505, 49514, 49525, 49536, 49543, 49554,
+    49573, 49585, 49602, 49617, 49627, 49637, 49648, 49659, 49676, 49688,
+    49701, 49712, 49726, 49741, 49756, 49768, 49779, 49784, 49792, 49800,
+    49807, 49814, 49822, 49834, 49845, 49857, 49872, 49889, 49900, 49911,
+    49925, 49937, 49949, 49959, 49970, 49989, 50005, 50016, 50031, 50050,
+    50064, 50082, 50093, 50109, 50124, 50136, 50148, 50159, 50173, 50186,
+    50197, 50210, 50221, 50235, 50245, 50255, 50264, 50278, 50290, 50302,
+    50316, 50324, 50335, 50346, 50364, 50377, 50393, 50406, 50421, 50433,
+    50447, 50455, 50468, 50481, 50492, 50508, 50516, 50528, 50540, 50553,
+    50571, 50585, 50601, 50616, 50628, 50638, 50650, 50661, 50670, 50679,
+    50690, 50705, 50714, 50726, 50735, 50748, 50762, 50771, 50785, 50803,
+    50816, 50825, 50837, 50848, 50857, 50868, 50879, 50892, 50908, 50921,
+    50933, 50944, 50955, 50967, 50980, 50990, 51003, 51013, 51024, 51040,
+    51052, 51061, 51075, 51085, 51097, 51107, 51119, 51130, 51139, 51152,
+    51161, 51171, 51185, 51195, 51207, 51221, 51238, 51252, 51265, 51276,
+    51293, 51307, 51321, 51331, 51342, 51356, 51369, 51379, 51388, 51401,
+    51410, 51419, 51430, 51438, 51453, 51466, 51478, 51488, 51501, 51514,
+    51525, 51538, 51555, 51569, 51578, 51589, 51603, 51612, 51627, 51637,
+    51647, 51657, 51666, 51675, 51688, 51697, 51706, 51715, 51722, 51732,
+    51748, 51759, 51773, 51782, 51792, 51802, 51813, 51831, 51841, 51851,
+    51861, 51873, 51884, 51897, 51908, 51920, 51932, 51948, 51963, 51974,
+    51983, 51997, 52009, 52023, 52037, 52052, 52066, 52083, 52101, 52114,
+    52124, 52134, 52145, 52155, 52168, 52179, 52190, 52203, 52216, 52234,
+    52250, 52265, 52281, 52295, 52307, 52320, 52333, 52350, 52363, 52374,
+    52389, 52402, 52414, 52424, 52436, 52446, 52461, 52473, 52489, 52504,
+    52520, 52536, 52548, 52559, 52579, 52592, 52606, 52621, 52640, 52650,
+    52662, 52672, 52683, 52696, 52710, 52720, 52732, 52745, 52756, 52772,
+    52784, 52794, 52805, 52818, 52828, 52839, 52851, 52868, 52879, 52893,
+    52908, 52924, 52942, 52957, 52972, 52992, 53006, 53022, 53040, 53056,
+    53072, 53089, 53104, 53118, 53136, 53151, 53167, 53178, 53192, 53203,
+    53218, 53231, 53249, 53265, 53280, 53294, 53312, 53325, 53336, 53350,
+    53362, 53374, 53390, 53406, 53417, 53429, 53441, 53451, 53462, 53475,
+    53485, 53498, 53510, 53523, 53533, 53547, 53560, 53574, 53589, 53600,
+    53610, 53621, 53634, 53646, 53661, 53677, 53687, 53698, 53711, 53721,
+    53733, 53745, 53759, 53770, 53783, 53797, 53807, 53821, 53834, 53847,
+    53857, 53869, 53883, 53895, 53903, 53913, 53932, 53944, 53954, 53972,
+    53984, 53996, 54010, 54022, 54030, 54044, 54058, 54070, 54083, 54096,
+    54111, 54119, 54128, 54139, 54148, 54161, 54170, 54183, 54195, 54208,
+    54219, 54229, 54239, 54254, 54270, 54283, 54296, 54309, 54319, 54332,
+    54343, 54352, 54361, 54375, 54388, 54400, 54411, 54421, 54432, 54444,
+    54453, 54469, 54480, 54491, 54508, 54520, 54534, 54543, 54552, 54564,
+    54576, 54586, 54603, 54613, 54625, 54637, 54649, 54659, 54669, 54678,
+    54689, 54702, 54713, 54728, 54740, 54751, 54763, 54776, 54785, 54796,
+    54809, 54821, 54834, 54842, 54852, 54864, 54875, 54890, 54905, 54914,
+    54924, 54933, 54942, 54952, 54963, 54978, 54990, 55001, 55009, 55018,
+    55031, 55040, 55053, 55063, 55072, 55082, 55092, 55105, 55117, 55129,
+    55142, 55152, 55164, 55172, 55181, 55191, 55209, 55220, 55229, 55240,
+    55249, 55257, 55274, 55286, 55297, 55308, 55318, 55330, 55339, 55351,
+    55363, 55373, 55385, 55398, 55413, 55422, 55432, 55443, 55457, 55468,
+    55476, 55492, 55504, 55514, 55524, 55534, 55547, 55559, 55566, 55575,
+    55584, 55592, 55603, 55617, 55627, 55638, 55647, 55655, 55665, 55674,
+    55687, 55700, 55708, 55719, 55726, 55737, 55752, 55768, 55777, 55785,
+    55797, 55806, 55817, 55829, 55843, 55853, 55865, 55874, 55886, 55897,
+    55911, 55922, 55933, 55942, 55953, 55963, 55972, 55983, 55995, 56006,
+    56015, 56028, 56039, 56048, 56060, 56071, 56082, 56095, 56109, 56121,
+    56129, 56141, 56149, 56160, 56168, 56177, 56184, 56195, 56207, 56214,
+    56223, 56230, 56243, 56251, 56262, 56273, 56282, 56289, 56305, 56315,
+    56330, 56346, 56358, 56376, 56386, 56398, 56408, 56421, 56438, 56449,
+    56468, 56479, 56491, 56500, 56511, 56521, 56527, 56537, 56546, 56561,
+    56579, 56588, 56603, 56612, 56620, 56640, 56656, 56665, 56677, 56687,
+    56698, 56710, 56720, 56735, 56743, 56754, 56764, 56774, 56784, 56790,
+    56800, 56810, 56820, 56833, 56845, 56857, 56865, 56874, 56882, 56892,
+    56901, 56910, 56919, 56935, 56948, 56963, 56977, 56989, 57003, 57013,
+    57024, 57038, 57046, 57054, 57065, 57079, 57087, 57098, 57113, 57134,
+    57144, 57156, 57167, 57179, 57191, 57203, 57214, 57226, 57240, 57255,
+    57267, 57279, 57294, 57305, 57317, 57322, 57330, 57338, 57347, 57355,
+    57363, 57371, 57380, 57386, 57396, 57405, 57416, 57427, 57442, 57456,
+    57470, 57486, 57501, 57514, 57528, 57549, 57569, 57586, 57601, 57616,
+    57631, 57647, 57660, 57672, 57681, 57691, 57709, 57718, 57730, 57740,
+    57750, 57756, 57766, 57781, 57790, 57799, 57807, 57822, 57839, 57852,
+    57862, 57870, 57887, 57896, 57905, 57913, 57923, 57935, 57946, 57955,
+    57967, 57977, 57991, 58001, 58012, 58023, 58033, 58041, 58046, 58053,
+    58061, 58070, 58079, 58089, 58104, 58115, 58129, 58146, 58164, 58174,
+    58183, 58196, 58206, 58217, 58231, 58240, 58252, 58265, 58279, 58292,
+    58304, 58318, 58327, 58342, 58356, 58368, 58381, 58396, 58407, 58422,
+    58435, 58450, 58462, 58475, 58487, 58499, 58516, 58532, 58547, 58560,
+    58576, 58586, 58598, 58614, 58625, 58635, 58649, 58662, 58679, 58698,
+    58712, 58725, 58739, 58750, 58767, 58779, 58794, 58806, 58819, 58835,
+    58846, 58860, 58871, 58884, 58896, 58907, 58920, 58933, 58944, 58956,
+    58967, 58978, 58993, 59006, 59021, 59039, 59052, 59065, 59079, 59092,
+    59108, 59120, 59134, 59146, 59158, 59175, 59190, 59204, 59216, 59229,
+    59239, 59251, 59263, 59277, 59291, 59306, 59317, 59330, 59343, 59354,
+    59371, 59386, 59398, 59408, 59422, 59437, 59449, 59460, 59471, 59482,
+    59492, 59505, 59520, 59529, 59539, 59549, 59560, 59574, 59586, 59599,
+    59613, 59625, 59636, 59646, 59652, 59662, 59670, 59678, 59688, 59697,
+    59707, 59723, 59732, 59744, 59756, 59767, 59781, 59789, 59801, 59811,
+    59822, 59831, 59841, 59846, 59860, 59868, 59879, 59886, 59901, 59910,
+    59921, 59931, 59939, 59947, 59955, 59963, 59971, 59979, 59988, 60003,
+    60011, 60024, 60033, 60045, 60054, 60061, 60070, 60082, 60096, 60108,
+    60119, 60130, 60142, 60155, 60165, 60176, 60188, 60202, 60222, 60232,
+    60241, 60250, 60260, 60274, 60284, 60294, 60304, 60314, 60324, 60336,
+    60349, 60365, 60381, 60396, 60411, 60422, 60433, 60447, 60459, 60470,
+    60478, 60489, 60500, 60512, 60523, 60534, 60544, 60551, 60562, 60581,
+    60595, 60607, 60616, 60625, 60636, 60646, 60657, 60666, 60676, 60691,
+    60701, 60712, 60723, 60738, 60747, 60759, 60773, 60784, 60794, 60806,
+    60820, 60831, 60845, 60859, 60870, 60881, 60886, 60896, 60904, 60911,
+    60919, 60927, 60934, 60943, 60951, 60959, 60976, 60989, 61002, 61017,
+    61028, 61040, 61052, 61063, 61074, 61086, 61100, 61115, 61127, 61144,
+    61159, 61172, 61182, 61187, 61199, 61207, 61223, 61232, 61242, 61253,
+    61261, 61269, 61276, 61289, 61297, 61305, 61313, 61323, 61334, 61343,
+    61352, 61360, 61372, 61385, 61398, 61405, 61413, 61422, 61431, 61440,
+    61448, 61458, 61470, 61481, 61488, 61497, 61507, 61520, 61532, 61545,
+    61558, 61567, 61576, 61585, 61596, 61604, 61613, 61621, 61632, 61643,
+    61660, 61673, 61684, 61698, 61709, 61721, 61733, 61743, 61750, 61763,
+    61774, 61784, 61797, 61805, 61816, 61828, 61836, 61846, 61854, 61864,
+    61875, 61884, 61897, 61911, 61928, 61939, 61948, 61957, 61971, 61983,
+    62000, 62008, 62017, 62028, 62036, 62045, 62053, 62065, 62077, 62085,
+    62097, 62109, 62120, 62135, 62149, 62158, 62166, 62180, 62191, 62200,
+    62210, 62220, 62230, 62240, 62249, 62258, 62266, 62277, 62286, 62295,
+    62305, 62317, 62326, 62339, 62355, 62366, 62378, 62390, 62400, 62412,
+    62424, 62437, 62446, 62460, 62473, 62483, 62495, 62503, 62513, 62525,
+    62533, 62545, 62553, 62564, 62571, 62580, 62591, 62603, 62615, 62627,
+    62640, 62653, 62661, 62671, 62679, 62688, 62700, 62710, 62721, 62731,
+    62748, 62762, 62771, 62783, 62794, 62805, 62813, 62821, 62829, 62838,
+    62849, 62858, 62865, 62875, 62887, 62897, 62911, 62924, 62944, 62953,
+    62966, 62975, 62984, 62995, 63005, 63015, 63025, 63036, 63049, 63063,
+    63079, 63092, 63105, 63116, 63131, 63145, 63161, 63177, 63189, 63195,
+    63205, 63214, 63224, 63232, 63242, 63252, 63259, 63275, 63285, 63299,
+    63310, 63320, 63332, 63341, 63350, 63359, 63369, 63381, 63392, 63407,
+    63419, 63435, 63449, 63459, 63464, 63472, 63480, 63488, 63496, 63505,
+    63514, 63523, 63533, 63545, 63561, 63577, 63589, 63602, 63621, 63635,
+    63648, 63666, 63682, 63698, 63711, 63724, 63739, 63753, 63767, 63784,
+    63797, 63814, 63830, 63846, 63866, 63884, 63900, 63918, 63935, 63950,
+    63966, 63982, 63997, 64017, 64034, 64051, 64068, 64083, 64100, 64106,
+    64116, 64128, 64138, 64149, 64162, 64170, 64186, 64196, 64206, 64215,
+    64224, 64233, 64242, 64251, 64260, 64268, 64284, 64293, 64303, 64317,
+    64327, 64338, 64350, 64363, 64374, 64385, 64398, 64419, 64438, 64459,
+    64475, 64493, 64508, 64528, 64543, 64558, 64574, 64590, 64607, 64623,
+    64639, 64656, 64673, 64680, 64691, 64704, 64716, 64732, 64743, 64751,
+    64759, 64771, 64778, 64792, 64801, 64812, 64821, 64838, 64851, 64863,
+    64874, 64890, 64901, 64911, 64924, 64934, 64949, 64959, 64970, 64982,
+    64997, 65012, 65023, 65037, 65051, 65059, 65073, 65084, 65098, 65107,
+    65117, 65128, 65139, 65150, 65159, 65171, 65183, 65195, 65203, 65212,
+    65222, 65231, 65239, 65247, 65255, 65266, 65279, 65289, 65297, 65311,
+    65321, 65330, 65338, 65347, 65357, 65371, 65386, 65396, 65409, 65418,
+    65434, 65445, 65453, 65461, 65471, 65486, 65495, 65507, 65515, 65527,
+    65536, 65549, 65560, 65571, 65582, 65594, 65608, 65616, 65627, 65638,
+    65648, 65659, 65671, 65679, 65690, 65701, 65712, 65721, 65732, 65741,
+    65752, 65770, 65784, 65792, 65800, 65812, 65825, 65835, 65848, 65857,
+    65867, 65876, 65884, 65895, 65904, 65912, 65923, 65931, 65943, 65955,
+    65964, 65972, 65982, 65994, 66002, 66014, 66028, 66041, 66058, 66066,
+    66080, 66090, 66102, 66114, 66123, 66132, 66142, 66155, 66163, 66172,
+    66183, 66194, 66203, 66213, 66225, 66237, 66248, 66264, 66276, 66288,
+    66301, 66319, 66331, 66339, 66350, 66364, 66379, 66390, 66404, 66419,
+    66431, 66442, 66457, 66469, 66478, 66488, 66500, 66515, 66536, 66544,
+    66553, 66562, 66572, 66582, 66592, 66605, 66621, 66636, 66649, 66658,
+    66669, 66680, 66691, 66701, 66713, 66724, 66734, 66743, 66752, 66763,
+    66776, 66791, 66802, 66812, 66824, 66838, 66854, 66863, 66875, 66884,
+    66894, 66905, 66915, 66925, 66939, 66951, 66963, 66976, 66985, 66998,
+    67011, 67022, 67037, 67049, 67064, 67074, 67086, 67097, 67109, 67120,
+    67133, 67145, 67154, 67166, 67177, 67188, 67201, 67214, 67228, 67238,
+    67251, 67263, 67277, 67289, 67303, 67318, 67329, 67339, 67349, 67358,
+    67370, 67379, 67390, 67403, 67415, 67425, 67437, 67445, 67457, 67466,
+    67476, 67484, 67494, 67503, 67512, 67520, 67532, 67547, 67560, 67574,
+    67585, 67596, 67614, 67624, 67639, 67651, 67663, 67673, 67684, 67694,
+    67705, 67720, 67734, 67748, 67760, 67776, 67788, 67803, 67817, 67829,
+    67839, 67845, 67853, 67861, 67870, 67879, 67889, 67898, 67907, 67917,
+    67930, 67945, 67958, 67970, 67987, 67999, 68012, 68027, 68047, 68067,
+    68080, 68093, 68106, 68120, 68134, 68151, 68164, 68178, 68193, 68212,
+    68229, 68243, 68260, 68274, 68290, 68303, 68318, 68332, 68337, 68354,
+    68364, 68372, 68379, 68395, 68402, 68409, 68418, 68427, 68435, 68444,
+    68452, 68461, 68472, 68482, 68492, 68502, 68511, 68523, 68534, 68544,
+    68552, 68558, 68571, 68580, 68588, 68597, 68608, 68619, 68632, 68640,
+    68657, 68665, 68674, 68683, 68693, 68701, 68710, 68719, 68728, 68736,
+    68747, 68756, 68768, 68780, 68794, 68805, 68820, 68836, 68845, 68856,
+    68866, 68871, 68879, 68884, 68891, 68905, 68917, 68927, 68939, 68951,
+    68959, 68974, 68986, 68995, 69003, 69012, 69020, 69028, 69041, 69052,
+    69061, 69070, 69083, 69092, 69102, 69116, 69123, 69135, 69144, 69152,
+    69163, 69173, 69188, 69199, 69217, 69229, 69240, 69251, 69262, 69274,
+    69288, 69300, 69312, 69325, 69339, 69353, 69368, 69380, 69393, 69403,
+    69415, 69427, 69439, 69443, 69451, 69459, 69466, 69477, 69487, 69506,
+    69516, 69531, 69543, 69554, 69563, 69578, 69594, 69604, 69614, 69628,
+    69639, 69649, 69661, 69675, 69686, 69701, 69714, 69730, 69746, 69757,
+    69769, 69785, 69801, 69816, 69837, 69851, 69867, 69881, 69896, 69911,
+    69926, 69941, 69957, 69971, 69989, 70005, 70020, 70038, 70056, 70072,
+    70088, 70108, 70124, 70143, 70159, 70166, 70175, 70188, 70200, 70212,
+    70223, 70234, 70247, 70257, 70268, 70280, 70295, 70305, 70318, 70328,
+    70345, 70354, 70365, 70375, 70386, 70402, 70412, 70422, 70432, 70443,
+    70452, 70466, 70481, 70497, 70510, 70527, 70538, 70548, 70559, 70570,
+    70581, 70595, 70606, 70617, 70629, 70642, 70653, 70659, 70669, 70678,
+    70688, 70699, 70713, 70721, 70731, 70747, 70757, 70765, 70776, 70787,
+    70800, 70818, 70832, 70844, 70854, 70865, 70878, 70886, 70895, 70901,
+    70909, 70920, 70935, 70944, 70952, 70962, 70976, 70984, 70995, 71005,
+    71013, 71022, 71031, 71040, 71049, 71058, 71070, 71081, 71095, 71110,
+    71122, 71138, 71150, 71159, 71169, 71182, 71192, 71203, 71213, 71223,
+    71231, 71241, 71252, 71257, 71264, 71271, 71280, 71289, 71296, 71304,
+    71315, 71325, 71336, 71353, 71370, 71380, 71390, 71400, 71411, 71428,
+    71439, 71454, 71465, 71477, 71495, 71506, 71517, 71528, 71540, 71556,
+    71566, 71579, 71591, 71607, 71620, 71635, 71652, 71666, 71678, 71690,
+    71704, 71716, 71722, 71736, 71745, 71756, 71766, 71786, 71799, 71813,
+    71824, 71833, 71848, 71857, 71865, 71874, 71882, 71897, 71906, 71916,
+    71927, 71936, 71951, 71962, 71970, 71978, 71987, 71997, 72002, 72014,
+    72032, 72038, 72047, 72062, 72073, 72080, 72097, 72105, 72118, 72128,
+    72144, 72159, 72169, 72189, 72198, 72207, 72218, 72233, 72243, 72250,
+    72265, 72279, 72292, 72305, 72312, 72322, 72330, 72340, 72350, 72359,
+    72367, 72375, 72383, 72391, 72399, 72413, 72428, 72437, 72446, 72455,
+    72465, 72477, 72486, 72493, 72503, 72515, 72524, 72533, 72544, 72556,
+    72577, 72593, 72605, 72623, 72638, 72650, 72661, 72673, 72684, 72696,
+    72715, 72728, 72744, 72764, 72776, 72790, 72803, 72815, 72828, 72848,
+    72862, 72875, 72888, 72893, 72902, 72909, 72916, 72925, 72934, 72940,
+    72950, 72959, 72968, 72985, 72995, 73008, 73017, 73025, 73033, 73045,
+    73054, 73063, 73073, 73085, 73101, 73111, 73119, 73133, 73142, 73151,
+    73161, 73175, 73187, 73197, 73209, 73219, 73234, 73244, 73254, 73266,
+    73276, 73289, 73296, 73309, 73318, 73328, 73339, 73355, 73368, 73382,
+    73393, 73403, 73412, 73422, 73432, 73445, 73455, 73466, 73480, 73491,
+    73507, 73517, 73531, 73546, 73560, 73573, 73586, 73599, 73613, 73625,
+    73639, 73653, 73662, 73680, 73696, 73709, 73726, 73744, 73762, 73778,
+    73790, 73802, 73814, 73826, 73837, 73852, 73866, 73882, 73898, 73913,
+    73926, 73932, 73944, 73957, 73966, 73980, 73989, 74000, 74009, 74023,
+    74036, 74047, 74060, 74072, 74084, 74092, 74107, 74117, 74129, 74143,
+    74151, 74161, 74171, 74181, 74192, 74201, 74210, 74220, 74231, 74241,
+    74253, 74265, 74275, 74284, 74294, 74312, 74325, 74337, 74349, 74359,
+    74369, 74382, 74393, 74405, 74415, 74425, 74433, 74442, 74451, 74461,
+    74471, 74481, 74491, 74504, 74517, 74525, 74536, 74545, 74556, 74569,
+    74581, 74591, 74604, 74613, 74624, 74637, 74649, 74659, 74674, 74689,
+    74703, 74716, 74730, 74745, 74755, 74768, 74779, 74793, 74801, 74811,
+    74823, 74836, 74844, 74862, 74876, 74888, 74901, 74910, 74919, 74928,
+    74939, 74950, 74963, 74976, 74984, 74995, 75005, 75020, 75033, 75041,
+    75050, 75058, 75072, 75083, 75093, 75106, 75114, 75122, 75133, 75143,
+    75152, 75164, 75173, 75182, 75193, 75206, 75222, 75238, 75249, 75262,
+    75272, 75283, 75291, 75305, 75319, 75328, 75342, 75354, 75362, 75370,
+    75381, 75391, 75402, 75409, 75419, 75431, 75441, 75451, 75463, 75476,
+    75485, 75494, 75507, 75518, 75530, 75540, 75549, 75562, 75573, 75583,
+    75591, 75599, 75607, 75616, 75625, 75635, 75648, 75657, 75666, 75677,
+    75689, 75696, 75705, 75713, 75721, 75729, 75741, 75750, 75758, 75764,
+    75773, 75784, 75793, 75803, 75818, 75833, 75842, 75858, 75870, 75879,
+    75888, 75900, 75910, 75920, 75930, 75938, 75946, 75959, 75969, 75982,
+    75997, 76014, 76028, 76043, 76055, 76074, 76087, 76101, 76114, 76127,
+    76140, 76153, 76171, 76186, 76204, 76219, 76238, 76255, 76269, 76283,
+    76302, 76314, 76322, 76333, 76343, 76360, 76373, 76388, 76401, 76412,
+    76430, 76442, 76452, 76463, 76474, 76485, 76501, 76513, 76525, 76537,
+    76552, 76568, 76582, 76596, 76613, 76625, 76640, 76652, 76660, 76671,
+    76682, 76695, 76706, 76716, 76726, 76740, 76755, 76767, 76778, 76788,
+    76807, 76818, 76829, 76841, 76853, 76864, 76879, 76895, 76909, 76924,
+    76940, 76952, 76965, 76983, 76994, 77004, 77017, 77036, 77049, 77062,
+    77079, 77093, 77106, 77120, 77133, 77153, 77167, 77182, 77197, 77211,
+    77225, 77242, 77256, 77268, 77282, 77296, 77315, 77328, 77342, 77350,
+    77361, 77372, 77385, 77395, 77405, 77421, 77432, 77442, 77456, 77471,
+    77481, 77498, 77515, 77528, 77541, 77553, 77566, 77578, 77590, 77604,
+    77617, 77632, 77646, 77661, 77677, 77694, 77710, 77727, 77741, 77753,
+    77767, 77779, 77796, 77810, 77825, 77838, 77853, 77869, 77881, 77893,
+    77903, 77915, 77927, 77940, 77961, 77976, 77992, 78008, 78024, 78040,
+    78055, 78075, 78094, 78111, 78130, 78145, 78163, 78180, 78193, 78208,
+    78224, 78240, 78256, 78271, 78279, 78290, 78300, 78311, 78322, 78335,
+    78356, 78367, 78377, 78387, 78401, 78416, 78427, 78438, 78450, 78463,
+    78478, 78491, 78503, 78514, 78525, 78541, 78555, 78567, 78582, 78595,
+    78607, 78617, 78628, 78640, 78648, 78659, 78672, 78683, 78701, 78716,
+    78727, 78737, 78749, 78760, 78779, 78791, 78804, 78816, 78828, 78842,
+    78854, 78866, 78875, 78891, 78904, 78919, 78936, 78948, 78964, 78982,
+    78998, 79011, 79022, 79035, 79046, 79058, 79077, 79097, 79109, 79121,
+    79133, 79146, 79159, 79172, 79184, 79202, 79215, 79230, 79246, 79263,
+    79276, 79290, 79303, 79317, 79330, 79343, 79356, 79369, 79380, 79395,
+    79412, 79421, 79435, 79448, 79461, 79472, 79481, 79493, 79511, 79525,
+    79537, 79549, 79562, 79573, 79585, 79597, 79609, 79620, 79634, 79649,
+    79664, 79678, 79696, 79714, 79725, 79738, 79751, 79766, 79781, 79794,
+    79806, 79818, 79831, 79845, 79858, 79873, 79886, 79901, 79917, 79926,
+    79941, 79951, 79965, 79975, 79990, 80008, 80022, 80038, 80048, 80062,
+    80074, 80087, 80098, 80108, 80123, 80138, 80147, 80161, 80171, 80182,
+    80197, 80208, 80218, 80232, 80242, 80252, 80262, 80272, 80284, 80299,
+    80311, 80327, 80339, 80350, 80360, 80371, 80383, 80393, 80406, 80416,
+    80428, 80443, 80454, 80472, 80487, 80498, 80510, 80522, 80532, 80549,
+    80562, 80577, 80591, 80603, 80615, 80627, 80640, 80659, 80679, 80689,
+    80701, 80715, 80727, 80737, 80748, 80759, 80772, 80783, 80798, 80809,
+    80823, 80838, 80848, 80859, 80872, 80882, 80893, 80908, 80921, 80931,
+    80942, 80953, 80963, 80972, 80982, 80995, 81009, 81019, 81030, 81041,
+    81049, 81059, 81070, 81080, 81092, 81103, 81115, 81129, 81145, 81163,
+    81173, 81189, 81201, 81213, 81227, 81241, 81251, 81264, 81274, 81285,
+    81298, 81312, 81324, 81344, 81358, 81374, 81389, 81403, 81416, 81430,
+    81445, 81460, 81473, 81483, 81498, 81514, 81524, 81539, 81553, 81570,
+    81581, 81595, 81606, 81622, 81635, 81652, 81667, 81678, 81692, 81704,
+    81717, 81730, 81743, 81760, 81774, 81785, 81796, 81808, 81829, 81843,
+    81861, 81878, 81895, 81913, 81928, 81942, 81954, 81968, 81983, 81998,
+    82016, 82027, 82044, 82057, 82073, 82086, 82100, 82117, 82129, 82140,
+    82151, 82164, 82175, 82188, 82199, 82218, 82230, 82249, 82260, 82278,
+    82293, 82305, 82317, 82331, 82345, 82356, 82368, 82379, 82394, 82406,
+    82419, 82435, 82450, 82462, 82478, 82494, 82513, 82527, 82541, 82557,
+    82569, 82581, 82594, 82607, 82622, 82639, 82651, 82665, 82678, 82693,
+    82708, 82721, 82732, 82746, 82761, 82772, 82787, 82800, 82812, 82824,
+    82838, 82854, 82868, 82880, 82894, 82909, 82925, 82941, 82952, 82965,
+    82976, 82990, 83001, 83017, 83029, 83046, 83056, 83068, 83082, 83093,
+    83103, 83114, 83126, 83136, 83147, 83163, 83179, 83190, 83197, 83207,
+    83221, 83231, 83240, 83256, 83265, 83275, 83286, 83297, 83306, 83316,
+    83326, 83337, 83350, 83361, 83374, 83384, 83398, 83409, 83421, 83430,
+    83441, 83446, 83454, 83462, 83470, 83478, 83485, 83494, 83503, 83511,
+    83524, 83538, 83549, 83559, 83570, 83582, 83594, 83605, 83616, 83628,
+    83640, 83653, 83667, 83679, 83691, 83703, 83715, 83727, 83739, 83749,
+    83758, 83771, 83782, 83794, 83806, 83824, 83842, 83858, 83869, 83882,
+    83895, 83906, 83924, 83943, 83955, 83967, 83980, 83995, 84016, 84032,
+    84047, 84063, 84079, 84092, 84109, 84126, 84142, 84155, 84166, 84179,
+    84193, 84210, 84225, 84237, 84250, 84260, 84278, 84296, 84309, 84322,
+    84336, 84355, 84373, 84387, 84403, 84418, 84432, 84449, 84464, 84478,
+    84494, 84513, 84526, 84540, 84553, 84567, 84573, 84583, 84592, 84600,
+    84609, 84616, 84622, 84630, 84640, 84649, 84659, 84669, 84678, 84683,
+    84692, 84702, 84711, 84719, 84726, 84735, 84747, 84761, 84776, 84783,
+    84797, 84806, 84816, 84825, 84838, 84848, 84864, 84874, 84884, 84896,
+    84907, 84918, 84929, 84940, 84951, 84962, 84972, 84984, 84992, 85002,
+    85009, 85017, 85023, 85029, 85039, 85047, 85058, 85068, 85081, 85090,
+    85099, 85113, 85123, 85132, 85143, 85154, 85165, 85178, 85192, 85202,
+    85211, 85223, 85230, 85239, 85252, 85262, 85275, 85284, 85295, 85302,
+    85311, 85320, 85330, 85338, 85349, 85357, 85368, 85374, 85383, 85394,
+    85402, 85409, 85417, 85430, 85437, 85447, 85457, 85467, 85477, 85490,
+    85502, 85516, 85525, 85537, 85549, 85561, 85573, 85586, 85596, 85606,
+    85615, 85624, 85632, 85640, 85648, 85655, 85664, 85675, 85682, 85691,
+    85699, 85710, 85721, 85732, 85740, 85749, 85756, 85767, 85777, 85787,
+    85797, 85809, 85818, 85827, 85838, 85852, 85862, 85872, 85882, 85892,
+    85909, 85920, 85932, 85943, 85953, 85966, 85983, 85994, 86005, 86017,
+    86026, 86037, 86048, 86056, 86064, 86076, 86086, 86096, 86106, 86116,
+    86129, 86138, 86145, 86156, 86164, 86175, 86186, 86197, 86209, 86219,
+    86230, 86242, 86254, 86266, 86275, 86285, 86296, 86307, 86317, 86327,
+    86336, 86348, 86368, 86382, 86398, 86410, 86421, 86440, 86453, 86466,
+    86478, 86489, 86501, 86512, 86531, 86543, 86557, 86575, 86588, 86606,
+    86622, 86635, 86648, 86659, 86666, 86676, 86687, 86694, 86701, 86712,
+    86732, 86745, 86758, 86772, 86790, 86805, 86819, 86833, 86848, 86865,
+    86880, 86895, 86911, 86924, 86937, 86947, 86958, 86967, 86984, 86995,
+    87007, 87019, 87030, 87042, 87058, 87076, 87089, 87101, 87116, 87130,
+    87141, 87155, 87166, 87174, 87182, 87192, 87203, 87215, 87225, 87232,
+    87243, 87258, 87271, 87285, 87294, 87303, 87316, 87326, 87340, 87350,
+    87360, 87370, 87380, 87390, 87401, 87413, 87423, 87437, 87450, 87462,
+    87476, 87492, 87505, 87518, 87531, 87545, 87559, 87568, 87578, 87590,
+    87599, 87606, 87614, 87621, 87628, 87636, 87647, 87659, 87672, 87685,
+    87695, 87702, 87713, 87719, 87726, 87733, 87741, 87748, 87755, 87762,
+    87770, 87776, 87786, 87796, 87807, 87816, 87828, 87837, 87846, 87860,
+    87872, 87882, 87896, 87909, 87919, 87931, 87949, 87958, 87971, 87982,
+    87995, 88005, 88015, 88027, 88037, 88047, 88052, 88059, 88066, 88075,
+    88082, 88090, 88098, 88106, 88114, 88123, 88136, 88143, 88152, 88164,
+    88174, 88186, 88197, 88206, 88219, 88231, 88240, 88248, 88259, 88276,
+    88292, 88303, 88320, 88330, 88340, 88352, 88369, 88379, 88390, 88402,
+    88414, 88430, 88447, 88459, 88474, 88486, 88501, 88517, 88527, 88539,
+    88549, 88560, 88576, 88588, 88600, 88607, 88618, 88627, 88643, 88659,
+    88669, 88684, 88694, 88704, 88715, 88728, 88742, 88755, 88771, 88784,
+    88798, 88809, 88820, 88828, 88839, 88856, 88875, 88885, 88897, 88909,
+    88920, 88936, 88954, 88966, 88977, 88987, 88998, 89017, 89028, 89043,
+    89058, 89069, 89082, 89095, 89105, 89117, 89128, 89143, 89157, 89172,
+    89187, 89194, 89208, 89218, 89230, 89243, 89257, 89271, 89283, 89293,
+    89309, 89319, 89330, 89340, 89350, 89361, 89371, 89382, 89395, 89410,
+    89419, 89431, 89442, 89453, 89467, 89480, 89500, 89512, 89526, 89545,
+    89558, 89572, 89588, 89601, 89617, 89631, 89644, 89655, 89660, 89668,
+    89675, 89682, 89690, 89697, 89705, 89714, 89722, 89730, 89735, 89742,
+    89750, 89759, 89771, 89783, 89799, 89808, 89818, 89830, 89839, 89852,
+    89860, 89870, 89885, 89895, 89913, 89926, 89938, 89950, 89963, 89980,
+    89991, 90004, 90017, 90028, 90043, 90055, 90066, 90077, 90089, 90100,
+    90109, 90118, 90129, 90143, 90155, 90167, 90178, 90187, 90201, 90213,
+    90223, 90242, 90257, 90270, 90283, 90296, 90306, 90316, 90329, 90345,
+    90359, 90374, 90385, 90400, 90412, 90422, 90439, 90456, 90466, 90475,
+    90484, 90495, 90504, 90516, 90526, 90539, 90549, 90563, 90580, 90592,
+    90604, 90616, 90627, 90638, 90653, 90666, 90676, 90685, 90696, 90705,
+    90717, 90728, 90740, 90753, 90762, 90776, 90786, 90798, 90808, 90818,
+    90830, 90840, 90852, 90861, 90871, 90881, 90892, 90902, 90910, 90925,
+    90935, 90948, 90960, 90972, 90985, 90998, 91008, 91021, 91034, 91046,
+    91056, 91061, 91068, 91077, 91084, 91093, 91100, 91112, 91126, 91143,
+    91154, 91164, 91175, 91193, 91208, 91223, 91241, 91253, 91266, 91279,
+    91293, 91309, 91324, 91339, 91355, 91368, 91382, 91388, 91396, 91405,
+    91414, 91424, 91434, 91443, 91451, 91463, 91476, 91492, 91513, 91524,
+    91535, 91546, 91563, 91575, 91586, 91598, 91611, 91628, 91642, 91654,
+    91667, 91682, 91694, 91705, 91717, 91721, 91727, 91735, 91743, 91748,
+    91755, 91763, 91777, 91789, 91796, 91804, 91811, 91822, 91831, 91839,
+    91853, 91861, 91868, 91884, 91892, 91900, 91908, 91917, 91924, 91935,
+    91946, 91955, 91964, 91977, 91993, 92009, 92020, 92032, 92047, 92059,
+    92071, 92084, 92095, 92111, 92125, 92141, 92155, 92171, 92188, 92203,
+    92218, 92233, 92246, 92258, 92271, 92285, 92298, 92310, 92321, 92330,
+    92341, 92352, 92362, 92367, 92375, 92382, 92399, 92413, 92423, 92431,
+    92446, 92453, 92464, 92473, 92481, 92489, 92505, 92514, 92522, 92531,
+    92543, 92554, 92567, 92579, 92586, 92593, 92603, 92615, 92622, 92631,
+    92649, 92668, 92681, 92691, 92701, 92715, 92731, 92740, 92750, 92760,
+    92770, 92783, 92793, 92805, 92820, 92831, 92845, 92857, 92862, 92869,
+    92878, 92886, 92893, 92902, 92906, 92914, 92920, 92926, 92933, 92940,
+    92947, 92955, 92962, 92971, 92981, 92991, 93002, 93011, 93022, 93030,
+    93040, 93052, 93068, 93078, 93089, 93101, 93112, 93124, 93135, 93147,
+    93163, 93174, 93185, 93197, 93208, 93219, 93232, 93248, 93264, 93278,
+    93293, 93305, 93322, 93336, 93348, 93359, 93368, 93380, 93397, 93416,
+    93427, 93438, 93450, 93461, 93480, 93493, 93505, 93518, 93530, 93542,
+    93555, 93568, 93583, 93599, 93612, 93625, 93639, 93656, 93669, 93687,
+    93696, 93708, 93724, 93741, 93754, 93766, 93777, 93790, 93803, 93814,
+    93826, 93838, 93851, 93866, 93881, 93896, 93912, 93925, 93938, 93951,
+    93968, 93979, 93984, 93992, 93999, 94007, 94017, 94035, 94052, 94068,
+    94086, 94105, 94117, 94130, 94149, 94161, 94181, 94193, 94211, 94224,
+    94239, 94253, 94268, 94284, 94300, 94317, 94326, 94332, 94349, 94363,
+    94372, 94385, 94396, 94404, 94412, 94427, 94436, 94446, 94462, 94474,
+    94484, 94494, 94510, 94519, 94528, 94537, 94546, 94563, 94578, 94591,
+    94600, 94609, 94622, 94638, 94648, 94662, 94678, 94686, 94696, 94707,
+    94713, 94722, 94730, 94742, 94751, 94761, 94773, 94782, 94790, 94803,
+    94814, 94829, 94838, 94847, 94859, 94870, 94883, 94893, 94905, 94911,
+    94919, 94933, 94948, 94963, 94974, 94990, 95001, 95012, 95023, 95035,
+    95045, 95057, 95071, 95083, 95098, 95115, 95129, 95143, 95155, 95170,
+    95187, 95199, 95211, 95220, 95230, 95240, 95248, 95256, 95272, 95289,
+    95300, 95317, 95328, 95341, 95351, 95363, 95379, 95390, 95401, 95414,
+    95426, 95446, 95461, 95476, 95486, 95502, 95514, 95520, 95528, 95537,
+    95545, 95555, 95565, 95575, 95581, 95590, 95601, 95613, 95626, 95642,
+    95656, 95668, 95680, 95695, 95708, 95720, 95733, 95745, 95757, 95769,
+    95783, 95799, 95812, 95827, 95839, 95851, 95865, 95882, 95898, 95909,
+    95924, 95937, 95949, 95963, 95972, 95980, 95990, 95998, 96006, 96016,
+    96022, 96031, 96040, 96050, 96058, 96073, 96082, 96091, 96100, 96115,
+    96125, 96137, 96154, 96168, 96183, 96193, 96206, 96216, 96227, 96237,
+    96242, 96251, 96258, 96265, 96273, 96281, 96290, 96299, 96308, 96313,
+    96323, 96330, 96338, 96346, 96355, 96363, 96381, 96395, 96405, 96416,
+    96428, 96440, 96452, 96464, 96474, 96488, 96505, 96517, 96532, 96544,
+    96556, 96569, 96587, 96602, 96614, 96627, 96633, 96646, 96655, 96664,
+    96677, 96696, 96704, 96712, 96722, 96731, 96741, 96752, 96764, 96774,
+    96784, 96794, 96803, 96815, 96826, 96838, 96848, 96863, 96873, 96881,
+    96890, 96900, 96909, 96922, 96937, 96949, 96970, 96984, 96999, 97011,
+    97023, 97035, 97047, 97060, 97073, 97084, 97097, 97109, 97125, 97141,
+    97158, 97175, 97192, 97207, 97226, 97239, 97250, 97263, 97277, 97290,
+    97303, 97313, 97327, 97346, 97364, 97380, 97392, 97405, 97418, 97432,
+    97450, 97463, 97480, 97498, 97513, 97527, 97541, 97557, 97576, 97590,
+    97604, 97618, 97633, 97647, 97659, 97667, 97679, 97690, 97707, 97718,
+    97732, 97746, 97759, 97769, 97782, 97792, 97806, 97818, 97828, 97847,
+    97858, 97869, 97880, 97891, 97904, 97920, 97936, 97948, 97961, 97973,
+    97983, 97996, 98008, 98014, 98023, 98032, 98043, 98057, 98073, 98087,
+    98096, 98104, 98119, 98132, 98141, 98154, 98162, 98177, 98186, 98197,
+    98213, 98227, 98240, 98251, 98264, 98277, 98289, 98299, 98309, 98322,
+    98334, 98344, 98359, 98375, 98388, 98397, 98408, 98419, 98427, 98435,
+    98448, 98455, 98464, 98474, 98482, 98493, 98502, 98519, 98530, 98542,
+    98554, 98568, 98580, 98587, 98597, 98609, 98624, 98638, 98650, 98665,
+    98674, 98684, 98694, 98706, 98717, 98727, 98740, 98748, 98758, 98772,
+    98782, 98793, 98801, 98809, 98819, 98832, 98840, 98851, 98860, 98872,
+    98883, 98898, 98909, 98923, 98934, 98944, 98955, 98965, 98975, 98984,
+    98994, 99005, 99015, 99028, 99037, 99046, 99054, 99062, 99073, 99088,
+    99098, 99107, 99115, 99128, 99140, 99149, 99162, 99173, 99186, 99197,
+    99210, 99226, 99237, 99251, 99266, 99281, 99293, 99304, 99314, 99327,
+    99338, 99349, 99359, 99375, 99383, 99393, 99405, 99413, 99421, 99433,
+    99445, 99456, 99466, 99474, 99484, 99492, 99501, 99511, 99525, 99533,
+    99540, 99553, 99561, 99570, 99578, 99586, 99595, 99604, 99612, 99620,
+    99631, 99641, 99651, 99663, 99675, 99687, 99697, 99711, 99724, 99738,
+    99750, 99768, 99778, 99793, 99804, 99817, 99827, 99841, 99850, 99864,
+    99873, 99884, 99904, 99923, 99938, 99951, 99966, 99980, 99994, 100010,
+    100024, 100036, 100049, 100062, 100077, 100091, 100106, 100123, 100136, 100147,
+    100159, 100174, 100184, 100196, 100212, 100222, 100235, 100254, 100269, 100279,
+    100290, 100302, 100314, 100329, 100341, 100357, 100370, 100382, 100396, 100410,
+    100427, 100443, 100460, 100474, 100493, 100507, 100519, 100529, 100539, 100552,
+    100566, 100576, 100586, 100599, 100612, 100624, 100635, 100648, 100659, 100675,
+    100685, 100696, 100706, 100718, 100735, 100750, 100762, 100774, 100792, 100805,
+    100815, 100825, 100835, 100847, 100864, 100875, 100885, 100900, 100911, 100924,
+    100936, 100951, 100969, 100980, 100993, 101008, 101021, 101034, 101048, 101060,
+    101070, 101084, 101099, 101110, 101122, 101136, 101146, 101158, 101172, 101182,
+    101194, 101204, 101218, 101228, 101242, 101259, 101276, 101295, 101305, 101315,
+    101325, 101336, 101348, 101359, 101375, 101386, 101397, 101411, 101422, 101435,
+    101449, 101462, 101472, 101486, 101497, 101510, 101523, 101534, 101545, 101553,
+    101565, 101576, 101586, 101604, 101616, 101628, 101638, 101651, 101663, 101676,
+    101695, 101706, 101717, 101729, 101739, 101754, 101766, 101781, 101792, 101804,
+    101818, 101830, 101842, 101858, 101868, 101880, 101887, 101897, 101911, 101922,
+    101938, 101950, 101960, 101971, 101981, 101992, 102001, 102018, 102028, 102037,
+    102048, 102060, 102070, 102080, 102092, 102105, 102116, 102132, 102143, 102155,
+    102165, 102176, 102187, 102192, 102200, 102209, 102219, 102233, 102246, 102261,
+    102273, 102287, 102299, 102312, 102326, 102336, 102350, 102365, 102377, 102398,
+    102418, 102432, 102446, 102459, 102472, 102485, 102498, 102512, 102524, 102545,
+    102564, 102580, 102596, 102614, 102633, 102646, 102661, 102679, 102693, 102707,
+    102718, 102732, 102746, 102760, 102776, 102793, 102807, 102821, 102841, 102856,
+    102873, 102888, 102903, 102922, 102936, 102950, 102964, 102979, 102996, 103015,
+    103030, 103044, 103058, 103076, 103091, 103105, 103110, 103117, 103126, 103135,
+    103140, 103153, 103167, 103175, 103184, 103197, 103205, 103219, 103226, 103234,
+    103245, 103259, 103268, 103278, 103288, 103297, 103308, 103319, 103328, 103338,
+    103347, 103356, 103361, 103371, 103385, 103398, 103406, 103414, 103422, 103431,
+    103439, 103455, 103463, 103472, 103482, 103492, 103501, 103513, 103527, 103535,
+    103542, 103553, 103565, 103580, 103594, 103608, 103618, 103627, 103645, 103654,
+    103665, 103677, 103695, 103705, 103715, 103728, 103739, 103752, 103762, 103773,
+    103786, 103801, 103814, 103825, 103838, 103848, 103854, 103863, 103878, 103888,
+    103908, 103921, 103932, 103942, 103951, 103961, 103981, 103991, 104001, 104012,
+    104022, 104032, 104045, 104055, 104065, 104074, 104087, 104097, 104103, 104113,
+    104122, 104131, 104141, 104151, 104161, 104166, 104174, 104186, 104194, 104205,
+    104218, 104227, 104237, 104245, 104253, 104262, 104275, 104287, 104302, 104313,
+    104323, 104336, 104345, 104354, 104364, 104369, 104377, 104384, 104392, 104397,
+    104409, 104417, 104431, 104445, 104454, 104466, 104475, 104482, 104493, 104502,
+    104513, 104521, 104533, 104546, 104555, 104568, 104578, 104585, 104592, 104600,
+    104609, 104619, 104625, 104633, 104651, 104660, 104668, 104681, 104689, 104699,
+    104715, 104725, 104734, 104744, 104752, 104763, 104783, 104792, 104801, 104810,
+    104820, 104831, 104842, 104850, 104866, 104872, 104885, 104894, 104909, 104926,
+    104937, 104949, 104962, 104970, 104978, 104990, 104999, 105009, 105018, 105030,
+    105042, 105058, 105071, 105086, 105101, 105112, 105125, 105138, 105150, 105161,
+    105181, 105193, 105205, 105217, 105230, 105244, 105257, 105274, 105287, 105306,
+    105322, 105338, 105350, 105363, 105372, 105381, 105390, 105398, 105410, 105422,
+    105440, 105453, 105468, 105481, 105495, 105507, 105517, 105525, 105535, 105549,
+    105563, 105580, 105592, 105603, 105613, 105627, 105636, 105656, 105675, 105688,
+    105700, 105716, 105729, 105738, 105752, 105769, 105786, 105801, 105813, 105825,
+    105838, 105848, 105860, 105873, 105883, 105893, 105904, 105915, 105931, 105945,
+    105955, 105968, 105979, 105989, 105999, 106009, 106023, 106035, 106048, 106065,
+    106075, 106089, 106103, 106119, 106130, 106142, 106155, 106165, 106175, 106189,
+    106204, 106222, 106233, 106244, 106254, 106267, 106276, 106287, 106300, 106311,
+    106323, 106338, 106348, 106362, 106377, 106390, 106402, 106423, 106435, 106448,
+    106468, 106482, 106495, 106507, 106521, 106534, 106550, 106564, 106578, 106593,
+    106607, 106621, 106639, 106656, 106668, 106682, 106697, 106708, 106723, 106738,
+    106751, 106769, 106782, 106796, 106809, 106821, 106835, 106851, 106864, 106879,
+    106891, 106903, 106916, 106928, 106942, 106952, 106964, 106973, 106983, 106995,
+    107007, 107016, 107029, 107042, 107052, 107062, 107075, 107089, 107104, 107117,
+    107128, 107138, 107148, 107158, 107169, 107178, 107191, 107204, 107214, 107223,
+    107237, 107246, 107256, 107267, 107281, 107292, 107299, 107310, 107329, 107339,
+    107351, 107367, 107381, 107392, 107402, 107414, 107424, 107434, 107444, 107459,
+    107470, 107481, 107493, 107505, 107518, 107533, 107547, 107561, 107572, 107581,
+    107594, 107605, 107615, 107626, 107636, 107649, 107663, 107682, 107698, 107716,
+    107733, 107752, 107764, 107781, 107795, 107808, 107820, 107833, 107846, 107860,
+    107875, 107888, 107901, 107917, 107931, 107945, 107959, 107973, 107987, 107993,
+    108002, 108015, 108023, 108032, 108042, 108057, 108066, 108075, 108084, 108094,
+    108109, 108120, 108135, 108149, 108162, 108172, 108183, 108192, 108201, 108205,
+    108211, 108217, 108225, 108238, 108250, 108264, 108273, 108288, 108302, 108317,
+    108334, 108348, 108358, 108371, 108386, 108399, 108409, 108420, 108430, 108444,
+    108464, 108477, 108488, 108502, 108521, 108534, 108549, 108562, 108579, 108595,
+    108608, 108621, 108630, 108644, 108661, 108673, 108686, 108700, 108719, 108734,
+    108745, 108758, 108771, 108784, 108796, 108811, 108821, 108833, 108845, 108855,
+    108870, 108884, 108894, 108905, 108916, 108936, 108950, 108965, 108974, 108988,
+    108998, 109010, 109021, 109031, 109042, 109052, 109066, 109076, 109089, 109106,
+    109119, 109133, 109145, 109159, 109172, 109183, 109194, 109204, 109220, 109231,
+    109241, 109251, 109266, 109277, 109292, 109307, 109317, 109335, 109345, 109359,
+    109374, 109387, 109400, 109414, 109427, 109444, 109455, 109468, 109480, 109492,
+    109504, 109518, 109532, 109544, 109557, 109569, 109582, 109594, 109608, 109618,
+    109628, 109642, 109653, 109666, 109681, 109692, 109703, 109713, 109725, 109741,
+    109757, 109768, 109782, 109792, 109806, 109821, 109833, 109844, 109854, 109865,
+    109875, 109888, 109898, 109909, 109921, 109932, 109942, 109951, 109962, 109972,
+    109984, 109995, 110004, 110015, 110023, 110031, 110038, 110046, 110057, 110063,
+    110072, 110079, 110095, 110106, 110116, 110129, 110142, 110153, 110167, 110182,
+    110193, 110204, 110220, 110235, 110246, 110260, 110273, 110286, 110299, 110314,
+    110327, 110341, 110357, 110370, 110382, 110396, 110408, 110417, 110435, 110444,
+    110456, 110469, 110481, 110497, 110507, 110517, 110531, 110541, 110555, 110570,
+    110586, 110597, 110609, 110620, 110640, 110657, 110677, 110693, 110703, 110718,
+    110733, 110747, 110760, 110771, 110782, 110792, 110808, 110820, 110832, 110848,
+    110858, 110869, 110885, 110896, 110914, 110928, 110941, 110954, 110966, 110984,
+    110995, 111005, 111018, 111032, 111043, 111054, 111067, 111080, 111094, 111105,
+    111119, 111129, 111140, 111149, 111159, 111171, 111182, 111193, 111207, 111222,
+    111237, 111251, 111266, 111276, 111289, 111301, 111316, 111326, 111336, 111348,
+    111362, 111377, 111387, 111398, 111412, 111427, 111439, 111454, 111465, 111483,
+    111494, 111507, 111517, 111528, 111541, 111554, 111564, 111575, 111587, 111598,
+    111612, 111624, 111634, 111647, 111658, 111669, 111679, 111688, 111697, 111705,
+    111722, 111734, 111745, 111760, 111775, 111791, 111806, 111823, 111837, 111851,
+    111865, 111883, 111901, 111920, 111938, 111953, 111969, 111983, 111997, 112012,
+    112019, 112026, 112036, 112047, 112054, 112066, 112077, 112084, 112093, 112104,
+    112113, 112123, 112132, 112140, 112149, 112163, 112173, 112180, 112189, 112199,
+    112214, 112224, 112233, 112242, 112253, 112261, 112271, 112279, 112290, 112298,
+    112308, 112318, 112328, 112343, 112353, 112363, 112375, 112383, 112393, 112402,
+    112414, 112423, 112431, 112440, 112450, 112459, 112469, 112478, 112488, 112499,
+    112507, 112517, 112528, 112536, 112544, 112553, 112566, 112573, 112580, 112589,
+    112596, 112605, 112618, 112624, 112634, 112642, 112648, 112655, 112667, 112673,
+    112680, 112688, 112700, 112711, 112720, 112730, 112742, 112753, 112761, 112771,
+    112778, 112786, 112794, 112805, 112816, 112823, 112832, 112839, 112849, 112859,
+    112867, 112876, 112888, 112900, 112910, 112923, 112932, 112941, 112952, 112958,
+    112969, 112985, 112995, 113003, 113012, 113022, 113031, 113040, 113049, 113061,
+    113073, 113083, 113094, 113103, 113113, 113121, 113131, 113143, 113150, 113157,
+    113164, 113183, 113189, 113196, 113207, 113217, 113229, 113240, 113251, 113262,
+    113272, 113281, 113294, 113303, 113315, 113322, 113332, 113341, 113349, 113356,
+    113365, 113375, 113382, 113391, 113403, 113411, 113419, 113429, 113443, 113454,
+    113462, 113470, 113478, 113485, 113493, 113504, 113512, 113524, 113534, 113549,
+    113568, 113579, 113593, 113601, 113613, 113624, 113635, 113644, 113655, 113663,
+    113673, 113683, 113693, 113701, 113712, 113722, 113734, 113747, 113758, 113769,
+    113776, 113788, 113799, 113809, 113819, 113834, 113849, 113858, 113868, 113877,
+    113885, 113892, 113899, 113906, 113915, 113923, 113933, 113943, 113954, 113962,
+    113968, 113975, 113982, 113990, 114001, 114011, 114019, 114030, 114034, 114040,
+    114047, 114055, 114062, 114068, 114077, 114086, 114099, 114107, 114116, 114125,
+    114134, 114148, 114161, 114169, 114178, 114187, 114198, 114208, 114216, 114231,
+    114240, 114251, 114263, 114275, 114285, 114299, 114310, 114319, 114339, 114356,
+    114374, 114390, 114407, 114419, 114437, 114448, 114461, 114472, 114484, 114497,
+    114513, 114529, 114541, 114554, 114562, 114572, 114587, 114602, 114612, 114624,
+    114635, 114645, 114656, 114667, 114679, 114695, 114710, 114726, 114741, 114755,
+    114761, 114771, 114782, 114796, 114813, 114822, 114831, 114840, 114850, 114861,
+    114871, 114881, 114896, 114905, 114919, 114929, 114939, 114950, 114963, 114973,
+    114982, 114992, 115000, 115012, 115025, 115036, 115047, 115057, 115069, 115080,
+    115090, 115101, 115112, 115123, 115137, 115149, 115166, 115177, 115196, 115216,
+    115232, 115246, 115259, 115275, 115285, 115298, 115303, 115310, 115319, 115324,
+    115332, 115339, 115347, 115355, 115364, 115373, 115378, 115386, 115394, 115402,
+    115411, 115420, 115429, 115433, 115441, 115448, 115459, 115467, 115478, 115483,
+    115490, 115497, 115506, 115515, 115521, 115534, 115540, 115547, 115556, 115564,
+    115571, 115580, 115588, 115597, 115609, 115620, 115628, 115636, 115642, 115651,
+    115659, 115667, 115675, 115685, 115691, 115704, 115712, 115723, 115731, 115741,
+    115751, 115762, 115782, 115796, 115805, 115819, 115830, 115841, 115852, 115866,
+    115879, 115894, 115904, 115919, 115928, 115933, 115942, 115950, 115963, 115971,
+    115990, 116000, 116011, 116024, 116031, 116040, 116051, 116058, 116071, 116079,
+    116087, 116096, 116105, 116116, 116124, 116137, 116148, 116157, 116166, 116179,
+    116188, 116195, 116204, 116212, 116221, 116225, 116231, 116240, 116248, 116254,
+    116268, 116275, 116281, 116287, 116294, 116301, 116313, 116319, 116334, 116346,
+    116355, 116362, 116370, 116385, 116396, 116406, 116416, 116427, 116437, 116445,
+    116450, 116457, 116464, 116472, 116481, 116490, 116497, 116505, 116524, 116541,
+    116552, 116564, 116581, 116591, 116606, 116618, 116629, 116640, 116652, 116662,
+    116676, 116688, 116702, 116718, 116733, 116745, 116760, 116772, 116784, 116794,
+    116806, 116811, 116824, 116838, 116849, 116857, 116864, 116872, 116880, 116889,
+    116899, 116908, 116927, 116942, 116950, 116958, 116966, 116977, 116990, 117001,
+    117010, 117019, 117029, 117038, 117045, 117060, 117068, 117081, 117090, 117095,
+    117103, 117110, 117118, 117126, 117135, 117143, 117152, 117157, 117165, 117173,
+    117181, 117188, 117196, 117205, 117214, 117220, 117229, 117238, 117248, 117258,
+    117264, 117274, 117283, 117291, 117300, 117310, 117319, 117329, 117333, 117339,
+    117346, 117351, 117360, 117368, 117375, 117382, 117388, 117403, 117414, 117431,
+    117440, 117448, 117456, 117465, 117478, 117488, 117500, 117509, 117520, 117530,
+    117542, 117554, 117566, 117578, 117592, 117605, 117614, 117627, 117632, 117645,
+    117653, 117667, 117678, 117696, 117710, 117725, 117732, 117740, 117748, 117756,
+    117767, 117775, 117785, 117802, 117814, 117823, 117832, 117842, 117851, 117858,
+    117867, 117876, 117881, 117888, 117896, 117908, 117920, 117932, 117943, 117951,
+    117958, 117970, 117979, 117986, 117994, 118002, 118011, 118020, 118037, 118045,
+    118058, 118070, 118079, 118089, 118099, 118108, 118115, 118124, 118134, 118141,
+    118150, 118156, 118165, 118174, 118187, 118199, 118208, 118218, 118227, 118235,
+    118251, 118263, 118271, 118282, 118291, 118302, 118312, 118321, 118330, 118343,
+    118353, 118366, 118376, 118386, 118394, 118404, 118410, 118418, 118428, 118437,
+    118446, 118456, 118466, 118471, 118479, 118490, 118503, 118519, 118526, 118534,
+    118542, 118549, 118558, 118567, 118576, 118585, 118596, 118605, 118618, 118631,
+    118643, 118652, 118660, 118669, 118681, 118687, 118696, 118707, 118717, 118730,
+    118742, 118750, 118759, 118769, 118779, 118788, 118796, 118806, 118815, 118824,
+    118834, 118844, 118854, 118870, 118882, 118892, 118910, 118919, 118932, 118944,
+    118954, 118964, 118976, 118986, 118996, 119004, 119012, 119022, 119032, 119042,
 };
 
+// Length of each word, without the NUL
+const uint8_t DICTIONARY_LENGTHS[10000] = {
+    4, 9, 7, 6, 6, 10, 14, 14, 13, 14, 11, 13, 12, 16, 10, 9, 9, 9, 9, 10,
+    10, 9, 13, 14, 12, 13, 8, 13, 10, 10, 8, 19, 13, 12, 18, 13, 12, 17, 13, 11,
+    11, 16, 10, 15, 14, 17, 15, 12, 14, 7, 9, 14, 16, 18, 9, 14, 10, 11, 10, 12,
+    15, 11, 13, 11, 14, 15, 11, 13, 16, 15, 9, 10, 12, 3, 5, 5, 7, 7, 11, 10,
+    15, 11, 14, 16, 10, 11, 9, 11, 10, 11, 10, 10, 9, 12, 16, 14, 11, 9, 9, 14,
+    5, 5, 9, 14, 14, 11, 12, 11, 11, 17, 19, 17, 12, 16, 14, 16, 14, 11, 17, 11,
+    12, 12, 13, 5, 8, 8, 8, 9, 7, 8, 12, 11, 10, 13, 10, 12, 11, 17, 14, 12,
+    11, 11, 13, 17, 12, 15, 12, 8, 11, 10, 12, 10, 13, 12, 13, 12, 16, 9, 11, 8,
+    10, 9, 8, 13, 12, 12, 16, 12, 7, 10, 15, 10, 11, 12, 15, 9, 7, 10, 10, 13,
+    11, 8, 8, 13, 11, 9, 10, 10, 10, 17, 9, 10, 18, 18, 14, 15, 12, 8, 9, 8,
+    12, 15, 10, 8, 11, 9, 8, 11, 11, 7, 15, 11, 9, 12, 8, 9, 9, 11, 16, 15,
+    11, 12, 13, 11, 15, 14, 10, 8, 8, 12, 12, 11, 11, 8, 11, 13, 11, 12, 12, 13,
+    14, 8, 11, 8, 9, 8, 12, 9, 12, 13, 9, 14, 7, 11, 11, 12, 12, 8, 9, 7,
+    7, 8, 11, 9, 8, 8, 9, 20, 17, 12, 18, 14, 11, 18, 19, 13, 11, 14, 13, 11,
+    12, 13, 17, 13, 16, 11, 17, 13, 12, 13, 13, 6, 9, 9, 9, 9, 8, 11, 15, 14,
+    14, 16, 14, 13, 14, 13, 14, 14, 14, 17, 15, 16, 15, 14, 19, 16, 14, 15, 15, 8,
+    12, 14, 10, 16, 12, 17, 18, 13, 14, 16, 11, 10, 12, 11, 14, 17, 12, 12, 13, 11,
+    13, 12, 19, 14, 12, 12, 12, 15, 12, 18, 15, 18, 14, 15, 15, 20, 16, 16, 15, 19,
+    20, 16, 17, 16, 4, 11, 7, 8, 11, 6, 6, 6, 7, 7, 8, 14, 8, 7, 7, 11,
+    9, 11, 8, 8, 8, 14, 8, 3, 5, 6, 5, 7, 5, 9, 11, 14, 12, 12, 18, 13,
+    13, 15, 18, 19, 13, 13, 11, 13, 5, 10, 14, 7, 8, 12, 8, 8, 8, 10, 11, 10,
+    11, 11, 13, 9, 10, 7, 7, 11, 11, 13, 9, 9, 9, 11, 11, 8, 8, 7, 12, 11,
+    10, 7, 9, 9, 12, 10, 17, 12, 14, 15, 9, 7, 12, 10, 11, 13, 10, 10, 13, 8,
+    8, 12, 14, 10, 14, 11, 9, 18, 15, 15, 14, 15, 12, 9, 8, 10, 9, 10, 10, 13,
+    10, 10, 11, 14, 9, 8, 9, 14, 9, 11, 14, 8, 11, 8, 10, 8, 16, 13, 8, 7,
+    10, 15, 10, 9, 8, 11, 9, 9, 13, 11, 11, 11, 11, 16, 9, 9, 12, 14, 8, 11,
+    14, 8, 11, 9, 7, 8, 12, 8, 11, 10, 12, 13, 9, 11, 9, 12, 9, 8, 12, 12,
+    11, 8, 11, 16, 13, 14, 8, 8, 9, 12, 10, 9, 18, 9, 12, 11, 7, 8, 8, 9,
+    10, 8, 8, 5, 8, 13, 12, 8, 11, 12, 14, 9, 9, 8, 9, 11, 11, 8, 8, 12,
+    15, 9, 9, 11, 8, 7, 12, 12, 9, 16, 17, 13, 10, 11, 17, 16, 10, 11, 12, 10,
+    12, 14, 11, 16, 14, 12, 7, 11, 7, 14, 9, 13, 18, 13, 9, 13, 11, 10, 11, 11,
+    12, 12, 15, 16, 16, 11, 13, 11, 16, 10, 11, 4, 7, 12, 18, 11, 7, 8, 7, 7,
+    8, 10, 8, 9, 9, 11, 8, 11, 9, 4, 6, 7, 8, 10, 8, 8, 12, 7, 7, 8,
+    10, 8, 9, 13, 12, 12, 8, 8, 9, 8, 11, 8, 5, 8, 8, 9, 9, 9, 5, 9,
+    8, 9, 8, 8, 8, 9, 9, 7, 9, 5, 7, 8, 8, 9, 8, 9, 3, 7, 5, 6,
+    8, 5, 6, 5, 7, 7, 17, 8, 11, 11, 10, 10, 11, 11, 12, 17, 11, 11, 12, 10,
+    15, 13, 17, 14, 12, 13, 15, 10, 18, 11, 6, 7, 13, 10, 7, 11, 10, 9, 7, 8,
+    3, 5, 6, 7, 5, 8, 19, 12, 10, 8, 13, 7, 10, 9, 8, 8, 8, 8, 8, 9,
+    10, 9, 10, 12, 8, 10, 9, 9, 9, 12, 10, 4, 7, 7, 6, 6, 6, 12, 10, 15,
+    9, 10, 9, 9, 9, 9, 9, 10, 10, 10, 13, 9, 13, 13, 10, 11, 14, 10, 10, 10,
+    3, 7, 8, 14, 6, 6, 7, 13, 7, 6, 5, 11, 8, 8, 7, 4, 7, 11, 14, 14,
+    6, 8, 8, 14, 7, 8, 11, 12, 10, 6, 8, 8, 6, 10, 9, 9, 9, 14, 17, 19,
+    16, 16, 19, 17, 17, 17, 18, 16, 18, 18, 18, 18, 19, 18, 7, 11, 10, 12, 16, 12,
+    14, 9, 9, 9, 17, 11, 10, 9, 15, 12, 14, 12, 11, 9, 10, 10, 5, 8, 8, 12,
+    11, 14, 12, 7, 7, 15, 12, 9, 13, 8, 8, 9, 11, 12, 17, 8, 8, 11, 12, 12,
+    14, 7, 11, 14, 14, 16, 10, 17, 14, 10, 11, 11, 10, 10, 14, 11, 12, 11, 12, 10,
+    9, 8, 11, 10, 9, 7, 7, 6, 7, 10, 6, 8, 5, 7, 15, 11, 10, 9, 5, 10,
+    8, 5, 9, 15, 11, 13, 9, 8, 10, 9, 8, 6, 11, 6, 8, 12, 6, 7, 6, 6,
+    6, 7, 10, 11, 15, 10, 6, 6, 10, 5, 8, 7, 16, 8, 7, 7, 8, 10, 8, 8,
+    8, 8, 9, 11, 9, 9, 14, 15, 11, 8, 10, 12, 9, 8, 10, 9, 12, 9, 9, 8,
+    4, 8, 11, 6, 7, 7, 7, 7, 8, 8, 8, 8, 8, 7, 13, 20, 20, 15, 15, 16,
+    16, 16, 17, 17, 20, 18, 16, 16, 17, 17, 6, 7, 12, 12, 14, 10, 9, 16, 9, 10,
+    13, 10, 10, 10, 10, 10, 10, 11, 12, 19, 16, 12, 15, 12, 16, 14, 17, 13, 11, 11,
+    17, 11, 16, 9, 20, 12, 16, 19, 15, 14, 16, 12, 13, 11, 12, 11, 19, 12, 11, 18,
+    12, 17, 15, 14, 18, 13, 13, 8, 15, 11, 12, 13, 11, 11, 11, 18, 11, 11, 11, 15,
+    13, 16, 13, 16, 12, 10, 12, 8, 7, 14, 10, 12, 14, 10, 9, 13, 9, 11, 10, 9,
+    14, 11, 11, 9, 10, 17, 10, 10, 11, 13, 13, 11, 11, 13, 15, 12, 11, 10, 9, 11,
+    18, 14, 16, 12, 11, 12, 18, 17, 13, 12, 11, 12, 15, 13, 11, 14, 13, 12, 20, 13,
+    16, 14, 13, 11, 12, 14, 8, 10, 11, 12, 10, 8, 12, 10, 10, 18, 17, 11, 11, 19,
+    12, 17, 17, 15, 15, 16, 16, 15, 15, 13, 13, 13, 7, 9, 10, 11, 14, 18, 9, 9,
+    10, 11, 11, 9, 11, 12, 15, 10, 10, 16, 11, 11, 10, 14, 15, 11, 12, 16, 9, 11,
+    15, 10, 11, 11, 8, 11, 12, 10, 10, 12, 10, 13, 12, 13, 14, 14, 20, 14, 13, 13,
+    13, 13, 19, 14, 13, 17, 12, 13, 15, 14, 8, 7, 9, 9, 7, 6, 6, 5, 9, 7,
+    7, 9, 6, 7, 10, 9, 10, 9, 11, 9, 11, 14, 12, 10, 8, 9, 8, 10, 6, 9,
+    10, 9, 9, 8, 11, 10, 9, 9, 13, 11, 12, 6, 6, 6, 11, 7, 12, 12, 14, 10,
+    17, 18, 10, 12, 11, 10, 15, 11, 12, 12, 20, 14, 14, 15, 13, 12, 10, 15, 13, 14,
+    15, 18, 14, 17, 15, 13, 14, 20, 13, 17, 15, 11, 13, 11, 12, 11, 14, 18, 17, 10,
+    11, 15, 18, 13, 11, 14, 13, 12, 12, 11, 14, 16, 13, 13, 12, 13, 11, 16, 12, 12,
+    16, 11, 14, 13, 15, 11, 13, 12, 11, 16, 12, 16, 14, 16, 14, 14, 14, 14, 15, 13,
+    14, 15, 13, 11, 14, 13, 11, 11, 13, 15, 13, 16, 12, 15, 14, 12, 16, 12, 14, 13,
+    15, 17, 11, 12, 11, 13, 17, 14, 15, 11, 11, 11, 15, 11, 15, 12, 7, 10, 11, 14,
+    16, 13, 9, 17, 9, 11, 11, 10, 14, 10, 11, 9, 10, 10, 11, 14, 13, 13, 18, 15,
+    13, 11, 14, 11, 9, 6, 8, 9, 10, 8, 8, 12, 9, 10, 9, 9, 16, 9, 9, 10,
+    12, 10, 11, 12, 10, 10, 10, 10, 9, 10, 7, 10, 7, 6, 8, 5, 5, 6, 6, 8,
+    9, 9, 10, 10, 10, 8, 10, 11, 10, 7, 11, 10, 10, 11, 10, 10, 10, 18, 15, 14,
+    12, 14, 19, 14, 12, 14, 11, 11, 11, 11, 11, 15, 9, 10, 11, 11, 3, 5, 6, 6,
+    6, 6, 7, 7, 6, 8, 11, 17, 10, 11, 15, 12, 17, 14, 12, 13, 10, 19, 11, 12,
+    10, 12, 13, 14, 17, 20, 11, 15, 12, 12, 17, 10, 11, 12, 3, 7, 16, 8, 6, 5,
+    6, 9, 5, 7, 6, 6, 7, 8, 7, 8, 8, 11, 5, 9, 9, 10, 6, 10, 6, 9,
+    6, 11, 9, 9, 8, 10, 9, 10, 10, 11, 8, 13, 9, 8, 13, 10, 12, 5, 11, 6,
+    9, 12, 8, 6, 6, 10, 8, 9, 11, 9, 10, 7, 16, 12, 12, 13, 11, 6, 10, 9,
+    7, 8, 8, 11, 17, 16, 14, 11, 11, 11, 11, 12, 11, 13, 18, 11, 13, 16, 14, 13,
+    17, 13, 15, 12, 13, 8, 8, 7, 9, 7, 12, 6, 7, 6, 10, 9, 13, 6, 9, 8,
+    14, 9, 6, 6, 13, 8, 7, 6, 9, 7, 7, 9, 7, 13, 11, 9, 9, 10, 8, 10,
+    9, 8, 11, 12, 7, 6, 9, 8, 8, 5, 6, 6, 19, 8, 12, 9, 13, 9, 10, 8,
+    16, 10, 16, 9, 13, 11, 11, 11, 12, 10, 9, 9, 10, 7, 10, 10, 8, 7, 7, 7,
+    8, 7, 8, 12, 16, 9, 11, 13, 20, 14, 20, 15, 14, 19, 17, 19, 15, 19, 16, 15,
+    19, 6, 10, 9, 8, 9, 9, 13, 11, 8, 12, 9, 8, 16, 10, 9, 9, 9, 9, 10,
+    8, 14, 10, 12, 10, 13, 13, 10, 11, 13, 10, 10, 15, 9, 10, 11, 7, 9, 5, 9,
+    5, 6, 7, 6, 7, 3, 6, 5, 7, 7, 7, 7, 10, 9, 11, 10, 11, 9, 13, 18,
+    17, 12, 20, 12, 12, 12, 12, 13, 11, 20, 13, 13, 13, 14, 18, 18, 13, 18, 12, 13,
+    9, 12, 11, 9, 13, 14, 15, 12, 8, 7, 8, 6, 9, 6, 17, 8, 10, 10, 16, 11,
+    9, 11, 10, 6, 14, 9, 13, 12, 11, 13, 8, 9, 10, 7, 16, 7, 12, 7, 9, 13,
+    10, 7, 11, 8, 13, 14, 12, 11, 11, 11, 8, 11, 10, 7, 11, 8, 7, 7, 9, 10,
+    9, 8, 10, 10, 8, 13, 8, 8, 11, 14, 13, 7, 9, 8, 10, 12, 10, 8, 10, 9,
+    14, 9, 7, 10, 11, 10, 16, 10, 11, 11, 15, 10, 10, 10, 11, 9, 14, 11, 16, 10,
+    13, 13, 11, 11, 11, 9, 12, 14, 14, 8, 8, 12, 10, 10, 12, 10, 12, 15, 14, 12,
+    9, 11, 8, 10, 9, 11, 10, 11, 7, 13, 11, 7, 8, 8, 10, 10, 12, 11, 10, 8,
+    11, 8, 12, 9, 7, 8, 11, 10, 11, 6, 7, 7, 8, 8, 13, 20, 16, 17, 17, 16,
+    16, 16, 16, 17, 17, 20, 18, 16, 17, 13, 16, 11, 14, 12, 11, 16, 10, 13, 20, 11,
+    13, 16, 13, 12, 15, 12, 12, 8, 11, 10, 12, 12, 9, 16, 11, 13, 14, 15, 15, 15,
+    14, 15, 13, 18, 15, 17, 17, 16, 11, 13, 15, 11, 12, 14, 14, 16, 18, 15, 11, 12,
+    16, 10, 14, 13, 12, 15, 12, 12, 16, 14, 13, 16, 15, 17, 16, 12, 17, 14, 14, 11,
+    18, 14, 13, 15, 14, 14, 19, 19, 14, 15, 13, 17, 15, 16, 19, 15, 20, 14, 7, 11,
+    15, 10, 10, 11, 10, 10, 13, 19, 11, 16, 12, 11, 10, 12, 5, 17, 13, 8, 7, 8,
+    11, 9, 10, 9, 11, 9, 10, 10, 14, 13, 9, 13, 13, 7, 10, 10, 10, 9, 9, 7,
+    9, 13, 14, 5, 11, 6, 11, 10, 7, 6, 16, 9, 7, 6, 10, 13, 13, 9, 5, 3,
+    5, 10, 14, 13, 8, 12, 12, 7, 5, 5, 6, 7, 13, 9, 15, 6, 14, 12, 9, 7,
+    10, 11, 13, 8, 11, 6, 12, 13, 8, 10, 14, 13, 11, 8, 9, 8, 10, 15, 10, 11,
+    10, 9, 10, 11, 9, 18, 12, 15, 13, 10, 10, 10, 6, 8, 8, 6, 15, 13, 8, 9,
+    10, 9, 17, 10, 11, 13, 12, 18, 9, 11, 10, 12, 11, 10, 9, 7, 6, 11, 8, 8,
+    7, 9, 13, 11, 15, 5, 10, 10, 9, 7, 11, 9, 8, 7, 6, 8, 9, 9, 13, 6,
+    6, 9, 9, 7, 7, 8, 9, 6, 9, 7, 11, 6, 11, 6, 5, 8, 7, 7, 6, 9,
+    7, 7, 9, 14, 8, 10, 6, 9, 11, 14, 12, 10, 9, 11, 9, 5, 10, 5, 10, 11,
+    7, 7, 9, 10, 11, 9, 9, 8, 11, 11, 12, 6, 7, 7, 5, 12, 15, 12, 10, 6,
+    6, 10, 7, 6, 5, 6, 6, 7, 7, 7, 8, 8, 7, 9, 12, 20, 12, 14, 17, 14,
+    16, 13, 13, 11, 13, 12, 12, 13, 19, 13, 13, 12, 16, 16, 15, 18, 13, 13, 16, 13,
+    12, 12, 13, 4, 7, 7, 7, 6, 7, 10, 13, 14, 14, 9, 10, 16, 10, 9, 10, 15,
+    9, 13, 13, 11, 14, 9, 11, 12, 12, 6, 9, 8, 9, 10, 13, 18, 12, 15, 13, 13,
+    12, 14, 13, 14, 12, 17, 16, 13, 17, 17, 14, 14, 9, 13, 11, 12, 13, 16, 10, 12,
+    10, 8, 10, 11, 8, 12, 15, 11, 17, 11, 12, 18, 14, 16, 10, 8, 11, 9, 11, 9,
+    14, 12, 11, 12, 10, 9, 14, 15, 12, 12, 13, 17, 16, 15, 16, 13, 8, 12, 11, 9,
+    9, 11, 9, 9, 9, 12, 15, 9, 10, 10, 10, 15, 9, 11, 10, 12, 12, 10, 12, 11,
+    10, 13, 10, 19, 13, 13, 15, 17, 12, 15, 11, 11, 15, 12, 11, 12, 13, 11, 11, 15,
+    13, 12, 10, 12, 13, 10, 14, 10, 13, 13, 10, 12, 11, 15, 10, 9, 10, 10, 13, 14,
+    11, 14, 10, 10, 12, 8, 11, 12, 11, 13, 9, 10, 14, 4, 11, 7, 7, 8, 12, 8,
+    9, 8, 9, 6, 7, 8, 4, 7, 6, 7, 7, 8, 8, 6, 10, 9, 11, 8, 9, 8,
+    9, 9, 16, 12, 9, 9, 10, 10, 10, 13, 11, 13, 18, 12, 11, 15, 10, 12, 10, 10,
+    7, 14, 15, 16, 12, 20, 16, 9, 10, 11, 10, 14, 10, 10, 11, 11, 10, 11, 11, 9,
+    13, 12, 9, 11, 4, 8, 6, 7, 7, 7, 8, 7, 4, 10, 7, 7, 18, 9, 10, 10,
+    13, 14, 6, 8, 8, 7, 7, 7, 7, 8, 9, 8, 12, 13, 8, 7, 11, 8, 8, 10,
+    8, 9, 13, 12, 12, 12, 12, 12, 13, 4, 7, 7, 7, 8, 8, 7, 6, 9, 10, 8,
+    12, 17, 9, 9, 9, 16, 9, 12, 10, 16, 9, 13, 6, 10, 10, 10, 9, 10, 10, 9,
+    10, 11, 13, 12, 12, 16, 8, 9, 9, 11, 8, 9, 12, 9, 11, 12, 17, 13, 12, 10,
+    10, 7, 12, 10, 10, 12, 10, 13, 11, 13, 18, 10, 14, 13, 12, 11, 10, 11, 10, 14,
+    8, 18, 13, 12, 12, 8, 11, 12, 8, 8, 12, 10, 9, 9, 11, 8, 8, 16, 11, 15,
+    8, 9, 9, 10, 9, 13, 11, 11, 18, 11, 14, 12, 10, 8, 12, 12, 8, 12, 12, 14,
+    12, 10, 8, 10, 11, 14, 10, 12, 8, 11, 7, 8, 12, 12, 8, 9, 9, 11, 13, 8,
+    12, 11, 11, 14, 10, 13, 10, 9, 8, 8, 13, 9, 8, 11, 11, 9, 13, 9, 11, 8,
+    9, 10, 15, 14, 12, 13, 13, 12, 13, 20, 13, 13, 14, 14, 14, 15, 14, 14, 9, 13,
+    12, 17, 16, 11, 15, 13, 12, 12, 12, 12, 12, 15, 13, 16, 18, 17, 14, 15, 13, 15,
+    18, 13, 13, 13, 9, 18, 12, 16, 14, 16, 17, 12, 18, 13, 13, 12, 12, 12, 13, 15,
+    14, 14, 16, 13, 14, 4, 7, 7, 7, 7, 8, 7, 10, 18, 7, 15, 8, 8, 8, 10,
+    12, 11, 8, 9, 11, 8, 8, 6, 8, 4, 8, 6, 6, 7, 7, 7, 8, 7, 8, 8,
+    11, 11, 15, 14, 11, 10, 11, 11, 18, 12, 11, 18, 17, 11, 12, 12, 10, 15, 12, 17,
+    13, 14, 12, 13, 12, 12, 11, 12, 13, 4, 6, 7, 7, 7, 7, 8, 6, 9, 9, 9,
+    9, 10, 13, 13, 15, 13, 12, 20, 12, 13, 16, 14, 16, 13, 14, 17, 16, 16, 14, 18,
+    14, 13, 7, 10, 12, 12, 12, 9, 10, 14, 11, 9, 14, 13, 12, 19, 10, 10, 14, 11,
+    12, 11, 9, 17, 15, 12, 14, 5, 8, 14, 8, 9, 12, 18, 7, 8, 7, 9, 8, 8,
+    10, 15, 8, 8, 9, 8, 10, 13, 11, 10, 13, 9, 9, 9, 8, 4, 8, 7, 7, 7,
+    7, 8, 8, 6, 10, 13, 8, 9, 15, 13, 10, 8, 10, 9, 11, 15, 9, 9, 12, 10,
+    10, 11, 14, 10, 8, 10, 9, 10, 10, 11, 4, 9, 9, 7, 7, 14, 11, 8, 12, 7,
+    13, 9, 9, 10, 8, 8, 11, 9, 8, 13, 7, 8, 7, 8, 6, 8, 9, 10, 8, 9,
+    12, 11, 12, 18, 11, 13, 12, 13, 12, 13, 12, 12, 12, 13, 11, 15, 16, 13, 15, 17,
+    18, 17, 15, 17, 6, 9, 10, 19, 16, 12, 12, 9, 9, 9, 16, 10, 15, 10, 9, 9,
+    17, 16, 9, 11, 14, 10, 10, 14, 14, 13, 7, 10, 10, 14, 16, 15, 13, 9, 11, 9,
+    10, 10, 10, 11, 11, 11, 10, 16, 17, 11, 11, 14, 9, 11, 13, 12, 11, 4, 8, 7,
+    7, 4, 11, 6, 6, 6, 13, 7, 6, 7, 10, 9, 13, 10, 8, 10, 9, 13, 6, 8,
+    4, 9, 7, 7, 7, 8, 5, 12, 10, 11, 8, 15, 19, 14, 9, 15, 14, 13, 11, 9,
+    14, 4, 6, 7, 8, 5, 13, 12, 10, 13, 18, 9, 8, 9, 8, 8, 8, 7, 9, 8,
+    10, 10, 11, 9, 7, 14, 20, 17, 17, 18, 17, 18, 19, 16, 20, 20, 19, 20, 18, 19,
+    6, 9, 9, 11, 8, 11, 7, 9, 6, 7, 7, 5, 6, 16, 9, 9, 7, 7, 6, 9,
+    10, 9, 10, 11, 10, 5, 10, 8, 5, 9, 15, 14, 16, 13, 9, 7, 8, 9, 8, 6,
+    8, 11, 11, 15, 13, 14, 14, 18, 15, 16, 15, 15, 15, 17, 18, 19, 16, 18, 20, 15,
+    11, 14, 18, 17, 18, 19, 16, 16, 17, 19, 16, 17, 17, 17, 19, 20, 20, 20, 18, 18,
+    10, 10, 8, 8, 12, 6, 9, 13, 10, 6, 10, 7, 11, 8, 7, 6, 9, 13, 6, 12,
+    8, 8, 8, 6, 9, 7, 6, 12, 10, 13, 15, 16, 12, 16, 14, 18, 15, 13, 13, 13,
+    13, 19, 14, 15, 15, 18, 19, 14, 15, 8, 9, 5, 8, 8, 7, 6, 9, 6, 10, 10,
+    7, 9, 10, 10, 11, 7, 10, 8, 10, 8, 8, 16, 10, 7, 6, 10, 12, 10, 11, 7,
+    7, 10, 7, 9, 10, 6, 9, 10, 11, 10, 14, 14, 12, 15, 13, 12, 19, 13, 13, 16,
+    13, 14, 16, 18, 17, 14, 14, 14, 14, 12, 15, 15, 15, 9, 12, 9, 8, 11, 14, 14,
+    19, 14, 13, 13, 14, 17, 17, 15, 14, 14, 19, 14, 20, 19, 19, 17, 19, 20, 15, 16,
+    15, 6, 13, 8, 10, 14, 11, 14, 10, 9, 10, 11, 8, 19, 12, 12, 12, 12, 13, 8,
+    11, 12, 12, 18, 13, 19, 11, 14, 8, 11, 10, 11, 17, 18, 13, 10, 10, 12, 15, 13,
+    19, 14, 11, 12, 12, 11, 9, 12, 12, 12, 12, 12, 11, 16, 13, 20, 18, 12, 12, 12,
+    15, 11, 13, 18, 12, 14, 14, 13, 12, 17, 14, 14, 14, 9, 13, 9, 12, 14, 14, 12,
+    10, 10, 19, 16, 16, 14, 8, 9, 9, 11, 9, 13, 13, 12, 15, 11, 14, 11, 11, 12,
+    11, 11, 10, 15, 10, 11, 13, 17, 16, 16, 15, 16, 16, 17, 16, 17, 15, 15, 8, 12,
+    16, 12, 15, 17, 15, 15, 12, 17, 19, 16, 11, 11, 12, 20, 16, 18, 12, 16, 10, 12,
+    10, 9, 9, 11, 12, 13, 10, 10, 14, 12, 12, 15, 12, 13, 11, 14, 13, 17, 11, 13,
+    12, 11, 9, 11, 13, 9, 11, 13, 12, 14, 9, 13, 9, 9, 10, 11, 14, 8, 11, 15,
+    8, 10, 13, 10, 8, 12, 10, 10, 8, 11, 9, 9, 10, 6, 8, 7, 10, 5, 10, 9,
+    6, 9, 11, 10, 6, 9, 10, 6, 3, 5, 6, 11, 5, 5, 12, 6, 5, 8, 5, 7,
+    10, 7, 10, 11, 5, 8, 6, 7, 8, 11, 13, 11, 12, 11, 13, 12, 12, 18, 12, 15,
+    13, 12, 12, 10, 15, 12, 4, 7, 7, 8, 7, 8, 7, 8, 7, 8, 8, 4, 6, 7,
+    4, 7, 6, 7, 7, 7, 8, 8, 6, 7, 8, 5, 8, 9, 5, 7, 8, 8, 8, 4,
+    8, 8, 6, 7, 8, 6, 8, 9, 9, 13, 9, 12, 20, 9, 9, 14, 10, 11, 9, 9,
+    15, 13, 8, 9, 14, 10, 5, 13, 19, 12, 8, 7, 7, 9, 8, 9, 8, 8, 11, 10,
+    12, 10, 12, 8, 14, 11, 9, 12, 9, 12, 4, 12, 7, 9, 12, 14, 6, 7, 8, 8,
+    14, 18, 7, 7, 7, 8, 9, 11, 10, 7, 9, 16, 11, 14, 8, 9, 8, 14, 5, 12,
+    7, 13, 8, 9, 13, 10, 13, 18, 7, 7, 8, 8, 7, 9, 15, 8, 16, 11, 8, 10,
+    9, 10, 7, 12, 4, 7, 7, 8, 6, 7, 8, 8, 8, 4, 6, 7, 11, 14, 9, 10,
+    7, 6, 8, 7, 13, 7, 7, 7, 7, 12, 8, 8, 8, 9, 7, 10, 8, 12, 8, 8,
+    6, 4, 8, 6, 7, 8, 5, 9, 8, 7, 9, 9, 8, 11, 16, 14, 11, 10, 17, 10,
+    12, 10, 12, 11, 16, 11, 12, 14, 12, 11, 11, 13, 14, 10, 11, 11, 13, 4, 7, 6,
+    8, 6, 4, 7, 7, 8, 8, 8, 4, 7, 6, 7, 7, 7, 7, 7, 8, 7, 11, 9,
+    14, 13, 10, 11, 13, 10, 11, 9, 14, 12, 11, 16, 14, 11, 10, 10, 11, 11, 15, 18,
+    16, 16, 14, 15, 14, 15, 14, 15, 20, 17, 15, 18, 17, 17, 15, 16, 4, 8, 7, 8,
+    8, 10, 12, 17, 16, 18, 15, 14, 19, 13, 13, 13, 16, 14, 15, 15, 17, 15, 17, 17,
+    16, 14, 6, 12, 9, 10, 16, 10, 12, 12, 14, 14, 10, 10, 8, 11, 10, 8, 11, 8,
+    11, 11, 14, 10, 10, 14, 11, 12, 18, 11, 11, 12, 12, 10, 11, 17, 12, 15, 15, 12,
+    9, 13, 16, 16, 15, 12, 12, 16, 18, 13, 13, 12, 12, 12, 11, 19, 15, 14, 15, 18,
+    18, 15, 19, 17, 13, 19, 7, 11, 11, 9, 4, 6, 8, 7, 7, 8, 6, 9, 10, 13,
+    12, 14, 8, 9, 10, 13, 12, 10, 9, 9, 14, 15, 9, 9, 17, 13, 13, 11, 10, 18,
+    9, 11, 13, 8, 8, 10, 10, 6, 10, 18, 11, 16, 14, 9, 9, 10, 10, 16, 11, 12,
+    10, 13, 14, 14, 11, 10, 4, 7, 7, 6, 6, 7, 11, 10, 11, 14, 16, 10, 10, 13,
+    11, 11, 9, 10, 18, 15, 10, 14, 18, 13, 17, 10, 15, 14, 11, 11, 10, 13, 12, 10,
+    12, 10, 13, 9, 9, 8, 13, 11, 11, 13, 7, 10, 10, 17, 12, 15, 12, 14, 11, 13,
+    7, 12, 12, 10, 15, 7, 11, 11, 12, 17, 13, 15, 14, 11, 9, 11, 10, 8, 8, 10,
+    14, 8, 11, 8, 12, 13, 8, 13, 17, 12, 8, 11, 10, 8, 10, 10, 12, 15, 12, 11,
+    10, 10, 11, 12, 9, 12, 9, 10, 15, 11, 8, 13, 9, 11, 9, 11, 10, 8, 12, 8,
+    9, 13, 9, 11, 13, 16, 13, 12, 10, 16, 13, 13, 9, 10, 13, 12, 9, 8, 12, 8,
+    8, 10, 7, 14, 12, 11, 9, 12, 12, 10, 12, 16, 13, 8, 10, 13, 8, 14, 9, 9,
+    9, 8, 8, 12, 8, 8, 8, 6, 9, 15, 10, 13, 8, 9, 9, 10, 17, 9, 9, 9,
+    11, 10, 12, 10, 11, 11, 15, 14, 10, 8, 13, 11, 13, 13, 14, 13, 16, 17, 12, 9,
+    9, 10, 9, 12, 10, 10, 12, 12, 17, 15, 14, 15, 13, 11, 12, 12, 16, 12, 10, 14,
+    12, 11, 9, 11, 9, 14, 11, 15, 14, 15, 15, 11, 10, 19, 12, 13, 14, 18, 9, 11,
+    9, 10, 12, 13, 9, 11, 12, 10, 15, 11, 9, 10, 12, 9, 10, 11, 16, 10, 13, 14,
+    15, 17, 14, 14, 19, 13, 15, 17, 15, 15, 16, 14, 13, 17, 14, 15, 10, 13, 10, 14,
+    12, 17, 15, 14, 13, 17, 12, 10, 13, 11, 11, 15, 15, 10, 11, 11, 9, 10, 12, 9,
+    12, 11, 12, 9, 13, 12, 13, 14, 10, 9, 10, 12, 11, 14, 15, 9, 10, 12, 9, 11,
+    11, 13, 10, 12, 13, 9, 13, 12, 12, 9, 11, 13, 11, 7, 9, 18, 11, 9, 17, 11,
+    11, 13, 11, 7, 13, 13, 11, 12, 12, 14, 7, 8, 10, 8, 12, 8, 12, 11, 12, 10,
+    9, 9, 14, 15, 12, 12, 12, 9, 12, 10, 8, 8, 13, 12, 11, 10, 9, 10, 11, 8,
+    15, 10, 10, 16, 11, 13, 8, 8, 11, 11, 9, 16, 9, 11, 11, 11, 9, 9, 8, 10,
+    12, 10, 14, 11, 10, 11, 12, 8, 10, 12, 11, 12, 7, 9, 11, 10, 14, 14, 8, 9,
+    8, 8, 9, 10, 14, 11, 10, 7, 8, 12, 8, 12, 9, 8, 9, 9, 12, 11, 11, 12,
+    9, 11, 7, 8, 9, 17, 10, 8, 10, 8, 7, 16, 11, 10, 10, 9, 11, 8, 11, 11,
+    9, 11, 12, 14, 8, 9, 10, 13, 10, 7, 15, 11, 9, 9, 9, 12, 11, 6, 8, 8,
+    7, 10, 13, 9, 10, 8, 7, 9, 8, 12, 12, 7, 10, 6, 10, 14, 15, 8, 7, 11,
+    8, 10, 11, 13, 9, 11, 8, 11, 10, 13, 10, 10, 8, 10, 9, 8, 10, 11, 10, 8,
+    12, 10, 8, 11, 10, 10, 12, 13, 11, 7, 11, 7, 10, 7, 8, 6, 10, 11, 6, 8,
+    6, 12, 7, 10, 10, 8, 6, 15, 9, 14, 15, 11, 17, 9, 11, 9, 12, 16, 10, 18,
+    10, 11, 8, 10, 9, 5, 9, 8, 14, 17, 8, 14, 8, 7, 19, 15, 8, 11, 9, 10,
+    11, 9, 14, 7, 10, 9, 9, 9, 5, 9, 9, 9, 12, 11, 11, 7, 8, 7, 9, 8,
+    8, 8, 15, 12, 14, 13, 11, 13, 9, 10, 13, 7, 7, 10, 13, 7, 10, 14, 20, 9,
+    11, 10, 11, 11, 11, 10, 11, 13, 14, 11, 11, 14, 10, 11, 4, 7, 7, 8, 7, 7,
+    7, 8, 5, 9, 8, 10, 10, 14, 13, 13, 15, 14, 12, 13, 20, 19, 16, 14, 14, 14,
+    15, 12, 11, 8, 9, 17, 8, 11, 9, 9, 5, 9, 14, 8, 8, 7, 14, 16, 12, 9,
+    7, 16, 8, 8, 7, 9, 11, 10, 8, 11, 9, 13, 9, 10, 10, 9, 7, 4, 6, 7,
+    8, 8, 9, 14, 10, 13, 16, 17, 9, 8, 12, 9, 10, 13, 8, 11, 12, 13, 12, 11,
+    13, 8, 14, 13, 11, 12, 14, 10, 14, 12, 14, 11, 12, 11, 11, 16, 15, 14, 12, 15,
+    9, 11, 15, 10, 9, 13, 12, 16, 18, 13, 12, 13, 10, 16, 11, 14, 11, 12, 15, 10,
+    13, 10, 12, 11, 10, 12, 12, 10, 11, 10, 10, 14, 12, 14, 17, 12, 12, 13, 12, 15,
+    11, 13, 11, 11, 16, 14, 13, 11, 12, 9, 11, 11, 13, 13, 14, 10, 12, 12, 10, 16,
+    14, 11, 9, 13, 14, 11, 10, 10, 10, 9, 12, 14, 8, 9, 9, 10, 13, 11, 12, 13,
+    11, 10, 9, 5, 9, 7, 7, 9, 8, 9, 15, 8, 11, 11, 10, 13, 7, 11, 9, 10,
+    8, 9, 4, 13, 7, 10, 6, 14, 8, 10, 9, 7, 7, 7, 7, 7, 7, 8, 14, 7,
+    12, 8, 11, 8, 6, 8, 11, 13, 11, 10, 10, 11, 12, 9, 10, 11, 13, 19, 9, 8,
+    8, 9, 13, 9, 9, 9, 9, 9, 11, 12, 15, 15, 14, 14, 10, 10, 13, 11, 10, 7,
+    10, 10, 11, 10, 10, 9, 6, 10, 18, 13, 11, 8, 8, 10, 9, 10, 8, 9, 14, 9,
+    10, 10, 14, 8, 11, 13, 10, 9, 11, 13, 10, 13, 13, 10, 10, 4, 9, 7, 6, 7,
+    7, 6, 8, 7, 7, 16, 12, 12, 14, 10, 11, 11, 10, 10, 11, 13, 14, 11, 16, 14,
+    12, 9, 4, 11, 7, 15, 8, 9, 10, 7, 7, 6, 12, 7, 7, 7, 9, 10, 8, 8,
+    7, 11, 12, 12, 6, 7, 8, 8, 8, 7, 9, 11, 10, 6, 8, 9, 12, 11, 12, 12,
+    8, 8, 8, 10, 7, 8, 7, 10, 10, 16, 12, 10, 13, 10, 11, 11, 9, 6, 12, 10,
+    9, 12, 7, 10, 11, 7, 9, 7, 9, 10, 8, 12, 13, 16, 10, 8, 8, 13, 11, 16,
+    7, 8, 10, 7, 8, 7, 11, 11, 7, 11, 11, 10, 14, 13, 8, 7, 13, 10, 8, 9,
+    9, 9, 9, 8, 8, 7, 10, 8, 8, 9, 11, 8, 12, 15, 10, 11, 11, 9, 11, 11,
+    12, 8, 13, 12, 9, 11, 7, 9, 11, 7, 11, 7, 10, 6, 8, 10, 11, 11, 11, 12,
+    12, 7, 9, 7, 8, 11, 9, 10, 9, 16, 13, 8, 11, 10, 10, 7, 7, 7, 8, 10,
+    8, 6, 9, 11, 9, 13, 12, 19, 8, 12, 8, 8, 10, 9, 9, 9, 10, 12, 13, 15,
+    12, 12, 10, 14, 13, 15, 15, 11, 5, 9, 8, 9, 7, 9, 9, 6, 15, 9, 13, 10,
+    9, 11, 8, 8, 8, 9, 11, 10, 14, 11, 15, 13, 9, 4, 7, 7, 7, 7, 8, 8,
+    8, 9, 11, 15, 15, 11, 12, 18, 13, 12, 17, 15, 15, 12, 12, 14, 13, 13, 16, 12,
+    16, 15, 15, 19, 17, 15, 17, 16, 14, 15, 15, 14, 19, 16, 16, 16, 14, 16, 5, 9,
+    11, 9, 10, 12, 7, 15, 9, 9, 8, 8, 8, 8, 8, 8, 7, 15, 8, 9, 13, 9,
+    10, 11, 12, 10, 10, 12, 20, 18, 20, 15, 17, 14, 19, 14, 14, 15, 15, 16, 15, 15,
+    16, 16, 6, 10, 12, 11, 15, 10, 7, 7, 11, 6, 13, 8, 10, 8, 16, 12, 11, 10,
+    15, 10, 9, 12, 9, 14, 9, 10, 11, 14, 14, 10, 13, 13, 7, 13, 10, 13, 8, 9,
+    10, 10, 10, 8, 11, 11, 11, 7, 8, 9, 8, 7, 7, 7, 10, 12, 9, 7, 13, 9,
+    8, 7, 8, 9, 13, 14, 9, 12, 8, 15, 10, 7, 7, 9, 14, 8, 11, 7, 11, 8,
+    12, 10, 10, 10, 11, 13, 7, 10, 10, 9, 10, 11, 7, 10, 10, 10, 8, 10, 8, 10,
+    17, 13, 7, 7, 11, 12, 9, 12, 8, 9, 8, 7, 10, 8, 7, 10, 7, 11, 11, 8,
+    7, 9, 11, 7, 11, 13, 12, 16, 7, 13, 9, 11, 11, 8, 8, 9, 12, 7, 8, 10,
+    10, 8, 9, 11, 11, 10, 15, 11, 11, 12, 17, 11, 7, 10, 13, 14, 10, 13, 14, 11,
+    10, 14, 11, 8, 9, 11, 14, 20, 7, 8, 8, 9, 9, 9, 12, 15, 14, 12, 8, 10,
+    10, 10, 9, 11, 10, 9, 8, 8, 10, 12, 14, 10, 9, 11, 13, 15, 8, 11, 8, 9,
+    10, 9, 9, 13, 11, 11, 12, 8, 12, 12, 10, 14, 11, 14, 9, 11, 10, 11, 10, 12,
+    11, 8, 11, 10, 10, 12, 12, 13, 9, 12, 11, 13, 11, 13, 14, 10, 9, 9, 8, 11,
+    8, 10, 12, 11, 9, 11, 7, 11, 8, 9, 7, 9, 8, 8, 7, 11, 14, 12, 13, 10,
+    10, 17, 9, 14, 11, 11, 9, 10, 9, 10, 14, 13, 13, 11, 15, 11, 14, 13, 11, 9,
+    5, 7, 7, 8, 8, 9, 8, 8, 9, 12, 14, 12, 11, 16, 11, 12, 14, 19, 19, 12,
+    12, 12, 13, 13, 16, 12, 13, 14, 18, 16, 13, 16, 13, 15, 12, 14, 13, 4, 16, 9,
+    7, 6, 15, 6, 6, 8, 8, 7, 8, 7, 8, 10, 9, 9, 9, 8, 11, 10, 9, 7,
+    5, 12, 8, 7, 8, 10, 10, 12, 7, 16, 7, 8, 8, 9, 7, 8, 8, 8, 7, 10,
+    8, 11, 11, 13, 10, 14, 15, 8, 10, 9, 4, 7, 4, 6, 13, 11, 9, 11, 11, 7,
+    14, 11, 8, 7, 8, 7, 7, 12, 10, 8, 8, 12, 8, 9, 13, 6, 11, 8, 7, 10,
+    9, 14, 10, 17, 11, 10, 10, 10, 11, 13, 11, 11, 12, 13, 13, 14, 11, 12, 9, 11,
+    11, 11, 3, 7, 7, 6, 10, 9, 18, 9, 14, 11, 10, 8, 14, 15, 9, 9, 13, 10,
+    9, 11, 13, 10, 14, 12, 15, 15, 10, 11, 15, 15, 14, 20, 13, 15, 13, 14, 14, 14,
+    14, 15, 13, 17, 15, 14, 17, 17, 15, 15, 19, 15, 18, 15, 6, 8, 12, 11, 11, 10,
+    10, 12, 9, 10, 11, 14, 9, 12, 9, 16, 8, 10, 9, 10, 15, 9, 9, 9, 10, 8,
+    13, 14, 15, 12, 16, 10, 9, 10, 10, 10, 13, 10, 10, 11, 12, 10, 5, 9, 8, 9,
+    10, 13, 7, 9, 15, 9, 7, 10, 10, 12, 17, 13, 11, 9, 10, 12, 7, 8, 5, 7,
+    10, 14, 8, 7, 9, 13, 7, 10, 9, 7, 8, 8, 8, 8, 8, 11, 10, 13, 14, 11,
+    15, 11, 8, 9, 12, 9, 10, 9, 9, 7, 9, 10, 4, 6, 6, 8, 8, 6, 7, 10,
+    9, 10, 16, 16, 9, 9, 9, 10, 16, 10, 14, 10, 11, 17, 10, 10, 10, 11, 15, 9,
+    12, 11, 15, 12, 14, 16, 13, 11, 11, 13, 11, 5, 13, 8, 10, 9, 19, 12, 13, 10,
+    8, 14, 8, 7, 8, 7, 14, 8, 9, 10, 8, 14, 10, 7, 7, 8, 9, 4, 11, 17,
+    5, 8, 14, 10, 6, 16, 7, 12, 9, 15, 14, 9, 19, 8, 8, 10, 14, 9, 6, 14,
+    13, 12, 12, 6, 9, 7, 9, 9, 8, 7, 7, 7, 7, 7, 13, 14, 8, 8, 8, 9,
+    11, 8, 6, 9, 11, 8, 8, 10, 11, 20, 15, 11, 17, 14, 11, 10, 11, 10, 11, 18,
+    12, 15, 19, 11, 13, 12, 11, 12, 19, 13, 12, 12, 4, 8, 6, 6, 8, 8, 5, 9,
+    8, 8, 16, 9, 12, 8, 7, 7, 11, 8, 8, 9, 11, 15, 9, 7, 13, 8, 8, 9,
+    13, 11, 9, 11, 9, 14, 9, 9, 11, 9, 12, 6, 12, 8, 9, 10, 15, 12, 13, 10,
+    9, 8, 9, 9, 12, 9, 10, 13, 10, 15, 9, 13, 14, 13, 12, 12, 12, 13, 11, 13,
+    13, 8, 17, 15, 12, 16, 17, 17, 15, 11, 11, 11, 11, 10, 14, 13, 15, 15, 14, 12,
+    5, 11, 12, 8, 13, 8, 10, 8, 13, 12, 10, 12, 11, 11, 7, 14, 9, 11, 13, 7,
+    9, 9, 9, 10, 8, 8, 9, 10, 9, 11, 11, 9, 8, 9, 17, 12, 11, 11, 9, 9,
+    12, 10, 11, 9, 9, 7, 8, 8, 9, 9, 9, 9, 12, 12, 7, 10, 8, 10, 12, 11,
+    9, 12, 8, 10, 12, 11, 9, 14, 14, 13, 12, 13, 14, 9, 12, 10, 13, 7, 9, 11,
+    12, 7, 17, 13, 11, 12, 8, 8, 8, 10, 10, 12, 12, 7, 10, 9, 14, 12, 7, 8,
+    7, 13, 10, 9, 12, 7, 7, 10, 9, 8, 11, 8, 8, 10, 12, 15, 15, 10, 12, 9,
+    10, 7, 13, 13, 8, 13, 11, 7, 7, 10, 9, 10, 6, 9, 11, 9, 9, 11, 12, 8,
+    8, 12, 10, 11, 9, 8, 12, 10, 9, 7, 7, 7, 8, 8, 9, 12, 8, 8, 10, 11,
+    6, 8, 7, 7, 7, 11, 8, 7, 5, 8, 10, 8, 9, 14, 14, 8, 15, 11, 8, 8,
+    11, 9, 9, 9, 7, 7, 12, 9, 12, 14, 16, 13, 14, 11, 18, 12, 13, 12, 12, 12,
+    12, 17, 14, 17, 14, 18, 16, 13, 13, 18, 11, 7, 10, 9, 16, 12, 14, 12, 10, 17,
+    11, 9, 10, 10, 10, 15, 11, 11, 11, 14, 15, 13, 13, 16, 11, 14, 11, 7, 10, 10,
+    12, 10, 9, 9, 13, 14, 11, 10, 9, 18, 10, 10, 11, 11, 10, 14, 15, 13, 14, 15,
+    11, 12, 17, 10, 9, 12, 18, 12, 12, 16, 13, 12, 13, 12, 19, 13, 14, 14, 13, 13,
+    16, 13, 11, 13, 13, 18, 12, 13, 7, 10, 10, 12, 9, 9, 15, 10, 9, 13, 14, 9,
+    16, 16, 12, 12, 11, 12, 11, 11, 13, 12, 14, 13, 14, 15, 16, 15, 16, 13, 11, 13,
+    11, 16, 13, 14, 12, 14, 15, 11, 11, 9, 11, 11, 12, 20, 14, 15, 15, 15, 15, 14,
+    19, 18, 16, 18, 14, 17, 16, 12, 14, 15, 15, 15, 14, 7, 10, 9, 10, 10, 12, 20,
+    10, 9, 9, 13, 14, 10, 10, 11, 12, 14, 12, 11, 10, 10, 15, 13, 11, 14, 12, 11,
+    9, 10, 11, 7, 10, 12, 10, 17, 14, 10, 9, 11, 10, 18, 11, 12, 11, 11, 13, 11,
+    11, 8, 15, 12, 14, 16, 11, 15, 17, 15, 12, 10, 12, 10, 11, 18, 19, 11, 11, 11,
+    12, 12, 12, 11, 17, 12, 14, 15, 16, 12, 13, 12, 13, 12, 12, 12, 12, 10, 14, 16,
+    8, 13, 12, 12, 10, 8, 11, 17, 13, 11, 11, 12, 10, 11, 11, 11, 10, 13, 14, 14,
+    13, 17, 17, 10, 12, 12, 14, 14, 12, 11, 11, 12, 13, 12, 14, 12, 14, 15, 8, 14,
+    9, 13, 9, 14, 17, 13, 15, 9, 13, 11, 12, 10, 9, 14, 14, 8, 13, 9, 10, 14,
+    10, 9, 13, 9, 9, 9, 9, 11, 14, 11, 15, 11, 10, 9, 10, 11, 9, 12, 9, 11,
+    14, 10, 17, 14, 10, 11, 11, 9, 16, 12, 14, 13, 11, 11, 11, 12, 18, 19, 9, 11,
+    13, 11, 9, 10, 10, 12, 10, 14, 10, 13, 14, 9, 10, 12, 9, 10, 14, 12, 9, 10,
+    10, 9, 8, 9, 12, 13, 9, 10, 10, 7, 9, 10, 9, 11, 10, 11, 13, 15, 17, 9,
+    15, 11, 11, 13, 13, 9, 12, 9, 10, 12, 13, 11, 19, 13, 15, 14, 13, 12, 13, 14,
+    14, 12, 9, 14, 15, 9, 14, 13, 16, 10, 13, 10, 15, 12, 16, 14, 10, 13, 11, 12,
+    12, 12, 16, 13, 10, 10, 11, 20, 13, 17, 16, 16, 17, 14, 13, 11, 13, 14, 14, 17,
+    10, 16, 12, 15, 12, 13, 16, 11, 10, 10, 12, 10, 12, 10, 18, 11, 18, 10, 17, 14,
+    11, 11, 13, 13, 10, 11, 10, 14, 11, 12, 15, 14, 11, 15, 15, 18, 13, 13, 15, 11,
+    11, 12, 12, 14, 16, 11, 13, 12, 14, 14, 12, 10, 13, 14, 10, 14, 12, 11, 11, 13,
+    15, 13, 11, 13, 14, 15, 15, 10, 12, 10, 13, 10, 15, 11, 16, 9, 11, 13, 10, 9,
+    10, 11, 9, 10, 15, 15, 10, 6, 9, 13, 9, 8, 15, 8, 9, 10, 10, 8, 9, 9,
+    10, 12, 10, 12, 9, 13, 10, 11, 8, 10, 4, 7, 7, 7, 7, 6, 8, 8, 7, 12,
+    13, 10, 9, 10, 11, 11, 10, 10, 11, 11, 12, 13, 11, 11, 11, 11, 11, 11, 9, 8,
+    12, 10, 11, 11, 17, 17, 15, 10, 12, 12, 10, 17, 18, 11, 11, 12, 14, 20, 15, 14,
+    15, 15, 12, 16, 16, 15, 12, 10, 12, 13, 16, 14, 11, 12, 9, 17, 17, 12, 12, 13,
+    18, 17, 13, 15, 14, 13, 16, 14, 13, 15, 18, 12, 13, 12, 13, 5, 9, 8, 7, 8,
+    6, 5, 7, 9, 8, 9, 9, 8, 4, 8, 9, 8, 7, 6, 8, 11, 13, 14, 6, 13,
+    8, 9, 8, 12, 9, 15, 9, 9, 11, 10, 10, 10, 10, 10, 10, 9, 11, 7, 9, 6,
+    7, 5, 5, 9, 7, 10, 9, 12, 8, 8, 13, 9, 8, 10, 10, 10, 12, 13, 9, 8,
+    11, 6, 8, 12, 9, 12, 8, 10, 6, 8, 8, 9, 7, 10, 7, 10, 5, 8, 10, 7,
+    6, 7, 12, 6, 9, 9, 9, 9, 12, 11, 13, 8, 11, 11, 11, 11, 12, 9, 9, 8,
+    8, 7, 7, 7, 6, 8, 10, 6, 8, 7, 10, 10, 10, 7, 8, 6, 10, 9, 9, 9,
+    11, 8, 8, 10, 13, 9, 9, 9, 9, 16, 10, 11, 10, 9, 12, 16, 10, 10, 11, 8,
+    10, 10, 7, 7, 11, 9, 9, 9, 9, 12, 8, 6, 10, 7, 10, 10, 10, 11, 9, 10,
+    11, 11, 11, 8, 9, 10, 10, 9, 9, 8, 11, 19, 13, 15, 11, 10, 18, 12, 12, 11,
+    10, 11, 10, 18, 11, 13, 17, 12, 17, 15, 12, 12, 10, 6, 9, 10, 6, 6, 10, 19,
+    12, 12, 13, 17, 14, 13, 13, 14, 16, 14, 14, 15, 12, 12, 9, 10, 8, 16, 10, 11,
+    11, 10, 11, 15, 17, 12, 11, 14, 13, 10, 13, 10, 7, 7, 9, 10, 11, 9, 6, 10,
+    14, 12, 13, 8, 8, 12, 9, 13, 9, 9, 9, 9, 9, 10, 11, 9, 13, 12, 11, 13,
+    15, 12, 12, 12, 13, 13, 8, 9, 11, 8, 6, 7, 6, 6, 7, 10, 11, 12, 12, 9,
+    6, 10, 5, 6, 6, 7, 6, 6, 6, 7, 5, 9, 9, 10, 8, 11, 8, 8, 13, 11,
+    9, 13, 12, 9, 11, 17, 8, 12, 10, 12, 9, 9, 11, 9, 9, 4, 6, 6, 8, 6,
+    7, 7, 7, 7, 8, 12, 6, 8, 11, 9, 11, 10, 8, 12, 11, 8, 7, 10, 16, 15,
+    10, 16, 9, 9, 11, 16, 9, 10, 11, 11, 15, 16, 11, 14, 11, 14, 15, 9, 11, 9,
+    10, 15, 11, 11, 6, 10, 8, 15, 15, 9, 14, 9, 9, 10, 12, 13, 12, 15, 12, 13,
+    10, 10, 7, 10, 16, 18, 9, 11, 11, 10, 15, 17, 11, 10, 9, 10, 18, 10, 14, 14,
+    10, 12, 12, 9, 11, 10, 14, 13, 14, 14, 6, 13, 9, 11, 12, 13, 13, 11, 9, 15,
+    9, 10, 9, 9, 10, 9, 10, 12, 14, 8, 11, 10, 10, 13, 12, 19, 11, 13, 18, 12,
+    13, 15, 12, 15, 13, 12, 10, 4, 7, 6, 6, 7, 6, 7, 8, 7, 7, 4, 6, 7,
+    8, 11, 11, 15, 8, 9, 11, 8, 12, 7, 9, 14, 9, 17, 12, 11, 11, 12, 16, 10,
+    12, 12, 10, 14, 11, 10, 10, 11, 10, 8, 8, 10, 13, 11, 11, 10, 8, 13, 11, 9,
+    18, 14, 12, 12, 12, 9, 9, 12, 15, 13, 14, 10, 14, 11, 9, 16, 16, 9, 8, 8,
+    10, 8, 11, 9, 12, 9, 13, 16, 11, 11, 11, 10, 10, 14, 12, 9, 8, 10, 8, 11,
+    10, 11, 12, 8, 13, 9, 11, 9, 9, 11, 9, 11, 8, 9, 9, 10, 9, 7, 14, 9,
+    12, 11, 11, 12, 12, 9, 12, 12, 11, 9, 4, 6, 8, 6, 8, 6, 11, 13, 16, 10,
+    9, 10, 17, 14, 14, 17, 11, 12, 12, 13, 15, 14, 14, 15, 12, 13, 5, 7, 8, 8,
+    9, 9, 8, 7, 11, 12, 15, 20, 10, 10, 10, 16, 11, 10, 11, 12, 16, 13, 11, 12,
+    14, 11, 10, 11, 3, 5, 7, 7, 4, 6, 7, 13, 11, 6, 7, 6, 10, 8, 7, 13,
+    7, 6, 15, 7, 7, 7, 8, 6, 10, 10, 8, 8, 12, 15, 15, 10, 11, 14, 11, 11,
+    12, 10, 15, 13, 15, 13, 15, 16, 14, 14, 14, 12, 11, 12, 13, 12, 11, 10, 8, 10,
+    10, 9, 4, 7, 6, 16, 13, 9, 7, 14, 6, 10, 8, 7, 7, 15, 8, 7, 8, 11,
+    10, 12, 11, 6, 6, 9, 11, 6, 8, 17, 18, 12, 9, 9, 13, 15, 8, 9, 9, 9,
+    12, 9, 11, 14, 10, 13, 11, 4, 6, 8, 7, 6, 8, 3, 7, 5, 5, 6, 6, 6,
+    7, 6, 8, 9, 9, 10, 8, 10, 7, 9, 11, 15, 9, 10, 11, 10, 11, 10, 11, 15,
+    10, 10, 11, 10, 10, 12, 15, 15, 13, 14, 11, 16, 13, 11, 10, 8, 11, 16, 18, 10,
+    10, 11, 10, 18, 12, 11, 12, 11, 11, 12, 12, 14, 15, 12, 12, 13, 16, 12, 17, 8,
+    11, 15, 16, 12, 11, 10, 12, 12, 10, 11, 11, 12, 14, 14, 14, 15, 12, 12, 12, 16,
+    10, 4, 7, 6, 7, 9, 17, 16, 15, 17, 18, 11, 12, 18, 11, 19, 11, 17, 12, 14,
+    13, 14, 15, 15, 16, 8, 5, 16, 13, 8, 12, 10, 7, 7, 14, 8, 9, 15, 11, 9,
+    9, 15, 8, 8, 8, 8, 16, 14, 12, 8, 8, 12, 15, 9, 13, 15, 7, 9, 10, 5,
+    8, 7, 11, 8, 9, 11, 8, 7, 12, 10, 14, 8, 8, 11, 10, 12, 9, 11, 5, 7,
+    13, 14, 14, 10, 15, 10, 10, 10, 11, 9, 11, 13, 11, 14, 16, 13, 13, 11, 14, 16,
+    11, 11, 8, 9, 9, 7, 7, 15, 16, 10, 16, 10, 12, 9, 11, 15, 10, 10, 12, 11,
+    19, 14, 14, 9, 15, 11, 5, 7, 8, 7, 9, 9, 9, 5, 8, 10, 11, 12, 15, 13,
+    11, 11, 14, 12, 11, 12, 11, 11, 11, 13, 15, 12, 14, 11, 11, 13, 16, 15, 10, 14,
+    12, 11, 13, 8, 7, 9, 7, 7, 9, 5, 8, 8, 9, 7, 14, 8, 8, 8, 14, 9,
+    11, 16, 13, 14, 9, 12, 9, 10, 9, 4, 8, 6, 6, 7, 7, 8, 8, 8, 4, 9,
+    6, 7, 7, 8, 7, 17, 13, 9, 10, 11, 11, 11, 11, 9, 13, 16, 11, 14, 11, 11,
+    12, 17, 14, 11, 12, 5, 12, 8, 8, 12, 18, 7, 7, 9, 8, 9, 10, 11, 9, 9,
+    9, 8, 11, 10, 11, 9, 14, 9, 7, 8, 9, 8, 12, 14, 11, 20, 13, 14, 11, 11,
+    11, 11, 12, 12, 10, 12, 11, 15, 15, 16, 16, 16, 14, 18, 12, 10, 12, 13, 12, 12,
+    9, 13, 18, 17, 15, 11, 12, 12, 13, 17, 12, 16, 17, 14, 13, 13, 15, 18, 13, 13,
+    13, 14, 13, 11, 7, 11, 10, 16, 10, 13, 13, 12, 9, 12, 9, 13, 11, 9, 18, 10,
+    10, 10, 10, 12, 15, 15, 11, 12, 11, 9, 12, 11, 5, 8, 8, 10, 13, 15, 13, 8,
+    7, 14, 12, 8, 12, 7, 14, 8, 10, 15, 13, 12, 10, 12, 12, 11, 9, 9, 12, 11,
+    9, 14, 15, 12, 8, 10, 10, 7, 7, 12, 6, 8, 9, 7, 10, 8, 16, 10, 11, 11,
+    13, 11, 6, 9, 11, 14, 13, 11, 14, 8, 9, 9, 11, 10, 9, 12, 7, 9, 13, 9,
+    10, 7, 7, 9, 12, 7, 10, 8, 11, 10, 14, 10, 13, 10, 9, 10, 9, 9, 8, 9,
+    10, 9, 12, 8, 8, 7, 7, 10, 14, 9, 8, 7, 12, 11, 8, 12, 10, 12, 10, 12,
+    15, 10, 13, 14, 14, 11, 10, 9, 12, 10, 10, 9, 15, 7, 9, 11, 7, 7, 11, 11,
+    10, 9, 7, 9, 7, 8, 9, 13, 7, 6, 12, 7, 8, 7, 7, 8, 8, 7, 7, 10,
+    9, 9, 11, 11, 11, 9, 13, 12, 13, 11, 17, 9, 14, 10, 12, 9, 13, 8, 13, 8,
+    10, 19, 18, 14, 12, 14, 13, 13, 15, 13, 11, 12, 12, 14, 13, 14, 16, 12, 10, 11,
+    14, 9, 11, 15, 9, 12, 18, 14, 9, 10, 11, 11, 14, 11, 15, 12, 11, 13, 13, 16,
+    15, 16, 13, 18, 13, 11, 9, 9, 12, 13, 9, 9, 12, 12, 11, 10, 12, 10, 15, 9,
+    10, 9, 11, 16, 14, 11, 11, 17, 12, 9, 9, 9, 11, 16, 10, 9, 14, 10, 12, 11,
+    14, 17, 10, 12, 14, 12, 12, 13, 11, 9, 13, 14, 10, 11, 13, 9, 11, 13, 9, 11,
+    9, 13, 9, 13, 16, 16, 18, 9, 9, 9, 10, 11, 10, 15, 10, 10, 13, 10, 12, 13,
+    12, 9, 13, 10, 12, 12, 10, 10, 7, 11, 10, 9, 17, 11, 11, 9, 12, 11, 12, 18,
+    10, 10, 11, 9, 14, 11, 14, 10, 11, 13, 11, 11, 15, 9, 11, 6, 9, 13, 10, 15,
+    11, 9, 10, 9, 10, 8, 16, 9, 8, 10, 11, 9, 9, 11, 12, 10, 15, 10, 11, 9,
+    10, 10, 4, 7, 8, 9, 13, 12, 14, 11, 13, 11, 12, 13, 9, 13, 14, 11, 20, 19,
+    13, 13, 12, 12, 12, 12, 13, 11, 20, 18, 15, 15, 17, 18, 12, 14, 17, 13, 13, 10,
+    13, 13, 13, 15, 16, 13, 13, 19, 14, 16, 14, 14, 18, 13, 13, 13, 14, 16, 18, 14,
+    13, 13, 17, 14, 13, 4, 6, 8, 8, 4, 12, 13, 7, 8, 12, 7, 13, 6, 7, 10,
+    13, 8, 9, 9, 8, 10, 10, 8, 9, 8, 8, 4, 9, 13, 12, 7, 7, 7, 8, 7,
+    15, 7, 8, 9, 9, 8, 11, 13, 7, 6, 10, 11, 14, 13, 13, 9, 8, 17, 8, 10,
+    11, 17, 9, 9, 12, 10, 12, 9, 10, 12, 14, 12, 10, 12, 9, 5, 8, 14, 9, 19,
+    12, 10, 9, 8, 9, 19, 9, 9, 10, 9, 9, 12, 9, 9, 8, 12, 9, 5, 9, 8,
+    8, 9, 9, 9, 4, 7, 11, 7, 10, 12, 8, 9, 7, 7, 8, 12, 11, 14, 10, 9,
+    12, 8, 8, 9, 4, 7, 6, 7, 4, 11, 7, 13, 13, 8, 11, 8, 6, 10, 8, 10,
+    7, 11, 12, 8, 12, 9, 6, 6, 7, 8, 9, 5, 7, 17, 8, 7, 12, 7, 9, 15,
+    9, 8, 9, 7, 10, 19, 8, 8, 8, 9, 10, 10, 7, 15, 5, 12, 8, 14, 16, 10,
+    11, 12, 7, 7, 11, 8, 9, 8, 11, 11, 15, 12, 14, 14, 10, 12, 12, 11, 10, 19,
+    11, 11, 11, 12, 13, 12, 16, 12, 18, 15, 15, 11, 12, 8, 8, 8, 7, 11, 11, 17,
+    12, 14, 12, 13, 11, 9, 7, 9, 13, 13, 16, 11, 10, 9, 13, 8, 19, 18, 12, 11,
+    15, 12, 8, 13, 16, 16, 14, 11, 11, 12, 9, 11, 12, 9, 9, 10, 10, 15, 13, 9,
+    12, 10, 9, 9, 9, 13, 11, 12, 16, 9, 13, 13, 15, 10, 11, 12, 9, 9, 13, 14,
+    17, 10, 10, 9, 12, 8, 10, 12, 10, 11, 14, 9, 13, 14, 12, 11, 20, 11, 12, 19,
+    13, 12, 11, 13, 12, 15, 13, 13, 14, 13, 13, 17, 16, 11, 13, 14, 10, 14, 14, 12,
+    17, 12, 13, 12, 11, 13, 15, 12, 14, 11, 11, 12, 11, 13, 9, 11, 8, 9, 11, 11,
+    8, 12, 12, 9, 9, 12, 13, 14, 12, 10, 9, 9, 9, 10, 8, 12, 12, 9, 8, 13,
+    8, 9, 10, 13, 10, 6, 10, 18, 9, 11, 15, 13, 10, 9, 11, 9, 9, 9, 14, 10,
+    10, 11, 11, 12, 14, 13, 13, 10, 8, 12, 10, 9, 10, 9, 12, 13, 18, 15, 17, 16,
+    18, 11, 16, 13, 12, 11, 12, 12, 13, 14, 12, 12, 15, 13, 13, 13, 13, 13, 5, 8,
+    12, 7, 8, 9, 14, 8, 8, 8, 9, 14, 10, 14, 13, 12, 9, 10, 8, 8, 3, 5,
+    5, 7, 12, 11, 13, 8, 14, 13, 14, 16, 13, 9, 12, 14, 12, 9, 10, 9, 13, 19,
+    12, 10, 13, 18, 12, 14, 12, 16, 15, 12, 12, 8, 13, 16, 11, 12, 13, 18, 14, 10,
+    12, 12, 12, 11, 14, 9, 11, 11, 9, 14, 13, 9, 10, 10, 19, 13, 14, 8, 13, 9,
+    11, 10, 9, 10, 9, 13, 9, 12, 16, 12, 13, 11, 13, 12, 10, 10, 9, 15, 10, 9,
+    9, 14, 10, 14, 14, 9, 17, 9, 13, 14, 12, 12, 13, 12, 16, 10, 12, 11, 11, 11,
+    13, 13, 11, 12, 11, 12, 11, 13, 9, 9, 13, 10, 12, 14, 10, 10, 9, 11, 15, 15,
+    10, 13, 9, 13, 14, 11, 10, 9, 10, 9, 12, 9, 10, 11, 10, 9, 8, 10, 9, 11,
+    10, 8, 10, 7, 7, 6, 7, 10, 5, 8, 6, 15, 10, 9, 12, 12, 10, 13, 14, 10,
+    10, 15, 14, 10, 13, 12, 12, 12, 14, 12, 13, 15, 12, 11, 13, 11, 8, 17, 8, 11,
+    12, 11, 15, 9, 9, 13, 9, 13, 14, 15, 10, 11, 10, 19, 16, 19, 15, 9, 14, 14,
+    13, 12, 10, 10, 9, 15, 11, 11, 15, 9, 10, 15, 10, 17, 13, 12, 12, 11, 17, 10,
+    9, 12, 13, 10, 10, 12, 12, 13, 10, 13, 9, 10, 8, 9, 11, 10, 10, 13, 14, 14,
+    13, 14, 9, 12, 11, 14, 9, 9, 11, 13, 14, 9, 10, 13, 14, 11, 14, 10, 17, 10,
+    12, 9, 10, 12, 12, 9, 10, 11, 10, 13, 11, 9, 12, 10, 10, 9, 8, 8, 7, 16,
+    11, 10, 14, 14, 15, 14, 16, 13, 13, 13, 17, 17, 18, 17, 14, 15, 13, 13, 14, 6,
+    6, 9, 10, 6, 11, 10, 6, 8, 10, 8, 9, 8, 7, 8, 13, 9, 6, 8, 9, 14,
+    9, 8, 8, 10, 7, 9, 7, 10, 7, 9, 9, 9, 14, 9, 9, 11, 7, 9, 8, 11,
+    8, 7, 8, 9, 8, 9, 8, 9, 10, 7, 9, 10, 7, 7, 8, 12, 6, 6, 8, 6,
+    8, 12, 5, 9, 7, 5, 6, 11, 5, 6, 7, 11, 10, 8, 9, 11, 10, 7, 9, 6,
+    7, 7, 10, 10, 6, 8, 6, 9, 9, 7, 8, 11, 11, 9, 12, 8, 8, 10, 5, 10,
+    15, 9, 7, 8, 9, 8, 8, 8, 11, 11, 9, 10, 8, 9, 7, 9, 11, 6, 6, 6,
+    18, 5, 6, 10, 9, 11, 10, 10, 10, 9, 8, 12, 8, 11, 6, 9, 8, 7, 6, 8,
+    9, 6, 8, 11, 7, 7, 9, 13, 10, 7, 7, 7, 6, 7, 10, 7, 11, 9, 14, 18,
+    10, 13, 7, 11, 10, 10, 8, 10, 7, 9, 9, 9, 7, 10, 9, 11, 12, 10, 10, 6,
+    11, 10, 9, 9, 14, 14, 8, 9, 8, 7, 6, 6, 6, 8, 7, 9, 9, 10, 7, 5,
+    6, 6, 7, 10, 9, 7, 10, 3, 5, 6, 7, 6, 5, 8, 8, 12, 7, 8, 8, 8,
+    13, 12, 7, 8, 8, 10, 9, 7, 14, 8, 10, 11, 11, 9, 13, 10, 8, 19, 16, 17,
+    15, 16, 11, 17, 10, 12, 10, 11, 12, 15, 15, 11, 12, 7, 9, 14, 14, 9, 11, 10,
+    9, 10, 10, 11, 15, 14, 15, 14, 13, 5, 9, 10, 13, 16, 8, 8, 8, 9, 10, 9,
+    9, 14, 8, 13, 9, 9, 10, 12, 9, 8, 9, 7, 11, 12, 10, 10, 9, 11, 10, 9,
+    10, 10, 10, 13, 11, 16, 10, 18, 19, 15, 13, 12, 15, 9, 12, 4, 6, 8, 4, 7,
+    6, 7, 7, 8, 8, 4, 7, 7, 7, 8, 8, 8, 3, 7, 6, 10, 7, 10, 4, 6,
+    6, 8, 8, 5, 12, 5, 6, 8, 7, 6, 8, 7, 8, 11, 10, 7, 7, 5, 8, 7,
+    7, 7, 9, 5, 12, 7, 10, 7, 9, 9, 10, 19, 13, 8, 13, 10, 10, 10, 13, 12,
+    14, 9, 14, 8, 4, 8, 7, 12, 7, 18, 9, 10, 12, 6, 8, 10, 6, 12, 7, 7,
+    8, 8, 10, 7, 12, 10, 8, 8, 12, 8, 6, 8, 7, 8, 3, 5, 8, 7, 5, 13,
+    6, 5, 5, 6, 6, 11, 5, 14, 11, 8, 6, 7, 14, 10, 9, 9, 10, 9, 7, 4,
+    6, 6, 7, 8, 8, 6, 7, 18, 16, 10, 11, 16, 9, 14, 11, 10, 10, 11, 9, 13,
+    11, 13, 15, 14, 11, 14, 11, 11, 9, 11, 4, 12, 13, 10, 7, 6, 7, 7, 8, 9,
+    8, 18, 14, 7, 7, 7, 10, 12, 10, 8, 8, 9, 8, 6, 14, 7, 12, 8, 4, 7,
+    6, 7, 7, 8, 7, 8, 4, 7, 7, 7, 6, 7, 8, 8, 5, 8, 8, 9, 9, 5,
+    9, 8, 7, 8, 9, 8, 9, 3, 5, 6, 4, 8, 7, 6, 6, 5, 14, 10, 16, 8,
+    7, 7, 8, 12, 9, 11, 8, 10, 9, 11, 11, 11, 11, 13, 12, 8, 12, 4, 12, 7,
+    13, 10, 17, 13, 14, 6, 7, 7, 7, 10, 7, 9, 16, 11, 8, 8, 9, 8, 6, 8,
+    8, 4, 6, 7, 11, 11, 11, 10, 7, 6, 11, 8, 6, 7, 7, 8, 8, 16, 7, 12,
+    11, 8, 9, 9, 8, 6, 8, 9, 6, 8, 5, 8, 8, 12, 11, 8, 9, 8, 7, 15,
+    11, 7, 10, 8, 10, 9, 8, 8, 12, 9, 12, 9, 9, 7, 9, 5, 7, 9, 8, 8,
+    9, 9, 4, 7, 10, 12, 15, 6, 7, 7, 6, 8, 8, 8, 8, 10, 8, 12, 12, 11,
+    8, 7, 8, 11, 5, 8, 10, 9, 12, 11, 7, 8, 9, 9, 8, 7, 9, 8, 8, 9,
+    9, 9, 15, 11, 9, 17, 8, 12, 11, 9, 9, 11, 9, 9, 7, 7, 9, 9, 9, 9,
+};
+
+// NUL-terminated word at index
+const char *dictionary_word(int index) {
+    return DICTIONARY_BLOB + DICTIONARY_OFFSETS[index];
+}
+
+int dictionary_word_length(int index) {
+    return DICTIONARY_LENGTHS[index];
+}
+
 #endif // DICTIONARY_WORDS_H
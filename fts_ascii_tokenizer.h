@@ -0,0 +1,231 @@
+#ifndef _FTS_ASCII_TOKENIZER_H_
+#define _FTS_ASCII_TOKENIZER_H_
+
+// FTS5 tokenizer with an ASCII fast path for the generated corpus.
+//
+// Produces the same tokens as the default unicode61 tokenizer: runs of ASCII
+// letters and digits, folded to lower case. Token boundaries are found 16
+// bytes at a time with SIMD byte classification (SSE2, NEON or WASM SIMD128,
+// scalar elsewhere). Any input containing a non-ASCII byte is handed to a
+// unicode61 instance unchanged, as is everything when tokenizer arguments
+// are given.
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "cpu_dispatch.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define FTS_ASCII_SIMD "sse2"
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FTS_ASCII_SIMD "neon"
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define FTS_ASCII_SIMD "simd128"
+#else
+#define FTS_ASCII_SIMD "scalar"
+#endif
+
+#define FTS_ASCII_TOKENIZER_NAME "ascii_fast"
+#define FTS_ASCII_MAX_TOKEN 256
+
+typedef struct {
+    Fts5Tokenizer *fallback;
+    fts5_tokenizer fallback_api;
+    int fast_path;
+} fts_ascii_tokenizer;
+
+int fts_ascii_is_alnum(unsigned char c) {
+    unsigned char lower = c | 0x20;
+    return (unsigned char)(c - '0') < 10 || (unsigned char)(lower - 'a') < 26;
+}
+
+// Sets bit i of *alnum for each ASCII letter or digit in p[0..15]; returns
+// non-zero if any of the 16 bytes is outside ASCII
+int fts_ascii_classify16(const unsigned char *p, uint32_t *alnum) {
+#if defined(__SSE2__)
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    // Signed-compare range checks: bias so that [lo, lo+n) maps to [-128, -128+n)
+    __m128i digit = _mm_cmplt_epi8(_mm_add_epi8(v, _mm_set1_epi8((char)(0x80 - '0'))),
+                                   _mm_set1_epi8((char)(-128 + 10)));
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i alpha = _mm_cmplt_epi8(_mm_add_epi8(lower, _mm_set1_epi8((char)(0x80 - 'a'))),
+                                   _mm_set1_epi8((char)(-128 + 26)));
+    *alnum = (uint32_t)_mm_movemask_epi8(_mm_or_si128(digit, alpha));
+    return _mm_movemask_epi8(v) != 0;
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t v = vld1q_u8(p);
+    uint8x16_t digit = vcltq_u8(vsubq_u8(v, vdupq_n_u8('0')), vdupq_n_u8(10));
+    uint8x16_t lower = vorrq_u8(v, vdupq_n_u8(0x20));
+    uint8x16_t alpha = vcltq_u8(vsubq_u8(lower, vdupq_n_u8('a')), vdupq_n_u8(26));
+    uint8x16_t bits = vandq_u8(vorrq_u8(digit, alpha), vld1q_u8(weights));
+    bits = vpaddq_u8(bits, bits);
+    bits = vpaddq_u8(bits, bits);
+    bits = vpaddq_u8(bits, bits);
+    *alnum = vgetq_lane_u16(vreinterpretq_u16_u8(bits), 0);
+    return vmaxvq_u8(v) >= 0x80;
+#elif defined(__wasm_simd128__)
+    v128_t v = wasm_v128_load(p);
+    v128_t digit = wasm_u8x16_lt(wasm_i8x16_sub(v, wasm_i8x16_splat('0')), wasm_i8x16_splat(10));
+    v128_t lower = wasm_v128_or(v, wasm_i8x16_splat(0x20));
+    v128_t alpha = wasm_u8x16_lt(wasm_i8x16_sub(lower, wasm_i8x16_splat('a')), wasm_i8x16_splat(26));
+    *alnum = wasm_i8x16_bitmask(wasm_v128_or(digit, alpha));
+    return wasm_i8x16_bitmask(v) != 0;
+#else
+    uint32_t mask = 0;
+    int high = 0;
+    for (int i = 0; i < 16; i++) {
+        mask |= (uint32_t)fts_ascii_is_alnum(p[i]) << i;
+        high |= p[i] & 0x80;
+    }
+    *alnum = mask;
+    return high != 0;
+#endif
+}
+
+// ORs 64-byte blocks as 8-byte words, left to the compiler so that the
+// x86-64-v3 clone checks a block with two AVX2 loads
+CPU_DISPATCH_CLONES
+int fts_ascii_has_high_bytes(const unsigned char *p, int n) {
+    const uint64_t high = 0x8080808080808080ULL;
+    int i = 0;
+    for (; i + 64 <= n; i += 64) {
+        uint64_t bits = 0;
+        for (int k = 0; k < 8; k++) {
+            uint64_t word;
+            memcpy(&word, p + i + 8 * k, 8);
+            bits |= word;
+        }
+        if (bits & high) {
+            return 1;
+        }
+    }
+    for (; i + 8 <= n; i += 8) {
+        uint64_t word;
+        memcpy(&word, p + i, 8);
+        if (word & high) {
+            return 1;
+        }
+    }
+    for (; i < n; i++) {
+        if (p[i] & 0x80) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// returns the first position >= pos whose alnum class equals want, or n
+int fts_ascii_scan(const unsigned char *p, int pos, int n, int want) {
+    while (pos + 16 <= n) {
+        uint32_t alnum;
+        fts_ascii_classify16(p + pos, &alnum);
+        uint32_t hits = want ? alnum : (~alnum & 0xFFFF);
+        if (hits) {
+            return pos + __builtin_ctz(hits);
+        }
+        pos += 16;
+    }
+    while (pos < n && fts_ascii_is_alnum(p[pos]) != want) {
+        pos++;
+    }
+    return pos;
+}
+
+int fts_ascii_create(void *ctx, const char **args, int nargs, Fts5Tokenizer **out) {
+    fts5_api *api = (fts5_api *)ctx;
+    void *user_data = NULL;
+    fts_ascii_tokenizer *tok = (fts_ascii_tokenizer *)sqlite3_malloc(sizeof(fts_ascii_tokenizer));
+    if (!tok) {
+        return SQLITE_NOMEM;
+    }
+    memset(tok, 0, sizeof(*tok));
+
+    int rc = api->xFindTokenizer(api, "unicode61", &user_data, &tok->fallback_api);
+    if (rc == SQLITE_OK) {
+        rc = tok->fallback_api.xCreate(user_data, args, nargs, &tok->fallback);
+    }
+    if (rc != SQLITE_OK) {
+        sqlite3_free(tok);
+        return rc;
+    }
+    // Options such as tokenchars or separators change the token rules, so
+    // only the argument-free configuration takes the fast path
+    tok->fast_path = nargs == 0;
+    *out = (Fts5Tokenizer *)tok;
+    return SQLITE_OK;
+}
+
+void fts_ascii_delete(Fts5Tokenizer *tokenizer) {
+    fts_ascii_tokenizer *tok = (fts_ascii_tokenizer *)tokenizer;
+    tok->fallback_api.xDelete(tok->fallback);
+    sqlite3_free(tok);
+}
+
+int fts_ascii_tokenize(Fts5Tokenizer *tokenizer, void *ctx, int flags,
+                       const char *text, int n,
+                       int (*emit)(void *, int, const char *, int, int, int)) {
+    fts_ascii_tokenizer *tok = (fts_ascii_tokenizer *)tokenizer;
+    const unsigned char *p = (const unsigned char *)text;
+
+    if (!tok->fast_path || fts_ascii_has_high_bytes(p, n)) {
+        return tok->fallback_api.xTokenize(tok->fallback, ctx, flags, text, n, emit);
+    }
+
+    char folded[FTS_ASCII_MAX_TOKEN];
+    int pos = 0;
+    while (pos < n) {
+        int start = fts_ascii_scan(p, pos, n, 1);
+        if (start >= n) {
+            break;
+        }
+        int end = fts_ascii_scan(p, start + 1, n, 0);
+        int len = end - start;
+        // unicode61 has no token length limit, so spill long tokens to the heap
+        char *buf = len <= FTS_ASCII_MAX_TOKEN ? folded : (char *)sqlite3_malloc(len);
+        if (!buf) {
+            return SQLITE_NOMEM;
+        }
+        for (int i = 0; i < len; i++) {
+            unsigned char c = p[start + i];
+            buf[i] = (char)((unsigned char)(c - 'A') < 26 ? c | 0x20 : c);
+        }
+        int rc = emit(ctx, 0, buf, len, start, end);
+        if (buf != folded) {
+            sqlite3_free(buf);
+        }
+        if (rc != SQLITE_OK) {
+            return rc;
+        }
+        pos = end;
+    }
+    return SQLITE_OK;
+}
+
+fts5_api *fts5_api_from_db(sqlite3 *db) {
+    fts5_api *api = NULL;
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v2(db, "SELECT fts5(?1)", -1, &stmt, NULL) == SQLITE_OK) {
+        sqlite3_bind_pointer(stmt, 1, (void *)&api, "fts5_api_ptr", NULL);
+        sqlite3_step(stmt);
+    }
+    sqlite3_finalize(stmt);
+    return api;
+}
+
+// Registers the tokenizer as "ascii_fast" on a connection
+int fts_register_ascii_tokenizer(sqlite3 *db) {
+    static fts5_tokenizer methods = {fts_ascii_create, fts_ascii_delete, fts_ascii_tokenize};
+    fts5_api *api = fts5_api_from_db(db);
+    if (!api) {
+        fprintf(stderr, "FTS5 API not available\n");
+        return SQLITE_ERROR;
+    }
+    return api->xCreateTokenizer(api, FTS_ASCII_TOKENIZER_NAME, (void *)api, &methods, NULL);
+}
+
+#endif
@@ -0,0 +1,555 @@
+#ifndef _FTS_BENCH_H_
+#define _FTS_BENCH_H_
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include <string.h>
+#include "timestamps.h"
+#include "bench_stats.h"
+
+// FTS5 storage layouts shared by the C and C++ drivers
+typedef enum {
+    FTS_LAYOUT_REGULAR,            // FTS5 keeps its own copy of the content
+    FTS_LAYOUT_EXTERNAL,           // content read back from the source table
+    FTS_LAYOUT_CONTENTLESS,        // index only, rows cannot be deleted
+    FTS_LAYOUT_CONTENTLESS_DELETE, // index only, with delete support (3.43+)
+    FTS_LAYOUT_COUNT
+} fts_layout_t;
+
+// An FTS5 index built over the columns of a regular source table
+typedef struct {
+    const char *fts_name;
+    const char *columns;       // comma separated, same names in both tables
+    const char *source_table;
+    const char *rowid_column;  // INTEGER PRIMARY KEY of the source table
+    const char *prefix;        // prefix= option, e.g. "2 3 4", NULL for none
+    const char *tokenize;      // tokenize= option, NULL for unicode61
+} fts_index_spec;
+
+// A MATCH expression run against one of the indexes of a benchmark
+typedef struct {
+    int index;
+    const char *match;
+} fts_query_spec;
+
+// Vocabulary accessor: returns the NUL-terminated word at index
+typedef const char *(*fts_word_fn)(int index);
+
+#define FTS_BENCH_QUERY_ITERATIONS 200
+#define FTS_PREFIX_BENCH_LOOKUPS 5000
+#define FTS_QUERY_ZIPF_EXPONENT 1.0
+#define FTS_NEAR_DISTANCE 5
+
+// Query shapes drawn by the query throughput workload
+typedef enum {
+    FTS_QUERY_TERM,
+    FTS_QUERY_PHRASE,
+    FTS_QUERY_AND,
+    FTS_QUERY_OR,
+    FTS_QUERY_NOT,
+    FTS_QUERY_NEAR,
+    FTS_QUERY_KIND_COUNT
+} fts_query_kind;
+
+const char *fts_layout_name(fts_layout_t layout) {
+    switch (layout) {
+        case FTS_LAYOUT_REGULAR: return "regular";
+        case FTS_LAYOUT_EXTERNAL: return "external";
+        case FTS_LAYOUT_CONTENTLESS: return "contentless";
+        case FTS_LAYOUT_CONTENTLESS_DELETE: return "contentless-delete";
+        default: return "unknown";
+    }
+}
+
+// returns 0 and stores the layout on success, -1 for an unknown name
+int fts_layout_parse(const char *name, fts_layout_t *layout) {
+    for (int i = 0; i < FTS_LAYOUT_COUNT; i++) {
+        if (strcmp(name, fts_layout_name((fts_layout_t)i)) == 0) {
+            *layout = (fts_layout_t)i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// Contentless layouts cannot return column values, only rowids
+int fts_layout_stores_content(fts_layout_t layout) {
+    return layout == FTS_LAYOUT_REGULAR || layout == FTS_LAYOUT_EXTERNAL;
+}
+
+int fts_exec(sqlite3 *db, const char *sql) {
+    char *err_msg = 0;
+    int rc = sqlite3_exec(db, sql, 0, 0, &err_msg);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "FTS error: %s\n  in: %s\n", err_msg, sql);
+        sqlite3_free(err_msg);
+    }
+    return rc;
+}
+
+int fts_create_index(sqlite3 *db, fts_layout_t layout, const fts_index_spec *spec) {
+    char sql[512];
+    // prefix= and tokenize= come from the command line, %Q quotes them as
+    // SQL string literals
+    char *prefix = sqlite3_mprintf("");
+    if (prefix && spec->prefix && spec->prefix[0]) {
+        char *option = sqlite3_mprintf("%s, prefix=%Q", prefix, spec->prefix);
+        sqlite3_free(prefix);
+        prefix = option;
+    }
+    if (prefix && spec->tokenize && spec->tokenize[0]) {
+        char *option = sqlite3_mprintf("%s, tokenize=%Q", prefix, spec->tokenize);
+        sqlite3_free(prefix);
+        prefix = option;
+    }
+    if (!prefix) {
+        return SQLITE_NOMEM;
+    }
+    switch (layout) {
+        case FTS_LAYOUT_EXTERNAL:
+            snprintf(sql, sizeof(sql),
+                     "CREATE VIRTUAL TABLE %s USING fts5(%s, content='%s', content_rowid='%s'%s);",
+                     spec->fts_name, spec->columns, spec->source_table, spec->rowid_column,
+                     prefix);
+            break;
+        case FTS_LAYOUT_CONTENTLESS:
+            snprintf(sql, sizeof(sql),
+                     "CREATE VIRTUAL TABLE %s USING fts5(%s, content=''%s);",
+                     spec->fts_name, spec->columns, prefix);
+            break;
+        case FTS_LAYOUT_CONTENTLESS_DELETE:
+            snprintf(sql, sizeof(sql),
+                     "CREATE VIRTUAL TABLE %s USING fts5(%s, content='', contentless_delete=1%s);",
+                     spec->fts_name, spec->columns, prefix);
+            break;
+        default:
+            snprintf(sql, sizeof(sql),
+                     "CREATE VIRTUAL TABLE %s USING fts5(%s%s);",
+                     spec->fts_name, spec->columns, prefix);
+            break;
+    }
+    sqlite3_free(prefix);
+    return fts_exec(db, sql);
+}
+
+// Indexes every row of the source table, keeping rowids aligned with it
+int fts_populate_index(sqlite3 *db, fts_layout_t layout, const fts_index_spec *spec) {
+    char sql[512];
+    if (layout == FTS_LAYOUT_EXTERNAL) {
+        snprintf(sql, sizeof(sql), "INSERT INTO %s(%s) VALUES('rebuild');",
+                 spec->fts_name, spec->fts_name);
+    } else {
+        snprintf(sql, sizeof(sql), "INSERT INTO %s(rowid, %s) SELECT %s, %s FROM %s;",
+                 spec->fts_name, spec->columns, spec->rowid_column, spec->columns,
+                 spec->source_table);
+    }
+    return fts_exec(db, sql);
+}
+
+void fts_drop_index(sqlite3 *db, const fts_index_spec *spec) {
+    char sql[256];
+    snprintf(sql, sizeof(sql), "DROP TABLE IF EXISTS %s;", spec->fts_name);
+    fts_exec(db, sql);
+}
+
+// Drops, recreates and populates an index in one transaction, storing the
+// time taken by the population in microseconds
+int fts_rebuild_index(sqlite3 *db, fts_layout_t layout, const fts_index_spec *spec,
+                      timestamp_t *build_us) {
+    fts_drop_index(db, spec);
+    if (fts_create_index(db, layout, spec) != SQLITE_OK) {
+        return SQLITE_ERROR;
+    }
+
+    timestamp_t start = timestamp_us();
+    fts_exec(db, "BEGIN TRANSACTION");
+    int rc = fts_populate_index(db, layout, spec);
+    fts_exec(db, "COMMIT");
+    *build_us = timestamp_us() - start;
+    return rc;
+}
+
+// Builds the query returning the indexed columns of every match; the MATCH
+// expression is bound as parameter 1
+void fts_match_sql(fts_layout_t layout, const fts_index_spec *spec, char *sql, size_t size) {
+    if (fts_layout_stores_content(layout)) {
+        snprintf(sql, size, "SELECT %s FROM %s WHERE %s MATCH ?",
+                 spec->columns, spec->fts_name, spec->fts_name);
+    } else {
+        snprintf(sql, size, "SELECT %s FROM %s WHERE %s IN (SELECT rowid FROM %s WHERE %s MATCH ?)",
+                 spec->columns, spec->source_table, spec->rowid_column,
+                 spec->fts_name, spec->fts_name);
+    }
+}
+
+// Bytes used by the FTS5 shadow tables of an index, via the dbstat vtab
+sqlite3_int64 fts_index_bytes(sqlite3 *db, const char *fts_name) {
+    sqlite3_stmt *stmt;
+    sqlite3_int64 bytes = -1;
+    int rc = sqlite3_prepare_v2(db,
+        "SELECT COALESCE(SUM(pgsize), 0) FROM dbstat "
+        "WHERE name LIKE ?1 || '\\_%' ESCAPE '\\';", -1, &stmt, NULL);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "dbstat error: %s\n", sqlite3_errmsg(db));
+        return -1;
+    }
+    sqlite3_bind_text(stmt, 1, fts_name, -1, SQLITE_STATIC);
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        bytes = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return bytes;
+}
+
+// Runs a MATCH query repeatedly and returns the average time in microseconds
+double fts_time_query(sqlite3 *db, fts_layout_t layout, const fts_index_spec *spec,
+                      const char *match, int iterations, int *hits) {
+    char sql[512];
+    sqlite3_stmt *stmt;
+    fts_match_sql(layout, spec, sql, sizeof(sql));
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "FTS query error: %s\n", sqlite3_errmsg(db));
+        return -1.0;
+    }
+    sqlite3_bind_text(stmt, 1, match, -1, SQLITE_STATIC);
+
+    timestamp_t start = timestamp_us();
+    for (int i = 0; i < iterations; i++) {
+        *hits = 0;
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            (*hits)++;
+        }
+        sqlite3_reset(stmt);
+    }
+    timestamp_t elapsed = timestamp_us() - start;
+    sqlite3_finalize(stmt);
+    return (double)elapsed / iterations;
+}
+
+// Builds every index under each layout in turn, reporting size, build and query time
+void fts_layout_benchmark(sqlite3 *db, const char *driver,
+                          const fts_index_spec *indexes, int index_count,
+                          const fts_query_spec *queries, int query_count) {
+    char tag[128];
+
+    printf("\n=== FTS5 Layout Benchmark (%s) ===\n", driver);
+    printf("  %-20s %-22s %12s %12s\n", "layout", "index", "bytes", "build ms");
+
+    for (int l = 0; l < FTS_LAYOUT_COUNT; l++) {
+        fts_layout_t layout = (fts_layout_t)l;
+        int ok = 1;
+
+        for (int i = 0; i < index_count && ok; i++) {
+            const fts_index_spec *spec = &indexes[i];
+            timestamp_t build_us;
+            if (fts_rebuild_index(db, layout, spec, &build_us) != SQLITE_OK) {
+                printf("  %-20s not supported by this SQLite build, skipping\n",
+                       fts_layout_name(layout));
+                ok = 0;
+                break;
+            }
+            sqlite3_int64 bytes = fts_index_bytes(db, spec->fts_name);
+
+            printf("  %-20s %-22s %12lld %12.3f\n", fts_layout_name(layout),
+                   spec->fts_name, (long long)bytes, build_us / 1000.0);
+            snprintf(tag, sizeof(tag), "%s_fts_%s_%s", driver, fts_layout_name(layout),
+                     spec->fts_name);
+            print_metric(tag, "index bytes", (double)bytes);
+            print_metric(tag, "build us", (double)build_us);
+        }
+
+        for (int q = 0; q < query_count && ok; q++) {
+            const fts_index_spec *spec = &indexes[queries[q].index];
+            int hits = 0;
+            double avg_us = fts_time_query(db, layout, spec, queries[q].match,
+                                           FTS_BENCH_QUERY_ITERATIONS, &hits);
+            printf("  %-20s %-22s MATCH '%s': %d rows, %.2f us/query\n",
+                   fts_layout_name(layout), spec->fts_name, queries[q].match, hits, avg_us);
+            snprintf(tag, sizeof(tag), "%s_fts_%s_query_%s", driver,
+                     fts_layout_name(layout), queries[q].match);
+            print_metric(tag, "avg us", avg_us);
+        }
+
+        for (int i = 0; i < index_count; i++) {
+            fts_drop_index(db, &indexes[i]);
+        }
+    }
+}
+
+// Rebuilds an index once per prefix= configuration and times random prefix
+// lookups drawn from the given vocabulary. Lookup lengths are spread over
+// 2-5 characters so both indexed and non-indexed prefix lengths are covered.
+void fts_prefix_benchmark(sqlite3 *db, const char *driver, fts_layout_t layout,
+                          const fts_index_spec *index, const char *const *prefixes,
+                          int prefix_count, fts_word_fn word_at, int word_count) {
+    char tag[128];
+    char sql[512];
+    char match[32];
+    sqlite3_int64 baseline_bytes = -1;
+
+    printf("\n=== FTS5 Prefix Index Benchmark (%s, %s layout, %d lookups) ===\n",
+           driver, fts_layout_name(layout), FTS_PREFIX_BENCH_LOOKUPS);
+    printf("  %-12s %12s %12s %12s %14s\n", "prefix", "bytes", "overhead", "build ms", "lookups/s");
+
+    for (int p = 0; p < prefix_count; p++) {
+        fts_index_spec spec = *index;
+        spec.prefix = prefixes[p];
+        timestamp_t build_us;
+        if (fts_rebuild_index(db, layout, &spec, &build_us) != SQLITE_OK) {
+            continue;
+        }
+        sqlite3_int64 bytes = fts_index_bytes(db, spec.fts_name);
+        if (baseline_bytes < 0) {
+            baseline_bytes = bytes;
+        }
+
+        sqlite3_stmt *stmt;
+        snprintf(sql, sizeof(sql), "SELECT rowid FROM %s WHERE %s MATCH ?;",
+                 spec.fts_name, spec.fts_name);
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+            fprintf(stderr, "FTS query error: %s\n", sqlite3_errmsg(db));
+            continue;
+        }
+
+        // Same lookup sequence for every configuration
+        unsigned int seed = 12345;
+        long long total_hits = 0;
+        timestamp_t start = timestamp_us();
+        for (int i = 0; i < FTS_PREFIX_BENCH_LOOKUPS; i++) {
+            seed = seed * 1103515245u + 12345u;
+            const char *word = word_at((int)((seed >> 8) % word_count));
+            int len = 2 + (int)((seed >> 4) % 4);
+            int word_len = (int)strlen(word);
+            if (len > word_len) len = word_len;
+            snprintf(match, sizeof(match), "%.*s*", len, word);
+
+            sqlite3_bind_text(stmt, 1, match, -1, SQLITE_STATIC);
+            while (sqlite3_step(stmt) == SQLITE_ROW) {
+                total_hits++;
+            }
+            sqlite3_reset(stmt);
+        }
+        timestamp_t elapsed = timestamp_us() - start;
+        sqlite3_finalize(stmt);
+
+        double throughput = elapsed > 0 ? FTS_PREFIX_BENCH_LOOKUPS * 1000000.0 / elapsed : 0.0;
+        const char *label = spec.prefix && spec.prefix[0] ? spec.prefix : "none";
+        printf("  %-12s %12lld %12lld %12.3f %14.0f  (%lld rows)\n", label, (long long)bytes,
+               (long long)(bytes - baseline_bytes), build_us / 1000.0, throughput, total_hits);
+
+        snprintf(tag, sizeof(tag), "%s_fts_prefix_%s", driver, label);
+        for (char *c = tag; *c; c++) {
+            if (*c == ' ') *c = '_';
+        }
+        print_metric(tag, "index bytes", (double)bytes);
+        print_metric(tag, "overhead bytes", (double)(bytes - baseline_bytes));
+        print_metric(tag, "build us", (double)build_us);
+        print_metric(tag, "lookups per s", throughput);
+    }
+    fts_drop_index(db, index);
+}
+
+const char *fts_query_kind_name(fts_query_kind kind) {
+    switch (kind) {
+        case FTS_QUERY_TERM: return "term";
+        case FTS_QUERY_PHRASE: return "phrase";
+        case FTS_QUERY_AND: return "and";
+        case FTS_QUERY_OR: return "or";
+        case FTS_QUERY_NOT: return "not";
+        case FTS_QUERY_NEAR: return "near";
+        default: return "unknown";
+    }
+}
+
+// Writes a MATCH expression of the given kind; terms are drawn by Zipf rank
+// and mapped to words through rank_to_word
+void fts_generate_query(char *match, size_t size, fts_query_kind kind,
+                        fts_word_fn word_at, const int *rank_to_word,
+                        const zipf_table *zipf, bench_rng *rng) {
+    const char *a = word_at(rank_to_word[zipf_sample(zipf, rng)]);
+    const char *b = word_at(rank_to_word[zipf_sample(zipf, rng)]);
+    switch (kind) {
+        case FTS_QUERY_PHRASE:
+            snprintf(match, size, "\"%s %s\"", a, b);
+            break;
+        case FTS_QUERY_AND:
+            snprintf(match, size, "\"%s\" AND \"%s\"", a, b);
+            break;
+        case FTS_QUERY_OR:
+            snprintf(match, size, "\"%s\" OR \"%s\"", a, b);
+            break;
+        case FTS_QUERY_NOT:
+            snprintf(match, size, "\"%s\" NOT \"%s\"", a, b);
+            break;
+        case FTS_QUERY_NEAR:
+            snprintf(match, size, "NEAR(\"%s\" \"%s\", %d)", a, b, FTS_NEAR_DISTANCE);
+            break;
+        default:
+            snprintf(match, size, "\"%s\"", a);
+            break;
+    }
+}
+
+// Runs randomly generated queries against an FTS5 table for a fixed duration,
+// once returning every match and once bm25-ranked with ORDER BY rank LIMIT 10,
+// reporting throughput and latency percentiles overall and per query shape
+void fts_query_workload(sqlite3 *db, const char *driver, const char *fts_name,
+                        fts_word_fn word_at, int word_count, int seconds) {
+    char sql[256];
+    char match[256];
+    char tag[128];
+    zipf_table zipf;
+    bench_rng rng;
+
+    int *rank_to_word = (int *)malloc(sizeof(int) * word_count);
+    if (!rank_to_word || zipf_init(&zipf, word_count, FTS_QUERY_ZIPF_EXPONENT) != 0) {
+        fprintf(stderr, "Out of memory for FTS query workload\n");
+        free(rank_to_word);
+        return;
+    }
+
+    // Popularity must not follow alphabetical order, so shuffle the ranks
+    bench_rng_seed(&rng, 2025);
+    for (int i = 0; i < word_count; i++) {
+        rank_to_word[i] = i;
+    }
+    for (int i = word_count - 1; i > 0; i--) {
+        int j = (int)bench_rng_range(&rng, i + 1);
+        int tmp = rank_to_word[i];
+        rank_to_word[i] = rank_to_word[j];
+        rank_to_word[j] = tmp;
+    }
+
+    printf("\n=== FTS5 Query Throughput (%s, %s, %d s per variant, zipf s=%.1f) ===\n",
+           driver, fts_name, seconds, FTS_QUERY_ZIPF_EXPONENT);
+
+    for (int ranked = 0; ranked <= 1; ranked++) {
+        const char *variant = ranked ? "bm25" : "all";
+        sqlite3_stmt *stmt;
+        if (ranked) {
+            snprintf(sql, sizeof(sql),
+                     "SELECT rowid FROM %s WHERE %s MATCH ? ORDER BY rank LIMIT 10;",
+                     fts_name, fts_name);
+        } else {
+            snprintf(sql, sizeof(sql), "SELECT rowid FROM %s WHERE %s MATCH ?;",
+                     fts_name, fts_name);
+        }
+        if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+            fprintf(stderr, "FTS query error: %s\n", sqlite3_errmsg(db));
+            continue;
+        }
+
+        latency_samples overall;
+        latency_samples per_kind[FTS_QUERY_KIND_COUNT];
+        latency_init(&overall);
+        for (int k = 0; k < FTS_QUERY_KIND_COUNT; k++) {
+            latency_init(&per_kind[k]);
+        }
+
+        long long rows = 0;
+        bench_rng_seed(&rng, 42);
+        timestamp_t start = timestamp_us();
+        timestamp_t deadline = start + (timestamp_t)seconds * 1000000ULL;
+        timestamp_t now = start;
+        while (now < deadline) {
+            fts_query_kind kind = (fts_query_kind)bench_rng_range(&rng, FTS_QUERY_KIND_COUNT);
+            fts_generate_query(match, sizeof(match), kind, word_at, rank_to_word, &zipf, &rng);
+
+            timestamp_t query_start = timestamp_us();
+            sqlite3_bind_text(stmt, 1, match, -1, SQLITE_STATIC);
+            while (sqlite3_step(stmt) == SQLITE_ROW) {
+                rows++;
+            }
+            sqlite3_reset(stmt);
+            now = timestamp_us();
+
+            latency_add(&overall, now - query_start);
+            latency_add(&per_kind[kind], now - query_start);
+        }
+        timestamp_t elapsed = now - start;
+        sqlite3_finalize(stmt);
+
+        printf(" Variant '%s' (%lld rows returned):\n", variant, rows);
+        snprintf(tag, sizeof(tag), "%s_fts_query_%s", driver, variant);
+        latency_report(tag, &overall, elapsed);
+        for (int k = 0; k < FTS_QUERY_KIND_COUNT; k++) {
+            snprintf(tag, sizeof(tag), "%s_fts_query_%s_%s", driver, variant,
+                     fts_query_kind_name((fts_query_kind)k));
+            // Throughput of one shape over the time spent running it, not
+            // its share of the mix
+            latency_report(tag, &per_kind[k], latency_total(&per_kind[k]));
+            latency_free(&per_kind[k]);
+        }
+        latency_free(&overall);
+    }
+
+    zipf_free(&zipf);
+    free(rank_to_word);
+}
+
+// Times the 'rebuild' command of external-content indexes once per tokenizer
+// and checks that every tokenizer finds the same rows for the given queries.
+// The first tokenizer is the baseline that speedups are reported against.
+void fts_tokenizer_benchmark(sqlite3 *db, const char *driver,
+                             const fts_index_spec *indexes, int index_count,
+                             const char *const *tokenizers, int tokenizer_count,
+                             const fts_query_spec *queries, int query_count,
+                             int iterations) {
+    char tag[128];
+    char sql[256];
+
+    printf("\n=== FTS5 Tokenizer Rebuild Benchmark (%s, %d rebuilds) ===\n", driver, iterations);
+    printf("  %-22s %-12s %14s %10s\n", "index", "tokenizer", "rebuild ms", "speedup");
+
+    for (int i = 0; i < index_count; i++) {
+        double baseline_us = 0.0;
+        int *baseline_hits = (int *)calloc(query_count > 0 ? query_count : 1, sizeof(int));
+
+        for (int t = 0; t < tokenizer_count; t++) {
+            fts_index_spec spec = indexes[i];
+            spec.tokenize = tokenizers[t];
+            timestamp_t build_us;
+            if (fts_rebuild_index(db, FTS_LAYOUT_EXTERNAL, &spec, &build_us) != SQLITE_OK) {
+                continue;
+            }
+
+            snprintf(sql, sizeof(sql), "INSERT INTO %s(%s) VALUES('rebuild');",
+                     spec.fts_name, spec.fts_name);
+            timestamp_t start = timestamp_us();
+            for (int r = 0; r < iterations; r++) {
+                fts_exec(db, sql);
+            }
+            double avg_us = (double)(timestamp_us() - start) / iterations;
+            if (t == 0) {
+                baseline_us = avg_us;
+            }
+
+            int mismatches = 0;
+            for (int q = 0; q < query_count; q++) {
+                if (queries[q].index != i) {
+                    continue;
+                }
+                int hits = 0;
+                fts_time_query(db, FTS_LAYOUT_EXTERNAL, &spec, queries[q].match, 1, &hits);
+                if (t == 0) {
+                    baseline_hits[q] = hits;
+                } else if (hits != baseline_hits[q]) {
+                    mismatches++;
+                }
+            }
+
+            const char *name = spec.tokenize ? spec.tokenize : "unicode61";
+            printf("  %-22s %-12s %14.3f %9.2fx%s\n", spec.fts_name, name, avg_us / 1000.0,
+                   avg_us > 0 ? baseline_us / avg_us : 0.0,
+                   mismatches ? "  RESULTS DIFFER" : "");
+            snprintf(tag, sizeof(tag), "%s_fts_tokenizer_%s_%s", driver, name, spec.fts_name);
+            print_metric(tag, "rebuild us", avg_us);
+            print_metric(tag, "query mismatches", (double)mismatches);
+        }
+
+        fts_drop_index(db, &indexes[i]);
+        free(baseline_hits);
+    }
+}
+
+#endif
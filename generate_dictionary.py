@@ -115,24 +115,61 @@ def generate_dictionary(count=10000):
     
     return sorted(list(words))[:count]
 
-def main():
-    print("Generating 10,000 dictionary words...")
-    dictionary = generate_dictionary(10000)
-    
-    # Write to C header file
-    with open('dictionary_words.h', 'w') as f:
+def write_dictionary_header(dictionary, path='dictionary_words.h'):
+    """Write the words as one NUL-separated blob plus offset and length tables.
+
+    An array of string pointers needs one relocation per word at load time
+    (static-PIE binaries, wasm data segments); the blob and the integer
+    tables are plain constant data.
+    """
+    offsets = []
+    position = 0
+    for word in dictionary:
+        offsets.append(position)
+        position += len(word.encode('utf-8')) + 1
+
+    with open(path, 'w') as f:
         f.write('#ifndef DICTIONARY_WORDS_H\n')
         f.write('#define DICTIONARY_WORDS_H\n\n')
-        f.write('const char* DICTIONARY_WORDS[10000] = {\n')
-        
+        f.write('#include <stdint.h>\n\n')
+        f.write('// Generated by generate_dictionary.py\n')
+        f.write(f'#define DICTIONARY_WORD_COUNT {len(dictionary)}\n\n')
+
+        f.write('// Every word followed by a NUL, back to back\n')
+        f.write(f'const char DICTIONARY_BLOB[{position + 1}] =\n')
         for i, word in enumerate(dictionary):
-            f.write(f'    "{word}"')
-            if i < len(dictionary) - 1:
-                f.write(',')
-            f.write('\n')
-        
+            f.write(f'    "{word}\\0"')
+            f.write(';\n' if i == len(dictionary) - 1 else '\n')
+        f.write('\n')
+
+        f.write('// Start of each word in DICTIONARY_BLOB\n')
+        f.write(f'const uint32_t DICTIONARY_OFFSETS[{len(dictionary)}] = {{\n')
+        for i in range(0, len(offsets), 10):
+            f.write('    ' + ', '.join(str(o) for o in offsets[i:i + 10]) + ',\n')
         f.write('};\n\n')
+
+        f.write('// Length of each word, without the NUL\n')
+        f.write(f'const uint8_t DICTIONARY_LENGTHS[{len(dictionary)}] = {{\n')
+        lengths = [len(word.encode('utf-8')) for word in dictionary]
+        for i in range(0, len(lengths), 20):
+            f.write('    ' + ', '.join(str(n) for n in lengths[i:i + 20]) + ',\n')
+        f.write('};\n\n')
+
+        f.write('// NUL-terminated word at index\n')
+        f.write('const char *dictionary_word(int index) {\n')
+        f.write('    return DICTIONARY_BLOB + DICTIONARY_OFFSETS[index];\n')
+        f.write('}\n\n')
+        f.write('int dictionary_word_length(int index) {\n')
+        f.write('    return DICTIONARY_LENGTHS[index];\n')
+        f.write('}\n\n')
         f.write('#endif // DICTIONARY_WORDS_H\n')
+
+def main():
+    print("Generating 10,000 dictionary words...")
+    dictionary = generate_dictionary(10000)
+    
+    # Write to C header file
+    write_dictionary_header(dictionary)
     
     print(f"Generated {len(dictionary)} words and saved to dictionary_words.h")
     print("Sample words:", dictionary[:20])
@@ -0,0 +1,423 @@
+#ifndef _JSON_BENCH_H_
+#define _JSON_BENCH_H_
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "timestamps.h"
+#include "bench_stats.h"
+
+// Nested documents per unit of scale factor
+#define JSON_DOCUMENTS_PER_SCALE 100000
+// Distinct values of $.key, so an equality filter matches ~documents/KEYS rows
+#define JSON_DISTINCT_KEYS 1000
+#define JSON_MAX_EVENTS 4
+#define JSON_DOCUMENT_SIZE 1024
+#define JSON_KEY_QUERIES 2000
+// Filters on a path without a generated column parse every document
+#define JSON_SCAN_QUERIES 10
+// Line-delimited documents per unit of scale factor for the ingestion workload
+#define JSON_INGEST_DOCUMENTS_PER_SCALE 50000
+#define JSON_INGEST_FILE "json_ingest.ndjson"
+
+static const char *const JSON_TYPES[] = {"test", "event", "metric", "log"};
+static const char *const JSON_TAGS[] = {"alpha", "beta", "gamma", "delta", "epsilon", "zeta"};
+
+// Same document for every run of a given id:
+// {"id":..,"key":"k..","type":..,"user":{"name":..,"age":..,"tags":[..]},
+//  "metrics":{"cpu":..,"mem":..},"events":[{"ts":..,"kind":..},..]}
+int json_generate_document(char *buf, size_t size, int id) {
+    bench_rng rng;
+    size_t used;
+    bench_rng_seed(&rng, 32 * 1000003ULL + id);
+
+    used = snprintf(buf, size,
+                    "{\"id\":%d,\"key\":\"k%d\",\"type\":\"%s\","
+                    "\"user\":{\"name\":\"user%d\",\"age\":%d,\"tags\":[\"%s\",\"%s\"]},"
+                    "\"metrics\":{\"cpu\":%.3f,\"mem\":%d},\"events\":[",
+                    id, (int)bench_rng_range(&rng, JSON_DISTINCT_KEYS),
+                    JSON_TYPES[bench_rng_range(&rng, 4)],
+                    (int)bench_rng_range(&rng, 100000), 18 + (int)bench_rng_range(&rng, 60),
+                    JSON_TAGS[bench_rng_range(&rng, 6)], JSON_TAGS[bench_rng_range(&rng, 6)],
+                    bench_rng_uniform(&rng) * 100.0, (int)bench_rng_range(&rng, 65536));
+    int events = 1 + (int)bench_rng_range(&rng, JSON_MAX_EVENTS);
+    for (int e = 0; e < events && used < size; e++) {
+        used += snprintf(buf + used, size - used, "%s{\"ts\":%d,\"kind\":\"%s\"}",
+                         e ? "," : "", 1700000000 + (int)bench_rng_range(&rng, 86400),
+                         JSON_TYPES[bench_rng_range(&rng, 4)]);
+    }
+    if (used < size) {
+        used += snprintf(buf + used, size - used, "]}");
+    }
+    return used < size ? (int)used : (int)size - 1;
+}
+
+int json_exec(sqlite3 *db, const char *sql) {
+    char *err = NULL;
+    int rc = sqlite3_exec(db, sql, NULL, NULL, &err);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "JSON error: %s\n", err ? err : sqlite3_errmsg(db));
+        sqlite3_free(err);
+    }
+    return rc;
+}
+
+// jsonb() arrived in SQLite 3.45
+int json_jsonb_supported(sqlite3 *db) {
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(db, "SELECT jsonb('{}')", -1, &stmt, NULL);
+    sqlite3_finalize(stmt);
+    return rc == SQLITE_OK;
+}
+
+// Inserts documents first_id..first_id+count-1 into table(data) inside one
+// transaction, converting them with jsonb() when binary is set
+int json_populate(sqlite3 *db, const char *table, int first_id, int count, int binary) {
+    char sql[256];
+    char doc[JSON_DOCUMENT_SIZE];
+    sqlite3_stmt *stmt;
+
+    snprintf(sql, sizeof(sql), "INSERT INTO %s (data) VALUES (%s);", table,
+             binary ? "jsonb(?1)" : "?1");
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "JSON error: %s\n", sqlite3_errmsg(db));
+        return SQLITE_ERROR;
+    }
+    json_exec(db, "BEGIN TRANSACTION");
+    for (int i = 0; i < count; i++) {
+        int len = json_generate_document(doc, sizeof(doc), first_id + i);
+        sqlite3_bind_text(stmt, 1, doc, len, SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            fprintf(stderr, "JSON insert error: %s\n", sqlite3_errmsg(db));
+        }
+        sqlite3_reset(stmt);
+    }
+    json_exec(db, "COMMIT");
+    sqlite3_finalize(stmt);
+    return SQLITE_OK;
+}
+
+// Runs sql with ?1 bound to a random "k.." key (when it has a parameter)
+// and reports per-query latency under tag
+void json_time_filter(sqlite3 *db, const char *sql, int queries, const char *tag) {
+    sqlite3_stmt *stmt;
+    bench_rng rng;
+    latency_samples samples;
+    long long rows = 0;
+    char key[32];
+
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "JSON error: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+    latency_init(&samples);
+    bench_rng_seed(&rng, 3200);
+    timestamp_t start = timestamp_us();
+    for (int q = 0; q < queries; q++) {
+        timestamp_t query_start = timestamp_us();
+        if (sqlite3_bind_parameter_count(stmt) > 0) {
+            snprintf(key, sizeof(key), "k%d", (int)bench_rng_range(&rng, JSON_DISTINCT_KEYS));
+            sqlite3_bind_text(stmt, 1, key, -1, SQLITE_TRANSIENT);
+        }
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            rows += sqlite3_column_int64(stmt, 0);
+        }
+        sqlite3_reset(stmt);
+        latency_add(&samples, timestamp_us() - query_start);
+    }
+    timestamp_t elapsed = timestamp_us() - start;
+    sqlite3_finalize(stmt);
+
+    printf("  %.1f matching rows per query\n", queries ? (double)rows / queries : 0.0);
+    latency_report(tag, &samples, elapsed);
+    latency_free(&samples);
+}
+
+// Compares text JSON with JSONB storage, STORED with VIRTUAL generated
+// columns on $.key, and no index with an index on the generated column.
+// The index exists during the load, so insert throughput includes its upkeep.
+void json_benchmark(sqlite3 *db, const char *driver, double scale) {
+    static const char *const storage_names[] = {"text", "jsonb"};
+    static const char *const column_kinds[] = {"STORED", "VIRTUAL"};
+    char sql[512];
+    char tag[128];
+    char table[64];
+    int count = (int)(scale * JSON_DOCUMENTS_PER_SCALE);
+    int jsonb = json_jsonb_supported(db);
+    if (count < 1) count = 1;
+
+    printf("\n=== JSON Benchmark (%s, %d documents, scale %.2f) ===\n", driver, count, scale);
+    for (int binary = 0; binary <= 1; binary++) {
+        if (binary && !jsonb) {
+            printf("  jsonb() not supported by this SQLite build, skipping\n");
+            break;
+        }
+        for (int kind = 0; kind < 2; kind++) {
+            for (int indexed = 0; indexed <= 1; indexed++) {
+                snprintf(table, sizeof(table), "json_bench_%s_%s%s", storage_names[binary],
+                         kind ? "virtual" : "stored", indexed ? "_indexed" : "");
+                snprintf(sql, sizeof(sql), "DROP TABLE IF EXISTS %s;", table);
+                json_exec(db, sql);
+                snprintf(sql, sizeof(sql),
+                         "CREATE TABLE %s (id INTEGER PRIMARY KEY, data BLOB, "
+                         "extracted_value TEXT GENERATED ALWAYS AS (json_extract(data, '$.key')) %s);",
+                         table, column_kinds[kind]);
+                if (json_exec(db, sql) != SQLITE_OK) {
+                    continue;
+                }
+                if (indexed) {
+                    snprintf(sql, sizeof(sql), "CREATE INDEX %s_value ON %s(extracted_value);",
+                             table, table);
+                    json_exec(db, sql);
+                }
+
+                timestamp_t start = timestamp_us();
+                json_populate(db, table, 1, count, binary);
+                timestamp_t load_us = timestamp_us() - start;
+                double rows_per_s = load_us ? count * 1000000.0 / load_us : 0.0;
+
+                snprintf(sql, sizeof(sql), "SELECT SUM(pgsize) FROM dbstat WHERE name = '%s';", table);
+                sqlite3_stmt *stmt;
+                sqlite3_int64 bytes = 0;
+                if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) == SQLITE_OK &&
+                    sqlite3_step(stmt) == SQLITE_ROW) {
+                    bytes = sqlite3_column_int64(stmt, 0);
+                }
+                sqlite3_finalize(stmt);
+
+                printf(" %s: insert %.1f ms (%.0f rows/s), %lld table bytes\n", table,
+                       load_us / 1000.0, rows_per_s, (long long)bytes);
+                snprintf(tag, sizeof(tag), "%s_%s", driver, table);
+                print_metric(tag, "insert us", (double)load_us);
+                print_metric(tag, "insert rows per s", rows_per_s);
+                print_metric(tag, "bytes", (double)bytes);
+
+                snprintf(sql, sizeof(sql), "SELECT COUNT(*) FROM %s WHERE extracted_value = ?1;", table);
+                snprintf(tag, sizeof(tag), "%s_%s_filter_key", driver, table);
+                json_time_filter(db, sql, indexed ? JSON_KEY_QUERIES : JSON_SCAN_QUERIES, tag);
+
+                snprintf(sql, sizeof(sql),
+                         "SELECT COUNT(*) FROM %s WHERE json_extract(data, '$.type') = 'test';", table);
+                snprintf(tag, sizeof(tag), "%s_%s_filter_type", driver, table);
+                json_time_filter(db, sql, JSON_SCAN_QUERIES, tag);
+
+                snprintf(sql, sizeof(sql), "DROP TABLE %s;", table);
+                json_exec(db, sql);
+            }
+        }
+    }
+}
+
+// Relational targets for the ingestion workload: one row per document, per
+// event and per tag, plus every scalar leaf found by json_tree
+static const char *const JSON_INGEST_SCHEMA =
+    "DROP TABLE IF EXISTS ingest_docs;"
+    "DROP TABLE IF EXISTS ingest_events;"
+    "DROP TABLE IF EXISTS ingest_tags;"
+    "DROP TABLE IF EXISTS ingest_attributes;"
+    "CREATE TABLE ingest_docs (id INTEGER PRIMARY KEY, key TEXT, type TEXT, "
+    "user_name TEXT, age INTEGER, cpu REAL, mem INTEGER);"
+    "CREATE TABLE ingest_events (doc_id INTEGER, ts INTEGER, kind TEXT);"
+    "CREATE TABLE ingest_tags (doc_id INTEGER, tag TEXT);"
+    "CREATE TABLE ingest_attributes (doc_id INTEGER, path TEXT, value);";
+
+// Writes count documents, one per line, and returns the file size or -1
+long json_write_ndjson(const char *path, int count) {
+    char doc[JSON_DOCUMENT_SIZE];
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "Cannot create %s\n", path);
+        return -1;
+    }
+    long bytes = 0;
+    for (int i = 1; i <= count; i++) {
+        int len = json_generate_document(doc, sizeof(doc), i);
+        fwrite(doc, 1, len, file);
+        fputc('\n', file);
+        bytes += len + 1;
+    }
+    fclose(file);
+    return bytes;
+}
+
+sqlite3_int64 json_ingested_rows(sqlite3 *db) {
+    sqlite3_stmt *stmt;
+    sqlite3_int64 rows = 0;
+    if (sqlite3_prepare_v2(db,
+                           "SELECT (SELECT COUNT(*) FROM ingest_docs) + (SELECT COUNT(*) FROM ingest_events)"
+                           " + (SELECT COUNT(*) FROM ingest_tags) + (SELECT COUNT(*) FROM ingest_attributes);",
+                           -1, &stmt, NULL) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+        rows = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return rows;
+}
+
+// Per-row path: each line is bound to four prepared INSERT ... SELECT
+// statements that pick it apart with json_extract, json_each and json_tree
+int json_ingest_per_row(sqlite3 *db, const char *path) {
+    static const char *const sql[] = {
+        "INSERT INTO ingest_docs SELECT json_extract(?1, '$.id'), json_extract(?1, '$.key'), "
+        "json_extract(?1, '$.type'), json_extract(?1, '$.user.name'), json_extract(?1, '$.user.age'), "
+        "json_extract(?1, '$.metrics.cpu'), json_extract(?1, '$.metrics.mem');",
+        "INSERT INTO ingest_events SELECT json_extract(?1, '$.id'), json_extract(value, '$.ts'), "
+        "json_extract(value, '$.kind') FROM json_each(?1, '$.events');",
+        "INSERT INTO ingest_tags SELECT json_extract(?1, '$.id'), value FROM json_each(?1, '$.user.tags');",
+        "INSERT INTO ingest_attributes SELECT json_extract(?1, '$.id'), fullkey, atom "
+        "FROM json_tree(?1) WHERE atom IS NOT NULL;",
+    };
+    sqlite3_stmt *stmts[4];
+    char line[JSON_DOCUMENT_SIZE + 2];
+    int rc = SQLITE_OK;
+
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return SQLITE_ERROR;
+    }
+    for (int s = 0; s < 4; s++) {
+        if (sqlite3_prepare_v2(db, sql[s], -1, &stmts[s], NULL) != SQLITE_OK) {
+            fprintf(stderr, "JSON error: %s\n", sqlite3_errmsg(db));
+            while (s-- > 0) sqlite3_finalize(stmts[s]);
+            fclose(file);
+            return SQLITE_ERROR;
+        }
+    }
+
+    json_exec(db, "BEGIN TRANSACTION");
+    while (rc == SQLITE_OK && fgets(line, sizeof(line), file)) {
+        int len = (int)strcspn(line, "\n");
+        if (len == 0) continue;
+        for (int s = 0; s < 4; s++) {
+            sqlite3_bind_text(stmts[s], 1, line, len, SQLITE_STATIC);
+            if (sqlite3_step(stmts[s]) != SQLITE_DONE) {
+                fprintf(stderr, "JSON ingest error: %s\n", sqlite3_errmsg(db));
+                rc = SQLITE_ERROR;
+            }
+            sqlite3_reset(stmts[s]);
+        }
+    }
+    json_exec(db, "COMMIT");
+    for (int s = 0; s < 4; s++) {
+        sqlite3_finalize(stmts[s]);
+    }
+    fclose(file);
+    return rc;
+}
+
+// Set-based path: the whole file becomes one JSON array, json_each splits it
+// into a staging table in a single statement (as JSONB when available) and
+// each relational table is filled by one INSERT ... SELECT over the staging
+int json_ingest_set_based(sqlite3 *db, const char *path, int binary) {
+    static const char *const sql[] = {
+        "INSERT INTO ingest_docs SELECT json_extract(doc, '$.id'), json_extract(doc, '$.key'), "
+        "json_extract(doc, '$.type'), json_extract(doc, '$.user.name'), json_extract(doc, '$.user.age'), "
+        "json_extract(doc, '$.metrics.cpu'), json_extract(doc, '$.metrics.mem') FROM ingest_staging;",
+        "INSERT INTO ingest_events SELECT json_extract(s.doc, '$.id'), json_extract(e.value, '$.ts'), "
+        "json_extract(e.value, '$.kind') FROM ingest_staging s, json_each(s.doc, '$.events') e;",
+        "INSERT INTO ingest_tags SELECT json_extract(s.doc, '$.id'), t.value "
+        "FROM ingest_staging s, json_each(s.doc, '$.user.tags') t;",
+        "INSERT INTO ingest_attributes SELECT json_extract(s.doc, '$.id'), t.fullkey, t.atom "
+        "FROM ingest_staging s, json_tree(s.doc) t WHERE t.atom IS NOT NULL;",
+    };
+    sqlite3_stmt *stmt;
+    int rc = SQLITE_OK;
+
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return SQLITE_ERROR;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    // "[" + lines joined by "," + "]"
+    char *array = (char *)malloc(size + 3);
+    if (!array) {
+        fclose(file);
+        return SQLITE_NOMEM;
+    }
+    array[0] = '[';
+    size_t len = 1 + fread(array + 1, 1, size, file);
+    fclose(file);
+    while (len > 1 && array[len - 1] == '\n') len--;
+    for (size_t i = 1; i < len; i++) {
+        if (array[i] == '\n') array[i] = ',';
+    }
+    array[len++] = ']';
+
+    json_exec(db, "DROP TABLE IF EXISTS ingest_staging; CREATE TEMP TABLE ingest_staging (doc);");
+    json_exec(db, "BEGIN TRANSACTION");
+    if (sqlite3_prepare_v2(db, binary
+                               ? "INSERT INTO ingest_staging SELECT jsonb(value) FROM json_each(?1);"
+                               : "INSERT INTO ingest_staging SELECT value FROM json_each(?1);",
+                           -1, &stmt, NULL) == SQLITE_OK) {
+        sqlite3_bind_text(stmt, 1, array, (int)len, SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE) rc = SQLITE_ERROR;
+    } else {
+        rc = SQLITE_ERROR;
+    }
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "JSON ingest error: %s\n", sqlite3_errmsg(db));
+    }
+    sqlite3_finalize(stmt);
+    for (int s = 0; s < 4 && rc == SQLITE_OK; s++) {
+        rc = json_exec(db, sql[s]);
+    }
+    json_exec(db, "COMMIT");
+    json_exec(db, "DROP TABLE ingest_staging;");
+    free(array);
+    return rc;
+}
+
+// Generates scale x JSON_INGEST_DOCUMENTS_PER_SCALE documents as a
+// line-delimited file in the working directory and ingests it per row and
+// set-based (text and JSONB staging), reporting MB/s parsed and rows/s inserted
+void json_ingest_benchmark(sqlite3 *db, const char *driver, double scale) {
+    static const char *const path_names[] = {"per_row", "set_based_text", "set_based_jsonb"};
+    char tag[128];
+    int count = (int)(scale * JSON_INGEST_DOCUMENTS_PER_SCALE);
+    if (count < 1) count = 1;
+
+    printf("\n=== JSON Ingestion Benchmark (%s, %d documents, scale %.2f) ===\n", driver, count, scale);
+    timestamp_t start = timestamp_us();
+    long bytes = json_write_ndjson(JSON_INGEST_FILE, count);
+    if (bytes < 0) {
+        return;
+    }
+    printf(" %s: %ld bytes written in %.1f ms\n", JSON_INGEST_FILE, bytes,
+           (timestamp_us() - start) / 1000.0);
+
+    for (int path = 0; path < 3; path++) {
+        if (path == 2 && !json_jsonb_supported(db)) {
+            printf("  jsonb() not supported by this SQLite build, skipping\n");
+            break;
+        }
+        json_exec(db, JSON_INGEST_SCHEMA);
+        start = timestamp_us();
+        int rc = path == 0 ? json_ingest_per_row(db, JSON_INGEST_FILE)
+                           : json_ingest_set_based(db, JSON_INGEST_FILE, path == 2);
+        timestamp_t elapsed = timestamp_us() - start;
+        if (rc != SQLITE_OK) {
+            continue;
+        }
+        sqlite3_int64 rows = json_ingested_rows(db);
+        double mb_per_s = elapsed ? bytes / (1024.0 * 1024.0) * 1000000.0 / elapsed : 0.0;
+        double rows_per_s = elapsed ? rows * 1000000.0 / elapsed : 0.0;
+
+        printf("  %-16s %8.1f ms  %8.2f MB/s  %10lld rows  %10.0f rows/s\n", path_names[path],
+               elapsed / 1000.0, mb_per_s, (long long)rows, rows_per_s);
+        snprintf(tag, sizeof(tag), "%s_json_ingest_%s", driver, path_names[path]);
+        print_metric(tag, "elapsed us", (double)elapsed);
+        print_metric(tag, "MB per s", mb_per_s);
+        print_metric(tag, "rows", (double)rows);
+        print_metric(tag, "rows per s", rows_per_s);
+    }
+    json_exec(db, "DROP TABLE ingest_docs; DROP TABLE ingest_events; "
+                  "DROP TABLE ingest_tags; DROP TABLE ingest_attributes;");
+    remove(JSON_INGEST_FILE);
+}
+
+#endif
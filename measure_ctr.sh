@@ -24,20 +24,39 @@ TAG="1.1"
 # WASM runtimes to test
 WASM_RUNTIMES=("wasmtime" "wamr" "wasmer")
 
+# Extra WASM image variants, tagged $TAG-<variant> (e.g. make docker-push-wasm-slim);
+# simd is pushed by make docker-build-push. WASM_VARIANTS="" tests only the base image
+read -r -a WASM_VARIANTS <<< "${WASM_VARIANTS-simd}"
+
 # Cache busting configuration
 USE_DIGEST=${USE_DIGEST:-false}
 
+# AOT_MODE=true measures compile-once (AOT) vs per-start JIT costs of the
+# local WASM_MODULE with each runtime instead of pulling images
+AOT_MODE=${AOT_MODE:-false}
+WASM_MODULE=${WASM_MODULE:-massive_sqlite.wasm}
+aot_output_file="aot_timing_results.csv"
+
 # Detect current architecture
 ARCH=$(uname -m)
+WASMER_FLAGS=""
 case $ARCH in
     x86_64)
         PLATFORM="linux/amd64"
+        AOT_ARCH="x86_64"
+        WAMRC_FLAGS="--target=x86_64"
         ;;
     aarch64|arm64)
         PLATFORM="linux/arm64"
+        AOT_ARCH="aarch64"
+        WAMRC_FLAGS="--target=aarch64v8"
         ;;
     riscv64)
         PLATFORM="linux/riscv64"
+        AOT_ARCH="riscv64"
+        WAMRC_FLAGS="--target=riscv64 --target-abi=lp64d --cpu=generic-rv64 --cpu-features=+m,+a,+c,+f,+d"
+        # Cranelift has no riscv64 backend in wasmer
+        WASMER_FLAGS="--llvm"
         ;;
     *)
         echo "Error: Unsupported architecture: $ARCH"
@@ -49,6 +68,135 @@ esac
 # Check dependencies
 command -v bc >/dev/null 2>&1 || { echo "Error: bc is required but not installed." >&2; exit 1; }
 
+# Runs one start of a WASM command and sets start_to_main, main_to_elapsed
+# and total_elapsed (s); the output must carry the main and duration lines
+run_wasm_start() {
+    local launch_time=$(date +%s.%3N)
+    local exec_output
+    exec_output=$(env -u WABENCH_FILE "$@" 2>&1)
+    local end_time=$(date +%s.%3N)
+    local main_timestamp=$(echo "$exec_output" | sed -n 's/.*main, timestamp, \([0-9][0-9]*\).*/\1/p' | head -1)
+    local elapsed_timestamp=$(echo "$exec_output" | sed -n 's/.*duration, elapsed time, \([0-9][0-9]*\).*/\1/p' | head -1)
+
+    total_elapsed=$(echo "$end_time - $launch_time" | bc)
+    if [ -n "$main_timestamp" ]; then
+        start_to_main=$(echo "scale=3; $main_timestamp / 1000 - $launch_time" | bc)
+    else
+        start_to_main="N/A"
+        echo "ERROR: no main timestamp from: $*" >&2
+        echo "First 200 chars: $(echo "$exec_output" | head -c 200)" >&2
+    fi
+    if [ -n "$elapsed_timestamp" ]; then
+        main_to_elapsed=$(echo "scale=3; $elapsed_timestamp / 1000" | bc)
+    else
+        main_to_elapsed="N/A"
+    fi
+}
+
+# For each runtime: compile WASM_MODULE ahead of time once (timed), then
+# start the plain module (compiled at every start; WAMR uses whatever mode
+# iwasm was built with) and the precompiled artifact n times each
+measure_aot() {
+    echo "Runtime,Mode,Artifact,Iteration,Compile Time (s),Start to Main Time (s),Main to Elapsed Time (s),Total Execution Time (s),Artifact Size (MB)" > "$aot_output_file"
+    if [ ! -f "$WASM_MODULE" ]; then
+        echo "Error: $WASM_MODULE not found (make wasm)"
+        exit 1
+    fi
+
+    for wasm_runtime in "${WASM_RUNTIMES[@]}"; do
+        local compile_cmd jit_cmd aot_cmd artifact
+        case $wasm_runtime in
+            "wasmtime")
+                artifact="massive_sqlite.$AOT_ARCH.cwasm"
+                compile_cmd=(wasmtime compile "$WASM_MODULE" -o "$artifact")
+                # No compilation cache, so every start compiles
+                jit_cmd=(wasmtime run -C cache=n --dir . "$WASM_MODULE")
+                aot_cmd=(wasmtime run --allow-precompiled --dir . "$artifact")
+                ;;
+            "wamr")
+                artifact="massive_sqlite.$AOT_ARCH.aot"
+                compile_cmd=(wamrc $WAMRC_FLAGS -o "$artifact" "$WASM_MODULE")
+                jit_cmd=(iwasm --dir=. "$WASM_MODULE")
+                aot_cmd=(iwasm --dir=. "$artifact")
+                ;;
+            "wasmer")
+                artifact="massive_sqlite.$AOT_ARCH.wasmu"
+                compile_cmd=(wasmer compile $WASMER_FLAGS "$WASM_MODULE" -o "$artifact")
+                jit_cmd=(wasmer run $WASMER_FLAGS --disable-cache --dir . "$WASM_MODULE")
+                aot_cmd=(wasmer run --dir . "$artifact")
+                ;;
+        esac
+        if ! command -v "${compile_cmd[0]}" >/dev/null 2>&1 || ! command -v "${jit_cmd[0]}" >/dev/null 2>&1; then
+            local tools="${compile_cmd[0]}"
+            [ "${jit_cmd[0]}" != "$tools" ] && tools="$tools and ${jit_cmd[0]}"
+            echo "$wasm_runtime: needs $tools, skipping"
+            continue
+        fi
+
+        echo ""
+        echo "=== AOT vs JIT: $wasm_runtime ==="
+        local compile_start=$(date +%s.%3N)
+        if ! "${compile_cmd[@]}" >/dev/null 2>&1; then
+            echo "ERROR: ${compile_cmd[*]} failed" >&2
+            continue
+        fi
+        local compile_elapsed=$(echo "$(date +%s.%3N) - $compile_start" | bc)
+        local module_size=$(echo "scale=3; $(stat -c %s "$WASM_MODULE") / 1048576" | bc)
+        local artifact_size=$(echo "scale=3; $(stat -c %s "$artifact") / 1048576" | bc)
+        echo "  compile once: ${compile_elapsed}s, $artifact ${artifact_size}MB"
+
+        for ((i=1; i<=n; i++))
+        do
+            run_wasm_start "${jit_cmd[@]}"
+            echo "  Iteration $i/$n: JIT start to main ${start_to_main}s, total ${total_elapsed}s"
+            echo "\"$wasm_runtime\",\"JIT\",\"$WASM_MODULE\",$i,0,\"$start_to_main\",\"$main_to_elapsed\",$total_elapsed,$module_size" >> "$aot_output_file"
+
+            run_wasm_start "${aot_cmd[@]}"
+            echo "  Iteration $i/$n: AOT start to main ${start_to_main}s, total ${total_elapsed}s"
+            echo "\"$wasm_runtime\",\"AOT\",\"$artifact\",$i,$compile_elapsed,\"$start_to_main\",\"$main_to_elapsed\",$total_elapsed,$artifact_size" >> "$aot_output_file"
+        done
+    done
+
+    echo ""
+    echo "Results saved to: $aot_output_file"
+    if command -v python3 >/dev/null 2>&1; then
+        python3 -c "
+import pandas as pd
+try:
+    df = pd.read_csv('$aot_output_file', na_values=['N/A'])
+    columns = ['Compile Time (s)', 'Start to Main Time (s)', 'Main to Elapsed Time (s)', 'Total Execution Time (s)', 'Artifact Size (MB)']
+    summary = df.groupby(['Runtime', 'Mode'])[columns].mean()
+    print('Average per start by Runtime and Mode:')
+    print(summary.round(3))
+
+    print('\nCompile once vs compile per start:')
+    for wasm_runtime in df['Runtime'].unique():
+        if (wasm_runtime, 'JIT') not in summary.index or (wasm_runtime, 'AOT') not in summary.index:
+            continue
+        jit = summary.loc[(wasm_runtime, 'JIT')]
+        aot = summary.loc[(wasm_runtime, 'AOT')]
+        saved = jit['Start to Main Time (s)'] - aot['Start to Main Time (s)']
+        compile_time = aot['Compile Time (s)']
+        if saved > 0:
+            print(f'{wasm_runtime}: AOT saves {saved:.3f}s per start; compiling once ({compile_time:.3f}s) pays off after {compile_time / saved:.1f} starts')
+        else:
+            print(f'{wasm_runtime}: AOT saves no start time ({saved:.3f}s per start)')
+except Exception as e:
+    print(f'Error analyzing CSV file: {e}')
+"
+    fi
+}
+
+if [ "$AOT_MODE" = "true" ]; then
+    echo "SQLite WASM AOT vs JIT Measurement"
+    echo "=================================="
+    echo "Current architecture: $ARCH"
+    echo "Module: $WASM_MODULE"
+    echo "Iterations: $n"
+    measure_aot
+    exit 0
+fi
+
 echo "SQLite Native Architecture Performance Measurement"
 echo "================================================="
 echo "Current architecture: $ARCH"
@@ -652,6 +800,9 @@ for wasm_runtime in "${WASM_RUNTIMES[@]}"; do
     echo ""
     echo "=== Testing WASM Runtime: $wasm_runtime ==="
     test_image "$WASM_IMAGE" "wasm" "WebAssembly ($wasm_runtime)" "$wasm_runtime"
+    for variant in "${WASM_VARIANTS[@]}"; do
+        test_image "docker.io/$WASM_REPO:$TAG-$variant" "wasm" "WebAssembly $variant ($wasm_runtime)" "$wasm_runtime"
+    done
 done
 
 echo "Performance measurement completed!"
@@ -678,9 +829,20 @@ try:
     print(summary.round(3))
     
     print('\nWASM Runtime Comparison:')
-    wasm_summary = df[df['Image Type'] == 'WebAssembly'].groupby(['Runtime', 'WASM_Runtime'])[['Pull Time (s)', 'Container Start to Main Time (s)', 'Main to Elapsed Time (s)', 'Total Execution Time (s)', 'Host Size (MB)']].mean()
+    wasm_summary = df[df['Image Type'] == 'WebAssembly'].groupby(['Runtime', 'WASM_Runtime', 'Image'])[['Pull Time (s)', 'Container Start to Main Time (s)', 'Main to Elapsed Time (s)', 'Total Execution Time (s)', 'Host Size (MB)']].mean()
     print(wasm_summary.round(3))
     
+    print('\nWASM variant speedup over the base image (main to elapsed):')
+    wasm = df[df['Image Type'] == 'WebAssembly'].copy()
+    wasm['Variant'] = wasm['Image'].apply(lambda x: x.rsplit(':', 1)[-1].split('-', 1)[1] if '-' in x.rsplit(':', 1)[-1] else 'base')
+    prog = wasm.groupby(['WASM_Runtime', 'Variant'])['Main to Elapsed Time (s)'].mean().unstack()
+    for variant in [v for v in prog.columns if v != 'base']:
+        for wasm_runtime, row in prog.iterrows():
+            base_time = row['base'] if 'base' in prog.columns else 0
+            variant_time = row[variant]
+            if base_time > 0 and variant_time > 0:
+                print(f'{wasm_runtime} {variant}: {base_time / variant_time:.2f}x ({variant_time:.3f}s vs {base_time:.3f}s)')
+    
     print('\nOverall averages by Image Type:')
     overall = df.groupby('Image Type')[['Pull Time (s)', 'Container Start to Main Time (s)', 'Main to Elapsed Time (s)', 'Total Execution Time (s)', 'Host Size (MB)']].mean()
     print(overall.round(3))
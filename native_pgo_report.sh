@@ -0,0 +1,110 @@
+#!/bin/bash
+
+# Native PGO Comparison Report
+# Runs the default and the profile-guided build (make native-pgo) on the same
+# workload and compares the run time and every timing metric they report.
+# VARIANT names the second build, e.g. VARIANT=tuned for make native-tuned.
+
+export LC_NUMERIC=C
+
+if [ "$#" -lt 2 ]; then
+    echo "Usage: $0 <default binary> <pgo binary> [benchmark options]"
+    echo "Example: $0 ./massive_sqlite ./massive_sqlite_pgo --scale=2 --fts-bench"
+    echo "Environment: RUNS (default 3), VARIANT (default PGO)"
+    exit 1
+fi
+
+BASE_BINARY=$1
+PGO_BINARY=$2
+shift 2
+WORKLOAD=("$@")
+RUNS=${RUNS:-3}
+VARIANT=${VARIANT:-PGO}
+output_file=${OUTPUT_FILE:-$(echo "$VARIANT" | tr '[:upper:]' '[:lower:]')_report.csv}
+work_dir=$(mktemp -d)
+trap 'rm -rf "$work_dir"' EXIT
+
+for binary in "$BASE_BINARY" "$PGO_BINARY"; do
+    if [ ! -x "$binary" ]; then
+        echo "Error: $binary not found"
+        exit 1
+    fi
+done
+
+echo "=== Native $VARIANT Comparison Report ==="
+echo "Architecture: $(uname -m)"
+echo "Workload: ${WORKLOAD[*]:-default}"
+echo "Runs: $RUNS per binary (interleaved)"
+echo ""
+
+echo "1. Binary sizes:"
+printf "   %-32s %12d bytes\n" "$BASE_BINARY" "$(stat -c %s "$BASE_BINARY")"
+printf "   %-32s %12d bytes\n" "$PGO_BINARY" "$(stat -c %s "$PGO_BINARY")"
+echo ""
+
+# Metrics of each run go to their own file; the benchmarks write scratch
+# databases to the current directory, so run inside work_dir
+base_path=$(realpath "$BASE_BINARY")
+pgo_path=$(realpath "$PGO_BINARY")
+echo "2. Running..."
+for ((i=1; i<=RUNS; i++)); do
+    for variant in base pgo; do
+        binary=$base_path
+        label=default
+        if [ "$variant" = "pgo" ]; then
+            binary=$pgo_path
+            label=$VARIANT
+        fi
+        (cd "$work_dir" && WABENCH_FILE="$work_dir/$variant.$i.txt" "$binary" "${WORKLOAD[@]}" >/dev/null 2>&1) ||
+            echo "   WARNING: $label run $i exited with an error"
+        duration=$(grep "^duration, elapsed time," "$work_dir/$variant.$i.txt" | awk -F', ' '{print $3}')
+        echo "   run $i $label: ${duration:-?} ms"
+    done
+done
+echo ""
+
+echo "3. Comparison:"
+# Mean of every "tag, metric, value" line over the runs, per variant. Lower is
+# better for times (us, ms, elapsed), higher for rates (per s); single-sample
+# maxima are too noisy to compare and are left out.
+cat "$work_dir"/base.*.txt | sed 's/^/base, /' > "$work_dir/all.txt"
+cat "$work_dir"/pgo.*.txt | sed 's/^/pgo, /' >> "$work_dir/all.txt"
+awk -F', ' -v out="$output_file" -v variant="$VARIANT" '
+    NF == 4 && $4 ~ /^[0-9.]+$/ {
+        key = $2 SUBSEP $3
+        sum[$1, key] += $4
+        count[$1, key]++
+        if (!(key in seen)) { seen[key] = 1; order[++keys] = key }
+    }
+    END {
+        print "Tag,Metric,Default," variant ",Speedup" > out
+        for (k = 1; k <= keys; k++) {
+            key = order[k]
+            if (!count["base", key] || !count["pgo", key]) continue
+            split(key, parts, SUBSEP)
+            lower = parts[2] ~ /us$|ms$|elapsed/
+            higher = parts[2] ~ /per s$/
+            if ((!lower && !higher) || parts[2] ~ /^max /) continue
+            base = sum["base", key] / count["base", key]
+            pgo = sum["pgo", key] / count["pgo", key]
+            if (base <= 0 || pgo <= 0) continue
+            speedup = lower ? base / pgo : pgo / base
+            printf "%s,%s,%.3f,%.3f,%.3f\n", parts[1], parts[2], base, pgo, speedup > out
+            log_sum += log(speedup)
+            compared++
+            if (parts[1] == "duration") {
+                printf "   total run time: %.0f ms -> %.0f ms (%.2fx)\n", base, pgo, speedup
+            }
+        }
+        if (compared) {
+            printf "   geometric mean speedup over %d timing metrics: %.3fx\n", compared, exp(log_sum / compared)
+        }
+    }' "$work_dir/all.txt"
+
+grep -v '^Tag,' "$output_file" | sort -t, -k5 -g > "$work_dir/sorted.csv"
+echo "   slowest metrics under $VARIANT:"
+head -5 "$work_dir/sorted.csv" | awk -F, '{printf "     %-40s %-12s %.2fx\n", $1, $2, $5}'
+echo "   fastest metrics under $VARIANT:"
+tail -5 "$work_dir/sorted.csv" | awk -F, '{printf "     %-40s %-12s %.2fx\n", $1, $2, $5}'
+echo ""
+echo "Results saved to: $output_file"
@@ -0,0 +1,204 @@
+#ifndef _PARALLEL_BENCH_H_
+#define _PARALLEL_BENCH_H_
+
+// Parallel read scaling benchmark: the loaded database is copied to a file
+// and 1, 2, 4, ... threads, each with its own read-only connection, run the
+// analysis queries for a fixed number of passes. Throughput relative to one
+// thread compares native pthreads with wasi-threads (make wasm-threads).
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include <string.h>
+#include "timestamps.h"
+#include "bench_stats.h"
+
+#define PARALLEL_DB_FILE "parallel_bench.db"
+// Timed passes over all queries per thread, after one untimed warm-up pass
+#define PARALLEL_PASSES 20
+#define PARALLEL_MAX_THREADS 64
+#define PARALLEL_MAX_QUERIES 8
+
+#if !(defined(__wasi__) && !defined(_REENTRANT))
+
+#include <pthread.h>
+
+typedef struct {
+    const char *const *queries;
+    int query_count;
+    int passes;
+    latency_samples samples;
+    timestamp_t first_start;
+    timestamp_t last_end;
+    // Sum of the first result column over one pass; every thread reads the
+    // same immutable file, so all must agree
+    double checksum;
+    int errors;
+} parallel_reader;
+
+// One pass over the queries; returns the checksum
+double parallel_pass(sqlite3_stmt **stmts, int count) {
+    double checksum = 0.0;
+    for (int q = 0; q < count; q++) {
+        while (sqlite3_step(stmts[q]) == SQLITE_ROW) {
+            checksum += sqlite3_column_double(stmts[q], 1);
+        }
+        sqlite3_reset(stmts[q]);
+    }
+    return checksum;
+}
+
+void *parallel_reader_main(void *arg) {
+    parallel_reader *reader = (parallel_reader *)arg;
+    sqlite3 *db = NULL;
+    sqlite3_stmt *stmts[PARALLEL_MAX_QUERIES];
+    int count = reader->query_count < PARALLEL_MAX_QUERIES ? reader->query_count : PARALLEL_MAX_QUERIES;
+
+    latency_init(&reader->samples);
+    // immutable=1 skips file locking, so readers never contend outside SQLite
+    if (sqlite3_open_v2("file:" PARALLEL_DB_FILE "?immutable=1", &db,
+                        SQLITE_OPEN_READONLY | SQLITE_OPEN_URI | SQLITE_OPEN_NOMUTEX,
+                        NULL) != SQLITE_OK) {
+        fprintf(stderr, "Cannot open database: %s\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        reader->errors++;
+        return NULL;
+    }
+    for (int q = 0; q < count; q++) {
+        if (sqlite3_prepare_v2(db, reader->queries[q], -1, &stmts[q], NULL) != SQLITE_OK) {
+            fprintf(stderr, "Parallel reader error: %s\n", sqlite3_errmsg(db));
+            while (q-- > 0) sqlite3_finalize(stmts[q]);
+            sqlite3_close(db);
+            reader->errors++;
+            return NULL;
+        }
+    }
+
+    // Fill the connection's page cache before timing
+    reader->checksum = parallel_pass(stmts, count);
+    reader->first_start = timestamp_us();
+    for (int p = 0; p < reader->passes; p++) {
+        timestamp_t start = timestamp_us();
+        if (parallel_pass(stmts, count) != reader->checksum) {
+            reader->errors++;
+        }
+        latency_add(&reader->samples, timestamp_us() - start);
+    }
+    reader->last_end = timestamp_us();
+
+    for (int q = 0; q < count; q++) {
+        sqlite3_finalize(stmts[q]);
+    }
+    sqlite3_close(db);
+    return NULL;
+}
+
+// Runs threads readers to completion; returns passes per second, 0 on error
+double parallel_run(const char *driver, const char *const *queries, int query_count, int threads,
+                    double baseline) {
+    char tag[128];
+    pthread_t reader_threads[PARALLEL_MAX_THREADS];
+    parallel_reader readers[PARALLEL_MAX_THREADS];
+    int started = 0, errors = 0, mismatches = 0;
+
+    for (int t = 0; t < threads; t++) {
+        memset(&readers[t], 0, sizeof(readers[t]));
+        readers[t].queries = queries;
+        readers[t].query_count = query_count;
+        readers[t].passes = PARALLEL_PASSES;
+    }
+    for (int t = 0; t < threads; t++) {
+        if (pthread_create(&reader_threads[t], NULL, parallel_reader_main, &readers[t]) != 0) {
+            fprintf(stderr, "Cannot start reader thread %d\n", t);
+            break;
+        }
+        started++;
+    }
+    for (int t = 0; t < started; t++) {
+        pthread_join(reader_threads[t], NULL);
+    }
+
+    // Wall time from the first timed pass of any thread to the last one ending
+    latency_samples all;
+    timestamp_t first = 0, last = 0;
+    latency_init(&all);
+    for (int t = 0; t < started; t++) {
+        for (size_t i = 0; i < readers[t].samples.count; i++) {
+            latency_add(&all, readers[t].samples.us[i]);
+        }
+        if (readers[t].samples.count) {
+            if (!first || readers[t].first_start < first) first = readers[t].first_start;
+            if (readers[t].last_end > last) last = readers[t].last_end;
+        }
+        if (readers[t].checksum != readers[0].checksum) mismatches++;
+        errors += readers[t].errors;
+        latency_free(&readers[t].samples);
+    }
+    timestamp_t elapsed = last - first;
+    if (started < threads || all.count == 0) {
+        latency_free(&all);
+        return 0.0;
+    }
+
+    double passes_per_s = elapsed ? all.count * 1000000.0 / elapsed : 0.0;
+    double speedup = baseline > 0 ? passes_per_s / baseline : 1.0;
+    printf(" %d threads: %.1f passes/s, speedup %.2fx, efficiency %.0f%%, %d errors%s\n", threads,
+           passes_per_s, speedup, 100.0 * speedup / threads, errors,
+           mismatches ? "  CHECKSUM MISMATCH" : "");
+    snprintf(tag, sizeof(tag), "%s_parallel_t%d", driver, threads);
+    latency_report(tag, &all, elapsed);
+    print_metric(tag, "threads", (double)threads);
+    print_metric(tag, "speedup", speedup);
+    print_metric(tag, "efficiency", speedup / threads);
+    latency_free(&all);
+    return passes_per_s;
+}
+
+// Copies db to PARALLEL_DB_FILE and runs queries on 1, 2, 4, ... up to
+// max_threads threads (max_threads itself is always included)
+void parallel_benchmark(sqlite3 *db, const char *driver, const char *const *queries,
+                        int query_count, int max_threads) {
+    if (max_threads > PARALLEL_MAX_THREADS) max_threads = PARALLEL_MAX_THREADS;
+    printf("\n=== Parallel Read Benchmark (%s, up to %d threads, %d passes per thread) ===\n",
+           driver, max_threads, PARALLEL_PASSES);
+    if (!sqlite3_threadsafe()) {
+        printf("  SQLite built with SQLITE_THREADSAFE=0, skipping\n");
+        return;
+    }
+    remove(PARALLEL_DB_FILE);
+    char *err = NULL;
+    if (sqlite3_exec(db, "VACUUM INTO '" PARALLEL_DB_FILE "';", NULL, NULL, &err) != SQLITE_OK) {
+        fprintf(stderr, "Parallel setup error: %s\n", err);
+        sqlite3_free(err);
+        return;
+    }
+
+    double baseline = 0.0;
+    int threads = 1;
+    for (;;) {
+        double passes_per_s = parallel_run(driver, queries, query_count, threads, baseline);
+        if (passes_per_s <= 0 || threads >= max_threads) {
+            break;
+        }
+        if (threads == 1) {
+            baseline = passes_per_s;
+        }
+        threads = threads * 2 < max_threads ? threads * 2 : max_threads;
+    }
+    remove(PARALLEL_DB_FILE);
+}
+
+#else
+
+void parallel_benchmark(sqlite3 *db, const char *driver, const char *const *queries,
+                        int query_count, int max_threads) {
+    (void)db;
+    (void)queries;
+    (void)query_count;
+    (void)max_threads;
+    printf("\n=== Parallel Read Benchmark (%s) ===\n", driver);
+    printf("  needs thread support (make wasm-threads), skipping\n");
+}
+
+#endif
+
+#endif
@@ -0,0 +1,266 @@
+#ifndef _SESSION_BENCH_H_
+#define _SESSION_BENCH_H_
+
+// Replication path benchmark: the bulk load of a set of tables is replayed
+// into scratch databases with and without a session attached, and the
+// captured changeset is applied to a fresh database.
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include <string.h>
+#include "timestamps.h"
+
+// Each load is repeated and the fastest run kept, to keep the capture
+// overhead above the noise
+#define SESSION_LOAD_REPEATS 3
+
+int session_exec(sqlite3 *db, const char *sql) {
+    char *err = NULL;
+    int rc = sqlite3_exec(db, sql, NULL, NULL, &err);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "Session error: %s\n", err ? err : sqlite3_errmsg(db));
+        sqlite3_free(err);
+    }
+    return rc;
+}
+
+// Opens an in-memory database holding the tables and indexes of src named
+// in tables, without their rows
+sqlite3 *session_open_copy_schema(sqlite3 *src, const char *const *tables, int table_count) {
+    sqlite3 *dst = NULL;
+    sqlite3_stmt *stmt;
+    if (sqlite3_open(":memory:", &dst) != SQLITE_OK) {
+        fprintf(stderr, "Cannot open database: %s\n", sqlite3_errmsg(dst));
+        sqlite3_close(dst);
+        return NULL;
+    }
+    // Tables sort before their indexes
+    if (sqlite3_prepare_v2(src,
+                           "SELECT sql FROM sqlite_schema WHERE tbl_name = ?1 AND sql IS NOT NULL "
+                           "ORDER BY type = 'index';",
+                           -1, &stmt, NULL) != SQLITE_OK) {
+        sqlite3_close(dst);
+        return NULL;
+    }
+    for (int t = 0; t < table_count; t++) {
+        sqlite3_bind_text(stmt, 1, tables[t], -1, SQLITE_STATIC);
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            session_exec(dst, (const char *)sqlite3_column_text(stmt, 0));
+        }
+        sqlite3_reset(stmt);
+    }
+    sqlite3_finalize(stmt);
+    return dst;
+}
+
+// Replays every row of table from src into dst with one prepared INSERT per
+// row, the same shape as the original bulk load; returns the row count
+sqlite3_int64 session_copy_rows(sqlite3 *src, sqlite3 *dst, const char *table) {
+    char sql[512];
+    sqlite3_stmt *select;
+    sqlite3_stmt *insert;
+    sqlite3_int64 rows = 0;
+
+    snprintf(sql, sizeof(sql), "SELECT * FROM %s;", table);
+    if (sqlite3_prepare_v2(src, sql, -1, &select, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Session error: %s\n", sqlite3_errmsg(src));
+        return -1;
+    }
+    int columns = sqlite3_column_count(select);
+    size_t used = snprintf(sql, sizeof(sql), "INSERT INTO %s VALUES (", table);
+    for (int c = 0; c < columns && used < sizeof(sql); c++) {
+        used += snprintf(sql + used, sizeof(sql) - used, c ? ", ?" : "?");
+    }
+    if (used < sizeof(sql)) {
+        snprintf(sql + used, sizeof(sql) - used, ");");
+    }
+    if (sqlite3_prepare_v2(dst, sql, -1, &insert, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Session error: %s\n", sqlite3_errmsg(dst));
+        sqlite3_finalize(select);
+        return -1;
+    }
+    while (sqlite3_step(select) == SQLITE_ROW) {
+        for (int c = 0; c < columns; c++) {
+            sqlite3_bind_value(insert, c + 1, sqlite3_column_value(select, c));
+        }
+        if (sqlite3_step(insert) == SQLITE_DONE) {
+            rows++;
+        } else {
+            fprintf(stderr, "Session insert error: %s\n", sqlite3_errmsg(dst));
+        }
+        sqlite3_reset(insert);
+    }
+    sqlite3_finalize(insert);
+    sqlite3_finalize(select);
+    return rows;
+}
+
+#if defined(SQLITE_ENABLE_SESSION) && defined(SQLITE_ENABLE_PREUPDATE_HOOK)
+
+int session_abort_on_conflict(void *ctx, int conflict, sqlite3_changeset_iter *iter) {
+    (void)ctx;
+    (void)conflict;
+    (void)iter;
+    return SQLITE_CHANGESET_ABORT;
+}
+
+// Loads tables from src into a fresh database inside one transaction. With
+// a session attached the changeset is captured into *changeset/*size
+// (sqlite3_free it), and its extraction time is stored in *capture_us.
+// Stores the load time in microseconds in *load_us; returns 0, or -1 if the
+// load or the capture failed.
+int session_timed_load(sqlite3 *src, const char *const *tables, int table_count,
+                       int capture, void **changeset, int *size,
+                       timestamp_t *load_us, timestamp_t *capture_us, sqlite3_int64 *rows) {
+    sqlite3_session *session = NULL;
+    int status = 0;
+    sqlite3 *dst = session_open_copy_schema(src, tables, table_count);
+    if (!dst) {
+        return -1;
+    }
+    if (capture) {
+        if (sqlite3session_create(dst, "main", &session) != SQLITE_OK) {
+            fprintf(stderr, "Session error: %s\n", sqlite3_errmsg(dst));
+            sqlite3_close(dst);
+            return -1;
+        }
+        for (int t = 0; t < table_count; t++) {
+            sqlite3session_attach(session, tables[t]);
+        }
+    }
+
+    *rows = 0;
+    timestamp_t start = timestamp_us();
+    session_exec(dst, "BEGIN TRANSACTION");
+    for (int t = 0; t < table_count && status == 0; t++) {
+        sqlite3_int64 copied = session_copy_rows(src, dst, tables[t]);
+        if (copied < 0) {
+            status = -1;
+        } else {
+            *rows += copied;
+        }
+    }
+    if (session_exec(dst, status == 0 ? "COMMIT" : "ROLLBACK") != SQLITE_OK) {
+        status = -1;
+    }
+    *load_us = timestamp_us() - start;
+
+    if (session) {
+        start = timestamp_us();
+        if (status == 0 && sqlite3session_changeset(session, size, changeset) != SQLITE_OK) {
+            fprintf(stderr, "Session changeset error: %s\n", sqlite3_errmsg(dst));
+            status = -1;
+        }
+        *capture_us = timestamp_us() - start;
+        sqlite3session_delete(session);
+    }
+    sqlite3_close(dst);
+    return status;
+}
+
+// Reports changeset size, the cost of recording a session during the bulk
+// load of tables, and how fast the changeset applies to a fresh database
+void session_benchmark(sqlite3 *src, const char *driver, const char *const *tables, int table_count) {
+    char tag[128];
+    void *changeset = NULL;
+    int size = 0;
+    timestamp_t best_plain = 0, best_session = 0, best_extract = 0;
+    int have_sample = 0;
+    sqlite3_int64 rows = 0;
+
+    printf("\n=== Session Changeset Benchmark (%s) ===\n", driver);
+    for (int r = 0; r < SESSION_LOAD_REPEATS; r++) {
+        void *captured = NULL;
+        int captured_size = 0;
+        timestamp_t plain = 0, with_session = 0, extract_us = 0;
+        if (session_timed_load(src, tables, table_count, 0, NULL, NULL, &plain, NULL, &rows) != 0 ||
+            session_timed_load(src, tables, table_count, 1, &captured, &captured_size,
+                               &with_session, &extract_us, &rows) != 0) {
+            fprintf(stderr, "Session benchmark aborted\n");
+            sqlite3_free(captured);
+            sqlite3_free(changeset);
+            return;
+        }
+        if (!have_sample || plain < best_plain) best_plain = plain;
+        if (!have_sample || with_session + extract_us < best_session + best_extract) {
+            best_session = with_session;
+            best_extract = extract_us;
+        }
+        have_sample = 1;
+        sqlite3_free(changeset);
+        changeset = captured;
+        size = captured_size;
+    }
+
+    double plain_rows_per_s = best_plain ? rows * 1000000.0 / best_plain : 0.0;
+    double session_rows_per_s = best_session + best_extract
+        ? rows * 1000000.0 / (best_session + best_extract) : 0.0;
+    double overhead = best_plain ? 100.0 * (best_session + best_extract - best_plain) / best_plain : 0.0;
+    printf("  %lld rows loaded\n", (long long)rows);
+    printf("  load without session: %8.1f ms (%.0f rows/s)\n", best_plain / 1000.0, plain_rows_per_s);
+    printf("  load with session:    %8.1f ms + %.1f ms changeset (%.0f rows/s, %+.1f%%)\n",
+           best_session / 1000.0, best_extract / 1000.0, session_rows_per_s, overhead);
+    printf("  changeset size: %d bytes (%.1f bytes/row)\n", size, rows ? (double)size / rows : 0.0);
+
+    snprintf(tag, sizeof(tag), "%s_session_capture", driver);
+    print_metric(tag, "rows", (double)rows);
+    print_metric(tag, "plain load us", (double)best_plain);
+    print_metric(tag, "session load us", (double)best_session);
+    print_metric(tag, "changeset us", (double)best_extract);
+    print_metric(tag, "overhead percent", overhead);
+    print_metric(tag, "changeset bytes", (double)size);
+
+    // Replay into a fresh database holding only the schema
+    sqlite3 *replica = session_open_copy_schema(src, tables, table_count);
+    if (!replica) {
+        sqlite3_free(changeset);
+        return;
+    }
+    timestamp_t start = timestamp_us();
+    session_exec(replica, "BEGIN TRANSACTION");
+    int rc = sqlite3changeset_apply(replica, size, changeset, NULL, session_abort_on_conflict, NULL);
+    session_exec(replica, rc == SQLITE_OK ? "COMMIT" : "ROLLBACK");
+    timestamp_t apply_us = timestamp_us() - start;
+
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "Changeset apply error: %s\n", sqlite3_errmsg(replica));
+    } else {
+        sqlite3_int64 applied = 0;
+        char sql[256];
+        for (int t = 0; t < table_count; t++) {
+            sqlite3_stmt *stmt;
+            snprintf(sql, sizeof(sql), "SELECT COUNT(*) FROM %s;", tables[t]);
+            if (sqlite3_prepare_v2(replica, sql, -1, &stmt, NULL) == SQLITE_OK &&
+                sqlite3_step(stmt) == SQLITE_ROW) {
+                applied += sqlite3_column_int64(stmt, 0);
+            }
+            sqlite3_finalize(stmt);
+        }
+        double rows_per_s = apply_us ? applied * 1000000.0 / apply_us : 0.0;
+        double mb_per_s = apply_us ? size / (1024.0 * 1024.0) * 1000000.0 / apply_us : 0.0;
+        printf("  apply: %lld rows in %.1f ms (%.0f rows/s, %.2f MB/s)%s\n", (long long)applied,
+               apply_us / 1000.0, rows_per_s, mb_per_s, applied == rows ? "" : "  ROW COUNT MISMATCH");
+
+        snprintf(tag, sizeof(tag), "%s_session_apply", driver);
+        print_metric(tag, "rows", (double)applied);
+        print_metric(tag, "apply us", (double)apply_us);
+        print_metric(tag, "rows per s", rows_per_s);
+        print_metric(tag, "MB per s", mb_per_s);
+    }
+    sqlite3_close(replica);
+    sqlite3_free(changeset);
+}
+
+#else
+
+void session_benchmark(sqlite3 *src, const char *driver, const char *const *tables, int table_count) {
+    (void)src;
+    (void)tables;
+    (void)table_count;
+    printf("\n=== Session Changeset Benchmark (%s) ===\n", driver);
+    printf("  built without SQLITE_ENABLE_SESSION and SQLITE_ENABLE_PREUPDATE_HOOK, skipping\n");
+}
+
+#endif
+
+#endif
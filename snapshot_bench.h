@@ -0,0 +1,309 @@
+#ifndef _SNAPSHOT_BENCH_H_
+#define _SNAPSHOT_BENCH_H_
+
+// WAL-mode concurrent read benchmark: reader threads run the analysis
+// queries while a writer thread keeps inserting, first each reading the
+// latest data and then all reading one snapshot pinned with
+// sqlite3_snapshot_get. The pinned snapshot holds back checkpoints, so the
+// WAL file size is sampled as the writer runs.
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "timestamps.h"
+#include "bench_stats.h"
+
+#define SNAPSHOT_DB_FILE "snapshot_bench.db"
+#define SNAPSHOT_WAL_FILE "snapshot_bench.db-wal"
+#define SNAPSHOT_SHM_FILE "snapshot_bench.db-shm"
+#define SNAPSHOT_READERS 4
+// Rows per writer transaction
+#define SNAPSHOT_WRITER_BATCH 100
+
+long long snapshot_file_size(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 ? (long long)st.st_size : 0;
+}
+
+void snapshot_remove_files(void) {
+    remove(SNAPSHOT_DB_FILE);
+    remove(SNAPSHOT_WAL_FILE);
+    remove(SNAPSHOT_SHM_FILE);
+}
+
+// WASI builds of SQLite define SQLITE_OMIT_WAL, so there is no snapshot to
+// pin there, wasi-threads builds included
+#if defined(SQLITE_ENABLE_SNAPSHOT) && !defined(__wasi__)
+
+#include <pthread.h>
+
+typedef struct {
+    const char *const *queries;
+    int query_count;
+    sqlite3_snapshot *snapshot;
+    volatile int *stop;
+    latency_samples samples;
+    // Sum of the first result column over all queries of one pass; a pass
+    // that sees different data than the first one counts as changed
+    double first_checksum;
+    int changed_passes;
+    int errors;
+} snapshot_reader;
+
+typedef struct {
+    const char *insert_sql;
+    volatile int *stop;
+    long long rows;
+    long long max_wal_bytes;
+    int errors;
+} snapshot_writer;
+
+sqlite3 *snapshot_open(void) {
+    sqlite3 *db = NULL;
+    if (sqlite3_open(SNAPSHOT_DB_FILE, &db) != SQLITE_OK) {
+        fprintf(stderr, "Cannot open database: %s\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return NULL;
+    }
+    sqlite3_busy_timeout(db, 5000);
+    return db;
+}
+
+void *snapshot_reader_main(void *arg) {
+    snapshot_reader *reader = (snapshot_reader *)arg;
+    sqlite3 *db = snapshot_open();
+    sqlite3_stmt *stmts[8];
+    int count = reader->query_count < 8 ? reader->query_count : 8;
+    int first = 1;
+
+    latency_init(&reader->samples);
+    if (!db) {
+        reader->errors++;
+        return NULL;
+    }
+    for (int q = 0; q < count; q++) {
+        if (sqlite3_prepare_v2(db, reader->queries[q], -1, &stmts[q], NULL) != SQLITE_OK) {
+            fprintf(stderr, "Snapshot reader error: %s\n", sqlite3_errmsg(db));
+            while (q-- > 0) sqlite3_finalize(stmts[q]);
+            sqlite3_close(db);
+            reader->errors++;
+            return NULL;
+        }
+    }
+    // sqlite3_snapshot_open needs a connection that has read the WAL before
+    sqlite3_exec(db, "SELECT COUNT(*) FROM sqlite_schema;", NULL, NULL, NULL);
+
+    while (!*reader->stop) {
+        double checksum = 0.0;
+        timestamp_t start = timestamp_us();
+        sqlite3_exec(db, "BEGIN", NULL, NULL, NULL);
+        if (reader->snapshot && sqlite3_snapshot_open(db, "main", reader->snapshot) != SQLITE_OK) {
+            fprintf(stderr, "Snapshot open error: %s\n", sqlite3_errmsg(db));
+            sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+            reader->errors++;
+            break;
+        }
+        for (int q = 0; q < count; q++) {
+            while (sqlite3_step(stmts[q]) == SQLITE_ROW) {
+                checksum += sqlite3_column_double(stmts[q], 1);
+            }
+            sqlite3_reset(stmts[q]);
+        }
+        sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+        latency_add(&reader->samples, timestamp_us() - start);
+
+        if (first) {
+            reader->first_checksum = checksum;
+            first = 0;
+        } else if (checksum != reader->first_checksum) {
+            reader->changed_passes++;
+        }
+    }
+    for (int q = 0; q < count; q++) {
+        sqlite3_finalize(stmts[q]);
+    }
+    sqlite3_close(db);
+    return NULL;
+}
+
+void *snapshot_writer_main(void *arg) {
+    snapshot_writer *writer = (snapshot_writer *)arg;
+    sqlite3 *db = snapshot_open();
+    sqlite3_stmt *stmt;
+    bench_rng rng;
+
+    if (!db || sqlite3_prepare_v2(db, writer->insert_sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Snapshot writer error: %s\n", db ? sqlite3_errmsg(db) : "cannot open");
+        sqlite3_close(db);
+        writer->errors++;
+        return NULL;
+    }
+    bench_rng_seed(&rng, 35);
+    while (!*writer->stop) {
+        sqlite3_exec(db, "BEGIN IMMEDIATE", NULL, NULL, NULL);
+        for (int i = 0; i < SNAPSHOT_WRITER_BATCH; i++) {
+            sqlite3_bind_double(stmt, 1, bench_rng_uniform(&rng) * 1000.0);
+            if (sqlite3_step(stmt) != SQLITE_DONE) {
+                writer->errors++;
+            }
+            sqlite3_reset(stmt);
+        }
+        if (sqlite3_exec(db, "COMMIT", NULL, NULL, NULL) == SQLITE_OK) {
+            writer->rows += SNAPSHOT_WRITER_BATCH;
+        } else {
+            writer->errors++;
+        }
+        long long wal = snapshot_file_size(SNAPSHOT_WAL_FILE);
+        if (wal > writer->max_wal_bytes) {
+            writer->max_wal_bytes = wal;
+        }
+    }
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+    return NULL;
+}
+
+// Runs SNAPSHOT_READERS readers and one writer for seconds; with pinned set
+// the readers share a snapshot taken (and held open) before the writer starts
+void snapshot_run_phase(const char *driver, const char *const *queries, int query_count,
+                        const char *insert_sql, int seconds, int pinned) {
+    const char *mode = pinned ? "pinned" : "latest";
+    char tag[128];
+    volatile int stop = 0;
+    pthread_t reader_threads[SNAPSHOT_READERS];
+    pthread_t writer_thread;
+    snapshot_reader readers[SNAPSHOT_READERS];
+    snapshot_writer writer;
+    sqlite3_snapshot *snapshot = NULL;
+    sqlite3 *pin = snapshot_open();
+
+    if (!pin) {
+        return;
+    }
+    // Start every phase from an empty WAL
+    sqlite3_exec(pin, "PRAGMA wal_checkpoint(TRUNCATE);", NULL, NULL, NULL);
+    if (pinned) {
+        // A snapshot cannot be taken of an empty WAL, so write one transaction first
+        sqlite3_exec(pin, "CREATE TABLE IF NOT EXISTS snapshot_marker (taken INTEGER);"
+                          "INSERT INTO snapshot_marker VALUES (1);", NULL, NULL, NULL);
+        sqlite3_exec(pin, "BEGIN; SELECT COUNT(*) FROM sqlite_schema;", NULL, NULL, NULL);
+        if (sqlite3_snapshot_get(pin, "main", &snapshot) != SQLITE_OK) {
+            fprintf(stderr, "Snapshot get error: %s\n", sqlite3_errmsg(pin));
+            sqlite3_close(pin);
+            return;
+        }
+    }
+
+    memset(&writer, 0, sizeof(writer));
+    writer.insert_sql = insert_sql;
+    writer.stop = &stop;
+    for (int r = 0; r < SNAPSHOT_READERS; r++) {
+        memset(&readers[r], 0, sizeof(readers[r]));
+        readers[r].queries = queries;
+        readers[r].query_count = query_count;
+        readers[r].snapshot = snapshot;
+        readers[r].stop = &stop;
+    }
+
+    timestamp_t start = timestamp_us();
+    pthread_create(&writer_thread, NULL, snapshot_writer_main, &writer);
+    for (int r = 0; r < SNAPSHOT_READERS; r++) {
+        pthread_create(&reader_threads[r], NULL, snapshot_reader_main, &readers[r]);
+    }
+    long long sampled_wal = 0;
+    while (timestamp_us() - start < (timestamp_t)seconds * 1000000) {
+        long long wal = snapshot_file_size(SNAPSHOT_WAL_FILE);
+        if (wal > sampled_wal) sampled_wal = wal;
+        usleep(10000);
+    }
+    stop = 1;
+    pthread_join(writer_thread, NULL);
+    if (sampled_wal > writer.max_wal_bytes) writer.max_wal_bytes = sampled_wal;
+    for (int r = 0; r < SNAPSHOT_READERS; r++) {
+        pthread_join(reader_threads[r], NULL);
+    }
+    timestamp_t elapsed = timestamp_us() - start;
+    long long end_wal = snapshot_file_size(SNAPSHOT_WAL_FILE);
+
+    if (snapshot) {
+        sqlite3_snapshot_free(snapshot);
+        sqlite3_exec(pin, "COMMIT;", NULL, NULL, NULL);
+    }
+    sqlite3_close(pin);
+
+    // Merge the readers' samples into one distribution
+    latency_samples all;
+    int changed = 0, errors = writer.errors;
+    latency_init(&all);
+    for (int r = 0; r < SNAPSHOT_READERS; r++) {
+        for (size_t i = 0; i < readers[r].samples.count; i++) {
+            latency_add(&all, readers[r].samples.us[i]);
+        }
+        changed += readers[r].changed_passes;
+        errors += readers[r].errors;
+        latency_free(&readers[r].samples);
+    }
+
+    double writer_rows_per_s = elapsed ? writer.rows * 1000000.0 / elapsed : 0.0;
+    printf(" %s: writer %lld rows (%.0f rows/s), WAL max %lld bytes, end %lld bytes, "
+           "%d reader passes saw changed data, %d errors\n",
+           mode, writer.rows, writer_rows_per_s, writer.max_wal_bytes, end_wal, changed, errors);
+    snprintf(tag, sizeof(tag), "%s_snapshot_%s", driver, mode);
+    latency_report(tag, &all, elapsed);
+    double p50 = latency_percentile(&all, 50);
+    double spread = p50 > 0 ? latency_percentile(&all, 99) / p50 : 0.0;
+    printf("  p99/p50 %.2f\n", spread);
+    print_metric(tag, "p99 over p50", spread);
+    print_metric(tag, "writer rows per s", writer_rows_per_s);
+    print_metric(tag, "wal max bytes", (double)writer.max_wal_bytes);
+    print_metric(tag, "wal end bytes", (double)end_wal);
+    print_metric(tag, "changed passes", (double)changed);
+    latency_free(&all);
+}
+
+// Copies db to SNAPSHOT_DB_FILE in WAL mode and compares latest-data reads
+// with snapshot-pinned reads of queries while insert_sql (one ?1 REAL
+// parameter) runs in a loop; the file and its WAL are removed afterwards
+void snapshot_benchmark(sqlite3 *db, const char *driver, const char *const *queries,
+                        int query_count, const char *insert_sql, int seconds) {
+    printf("\n=== Snapshot Read Benchmark (%s, %d readers, %d s per mode) ===\n", driver,
+           SNAPSHOT_READERS, seconds);
+    snapshot_remove_files();
+    char *err = NULL;
+    if (sqlite3_exec(db, "VACUUM INTO '" SNAPSHOT_DB_FILE "';", NULL, NULL, &err) != SQLITE_OK) {
+        fprintf(stderr, "Snapshot setup error: %s\n", err);
+        sqlite3_free(err);
+        return;
+    }
+    sqlite3 *setup = snapshot_open();
+    if (!setup) {
+        snapshot_remove_files();
+        return;
+    }
+    sqlite3_exec(setup, "PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL;", NULL, NULL, NULL);
+
+    snapshot_run_phase(driver, queries, query_count, insert_sql, seconds, 0);
+    snapshot_run_phase(driver, queries, query_count, insert_sql, seconds, 1);
+
+    sqlite3_close(setup);
+    snapshot_remove_files();
+}
+
+#else
+
+void snapshot_benchmark(sqlite3 *db, const char *driver, const char *const *queries,
+                        int query_count, const char *insert_sql, int seconds) {
+    (void)db;
+    (void)queries;
+    (void)query_count;
+    (void)insert_sql;
+    (void)seconds;
+    printf("\n=== Snapshot Read Benchmark (%s) ===\n", driver);
+    printf("  needs SQLITE_ENABLE_SNAPSHOT, WAL and thread support (not on WASI), skipping\n");
+}
+
+#endif
+
+#endif
@@ -0,0 +1,530 @@
+#ifndef _SPATIAL_BENCH_H_
+#define _SPATIAL_BENCH_H_
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "timestamps.h"
+#include "bench_stats.h"
+
+// Bounding boxes per unit of scale factor
+#define SPATIAL_BOXES_PER_SCALE 1000000
+// Boxes live in a WORLD x WORLD square with sides up to MAX_BOX
+#define SPATIAL_WORLD_SIZE 100000.0
+#define SPATIAL_MAX_BOX 50.0
+// Entries per R-Tree leaf for a 2-D rtree on 4096-byte pages:
+// (4096 - 4) / (8 byte id + 4 x 4 byte coordinate)
+#define SPATIAL_STR_LEAF_CAPACITY 170
+#define SPATIAL_HILBERT_ORDER 16
+#define SPATIAL_WINDOW_QUERIES 2000
+#define SPATIAL_WINDOW_SIZE 1000.0
+#define SPATIAL_KNN_QUERIES 1000
+#define SPATIAL_KNN_K 10
+
+// Polygons per unit of scale factor, half regular and half irregular
+#define GEOPOLY_SHAPES_PER_SCALE 100000
+#define GEOPOLY_MAX_RADIUS 40.0
+#define GEOPOLY_MAX_VERTICES 12
+#define GEOPOLY_INDEXED_QUERIES 1000
+#define GEOPOLY_WINDOW_SIZE 1000.0
+// geopoly_contains_point() alone cannot use the index and scans every shape
+#define GEOPOLY_SCAN_QUERIES 20
+
+typedef enum {
+    SPATIAL_ORDER_RANDOM,
+    SPATIAL_ORDER_STR,
+    SPATIAL_ORDER_HILBERT,
+    SPATIAL_ORDER_COUNT
+} spatial_order_t;
+
+typedef struct {
+    sqlite3_int64 id;
+    double min_x, max_x, min_y, max_y;
+    uint64_t key;
+} spatial_box;
+
+const char *spatial_order_name(spatial_order_t order) {
+    switch (order) {
+        case SPATIAL_ORDER_RANDOM: return "random";
+        case SPATIAL_ORDER_STR: return "str";
+        case SPATIAL_ORDER_HILBERT: return "hilbert";
+        default: return "unknown";
+    }
+}
+
+// Same boxes for every run of a given count
+void spatial_generate_boxes(spatial_box *boxes, int count) {
+    bench_rng rng;
+    bench_rng_seed(&rng, 30);
+    for (int i = 0; i < count; i++) {
+        double x = bench_rng_uniform(&rng) * (SPATIAL_WORLD_SIZE - SPATIAL_MAX_BOX);
+        double y = bench_rng_uniform(&rng) * (SPATIAL_WORLD_SIZE - SPATIAL_MAX_BOX);
+        boxes[i].id = i + 1;
+        boxes[i].min_x = x;
+        boxes[i].max_x = x + 1.0 + bench_rng_uniform(&rng) * (SPATIAL_MAX_BOX - 1.0);
+        boxes[i].min_y = y;
+        boxes[i].max_y = y + 1.0 + bench_rng_uniform(&rng) * (SPATIAL_MAX_BOX - 1.0);
+        boxes[i].key = 0;
+    }
+}
+
+// Distance along a Hilbert curve of the given order for grid cell (x, y)
+uint64_t spatial_hilbert_index(uint32_t x, uint32_t y, int order) {
+    uint64_t d = 0;
+    for (uint32_t s = 1u << (order - 1); s > 0; s >>= 1) {
+        uint32_t rx = (x & s) > 0;
+        uint32_t ry = (y & s) > 0;
+        d += (uint64_t)s * s * ((3 * rx) ^ ry);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = s - 1 - x;
+                y = s - 1 - y;
+            }
+            uint32_t t = x;
+            x = y;
+            y = t;
+        }
+    }
+    return d;
+}
+
+uint32_t spatial_grid_cell(double v, int order) {
+    double cells = (double)(1u << order);
+    double cell = v / SPATIAL_WORLD_SIZE * cells;
+    if (cell < 0) cell = 0;
+    if (cell > cells - 1) cell = cells - 1;
+    return (uint32_t)cell;
+}
+
+int spatial_compare_key(const void *a, const void *b) {
+    uint64_t x = ((const spatial_box *)a)->key;
+    uint64_t y = ((const spatial_box *)b)->key;
+    return (x > y) - (x < y);
+}
+
+int spatial_compare_center_x(const void *a, const void *b) {
+    const spatial_box *p = (const spatial_box *)a;
+    const spatial_box *q = (const spatial_box *)b;
+    double x = p->min_x + p->max_x;
+    double y = q->min_x + q->max_x;
+    return (x > y) - (x < y);
+}
+
+int spatial_compare_center_y(const void *a, const void *b) {
+    const spatial_box *p = (const spatial_box *)a;
+    const spatial_box *q = (const spatial_box *)b;
+    double x = p->min_y + p->max_y;
+    double y = q->min_y + q->max_y;
+    return (x > y) - (x < y);
+}
+
+// Reorders boxes for bulk loading. Random order is the generation order.
+void spatial_sort_boxes(spatial_box *boxes, int count, spatial_order_t order) {
+    if (order == SPATIAL_ORDER_HILBERT) {
+        for (int i = 0; i < count; i++) {
+            uint32_t cx = spatial_grid_cell((boxes[i].min_x + boxes[i].max_x) / 2, SPATIAL_HILBERT_ORDER);
+            uint32_t cy = spatial_grid_cell((boxes[i].min_y + boxes[i].max_y) / 2, SPATIAL_HILBERT_ORDER);
+            boxes[i].key = spatial_hilbert_index(cx, cy, SPATIAL_HILBERT_ORDER);
+        }
+        qsort(boxes, count, sizeof(spatial_box), spatial_compare_key);
+    } else if (order == SPATIAL_ORDER_STR) {
+        // Sort-Tile-Recursive: vertical slices of whole leaves, each sorted by y
+        int leaves = (count + SPATIAL_STR_LEAF_CAPACITY - 1) / SPATIAL_STR_LEAF_CAPACITY;
+        int slices = (int)ceil(sqrt((double)leaves));
+        int per_slice = slices ? ((leaves + slices - 1) / slices) * SPATIAL_STR_LEAF_CAPACITY : count;
+        qsort(boxes, count, sizeof(spatial_box), spatial_compare_center_x);
+        for (int start = 0; start < count; start += per_slice) {
+            int n = count - start < per_slice ? count - start : per_slice;
+            qsort(boxes + start, n, sizeof(spatial_box), spatial_compare_center_y);
+        }
+    }
+}
+
+int spatial_exec(sqlite3 *db, const char *sql) {
+    char *err_msg = 0;
+    int rc = sqlite3_exec(db, sql, 0, 0, &err_msg);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "Spatial error: %s\n  in: %s\n", err_msg, sql);
+        sqlite3_free(err_msg);
+    }
+    return rc;
+}
+
+// Drops and recreates an rtree(id, min_x, max_x, min_y, max_y) table and
+// inserts the boxes in array order in a single transaction
+int spatial_load(sqlite3 *db, const char *table, const spatial_box *boxes, int count) {
+    char sql[256];
+    sqlite3_stmt *stmt;
+
+    snprintf(sql, sizeof(sql), "DROP TABLE IF EXISTS %s;", table);
+    spatial_exec(db, sql);
+    snprintf(sql, sizeof(sql),
+             "CREATE VIRTUAL TABLE %s USING rtree(id, min_x, max_x, min_y, max_y);", table);
+    if (spatial_exec(db, sql) != SQLITE_OK) {
+        return SQLITE_ERROR;
+    }
+
+    snprintf(sql, sizeof(sql),
+             "INSERT INTO %s (id, min_x, max_x, min_y, max_y) VALUES (?, ?, ?, ?, ?);", table);
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Spatial error: %s\n", sqlite3_errmsg(db));
+        return SQLITE_ERROR;
+    }
+    spatial_exec(db, "BEGIN TRANSACTION");
+    for (int i = 0; i < count; i++) {
+        sqlite3_bind_int64(stmt, 1, boxes[i].id);
+        sqlite3_bind_double(stmt, 2, boxes[i].min_x);
+        sqlite3_bind_double(stmt, 3, boxes[i].max_x);
+        sqlite3_bind_double(stmt, 4, boxes[i].min_y);
+        sqlite3_bind_double(stmt, 5, boxes[i].max_y);
+        sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+    }
+    spatial_exec(db, "COMMIT");
+    sqlite3_finalize(stmt);
+    return SQLITE_OK;
+}
+
+// Bytes used by the rtree shadow tables
+sqlite3_int64 spatial_table_bytes(sqlite3 *db, const char *table) {
+    sqlite3_stmt *stmt;
+    sqlite3_int64 bytes = -1;
+    if (sqlite3_prepare_v2(db,
+            "SELECT COALESCE(SUM(pgsize), 0) FROM dbstat "
+            "WHERE name LIKE ?1 || '\\_%' ESCAPE '\\';", -1, &stmt, NULL) != SQLITE_OK) {
+        return -1;
+    }
+    sqlite3_bind_text(stmt, 1, table, -1, SQLITE_STATIC);
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        bytes = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return bytes;
+}
+
+// Window queries covering SPATIAL_WINDOW_SIZE squares at random positions
+void spatial_window_queries(sqlite3 *db, const char *table, const char *tag) {
+    char sql[256];
+    sqlite3_stmt *stmt;
+    bench_rng rng;
+    latency_samples samples;
+    long long hits = 0;
+
+    snprintf(sql, sizeof(sql),
+             "SELECT id FROM %s WHERE max_x >= ?1 AND min_x <= ?2 AND max_y >= ?3 AND min_y <= ?4;",
+             table);
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Spatial error: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+
+    latency_init(&samples);
+    bench_rng_seed(&rng, 3030);
+    timestamp_t start = timestamp_us();
+    for (int q = 0; q < SPATIAL_WINDOW_QUERIES; q++) {
+        double x = bench_rng_uniform(&rng) * (SPATIAL_WORLD_SIZE - SPATIAL_WINDOW_SIZE);
+        double y = bench_rng_uniform(&rng) * (SPATIAL_WORLD_SIZE - SPATIAL_WINDOW_SIZE);
+        timestamp_t query_start = timestamp_us();
+        sqlite3_bind_double(stmt, 1, x);
+        sqlite3_bind_double(stmt, 2, x + SPATIAL_WINDOW_SIZE);
+        sqlite3_bind_double(stmt, 3, y);
+        sqlite3_bind_double(stmt, 4, y + SPATIAL_WINDOW_SIZE);
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            hits++;
+        }
+        sqlite3_reset(stmt);
+        latency_add(&samples, timestamp_us() - query_start);
+    }
+    timestamp_t elapsed = timestamp_us() - start;
+    sqlite3_finalize(stmt);
+
+    printf("  window queries: %.1f boxes per window\n", (double)hits / SPATIAL_WINDOW_QUERIES);
+    latency_report(tag, &samples, elapsed);
+    latency_free(&samples);
+}
+
+// k-nearest-neighbour search by box centre. The rtree module has no native
+// kNN, so a square window around the point is doubled until it holds k boxes
+// whose k-th distance lies inside the window, which makes the answer exact.
+void spatial_knn_queries(sqlite3 *db, const char *table, const char *tag) {
+    char sql[512];
+    sqlite3_stmt *stmt;
+    bench_rng rng;
+    latency_samples samples;
+    long long probes = 0;
+
+    snprintf(sql, sizeof(sql),
+             "SELECT id, ((min_x + max_x) / 2 - ?1) * ((min_x + max_x) / 2 - ?1) + "
+             "((min_y + max_y) / 2 - ?2) * ((min_y + max_y) / 2 - ?2) AS dist2 "
+             "FROM %s WHERE max_x >= ?1 - ?3 AND min_x <= ?1 + ?3 "
+             "AND max_y >= ?2 - ?3 AND min_y <= ?2 + ?3 "
+             "ORDER BY dist2 LIMIT %d;", table, SPATIAL_KNN_K);
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Spatial error: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+
+    latency_init(&samples);
+    bench_rng_seed(&rng, 3131);
+    timestamp_t start = timestamp_us();
+    for (int q = 0; q < SPATIAL_KNN_QUERIES; q++) {
+        double x = bench_rng_uniform(&rng) * SPATIAL_WORLD_SIZE;
+        double y = bench_rng_uniform(&rng) * SPATIAL_WORLD_SIZE;
+        double radius = SPATIAL_MAX_BOX;
+        timestamp_t query_start = timestamp_us();
+        for (;;) {
+            int found = 0;
+            double kth = 0.0;
+            sqlite3_bind_double(stmt, 1, x);
+            sqlite3_bind_double(stmt, 2, y);
+            sqlite3_bind_double(stmt, 3, radius);
+            while (sqlite3_step(stmt) == SQLITE_ROW) {
+                kth = sqlite3_column_double(stmt, 1);
+                found++;
+            }
+            sqlite3_reset(stmt);
+            probes++;
+            // Every centre within radius of the point lies inside the window
+            if ((found == SPATIAL_KNN_K && kth <= radius * radius) || radius >= SPATIAL_WORLD_SIZE) {
+                break;
+            }
+            radius *= 2;
+        }
+        latency_add(&samples, timestamp_us() - query_start);
+    }
+    timestamp_t elapsed = timestamp_us() - start;
+    sqlite3_finalize(stmt);
+
+    printf("  %d-NN queries: %.2f window probes per query\n", SPATIAL_KNN_K,
+           (double)probes / SPATIAL_KNN_QUERIES);
+    latency_report(tag, &samples, elapsed);
+    latency_free(&samples);
+}
+
+// Loads scale x SPATIAL_BOXES_PER_SCALE boxes into the rtree table in each
+// bulk-load order and times the load, window and nearest-neighbour queries.
+// Hilbert order runs last, so the table stays populated in that order.
+void spatial_benchmark(sqlite3 *db, const char *driver, const char *table, double scale) {
+    char tag[128];
+    int count = (int)(scale * SPATIAL_BOXES_PER_SCALE);
+    if (count < 1) count = 1;
+
+    spatial_box *boxes = (spatial_box *)malloc(sizeof(spatial_box) * count);
+    if (!boxes) {
+        fprintf(stderr, "Out of memory for %d bounding boxes\n", count);
+        return;
+    }
+
+    printf("\n=== R-Tree Spatial Benchmark (%s, %d boxes, scale %.2f) ===\n", driver, count, scale);
+    for (int o = 0; o < SPATIAL_ORDER_COUNT; o++) {
+        spatial_order_t order = (spatial_order_t)o;
+        spatial_generate_boxes(boxes, count);
+
+        timestamp_t start = timestamp_us();
+        spatial_sort_boxes(boxes, count, order);
+        timestamp_t sort_us = timestamp_us() - start;
+
+        start = timestamp_us();
+        if (spatial_load(db, table, boxes, count) != SQLITE_OK) {
+            break;
+        }
+        timestamp_t load_us = timestamp_us() - start;
+        sqlite3_int64 bytes = spatial_table_bytes(db, table);
+
+        printf(" Order '%s': sort %.1f ms, load %.1f ms (%.0f boxes/s), %lld bytes\n",
+               spatial_order_name(order), sort_us / 1000.0, load_us / 1000.0,
+               load_us ? count * 1000000.0 / load_us : 0.0, (long long)bytes);
+        snprintf(tag, sizeof(tag), "%s_rtree_%s", driver, spatial_order_name(order));
+        print_metric(tag, "boxes", (double)count);
+        print_metric(tag, "sort us", (double)sort_us);
+        print_metric(tag, "load us", (double)load_us);
+        print_metric(tag, "bytes", (double)bytes);
+
+        snprintf(tag, sizeof(tag), "%s_rtree_%s_window", driver, spatial_order_name(order));
+        spatial_window_queries(db, table, tag);
+        snprintf(tag, sizeof(tag), "%s_rtree_%s_knn", driver, spatial_order_name(order));
+        spatial_knn_queries(db, table, tag);
+    }
+    free(boxes);
+}
+
+// Writes a closed, counter-clockwise star-shaped polygon around (x, y) as
+// geopoly JSON: vertex angles and radii are jittered around a regular polygon
+void geopoly_irregular_json(char *json, size_t size, double x, double y, double radius,
+                            int vertices, bench_rng *rng) {
+    size_t used = 0;
+    double first_x = 0.0, first_y = 0.0;
+    used += snprintf(json + used, size - used, "[");
+    for (int v = 0; v < vertices && used < size; v++) {
+        double angle = (v + 0.8 * bench_rng_uniform(rng)) * 2.0 * M_PI / vertices;
+        double r = radius * (0.4 + 0.6 * bench_rng_uniform(rng));
+        double vx = x + r * cos(angle);
+        double vy = y + r * sin(angle);
+        if (v == 0) {
+            first_x = vx;
+            first_y = vy;
+        }
+        used += snprintf(json + used, size - used, "[%.4f,%.4f],", vx, vy);
+    }
+    if (used < size) {
+        snprintf(json + used, size - used, "[%.4f,%.4f]]", first_x, first_y);
+    }
+}
+
+// Drops and recreates a geopoly(kind) table holding count shapes, alternating
+// regular polygons built by geopoly_regular() and irregular ones from JSON
+int geopoly_load(sqlite3 *db, const char *table, int count) {
+    char sql[256];
+    char json[GEOPOLY_MAX_VERTICES * 40 + 64];
+    sqlite3_stmt *regular;
+    sqlite3_stmt *irregular;
+    bench_rng rng;
+
+    snprintf(sql, sizeof(sql), "DROP TABLE IF EXISTS %s;", table);
+    spatial_exec(db, sql);
+    snprintf(sql, sizeof(sql), "CREATE VIRTUAL TABLE %s USING geopoly(kind);", table);
+    if (spatial_exec(db, sql) != SQLITE_OK) {
+        return SQLITE_ERROR;
+    }
+
+    snprintf(sql, sizeof(sql),
+             "INSERT INTO %s (_shape, kind) VALUES (geopoly_regular(?1, ?2, ?3, ?4), 'regular');",
+             table);
+    if (sqlite3_prepare_v2(db, sql, -1, &regular, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Geopoly error: %s\n", sqlite3_errmsg(db));
+        return SQLITE_ERROR;
+    }
+    snprintf(sql, sizeof(sql), "INSERT INTO %s (_shape, kind) VALUES (?1, 'irregular');", table);
+    if (sqlite3_prepare_v2(db, sql, -1, &irregular, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Geopoly error: %s\n", sqlite3_errmsg(db));
+        sqlite3_finalize(regular);
+        return SQLITE_ERROR;
+    }
+
+    bench_rng_seed(&rng, 31);
+    spatial_exec(db, "BEGIN TRANSACTION");
+    for (int i = 0; i < count; i++) {
+        double x = GEOPOLY_MAX_RADIUS + bench_rng_uniform(&rng) * (SPATIAL_WORLD_SIZE - 2 * GEOPOLY_MAX_RADIUS);
+        double y = GEOPOLY_MAX_RADIUS + bench_rng_uniform(&rng) * (SPATIAL_WORLD_SIZE - 2 * GEOPOLY_MAX_RADIUS);
+        double radius = 1.0 + bench_rng_uniform(&rng) * (GEOPOLY_MAX_RADIUS - 1.0);
+        int vertices = 3 + (int)bench_rng_range(&rng, GEOPOLY_MAX_VERTICES - 2);
+        sqlite3_stmt *stmt;
+        if (i % 2 == 0) {
+            stmt = regular;
+            sqlite3_bind_double(stmt, 1, x);
+            sqlite3_bind_double(stmt, 2, y);
+            sqlite3_bind_double(stmt, 3, radius);
+            sqlite3_bind_int(stmt, 4, vertices);
+        } else {
+            stmt = irregular;
+            geopoly_irregular_json(json, sizeof(json), x, y, radius, vertices, &rng);
+            sqlite3_bind_text(stmt, 1, json, -1, SQLITE_STATIC);
+        }
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            fprintf(stderr, "Geopoly insert error: %s\n", sqlite3_errmsg(db));
+        }
+        sqlite3_reset(stmt);
+    }
+    spatial_exec(db, "COMMIT");
+    sqlite3_finalize(regular);
+    sqlite3_finalize(irregular);
+    return SQLITE_OK;
+}
+
+// Times one geopoly predicate at random points. Point queries take the point
+// as ?1/?2, the others take ?1 as a GEOPOLY_WINDOW_SIZE square query polygon
+// anchored at it.
+void geopoly_time_queries(sqlite3 *db, const char *sql, int point, int queries, const char *tag) {
+    sqlite3_stmt *stmt;
+    bench_rng rng;
+    latency_samples samples;
+    long long hits = 0;
+    char window[160];
+
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "Geopoly error: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+    latency_init(&samples);
+    bench_rng_seed(&rng, 3232);
+    timestamp_t start = timestamp_us();
+    for (int q = 0; q < queries; q++) {
+        double x = bench_rng_uniform(&rng) * (SPATIAL_WORLD_SIZE - GEOPOLY_WINDOW_SIZE);
+        double y = bench_rng_uniform(&rng) * (SPATIAL_WORLD_SIZE - GEOPOLY_WINDOW_SIZE);
+        if (!point) {
+            snprintf(window, sizeof(window), "[[%.1f,%.1f],[%.1f,%.1f],[%.1f,%.1f],[%.1f,%.1f],[%.1f,%.1f]]",
+                     x, y, x + GEOPOLY_WINDOW_SIZE, y, x + GEOPOLY_WINDOW_SIZE, y + GEOPOLY_WINDOW_SIZE,
+                     x, y + GEOPOLY_WINDOW_SIZE, x, y);
+        }
+        timestamp_t query_start = timestamp_us();
+        if (point) {
+            sqlite3_bind_double(stmt, 1, x);
+            sqlite3_bind_double(stmt, 2, y);
+        } else {
+            sqlite3_bind_text(stmt, 1, window, -1, SQLITE_STATIC);
+        }
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            hits++;
+        }
+        sqlite3_reset(stmt);
+        latency_add(&samples, timestamp_us() - query_start);
+    }
+    timestamp_t elapsed = timestamp_us() - start;
+    sqlite3_finalize(stmt);
+
+    printf("  %.2f shapes per query\n", queries ? (double)hits / queries : 0.0);
+    latency_report(tag, &samples, elapsed);
+    latency_free(&samples);
+}
+
+// Loads 1/4, 1/2 and all of scale x GEOPOLY_SHAPES_PER_SCALE polygons and
+// times geopoly_overlap, geopoly_within and geopoly_contains_point at each size
+void geopoly_benchmark(sqlite3 *db, const char *driver, const char *table, double scale) {
+    char tag[128];
+    char sql[512];
+    int total = (int)(scale * GEOPOLY_SHAPES_PER_SCALE);
+    if (total < 4) total = 4;
+
+    printf("\n=== Geopoly Benchmark (%s, up to %d polygons, scale %.2f) ===\n", driver, total, scale);
+    for (int step = 4; step >= 1; step /= 2) {
+        int count = total / step;
+
+        timestamp_t start = timestamp_us();
+        if (geopoly_load(db, table, count) != SQLITE_OK) {
+            printf("  geopoly not available in this SQLite build, skipping\n");
+            return;
+        }
+        timestamp_t load_us = timestamp_us() - start;
+        sqlite3_int64 bytes = spatial_table_bytes(db, table);
+
+        printf(" %d polygons: load %.1f ms (%.0f polygons/s), %lld bytes\n", count,
+               load_us / 1000.0, load_us ? count * 1000000.0 / load_us : 0.0, (long long)bytes);
+        snprintf(tag, sizeof(tag), "%s_geopoly_%d", driver, count);
+        print_metric(tag, "load us", (double)load_us);
+        print_metric(tag, "bytes", (double)bytes);
+
+        snprintf(sql, sizeof(sql), "SELECT rowid FROM %s WHERE geopoly_overlap(_shape, ?1);", table);
+        snprintf(tag, sizeof(tag), "%s_geopoly_%d_overlap", driver, count);
+        geopoly_time_queries(db, sql, 0, GEOPOLY_INDEXED_QUERIES, tag);
+
+        snprintf(sql, sizeof(sql), "SELECT rowid FROM %s WHERE geopoly_within(_shape, ?1);", table);
+        snprintf(tag, sizeof(tag), "%s_geopoly_%d_within", driver, count);
+        geopoly_time_queries(db, sql, 0, GEOPOLY_INDEXED_QUERIES, tag);
+
+        snprintf(sql, sizeof(sql),
+                 "SELECT rowid FROM %s WHERE geopoly_contains_point(_shape, ?1, ?2);", table);
+        snprintf(tag, sizeof(tag), "%s_geopoly_%d_contains_point_scan", driver, count);
+        geopoly_time_queries(db, sql, 1, GEOPOLY_SCAN_QUERIES, tag);
+
+        // Same predicate behind an index-usable overlap with a tiny box at the point
+        snprintf(sql, sizeof(sql),
+                 "SELECT rowid FROM %s WHERE geopoly_overlap(_shape, "
+                 "geopoly_regular(?1, ?2, 0.01, 4)) AND geopoly_contains_point(_shape, ?1, ?2);", table);
+        snprintf(tag, sizeof(tag), "%s_geopoly_%d_contains_point_indexed", driver, count);
+        geopoly_time_queries(db, sql, 1, GEOPOLY_INDEXED_QUERIES, tag);
+    }
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef _STMT_MONITOR_H_
+#define _STMT_MONITOR_H_
+
+// Prepared-statement instrumentation from the sqlite_stmt virtual table
+// (SQLITE_ENABLE_STMTVTAB). sqlite_stmt only lists statements that are
+// still prepared, so the driver takes snapshots at phase boundaries before
+// finalizing the phase's statements.
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include "timestamps.h"
+
+static int stmt_monitor_enabled = 0;
+
+void stmt_monitor_enable(void) {
+    stmt_monitor_enabled = 1;
+}
+
+// Prints every live statement and records per-phase totals of nstep,
+// reprep, run and mem as "stmt_<phase>" metrics next to the timestamps
+void stmt_monitor_snapshot(sqlite3 *db, const char *phase) {
+    sqlite3_stmt *stmt;
+    char tag[128];
+    long long statements = 0, nstep = 0, reprep = 0, run = 0, mem = 0;
+
+    if (!stmt_monitor_enabled) {
+        return;
+    }
+    // The snapshot query itself shows up in sqlite_stmt while it runs
+    if (sqlite3_prepare_v2(db,
+                           "SELECT sql, nstep, reprep, run, mem FROM sqlite_stmt "
+                           "WHERE sql NOT LIKE '%FROM sqlite_stmt%';",
+                           -1, &stmt, NULL) != SQLITE_OK) {
+        printf("  sqlite_stmt not available in this SQLite build, statement monitor disabled\n");
+        stmt_monitor_enabled = 0;
+        return;
+    }
+    printf("\n--- Statement monitor: %s ---\n", phase);
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        const char *sql = (const char *)sqlite3_column_text(stmt, 0);
+        long long s_nstep = sqlite3_column_int64(stmt, 1);
+        long long s_reprep = sqlite3_column_int64(stmt, 2);
+        long long s_run = sqlite3_column_int64(stmt, 3);
+        long long s_mem = sqlite3_column_int64(stmt, 4);
+        printf("  nstep %10lld  reprep %3lld  run %7lld  mem %7lld  %.60s\n", s_nstep, s_reprep,
+               s_run, s_mem, sql ? sql : "");
+        statements++;
+        nstep += s_nstep;
+        reprep += s_reprep;
+        run += s_run;
+        mem += s_mem;
+    }
+    sqlite3_finalize(stmt);
+    printf("  %lld live statements, %lld bytes\n", statements, mem);
+
+    snprintf(tag, sizeof(tag), "stmt_%s", phase);
+    print_metric(tag, "statements", (double)statements);
+    print_metric(tag, "nstep", (double)nstep);
+    print_metric(tag, "reprep", (double)reprep);
+    print_metric(tag, "run", (double)run);
+    print_metric(tag, "mem", (double)mem);
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef _STORAGE_REPORT_H_
+#define _STORAGE_REPORT_H_
+
+// End-of-run storage footprint of every table, index and virtual table
+// shadow table, read from the dbstat virtual table.
+
+#include "sqlite3.h"
+#include <stdio.h>
+#include "bench_stats.h"
+
+#define STORAGE_REPORT_DEFAULT_FILE "dbstat_report.csv"
+
+// One row per b-tree. Fragmentation is the percentage of pages that do not
+// directly follow the previous page in b-tree order, as sqlite3_analyzer
+// reports it. Shadow tables are those named after a virtual table plus '_'.
+static const char *const STORAGE_REPORT_SQL =
+    "WITH pages AS ("
+    "  SELECT name, pageno, payload, unused, "
+    "         LAG(pageno) OVER (PARTITION BY name ORDER BY path) AS prev "
+    "  FROM dbstat('main')"
+    ") "
+    "SELECT p.name, "
+    "  CASE WHEN s.type = 'index' THEN 'index' "
+    "       WHEN EXISTS (SELECT 1 FROM sqlite_schema v WHERE v.sql LIKE 'CREATE VIRTUAL TABLE%' "
+    "                    AND p.name LIKE v.name || '\\_%' ESCAPE '\\') THEN 'shadow' "
+    "       WHEN s.type = 'table' THEN 'table' "
+    "       ELSE 'internal' END AS kind, "
+    "  COUNT(*), SUM(payload), SUM(unused), "
+    "  100.0 * SUM(prev IS NOT NULL AND pageno != prev + 1) / COUNT(*) "
+    "FROM pages p LEFT JOIN sqlite_schema s ON s.name = p.name "
+    "GROUP BY p.name ORDER BY COUNT(*) DESC, p.name;";
+
+// Prints the footprint table and appends it to csv_path as
+// arch,scale,name,kind,pages,payload_bytes,unused_bytes,fragmentation_pct
+// (with a header line when the file is new)
+void storage_report(sqlite3 *db, const char *csv_path, double scale) {
+    sqlite3_stmt *stmt;
+    long long total_pages = 0, total_payload = 0, total_unused = 0;
+
+    if (sqlite3_prepare_v2(db, STORAGE_REPORT_SQL, -1, &stmt, NULL) != SQLITE_OK) {
+        fprintf(stderr, "dbstat error: %s\n", sqlite3_errmsg(db));
+        return;
+    }
+    FILE *csv = fopen(csv_path, "a");
+    if (!csv) {
+        fprintf(stderr, "Cannot open %s\n", csv_path);
+        sqlite3_finalize(stmt);
+        return;
+    }
+    // Append mode leaves the position at 0 until the first write on musl and
+    // wasi-libc, so seek to the end before testing for an empty file
+    fseek(csv, 0, SEEK_END);
+    if (ftell(csv) == 0) {
+        fprintf(csv, "arch,scale,name,kind,pages,payload_bytes,unused_bytes,fragmentation_pct\n");
+    }
+
+    printf("\n=== Storage Footprint (dbstat, %s, scale %.2f) ===\n", BENCH_ARCH, scale);
+    printf("  %-36s %-8s %8s %12s %12s %6s\n", "name", "kind", "pages", "payload", "unused", "frag%");
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        const char *name = (const char *)sqlite3_column_text(stmt, 0);
+        const char *kind = (const char *)sqlite3_column_text(stmt, 1);
+        long long pages = sqlite3_column_int64(stmt, 2);
+        long long payload = sqlite3_column_int64(stmt, 3);
+        long long unused = sqlite3_column_int64(stmt, 4);
+        double fragmentation = sqlite3_column_double(stmt, 5);
+
+        printf("  %-36s %-8s %8lld %12lld %12lld %6.1f\n", name, kind, pages, payload, unused,
+               fragmentation);
+        fprintf(csv, "%s,%g,%s,%s,%lld,%lld,%lld,%.2f\n", BENCH_ARCH, scale, name, kind, pages,
+                payload, unused, fragmentation);
+        total_pages += pages;
+        total_payload += payload;
+        total_unused += unused;
+    }
+    printf("  %-36s %-8s %8lld %12lld %12lld\n", "total", "", total_pages, total_payload, total_unused);
+    printf("  appended to %s\n", csv_path);
+    fclose(csv);
+    sqlite3_finalize(stmt);
+}
+
+#endif
@@ -24,6 +24,20 @@ void init_timestamps() {
     }
 }
 
+// closes the output stream; the next timestamp reopens it. Used before a
+// memory snapshot taken at build time, whose streams are gone at run time
+void reset_timestamps() {
+    if (initialised) {
+        if (fd && fd != stdout) {
+            fclose(fd);
+        } else if (fd) {
+            fflush(fd);
+        }
+        fd = NULL;
+        initialised = 0;
+    }
+}
+
 // returns a timestamp in milliseconds since epoch
 timestamp_t timestamp() {
     struct timespec ts;
@@ -37,6 +51,18 @@ timestamp_t timestamp() {
     return millis; 
 }
 
+// returns a monotonic timestamp in microseconds, for timing short operations
+timestamp_t timestamp_us() {
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) < 0) {
+        fprintf(stderr, "Could not retrieve correct timestamp");
+        exit(-1);
+    }
+
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000ULL;
+}
+
 // returns the time since the last time stamp
 timeduration_t time_since(timestamp_t ts1){
     timestamp_t ts2 = timestamp();
@@ -57,4 +83,11 @@ void print_elapsed_time(const char * tag, timeduration_t time){
     fprintf(fd, "%s, elapsed time, %llu\n", tag, time);
 }
 
+void print_metric(const char * tag, const char * metric, double value){
+    if (!initialised) {
+        init_timestamps();
+    }
+    fprintf(fd, "%s, %s, %.3f\n", tag, metric, value);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,93 @@
+#!/bin/bash
+
+# WASM Section and Instantiation Report
+# Compares section sizes, compressed (pull) size and instantiation time of
+# WASM builds, e.g. the full build against make wasm-slim
+
+export LC_NUMERIC=C
+
+RUNS=${RUNS:-5}
+RUNTIME=${RUNTIME:-wasmtime}
+
+# Timestamps must go to stdout to be parsed
+unset WABENCH_FILE
+
+if [ "$#" -lt 1 ]; then
+    echo "Usage: $0 <module.wasm> [module.wasm ...]"
+    echo "Example: $0 massive_sqlite.wasm massive_sqlite_slim.wasm"
+    echo "Environment: RUNS (default 5), RUNTIME (default wasmtime)"
+    exit 1
+fi
+
+echo "=== WASM Section and Instantiation Report ==="
+echo ""
+
+# Section sizes in bytes, one "name size" line per section
+section_sizes() {
+    wasm-objdump -h "$1" 2>/dev/null | awk '/start=.*size=/ {
+        name = $1
+        if (name == "Custom") { name = "Custom:" $NF; gsub(/"/, "", name) }
+        match($0, /size=0x[0-9a-fA-F]+/)
+        print name, substr($0, RSTART + 5, RLENGTH - 5)
+    }' | while read -r name hex; do
+        echo "$name $((hex))"
+    done
+}
+
+echo "1. Sizes:"
+printf "   %-32s %12s %12s\n" "module" "bytes" "gzip bytes"
+for module in "$@"; do
+    if [ ! -f "$module" ]; then
+        printf "   %-32s %12s\n" "$module" "not found"
+        continue
+    fi
+    printf "   %-32s %12d %12d\n" "$module" "$(stat -c %s "$module")" "$(gzip -9 -c "$module" | wc -c)"
+done
+echo ""
+
+echo "2. Sections (bytes):"
+if command -v wasm-objdump >/dev/null 2>&1; then
+    for module in "$@"; do
+        [ -f "$module" ] || continue
+        echo "   $module:"
+        section_sizes "$module" | while read -r name size; do
+            printf "     %-24s %12d\n" "$name" "$size"
+        done
+        data_segments=$(wasm-objdump -x -j Data "$module" 2>/dev/null | grep -c "segment\[")
+        echo "     data segments: $data_segments"
+    done
+else
+    echo "   wasm-objdump not available - install wabt tools for section sizes"
+fi
+echo ""
+
+# Launch to the wasm_init timestamp printed by the module's constructor, and
+# launch to exit; --help prints the usage and exits 0 right after argument
+# parsing
+echo "3. Instantiation ($RUNTIME, mean of $RUNS runs):"
+if command -v "$RUNTIME" >/dev/null 2>&1 && command -v bc >/dev/null 2>&1; then
+    printf "   %-32s %16s %16s\n" "module" "to wasm_init ms" "to exit ms"
+    for module in "$@"; do
+        [ -f "$module" ] || continue
+        # Warm the compilation cache so every run measures instantiation
+        "$RUNTIME" run "$module" --help >/dev/null 2>&1
+        init_total=0
+        exit_total=0
+        for ((i=1; i<=RUNS; i++)); do
+            start_ms=$(date +%s%3N)
+            output=$("$RUNTIME" run "$module" --help 2>/dev/null)
+            end_ms=$(date +%s%3N)
+            init_ms=$(echo "$output" | grep "wasm_init, timestamp," | head -1 | sed 's/.*timestamp, \([0-9]*\).*/\1/')
+            [ -n "$init_ms" ] || init_ms=$end_ms
+            init_total=$((init_total + init_ms - start_ms))
+            exit_total=$((exit_total + end_ms - start_ms))
+        done
+        printf "   %-32s %16.1f %16.1f\n" "$module" \
+            "$(echo "scale=1; $init_total / $RUNS" | bc)" "$(echo "scale=1; $exit_total / $RUNS" | bc)"
+    done
+else
+    echo "   $RUNTIME or bc not available - skipping instantiation timing"
+fi
+echo ""
+
+echo "=== Report Complete ==="
@@ -0,0 +1,78 @@
+#!/bin/bash
+
+# Parallel Read Scaling: native pthreads vs wasm32-wasi-threads
+# Runs --parallel-bench in the native binary and in the wasi-threads module
+# (make native wasm-threads) on the same machine and compares the scaling
+
+export LC_NUMERIC=C
+
+# Default to one thread per CPU, at most PARALLEL_MAX_THREADS (parallel_bench.h)
+MAX_THREADS=64
+THREADS=${1:-$(nproc)}
+if [ -z "$1" ] && [ "$THREADS" -gt "$MAX_THREADS" ]; then
+    THREADS=$MAX_THREADS
+fi
+SCALE=${SCALE:-1}
+NATIVE_BINARY=${NATIVE_BINARY:-./massive_sqlite}
+WASM_THREADS_MODULE=${WASM_THREADS_MODULE:-./massive_sqlite_threads.wasm}
+output_file=${OUTPUT_FILE:-parallel_scaling.csv}
+
+# Metrics must go to stdout to be parsed
+unset WABENCH_FILE
+
+for file in "$NATIVE_BINARY" "$WASM_THREADS_MODULE"; do
+    if [ ! -f "$file" ]; then
+        echo "Error: $file not found (make native wasm-threads)"
+        exit 1
+    fi
+done
+command -v wasmtime >/dev/null 2>&1 || { echo "Error: wasmtime is required but not installed." >&2; exit 1; }
+
+echo "=== Parallel Read Scaling: native vs wasi-threads ==="
+echo "Architecture: $(uname -m), $(nproc) CPUs"
+echo "Threads: up to $THREADS, scale $SCALE"
+echo "wasmtime: $(wasmtime --version)"
+echo ""
+
+echo "1. Native ($NATIVE_BINARY)..."
+native_output=$("$NATIVE_BINARY" --scale="$SCALE" --parallel-bench="$THREADS" 2>&1)
+echo "$native_output" | grep "threads: .*passes/s"
+echo ""
+
+# -W threads enables shared memory and atomics, -S threads the wasi-threads
+# thread-spawn import
+echo "2. WebAssembly ($WASM_THREADS_MODULE, wasmtime)..."
+wasm_output=$(wasmtime run -W threads=y -S threads=y --dir . "$WASM_THREADS_MODULE" \
+    --scale="$SCALE" --parallel-bench="$THREADS" 2>&1)
+echo "$wasm_output" | grep "threads: .*passes/s"
+echo ""
+
+# Prints "threads passes_per_s speedup" per thread count from the metrics
+parallel_metrics() {
+    awk -F', ' '$1 ~ /^c_parallel_t[0-9]+$/ {
+        threads = substr($1, 13)
+        if ($2 == "ops per s") rate[threads] = $3
+        if ($2 == "speedup") speedup[threads] = $3
+    }
+    END { for (t in rate) print t, rate[t], speedup[t] }' | sort
+}
+
+echo "3. Comparison:"
+echo "Architecture,Threads,Native Passes per s,Native Speedup,WASM Passes per s,WASM Speedup,WASM to Native Throughput" > "$output_file"
+printf "   %8s %14s %10s %14s %10s %12s\n" "threads" "native pass/s" "speedup" "wasm pass/s" "speedup" "wasm/native"
+join <(echo "$native_output" | parallel_metrics) <(echo "$wasm_output" | parallel_metrics) | sort -n |
+while read -r threads native_rate native_speedup wasm_rate wasm_speedup; do
+    ratio=$(awk -v w="$wasm_rate" -v n="$native_rate" 'BEGIN { printf "%.3f", (n > 0 ? w / n : 0) }')
+    printf "   %8d %14.1f %9.2fx %14.1f %9.2fx %11.2fx\n" "$threads" "$native_rate" "$native_speedup" \
+        "$wasm_rate" "$wasm_speedup" "$ratio"
+    echo "$(uname -m),$threads,$native_rate,$native_speedup,$wasm_rate,$wasm_speedup,$ratio" >> "$output_file"
+done
+echo ""
+
+if ! echo "$wasm_output" | grep -q "^c_parallel_t"; then
+    echo "No parallel results from the WASM module; its output was:"
+    echo "$wasm_output" | tail -20
+    echo ""
+fi
+
+echo "Results saved to: $output_file"